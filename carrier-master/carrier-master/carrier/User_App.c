@@ -55,8 +55,21 @@
 #include "accessories_support.h"
 #include "cvc_power_sequencing.h"
 #include "timer_service.h"
+#include "time_service.h"
+#include "debounce_bank.h"
 #include "cl712_device_control.h"
 #include "hydraulic_inverter_control.h"
+#include "flight_recorder.h"
+#include "fault_manager.h"
+#include "j1939_dm1.h"
+#include "emergency_stop.h"
+#include "energy_estimator.h"
+#include "charge_profile.h"
+#include "bel_charger_coordinator.h"
+#include "pack_divergence.h"
+#include "orion_cell_dump.h"
+#include "discharge_limit_predictor.h"
+#include "throttle_pipeline.h"
 
 
 /*
@@ -160,20 +173,53 @@ void User_App(void)
 {
 
     static uint32_t loop_cnt = 0;
-    static uint32_t first_pass = TRUE;
-    static timer_t startup_timer;
 
+    //
+    // A two second timer.
+    //
+    static timer_t startup_timer = TIMER_INIT_MS(2000, RISING);
 
-    if(first_pass)
-    {
+    //=============================================================================
+    //
+    // Sample the millisecond clock once for this loop. Every timer,
+    // CAN receive timeout and CAN transmit rate below is accounted in
+    // the time elapsed since the previous loop.
+    //
+    //=============================================================================
+    //
+    time_service_update();
+
+    //=============================================================================
+    //
+    // Read every CVC input once. All the control functions below read
+    // the inputs from this snapshot, so they all see the same value of
+    // an input in this loop.
+    //
+    //=============================================================================
+    //
+    cvc_input_snapshot_update();
 
-        //
-        // Initialise a three second timer.
-        //
-        startup_timer = timer_setup(get_TWO_SECONDS(), RISING);
-        first_pass = FALSE;
+    //=============================================================================
+    //
+    // Fast path for the E-stops and the master switch. Open the
+    // contactors and disable the inverters now, rather than after
+    // the state machine has run. The rest of the loop still runs so
+    // the state machine moves to E_STOP or SHUTDOWN.
+    //
+    //=============================================================================
+    //
+    emergency_stop_update();
 
-    }
+    //=============================================================================
+    //
+    // Debounce every fault and input latched with
+    // debounce_bank_set_input() during the previous loop, in one
+    // pass. The debounced outputs are read back by the control
+    // functions below.
+    //
+    //=============================================================================
+    //
+    debounce_bank_update();
 
     //=============================================================================
     //
@@ -188,6 +234,20 @@ void User_App(void)
     low_power_mode =
        cvc_power_sequencing_low_power_control();
 
+    //=============================================================================
+    //
+    // The device drivers only check their pointers in a debug
+    // build. If any device record or CAN registration failed
+    // validation at the end of User_Init(), do not run any of the
+    // vehicle control below. The contactor outputs stay off.
+    //
+    //=============================================================================
+    //
+    if (fvt_can_get_device_registrations_valid() == FALSE)
+    {
+        return;
+    }
+
     //=============================================================================
     //
     // Start up timer: If the vehicle is not in low power mode. enable
@@ -197,7 +257,7 @@ void User_App(void)
     //=============================================================================
     //
     bool_t startup_timer_state =  timer_operate(&startup_timer,
-                                         !low_power_mode);
+                                                !low_power_mode);
 
     //=============================================================================
     //
@@ -260,6 +320,23 @@ void User_App(void)
     //
     gears_and_transmission_control();
 
+    //=============================================================================
+    //
+    // The traction battery current limit, ramped ahead of a drop in
+    // the BMS discharge current limit.
+    //
+    //=============================================================================
+    //
+    discharge_limit_predictor_update();
+
+    //=============================================================================
+    //
+    // The throttle demand, from the reading of the throttle pedal.
+    //
+    //=============================================================================
+    //
+    throttle_pipeline_update();
+
     //=============================================================================
     //
     // The function gathers data from the state machine, orion BMS and
@@ -301,6 +378,17 @@ void User_App(void)
     //
     bool_t status = shinry_dc_dc_control();
 
+    //=============================================================================
+    //
+    // Work out the total charge current through the CC-CV charge
+    // profile, then split it across the bel chargers by what each one
+    // can deliver.
+    //
+    //=============================================================================
+    //
+    charge_profile_update();
+    bel_charger_coordinator_update();
+
     //=============================================================================
     //
     // A function that enables/disables the bel charger based on
@@ -311,6 +399,24 @@ void User_App(void)
     bel_charger_control(ONE);
     bel_charger_control(TWO);
 
+    //=============================================================================
+    //
+    // Track how far each battery pack is from the others, so a pack
+    // trending apart is flagged before it faults.
+    //
+    //=============================================================================
+    //
+    pack_divergence_update();
+
+    //=============================================================================
+    //
+    // Fault manager: detect and debounce every fault, before the
+    // state machine inputs are populated from them.
+    //
+    //=============================================================================
+    //
+    fault_manager_update();
+
     //=============================================================================
     //
     // populate state machine
@@ -349,6 +455,15 @@ void User_App(void)
     //
     accessories_support();
 
+    //=============================================================================
+    //
+    // Integrate the charge and energy of the battery packs and learn
+    // the consumption rates for the range estimate.
+    //
+    //=============================================================================
+    //
+    energy_estimator_update();
+
     //=============================================================================
     //
     // Transmit CAN messages to the screen
@@ -400,6 +515,37 @@ void User_App(void)
                                       get_rear_accum_pressure(),
                                       get_drive_line_brake_pressure());
 
+    send_debug_can_messages_32bits(0xF00A,
+                                   debounce_bank_get_inputs(),
+                                   debounce_bank_get_outputs());
+
+    //=============================================================================
+    //
+    // J1939 DM1: the active faults and receive timeouts, every
+    // second and on change.
+    //
+    //=============================================================================
+    //
+    j1939_dm1_update();
+
+    //=============================================================================
+    //
+    // Send the next record of a flight recorder dump, if one was
+    // requested.
+    //
+    //=============================================================================
+    //
+    flight_recorder_update();
+
+    //=============================================================================
+    //
+    // Send the next cells of a BMS cell table dump, if one was
+    // requested.
+    //
+    //=============================================================================
+    //
+    orion_cell_dump_update();
+
     send_debug_can_messages_16bits(0xF009,
                                   shinry_get_instantaneous_input_voltage(ONE),
                                   shinry_get_instantaneous_output_voltage(ONE),
@@ -4,6 +4,9 @@
 #include "User_App.h"
 #include "User_Can_Receive.h"
 #include "can_service.h"
+#include "state_machine.h"
+#include "flight_recorder.h"
+#include "orion_cell_dump.h"
 
 
 /******************************************************************************
@@ -38,6 +41,26 @@
 void User_Can_Receive(Can_Message_ canmessage, uint8_t module_id, CANLINE_ can_line)
 {
 
+    //
+    // A request for a dump of the state machine flight recorder.
+    //
+    if ((can_line == CAN3) &&
+        (canmessage.identifier == FLIGHT_RECORDER_DUMP_REQUEST_ID))
+    {
+        flight_recorder_request_dump();
+        return;
+    }
+
+    //
+    // A request for a dump of the cell tables of the BMSs.
+    //
+    if ((can_line == CAN3) &&
+        (canmessage.identifier == ORION_CELL_DUMP_REQUEST_ID))
+    {
+        orion_cell_dump_request(canmessage.data[0]);
+        return;
+    }
+
     //
     // Process the received CAN message. See comment above.
     //
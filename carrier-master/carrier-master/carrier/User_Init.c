@@ -41,6 +41,9 @@
 #include "sevcon_hvlp10_device.h"
 #include "skai2_inverter_vissim.h"
 #include "cl712_device.h"
+#include "state_machine.h"
+#include "flight_recorder.h"
+#include "energy_estimator.h"
 
 /******************************************************************************
  *
@@ -155,4 +158,33 @@ void User_Init(void)
     //
     cl712_init(ONE, 0, CAN1);
 
+    //=============================================================================
+    //
+    // Restore the state machine flight recorder saved at the last
+    // shutdown.
+    //
+    //=============================================================================
+    //
+    flight_recorder_init();
+
+    //=============================================================================
+    //
+    // Restore the consumption rates learned by the range estimator
+    // before the last shutdown.
+    //
+    //=============================================================================
+    //
+    energy_estimator_init();
+
+    //=============================================================================
+    //
+    // Validate every device record and CAN registration created
+    // above. This must stay the last call in User_Init(). A device
+    // instance that failed is left unresolved, and its getters return
+    // their defaults (see NULL_CHECK_RETURN in can_service.h).
+    //
+    //=============================================================================
+    //
+    fvt_can_validate_device_registrations();
+
 }
@@ -23,45 +23,24 @@
 #include "can_service.h"
 #include "orion_control.h"
 #include "timer_service.h"
+#include "debounce_bank.h"
 #include "fvt_library.h"
 #include "bel_charger_device.h"
 #include "bel_charger_control.h"
+#include "charge_profile.h"
+#include "bel_charger_coordinator.h"
 #include "can_switches.h"
 #include "state_machine.h"
 #include "cvc_debug_msgs.h"
+#include "cvc_input_control.h"
 
-#define EEVAR_max_allowable_charging_cell_voltage 40400
 #define EEVAR_battery_over_voltage_limit 840 * 20
 #define EEVAR_battery_under_voltage_limit 450 * 20
 
 #define ZENER_VOLTAGE_LIMIT_MV 4000
-
-//=============================================================================
-//
-// Static Timers
-//
-//=============================================================================
-//
-static timer_t top_of_pack_timer;
-static timer_t delay_begin_charging;
-static timer_t delay_open_ac_contactor;
-static timer_t charge_enable_timer;
+#define PLUGGED_IN_DELAY_MS 3000
 
 static bool_t charging_desired = FALSE;
-static bool_t charge_button_state = FALSE;
-
-
-static bool_t get_charge_button_state();
-
-//=============================================================================
-//
-// Static Function Prototypes
-//
-//=============================================================================
-//
-static float get_charge_current_factor(
-    uint16_t max_cell_voltage,
-    bool_t charging_desired);
 
 
 /******************************************************************************
@@ -80,56 +59,15 @@ void bel_charger_control(
     device_instances_t device)
 {
 
-    static bool_t first_pass = TRUE;
-
     bool_t wake_up_ecu_enable = FALSE;
     bool_t gpo_enable = FALSE;
 
-
-    if(first_pass == TRUE)
-    {
-
-        //
-        // Initialisation of timers necessary for the operation of the bel
-        // chargers.
-        //
-
-        // top_of_pack_timer = timer_setup(45 * get_ONE_MINUTE(), RISING);
-
-        top_of_pack_timer = timer_setup(get_TEN_SECONDS(), RISING);
-
-        delay_begin_charging = timer_setup(get_FIVE_HUNDRED_MSECS(), RISING);
-
-        delay_open_ac_contactor = timer_setup(get_ONE_SECOND(), FALLING);
-
-        charge_enable_timer = timer_setup(get_ONE_SECOND(), RISING);
-
     //
-    // set first pass to false.
+    // Each charger has its own set of debounce channels.
     //
-    first_pass = FALSE;
-
-    }
-
-    //
-    // A boolean that determines if the cell voltage is below the
-    // maximum or not.
-    //
-    static bool_t cell_voltage_ok = FALSE;
-
-    //
-    // A boolean that determines if the cell voltage is below the
-    // maximum at the time the vehicle is powered up
-    //
-    static bool_t cell_voltage_ok_on_startup = TRUE;
-
-    //
-    // A value that is calculated dynamically based on the highcell
-    // voltage / battery pack voltage. This is done, to reduce the
-    // current flowing into the battery pack as the cells charge up to
-    // their max value.
-    //
-    float charge_current_factor = 0;
+    debounce_channel_t begin_charging_channel =
+        (device == ONE) ? DEBOUNCE_CHARGER_1_BEGIN_CHARGING
+                        : DEBOUNCE_CHARGER_2_BEGIN_CHARGING;
 
     //
     // A bool to determine if charging is ready to begin.
@@ -141,17 +79,6 @@ void bel_charger_control(
     //
     bool_t enable_charger;
 
-    //
-    // Timer temp variables are used to force timers to run (sometimes
-    // won't run if they're in AND statements)
-    //
-    bool_t timer_temp;
-
-    //
-    // max_cell_voltage from the BMS
-    //
-    uint16_t pack_high_cell_voltage =  get_pack_high_cell_voltage();
-
     bool_t high_voltage_enabled = get_sm_status_enable_hv_systems();
     bool_t charging_mode = (get_sm_current_state() == CHARGING) && high_voltage_enabled;
 
@@ -160,65 +87,32 @@ void bel_charger_control(
     //
     charging_desired = (high_voltage_enabled && charging_mode);
 
-    //
-	// This flip flop can never be set. cellVoltageOKonStartup is
-	// initially TRUE. Once the maxCellVoltage is above the
-	// maxChargingCellVoltage for the first time, it flops to FALSE
-	// and will remain FALSE until the program is restarted
-    //
-	cell_voltage_ok_on_startup =
-        reset_set(cell_voltage_ok_on_startup,
-                  FALSE,
-                  pack_high_cell_voltage >= EEVAR_max_allowable_charging_cell_voltage);
-
-    //
-    // If the cell voltage is more than 0.01 V below the maximum, it
-	// is OK to charge.  Hysteresis prevents rapid on-off if the
-	// voltage is just on the cusp.
-    //
-    cell_voltage_ok =
-        (EEVAR_max_allowable_charging_cell_voltage >= pack_high_cell_voltage);
-
-    //
-	// If the cell voltage is OK, wait 45 minutes before enabling.
-    //
-    timer_temp = timer_operate(&top_of_pack_timer,
-                               cell_voltage_ok);
-
     //
 	// ready_to_charge is what enables the charger and AC Contactor.
+    // The charge profile engine ends the charge at the top of the
+    // pack, and restarts it once the high cell has dropped back.
     //
-	ready_to_charge = (cell_voltage_ok
-                        && charging_desired
-                        && (timer_temp || cell_voltage_ok_on_startup));
+	ready_to_charge = (charging_desired
+                        && charge_profile_get_charger_enabled());
 
 
     //
     // Once we're ready to charge, wait 500ms before enabling
-    // charger for AC contactor to close.
-    //
-	enable_charger = timer_operate(&delay_begin_charging,
-                                   ready_to_charge);
-
-    //
-    // AC Contactor closes right away when charger is enabled, and is
-    // opened 1 second after the charger is not enabled.
+    // charger for AC contactor to close. The bank is updated at the
+    // top of the loop, so its output is a loop behind. ready_to_charge
+    // is ANDed in so that the charge profile going IDLE or COMPLETE
+    // disables the charger in the same loop.
     //
-    timer_temp = timer_operate(&delay_open_ac_contactor,
-                               enable_charger);
+    debounce_bank_set_input(begin_charging_channel, ready_to_charge);
+	enable_charger = ready_to_charge
+                     && debounce_bank_get_output(begin_charging_channel);
 
     //
-    // Calculate the charge current factor
-    //
-    charge_current_factor = get_charge_current_factor(
-        pack_high_cell_voltage,
-        charging_desired);
-
-    //
-    // Calculate the current command of the charger
+    // The share of the charge current for this charger, in 0.05A,
+    // from bel_charger_coordinator_update().
     //
     uint16_t current_command =
-        (uint16_t)((EEVAR_CHARGER_total_current_command * charge_current_factor) / EEVAR_CHARGER_no_of_chargers);
+        bel_charger_coordinator_get_current_command(device);
 
     //
     // Will be used only if the IO on the bel charge control
@@ -253,9 +147,9 @@ void bel_charger_control(
     //
     bel_set_setpoint(
         device,
-        (current_command * 20),
+        current_command,
          battery_voltage_limit,
-         charging_desired);
+         enable_charger);
 
     //
     // Set the CAN message responsible for the IO control on the bel
@@ -306,103 +200,6 @@ void bel_charger_control(
 }
 
 
-/******************************************************************************
- *
- *        Name: get_charge_current_factor()
- *
- * Description: Calculte the charge current factor if the voltage
- *              difference between the max_cell_voltage from the bms
- *              and the EEPROM_max_allowable_charging_cell_voltage is
- *              less than 0.5V.  The formula would decrease the output
- *              of current to zero as the max cell voltage reaches the
- *              EEVAR_max_allowable_charging_cell_voltage eeprom set
- *              limit.
- *
- *
- *        Date: Friday, 06 September 2019
- *
- ******************************************************************************
- */
-static float get_charge_current_factor(
-    uint16_t max_cell_voltage,
-    bool_t charging_desired)
-{
-
-    //
-    // set the slowdown voltage within 0.1V of the set maximum cell
-    // voltage.
-    //
-    static uint16_t SLOW_CHARGING_VOLTAGE_PROX_UV_VAR  = 500;
-
-	float charge_current_factor	= 0;
-
-    //
-	// calculate the current scaling factor. the intention is that the
-	// current command sent to the charger gets multiplied by this
-	// value, so to reduce the current entering the pack as it
-	// approaches the top.  it is calculated using an exponential
-	// decay function, only once the max cell voltage is within a
-	// predetermined threshold
-    //
-    if (!charging_desired)
-	{
-
-        //
-        // If charging is disabled, set charge_current_factor to
-        // zero. Basically setting the current to zero.
-        //
-		charge_current_factor	= 0;
-
-    }
-	else if ((EEVAR_max_allowable_charging_cell_voltage - max_cell_voltage)
-			 <= SLOW_CHARGING_VOLTAGE_PROX_UV_VAR)
-	{
-
-        //
-        // calculte the charge current factor if the voltage
-        // difference between the max_cell_voltage from the bms and
-        // the EEPROM_max_allowable_charging_cell_voltage is less than
-        // 0.5V.  The formula would decrease the output of current to
-        // zero as the max cell voltage reaches the
-        // EEVAR_max_allowable_charging_cell_voltage eeprom set limit.
-        //
-		charge_current_factor	= (float)(pow(0.1,pow((max_cell_voltage
-                                                       - (EEVAR_max_allowable_charging_cell_voltage - SLOW_CHARGING_VOLTAGE_PROX_UV_VAR))
-                                                      * (-1.0 / SLOW_CHARGING_VOLTAGE_PROX_UV_VAR), 2)));
-        //
-		// protect against overshoot
-        //
-		if (charge_current_factor > 1)
-		{
-
-            //
-            // force charge factor value to one if the calculation
-            // results to a value greater than 1.
-            //
-			charge_current_factor	= 1;
-
-        }
-
-	}
-	else
-	{
-
-        //
-        // the difference between max_cell_voltage and
-        // EEVAR_max_allowable_charging_cell_voltage is not under
-        // 0.5V.  Set limit to 1. This indicates max current (set in
-        // the EEPROM) is delivered to the battery pack.
-        //
-		charge_current_factor	= 1;
-
-	}
-
-    //
-    // return the charger current factor
-    //
-	return charge_current_factor;
-}
-
 //=============================================================================
 //
 // charger_enabled_state()
@@ -438,26 +235,8 @@ bool_t detect_charge_handle()
     // Controls the debounce for detecting if the charge handle is
     // plugged in.
     //
-    static timer_t plugged_in_timer;
-    static bool_t first_run = TRUE;
-
-    //
-    // Processes to be done during first run.
-    //
-    if(first_run)
-    {
-
-        //
-        // Initialse Timers used by the state machine
-        //
-        plugged_in_timer = timer_setup(get_THREE_SECONDS(), RISING);
-
-        //
-        // set first run to false
-        //
-        first_run = FALSE;
-
-    }
+    static timer_t plugged_in_timer =
+        TIMER_INIT_MS(PLUGGED_IN_DELAY_MS, RISING);
 
     //
     // Check to see of the charge_button if pressed
@@ -490,8 +269,9 @@ bool_t detect_charge_handle()
     // Measure to check if the zener voltage is present. Look for
     // a voltage greater than 4V.
     //
-    bool_t charge_plugged_in_timer = timer_operate(&plugged_in_timer,
-                                           IN_E01_cvc_zener_input > 4000);
+    bool_t charge_plugged_in_timer = timer_operate(
+        &plugged_in_timer,
+        cvc_input_get_analog(CVC_AIN_E01_ZENER_INPUT) > ZENER_VOLTAGE_LIMIT_MV);
 
     //
     // Set variable to TRUE only if both the charge_button variable is
@@ -518,16 +298,12 @@ bool_t detect_charge_handle()
  */
 bool_t get_charger_button_enabled_state()
 {
-    bool_t ret_val = FALSE;
-    uint16_t screen_ma = 0;
-    uint16_t telematics_ma = 0;
-    static bool_t first_pass = TRUE;
-    static timer_t shutdown_timer;
     static charge_state_t charge_enable_state = ALMOST_ON;
     Input_State_t charge_input_switch;
     bool_t state;
 
-    charge_input_switch = IN_A15_stop_charging_button_signal;
+    charge_input_switch =
+        cvc_input_get_digital(CVC_DIN_A15_STOP_CHARGING_BUTTON);
 
     switch (charge_enable_state)
     {
@@ -0,0 +1,396 @@
+/******************************************************************************
+ *
+ *        Name: bel_charger_coordinator.c
+ *
+ * Description: Splits the charge current across the Bel chargers.
+ *              See bel_charger_coordinator.h.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "reserved.h"
+#include "Prototypes.h"
+#include "Constants.h"
+#include "typedefs.h"
+#include "can_service.h"
+#include "time_service.h"
+#include "orion_control.h"
+#include "bel_charger_device.h"
+#include "state_machine.h"
+#include "charge_profile.h"
+#include "bel_charger_coordinator.h"
+
+//
+// Rated output current of one charger, in A.
+//
+#define CHARGER_RATED_CURRENT_A                 40
+
+//
+// The chassis temperature at which a charger starts to be derated,
+// and at which it is derated to nothing, in degC. Close to the over
+// temperature shutdown of the charger: a charger that derates itself
+// sooner is caught by the shortfall check below.
+//
+#define CHARGER_DERATE_START_C                  85
+#define CHARGER_DERATE_STOP_C                   100
+
+//
+// The output current the AC input can supply is
+// sqrt(3) x line voltage x line current x efficiency / output
+// voltage. sqrt(3) x 0.93 efficiency, x 1000.
+//
+#define CHARGER_SQRT3_EFFICIENCY_X1000          1611
+
+//
+// Line voltages above this are not valid readings, and are not used.
+//
+#define CHARGER_MAX_LINE_VOLTAGE_V              1000
+
+//
+// SAE J1772: pilot duty cycles of 10% to 85% advertise 0.6A of line
+// current per percent.
+//
+#define J1772_MIN_DUTY_CYCLE_PERCENT            10
+#define J1772_MAX_DUTY_CYCLE_PERCENT            85
+#define J1772_LINE_CURRENT_A10_PER_PERCENT      6
+
+//
+// A charger delivering more than BEL_COORDINATOR_SHORTFALL_A20 below
+// its command for BEL_COORDINATOR_SHORTFALL_MS has derated. Its limit
+// is raised again by BEL_COORDINATOR_RECOVERY_A20 every second it
+// keeps up. The time is long enough for the charger to ramp up at
+// the start of charging.
+//
+#define BEL_COORDINATOR_SHORTFALL_A20           40
+#define BEL_COORDINATOR_SHORTFALL_MS            10000
+#define BEL_COORDINATOR_RECOVERY_A20            20
+#define BEL_COORDINATOR_RECOVERY_MS             1000
+
+#define BEL_COORDINATOR_NO_OBSERVED_LIMIT       0xFFFF
+
+//=============================================================================
+//
+// Static Variables
+//
+//=============================================================================
+//
+static const device_instances_t charger_devices[BEL_COORDINATOR_MAX_CHARGERS] =
+{
+    ONE,
+    TWO
+};
+
+typedef struct
+{
+    uint16_t limit;
+    uint16_t command;
+
+    //
+    // The limit learned from a charger that has derated on its own,
+    // BEL_COORDINATOR_NO_OBSERVED_LIMIT when it keeps up.
+    //
+    uint16_t observed_limit;
+
+    //
+    // When the charger last started to fall short, or to keep up.
+    //
+    bool_t   falling_short;
+    uint32_t since_ms;
+} charger_share_t;
+
+static charger_share_t chargers[BEL_COORDINATOR_MAX_CHARGERS];
+
+static void track_charger_output(charger_share_t *charger,
+                                 device_instances_t device);
+static uint16_t get_charger_limit(const charger_share_t *charger,
+                                  device_instances_t device);
+
+
+/******************************************************************************
+ *
+ *        Name: bel_charger_coordinator_update()
+ *
+ * Description: Works out the limit of each installed charger, the
+ *              total charge current, and the share of each charger.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+void bel_charger_coordinator_update()
+{
+    uint8_t installed = (uint8_t)EEVAR_CHARGER_no_of_chargers;
+    uint32_t sum_of_limits = 0;
+    uint32_t total;
+    uint8_t i;
+
+    const battery_pack_aggregate_t *aggregate = get_battery_pack_aggregate();
+
+    bool_t charging_desired =
+        get_sm_status_enable_hv_systems() &&
+        (get_sm_current_state() == CHARGING);
+
+    if (installed > BEL_COORDINATOR_MAX_CHARGERS)
+    {
+        installed = BEL_COORDINATOR_MAX_CHARGERS;
+    }
+
+    for (i = 0; i < BEL_COORDINATOR_MAX_CHARGERS; i++)
+    {
+        charger_share_t *charger = &chargers[i];
+
+        if (!charging_desired || (i >= installed))
+        {
+            charger->limit = 0;
+            charger->command = 0;
+            charger->observed_limit = BEL_COORDINATOR_NO_OBSERVED_LIMIT;
+            charger->falling_short = FALSE;
+            charger->since_ms = time_service_get_ms();
+            continue;
+        }
+
+        track_charger_output(charger, charger_devices[i]);
+
+        charger->limit = get_charger_limit(charger, charger_devices[i]);
+        sum_of_limits += charger->limit;
+    }
+
+    //
+    // The packs are in parallel, so they can take the lowest CCL once
+    // per pack. CCL is in A.
+    //
+    total = (uint32_t)aggregate->signal[PACK_SIGNAL_CHARGE_CURRENT_LIMIT].min
+            * get_number_of_bms() * 20;
+
+    if (total > charge_profile_get_current_command())
+    {
+        total = charge_profile_get_current_command();
+    }
+
+    if (total > sum_of_limits)
+    {
+        total = sum_of_limits;
+    }
+
+    //
+    // Share the total in proportion to the limits. Every charger runs
+    // at the same fraction of its limit, and no charger is commanded
+    // above its limit, as the total is no more than the sum.
+    //
+    for (i = 0; i < installed; i++)
+    {
+        if (charging_desired && (sum_of_limits > 0))
+        {
+            chargers[i].command =
+                (uint16_t)((total * chargers[i].limit) / sum_of_limits);
+        }
+    }
+}
+
+
+//=============================================================================
+//
+// track_charger_output()
+//
+// Compares the output current of a charger with the command it was
+// sent, and learns the limit of a charger that has derated on its
+// own.
+//
+//=============================================================================
+//
+static void track_charger_output(
+    charger_share_t *charger,
+    device_instances_t device)
+{
+    uint16_t output = bel_get_output_current_a_20(device);
+
+    bool_t falling_short =
+        ((uint32_t)charger->command > ((uint32_t)output + BEL_COORDINATOR_SHORTFALL_A20));
+
+    if (falling_short != charger->falling_short)
+    {
+        charger->falling_short = falling_short;
+        charger->since_ms = time_service_get_ms();
+        return;
+    }
+
+    if (falling_short)
+    {
+        //
+        // Limit the charger to what it delivers. The others take up
+        // the difference.
+        //
+        if (time_service_ms_since(charger->since_ms) >= BEL_COORDINATOR_SHORTFALL_MS)
+        {
+            charger->observed_limit = output + BEL_COORDINATOR_SHORTFALL_A20;
+        }
+
+        return;
+    }
+
+    //
+    // Keeping up: raise the learned limit a step every second, until it
+    // is at or above the other limits and so no longer used.
+    //
+    if ((charger->observed_limit != BEL_COORDINATOR_NO_OBSERVED_LIMIT) &&
+        (time_service_ms_since(charger->since_ms) >= BEL_COORDINATOR_RECOVERY_MS))
+    {
+        charger->since_ms = time_service_get_ms();
+
+        if (charger->observed_limit >= ((uint32_t)CHARGER_RATED_CURRENT_A * 20))
+        {
+            charger->observed_limit = BEL_COORDINATOR_NO_OBSERVED_LIMIT;
+        }
+        else
+        {
+            charger->observed_limit += BEL_COORDINATOR_RECOVERY_A20;
+        }
+    }
+}
+
+
+//=============================================================================
+//
+// get_charger_limit()
+//
+// The current a charger can deliver, in 0.05A.
+//
+//=============================================================================
+//
+static uint16_t get_charger_limit(
+    const charger_share_t *charger,
+    device_instances_t device)
+{
+    uint32_t limit = (uint32_t)CHARGER_RATED_CURRENT_A * 20;
+
+    if (!bel_get_input_voltage_ok(device) ||
+        bel_get_unit_overtemperature(device) ||
+        bel_get_converter_latched_off_due_to_fault(device))
+    {
+        return 0;
+    }
+
+    //
+    // The maximum current the charger reports, in A. Zero before the
+    // charger has reported it.
+    //
+    uint32_t reported = (uint32_t)bel_get_max_charging_current_ava(device) * 20;
+
+    if ((reported > 0) && (reported < limit))
+    {
+        limit = reported;
+    }
+
+    //
+    // The current the AC input can supply, when the charge station
+    // advertises its line current on the pilot.
+    //
+    uint8_t duty_cycle = bel_get_pilot_duty_cycle_percent(device);
+
+    if ((duty_cycle >= J1772_MIN_DUTY_CYCLE_PERCENT) &&
+        (duty_cycle <= J1772_MAX_DUTY_CYCLE_PERCENT))
+    {
+        uint32_t line_voltage =
+            ((uint32_t)bel_get_input_voltage_rms_phase_1_2_v(device) +
+             bel_get_input_voltage_rms_phase_2_3_v(device) +
+             bel_get_input_voltage_rms_phase_3_1_v(device)) / 3;
+
+        //
+        // Output voltage in 0.05V, or the pack voltage in 0.1V before
+        // the charger has started.
+        //
+        uint32_t output_voltage_v20 = bel_get_output_voltage_v_20(device);
+
+        if (output_voltage_v20 == 0)
+        {
+            output_voltage_v20 = (uint32_t)get_battery_pack_voltage() * 2;
+        }
+
+        if ((line_voltage <= CHARGER_MAX_LINE_VOLTAGE_V) &&
+            (output_voltage_v20 > 0))
+        {
+            uint32_t line_current_a10 =
+                (uint32_t)duty_cycle * J1772_LINE_CURRENT_A10_PER_PERCENT;
+
+            //
+            // V x 0.1A x 1611 is at most 1000 x 510 x 1611. The 0.1A
+            // line current, the 0.05V output voltage and the x 1000
+            // leave the result in 0.05A x 25.
+            //
+            uint32_t input_limit =
+                ((line_voltage * line_current_a10 * CHARGER_SQRT3_EFFICIENCY_X1000) /
+                 output_voltage_v20) / 25;
+
+            if (input_limit < limit)
+            {
+                limit = input_limit;
+            }
+        }
+    }
+
+    //
+    // Linear temperature derate.
+    //
+    int8_t temperature = bel_get_chassis_temperature_c(device);
+
+    if (temperature >= CHARGER_DERATE_STOP_C)
+    {
+        return 0;
+    }
+
+    if (temperature > CHARGER_DERATE_START_C)
+    {
+        limit = (limit * (uint32_t)(CHARGER_DERATE_STOP_C - temperature)) /
+                (CHARGER_DERATE_STOP_C - CHARGER_DERATE_START_C);
+    }
+
+    if (charger->observed_limit < limit)
+    {
+        limit = charger->observed_limit;
+    }
+
+    return (uint16_t)limit;
+}
+
+
+//=============================================================================
+//
+// Getters
+//
+//=============================================================================
+//
+uint16_t bel_charger_coordinator_get_current_command(device_instances_t device)
+{
+    uint8_t i;
+
+    for (i = 0; i < BEL_COORDINATOR_MAX_CHARGERS; i++)
+    {
+        if (charger_devices[i] == device)
+        {
+            return chargers[i].command;
+        }
+    }
+
+    return 0;
+}
+
+uint16_t bel_charger_coordinator_get_limit(device_instances_t device)
+{
+    uint8_t i;
+
+    for (i = 0; i < BEL_COORDINATOR_MAX_CHARGERS; i++)
+    {
+        if (charger_devices[i] == device)
+        {
+            return chargers[i].limit;
+        }
+    }
+
+    return 0;
+}
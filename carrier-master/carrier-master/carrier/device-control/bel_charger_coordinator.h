@@ -0,0 +1,71 @@
+/******************************************************************************
+ *
+ *        Name: bel_charger_coordinator.h
+ *
+ * Description: Splits the charge current the battery packs can take
+ *              across the Bel chargers, so the total charge power is
+ *              as high as the packs and the chargers allow.
+ *
+ *              The total is the lowest of:
+ *
+ *              1) The charge current limit of the packs: the lowest
+ *                 Orion CCL times the number of packs in parallel.
+ *              2) The command of the charge profile engine
+ *                 (charge_profile.h).
+ *              3) The sum of the limits of the chargers.
+ *
+ *              The limit of each charger is the lowest of its rated
+ *              current, the maximum current it reports, the current
+ *              its AC input can supply (from the pilot duty cycle and
+ *              the line voltage), and a linear temperature derate.
+ *              If a charger delivers less than it is commanded for
+ *              BEL_COORDINATOR_SHORTFALL_MS, it has derated on its
+ *              own: its limit is dropped to what it delivers, and
+ *              raised again slowly once it keeps up.
+ *
+ *              The total is shared in proportion to the limits, so
+ *              when one charger derates the others take up the
+ *              difference, up to their own limits.
+ *
+ *              All currents are in the units of the Bel setpoint,
+ *              0.05A.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+
+#ifndef BEL_CHARGER_COORDINATOR_H_
+#define BEL_CHARGER_COORDINATOR_H_
+
+//
+// Chargers ONE and TWO.
+//
+#define BEL_COORDINATOR_MAX_CHARGERS 2
+
+/******************************************************************************
+ *
+ *        Name: bel_charger_coordinator_update()
+ *
+ * Description: Works out the limit of each charger and splits the
+ *              total charge current between them. Called once a loop
+ *              from User_App(), after charge_profile_update() and
+ *              before bel_charger_control().
+ *
+ ******************************************************************************
+ */
+void bel_charger_coordinator_update();
+
+//
+// The current command of a charger, in 0.05A. Zero for a charger
+// that is not installed, and when not charging.
+//
+uint16_t bel_charger_coordinator_get_current_command(device_instances_t device);
+
+//
+// The limit of a charger, in 0.05A.
+//
+uint16_t bel_charger_coordinator_get_limit(device_instances_t device);
+
+#endif // BEL_CHARGER_COORDINATOR_H_
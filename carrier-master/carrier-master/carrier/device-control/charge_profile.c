@@ -0,0 +1,371 @@
+/******************************************************************************
+ *
+ *        Name: charge_profile.c
+ *
+ * Description: The CC-CV charge profile engine. See charge_profile.h.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+
+#include "Prototypes.h"
+#include "Constants.h"
+#include "typedefs.h"
+#include "can_service.h"
+#include "time_service.h"
+#include "orion_control.h"
+#include "state_machine.h"
+#include "charge_profile.h"
+
+//
+// The tunables of the profile are fixed at build time. They are not
+// EEVARs, as Constants.h has no EEPROM locations for them.
+//
+
+//
+// The CV target is CHARGE_PROFILE_CV_MARGIN below the maximum
+// cell voltage, so the loop can overshoot it a little without reaching
+// the maximum. CV starts CHARGE_PROFILE_CV_ENTRY_MARGIN below the
+// target. In 0.1mV.
+//
+#define CHARGE_PROFILE_CV_MARGIN                    30
+#define CHARGE_PROFILE_CV_ENTRY_MARGIN              150
+
+//
+// PI gains on the high cell voltage error. Kp is in 0.05A per 0.1mV,
+// Q8: 512 is 1A per mV. Ki is in 0.05A per 0.1mV per second, Q16:
+// 26214 is 0.4A per mV per second.
+//
+#define CHARGE_PROFILE_KP_Q8                        512
+#define CHARGE_PROFILE_KI_Q16                       26214
+
+//
+// Phase currents, in A.
+//
+#define CHARGE_PROFILE_TAPER_CURRENT_A              15
+#define CHARGE_PROFILE_TERMINATION_CURRENT_A        3
+#define CHARGE_PROFILE_BALANCE_CURRENT_A            1
+
+//
+// Balancing ends once the cells are within
+// CHARGE_PROFILE_BALANCE_SPREAD of each other (0.1mV), or after
+// CHARGE_PROFILE_BALANCE_MS.
+//
+#define CHARGE_PROFILE_BALANCE_SPREAD               100
+#define CHARGE_PROFILE_BALANCE_MS                   3600000
+
+//
+// A complete charge restarts once the high cell has dropped this far
+// below the CV target, in 0.1mV.
+//
+#define CHARGE_PROFILE_RESTART_DROP                 500
+
+//
+// Bounds on the PI step, so a late BMS frame or a large error cannot
+// overflow the 32 bit arithmetic: Ki x error x step is at most
+// 26214 x 1000 / 1000 x 1000.
+//
+#define CHARGE_PROFILE_MAX_STEP_MS                  1000
+#define CHARGE_PROFILE_MAX_ERROR                    1000
+
+#define CV_TARGET \
+    (EEVAR_max_allowable_charging_cell_voltage - CHARGE_PROFILE_CV_MARGIN)
+
+//=============================================================================
+//
+// Static Variables
+//
+//=============================================================================
+//
+static charge_profile_phase_t phase = CHARGE_PROFILE_IDLE;
+static uint16_t current_command = 0;
+
+//
+// The PI integrator, in 0.05A Q16.
+//
+static int32_t integrator_q16 = 0;
+
+//
+// In TAPER, the lowest current commanded so far.
+//
+static uint16_t taper_ceiling = 0;
+
+static uint32_t phase_start_ms = 0;
+static uint32_t last_step_ms = 0;
+static uint32_t last_frame_count = 0;
+
+static void set_phase(charge_profile_phase_t new_phase);
+static uint16_t pi_step(
+    int32_t error,
+    uint32_t step_ms,
+    uint16_t max_current);
+
+
+/******************************************************************************
+ *
+ *        Name: charge_profile_update()
+ *
+ * Description: Resets the profile when not charging. Otherwise,
+ *              every time the BMSs have sent new data, steps the PI
+ *              loop and moves through the phases.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+void charge_profile_update()
+{
+    const battery_pack_aggregate_t *aggregate = get_battery_pack_aggregate();
+
+    bool_t charging_desired =
+        get_sm_status_enable_hv_systems() &&
+        (get_sm_current_state() == CHARGING);
+
+    if (!charging_desired)
+    {
+        set_phase(CHARGE_PROFILE_IDLE);
+        current_command = 0;
+        integrator_q16 = 0;
+        last_step_ms = time_service_get_ms();
+        return;
+    }
+
+    if (aggregate->frame_count == last_frame_count)
+    {
+        return;
+    }
+
+    last_frame_count = aggregate->frame_count;
+
+    uint32_t step_ms = time_service_ms_since(last_step_ms);
+    last_step_ms = time_service_get_ms();
+
+    if (step_ms > CHARGE_PROFILE_MAX_STEP_MS)
+    {
+        step_ms = CHARGE_PROFILE_MAX_STEP_MS;
+    }
+
+    int32_t high_cell =
+        aggregate->signal[PACK_SIGNAL_HIGH_CELL_VOLTAGE].max;
+
+    int32_t cell_spread =
+        high_cell - aggregate->signal[PACK_SIGNAL_LOW_CELL_VOLTAGE].min;
+
+    int32_t error = CV_TARGET - high_cell;
+
+    //
+    // The most the packs can take, which bounds the integrator as
+    // well: the CCL is in A, once per pack in parallel.
+    //
+    uint32_t max_current = (uint32_t)EEVAR_CHARGER_total_current_command * 20;
+    uint32_t ccl =
+        (uint32_t)aggregate->signal[PACK_SIGNAL_CHARGE_CURRENT_LIMIT].min
+        * get_number_of_bms() * 20;
+
+    if (ccl < max_current)
+    {
+        max_current = ccl;
+    }
+
+    //
+    // Never charge at or above the maximum, whatever the phase.
+    //
+    if (high_cell >= EEVAR_max_allowable_charging_cell_voltage)
+    {
+        integrator_q16 = 0;
+    }
+
+    switch (phase)
+    {
+    case CHARGE_PROFILE_IDLE:
+
+        set_phase(((CV_TARGET - high_cell) <= CHARGE_PROFILE_CV_ENTRY_MARGIN)
+                  ? CHARGE_PROFILE_CV : CHARGE_PROFILE_CC);
+
+        current_command = 0;
+
+        break;
+
+    case CHARGE_PROFILE_CC:
+
+        current_command = (uint16_t)max_current;
+
+        if (error <= CHARGE_PROFILE_CV_ENTRY_MARGIN)
+        {
+            //
+            // Preload the integrator with the CC current less the
+            // proportional term, so the command does not jump.
+            //
+            integrator_q16 =
+                ((int32_t)current_command
+                 - ((CHARGE_PROFILE_KP_Q8 * error) / 256)) * 65536;
+
+            set_phase(CHARGE_PROFILE_CV);
+        }
+
+        break;
+
+    case CHARGE_PROFILE_CV:
+
+        current_command = pi_step(error, step_ms, (uint16_t)max_current);
+
+        if (current_command < (CHARGE_PROFILE_TAPER_CURRENT_A * 20))
+        {
+            taper_ceiling = current_command;
+            set_phase(CHARGE_PROFILE_TAPER);
+        }
+
+        break;
+
+    case CHARGE_PROFILE_TAPER:
+
+        if (taper_ceiling > max_current)
+        {
+            taper_ceiling = (uint16_t)max_current;
+        }
+
+        current_command = pi_step(error, step_ms, taper_ceiling);
+        taper_ceiling = current_command;
+
+        if (current_command < (CHARGE_PROFILE_TERMINATION_CURRENT_A * 20))
+        {
+            set_phase(CHARGE_PROFILE_BALANCE);
+        }
+
+        break;
+
+    case CHARGE_PROFILE_BALANCE:
+
+        current_command = pi_step(
+            error,
+            step_ms,
+            (max_current < (CHARGE_PROFILE_BALANCE_CURRENT_A * 20))
+                ? (uint16_t)max_current
+                : (CHARGE_PROFILE_BALANCE_CURRENT_A * 20));
+
+        if ((cell_spread <= CHARGE_PROFILE_BALANCE_SPREAD) ||
+            (time_service_ms_since(phase_start_ms) >= CHARGE_PROFILE_BALANCE_MS))
+        {
+            current_command = 0;
+            set_phase(CHARGE_PROFILE_COMPLETE);
+        }
+
+        break;
+
+    case CHARGE_PROFILE_COMPLETE:
+
+        current_command = 0;
+        integrator_q16 = 0;
+
+        if (error >= CHARGE_PROFILE_RESTART_DROP)
+        {
+            set_phase(CHARGE_PROFILE_CC);
+        }
+
+        break;
+
+    default:
+
+        set_phase(CHARGE_PROFILE_IDLE);
+        current_command = 0;
+
+        break;
+    }
+}
+
+
+//=============================================================================
+//
+// set_phase()
+//
+//=============================================================================
+//
+static void set_phase(charge_profile_phase_t new_phase)
+{
+    if (new_phase != phase)
+    {
+        phase = new_phase;
+        phase_start_ms = time_service_get_ms();
+    }
+}
+
+
+//=============================================================================
+//
+// pi_step()
+//
+// One step of the PI loop on the high cell voltage error. The
+// integrator is held between zero and max_current, so it does not
+// wind up while the current is limited elsewhere.
+//
+//=============================================================================
+//
+static uint16_t pi_step(
+    int32_t error,
+    uint32_t step_ms,
+    uint16_t max_current)
+{
+    int32_t max_integrator = (int32_t)max_current * 65536;
+    int32_t output;
+
+    if (error > CHARGE_PROFILE_MAX_ERROR)
+    {
+        error = CHARGE_PROFILE_MAX_ERROR;
+    }
+    else if (error < -CHARGE_PROFILE_MAX_ERROR)
+    {
+        error = -CHARGE_PROFILE_MAX_ERROR;
+    }
+
+    integrator_q16 +=
+        ((CHARGE_PROFILE_KI_Q16 * error) / 1000) * (int32_t)step_ms;
+
+    if (integrator_q16 < 0)
+    {
+        integrator_q16 = 0;
+    }
+    else if (integrator_q16 > max_integrator)
+    {
+        integrator_q16 = max_integrator;
+    }
+
+    output = ((CHARGE_PROFILE_KP_Q8 * error) / 256)
+             + (integrator_q16 / 65536);
+
+    if (output < 0)
+    {
+        output = 0;
+    }
+    else if (output > max_current)
+    {
+        output = max_current;
+    }
+
+    return (uint16_t)output;
+}
+
+
+//=============================================================================
+//
+// Getters
+//
+//=============================================================================
+//
+uint16_t charge_profile_get_current_command()
+{
+    return current_command;
+}
+
+bool_t charge_profile_get_charger_enabled()
+{
+    return (phase != CHARGE_PROFILE_IDLE) &&
+           (phase != CHARGE_PROFILE_COMPLETE);
+}
+
+charge_profile_phase_t charge_profile_get_phase()
+{
+    return phase;
+}
@@ -0,0 +1,93 @@
+/******************************************************************************
+ *
+ *        Name: charge_profile.h
+ *
+ * Description: The charge profile engine. Works out the total charge
+ *              current command for the Bel chargers
+ *              (bel_charger_coordinator.h) through four phases:
+ *
+ *              1) CC:      Constant current at
+ *                          EEVAR_CHARGER_total_current_command, until
+ *                          the high cell comes within
+ *                          CHARGE_PROFILE_CV_ENTRY_MARGIN of the
+ *                          CV target.
+ *              2) CV:      A PI loop on the high cell voltage holds it
+ *                          at the CV target, just below
+ *                          EEVAR_max_allowable_charging_cell_voltage.
+ *                          The current falls as the pack fills.
+ *              3) TAPER:   Once the current has fallen below
+ *                          CHARGE_PROFILE_TAPER_CURRENT_A, it is
+ *                          not allowed to rise again, so the current
+ *                          does not pump back up as the cells relax.
+ *                          Ends below
+ *                          CHARGE_PROFILE_TERMINATION_CURRENT_A.
+ *              4) BALANCE: A small top-off current, still held under
+ *                          the CV target by the PI loop, while the BMS
+ *                          balances the cells. Ends when the cell
+ *                          spread is down to
+ *                          CHARGE_PROFILE_BALANCE_SPREAD, or
+ *                          after CHARGE_PROFILE_BALANCE_MS.
+ *
+ *              Then the charge is complete and the chargers are
+ *              disabled, until the high cell has dropped
+ *              CHARGE_PROFILE_RESTART_DROP below the CV target.
+ *
+ *              The PI loop is stepped every time new BMS data has been
+ *              received, not every loop, so it works on fresh
+ *              voltages only. It is in fixed point.
+ *
+ *              Currents are in the units of the Bel setpoint, 0.05A.
+ *              Cell voltages are in the units of the Orion, 0.1mV.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+
+#ifndef CHARGE_PROFILE_H_
+#define CHARGE_PROFILE_H_
+
+//
+// The highest cell voltage charged to, in 0.1mV. The same as
+// setting_max_charging_cell_voltage_uv in the state machine.
+//
+#define EEVAR_max_allowable_charging_cell_voltage 40400
+
+typedef enum
+{
+    CHARGE_PROFILE_IDLE = 0,
+    CHARGE_PROFILE_CC,
+    CHARGE_PROFILE_CV,
+    CHARGE_PROFILE_TAPER,
+    CHARGE_PROFILE_BALANCE,
+    CHARGE_PROFILE_COMPLETE
+} charge_profile_phase_t;
+
+/******************************************************************************
+ *
+ *        Name: charge_profile_update()
+ *
+ * Description: Steps the charge profile. Called once a loop from
+ *              User_App(), before bel_charger_coordinator_update().
+ *
+ ******************************************************************************
+ */
+void charge_profile_update();
+
+//
+// The total charge current command, in 0.05A.
+//
+uint16_t charge_profile_get_current_command();
+
+//
+// TRUE while the chargers should be enabled: charging is desired and
+// the charge is not complete. bel_charger_control() sends it as the
+// enable of the Bel setpoint, so the chargers are disabled in IDLE and
+// COMPLETE, not just commanded to 0A.
+//
+bool_t charge_profile_get_charger_enabled();
+
+charge_profile_phase_t charge_profile_get_phase();
+
+#endif // CHARGE_PROFILE_H_
@@ -32,6 +32,8 @@
 #include "pdm_control_3.h"
 #include "fvt_library.h"
 #include "cvc_debug_msgs.h"
+#include "cvc_input_control.h"
+#include "energy_estimator.h"
 
 #define UNUSED 0x00
 
@@ -164,38 +166,25 @@ static void screen_update_main_screen()
     //
     uint16_t soc_being_displayed = (uint16_t)(((100 / 81) * (screen_SOC / 2)) - (500 / 81));
 
-    // Ground Spped Calculations
-    uint16_t ground_speed_of_vehicle = 0;
-    if(gear == 3)
-    {
-        // 1st Gear
-        ground_speed_of_vehicle = (uint16_t)((float)abs_motor_rpm * 0.0019043539);
-    }
-    else if(gear == 4)
-    {
-        // 2nd Gear
-        ground_speed_of_vehicle = (uint16_t)((float)abs_motor_rpm * 0.0039677741);
-    }
-    else if (gear == 5)
-    {
-        // 3rd Gear
-        ground_speed_of_vehicle = (uint16_t)((float)abs_motor_rpm * 0.0069031280);
-    }
-    else
-    {
-        ground_speed_of_vehicle = 0;
-    }
+    // Ground Spped Calculations: mm/s to km/h
+    uint16_t ground_speed_of_vehicle =
+        (uint16_t)(((uint32_t)get_ground_speed_mmps() * 36) / 10000);
 
     send_debug_can_messages_32bits(0xF003,
                                    EEVAR_HOURMETER_SECONDS_VALUE,
                                    EEVAR_TIME_UNTIL_SERVICE_VALUE);
 
 
+    //
+    // Range in minutes and in 10 m.
+    //
+    uint32_t range_10m = energy_estimator_get_range_metres() / 10;
+
     send_debug_can_messages_16bits(0xF004,
                                    soc_being_displayed,
                                    ground_speed_of_vehicle,
-                                   0x00,
-                                   0x00);
+                                   energy_estimator_get_range_minutes(),
+                                   (range_10m > 0xFFFF) ? 0xFFFF : (uint16_t)range_10m);
 
     send_debug_can_messages_32bits(0xF005,
                                    odometer_reading,
@@ -596,7 +585,7 @@ static void screen_update_traction_inverter()
 
    cl712_set_tx_drive_system_screen_message2(
         ONE,
-        IN_E03_throttle_position_sensor_signal,
+        cvc_input_get_analog(CVC_AIN_E03_THROTTLE_POSITION_SENSOR),
         EEVAR_THROTTLE_RELEASED,
         EEVAR_THROTTLE_DEPRESSED);
 
@@ -27,179 +27,209 @@
 #include "pdm_control_2.h"
 #include "orion_control.h"
 
+//
+// The bitsets of the digital snapshot are 32 bits wide.
+//
+typedef char cvc_digital_input_count_check[
+    (NUM_CVC_DIGITAL_INPUTS <= 32) ? 1 : -1];
+
 //=============================================================================
 //
-// IN_A15_stop_charging_button_signal_status()
+// IOMap index of each input held in the snapshot.
 //
 //=============================================================================
 //
-Input_State_t IN_A15_stop_charging_button_signal_status()
+static const uint8_t digital_input_iomap_index[NUM_CVC_DIGITAL_INPUTS] =
 {
-    Input_State_t status;
-
-    //
-    // Check the state of pin E01 and return the status of the PIN.
-    // True indicates the presence of 12V at the PIN. False indicates
-    // 0V at the PIN.
-    //
-    if (IN_A15_stop_charging_button_signal == INPUT_ON)
-    {
+    [CVC_DIN_E11_MASTER_SWITCH]       = IOMapIndex_IN_E11_master_switch_signal,
+    [CVC_DIN_A15_STOP_CHARGING_BUTTON] = IOMapIndex_IN_A15_stop_charging_button_signal,
+    [CVC_DIN_A16_DASH_E_STOP]         = IOMapIndex_IN_A16_dash_e_stop_signal,
+    [CVC_DIN_A17_CHARGE_BOX_E_STOP]   = IOMapIndex_IN_A17_charge_box_e_stop_signal,
+    [CVC_DIN_A18_DIAGNOSTIC_SWITCH]   = IOMapIndex_IN_A18_diagnositic_switch_signal,
+    [CVC_DIN_B15_FORWARD_SWITCH]      = IOMapIndex_IN_B15_forward_switch,
+    [CVC_DIN_B16_1ST_GEAR_SWITCH]     = IOMapIndex_IN_B16_1st_gear_switch,
+    [CVC_DIN_B17_2ND_GEAR_SWITCH]     = IOMapIndex_IN_B17_2nd_gear_switch,
+    [CVC_DIN_B18_3RD_GEAR_SWITCH]     = IOMapIndex_IN_B18_3rd_gear_switch,
+    [CVC_DIN_C11_NEUTRAL_SWITCH]      = IOMapIndex_IN_C11_neutral_switch,
+    [CVC_DIN_C15_ABA_BRAKE_BUTTON]    = IOMapIndex_IN_C15_aba_brake_button_signal,
+    [CVC_DIN_C16_ABA_BRAKE_MOMENTARY] = IOMapIndex_IN_C16_aba_brake_momentary_signal,
+    [CVC_DIN_C18_REVERSE_SWITCH]      = IOMapIndex_IN_C18_reverse_switch,
+};
+
+static const uint8_t analog_input_iomap_index[NUM_CVC_ANALOG_INPUTS] =
+{
+    [CVC_AIN_E01_ZENER_INPUT]              = IOMapIndex_IN_E01_cvc_zener_input,
+    [CVC_AIN_E03_THROTTLE_POSITION_SENSOR] = IOMapIndex_IN_E03_throttle_position_sensor_signal,
+    [CVC_AIN_E10_MAIN_SYS_PRESSURE_SENSOR] = IOMapIndex_IN_E10_main_sys_pressure_sensor_signal,
+    [CVC_AIN_A11_KEYSWITCH]                = IOMapIndex_IN_A11_keyswitch,
+};
 
-        // The digital input is on
-        status = INPUT_ON;
+//=============================================================================
+//
+// Static Variables
+//
+//=============================================================================
+//
+static uint32_t digital_on_bits = 0;
+static uint32_t digital_disabled_bits = 0;
+static uint16_t analog_values[NUM_CVC_ANALOG_INPUTS];
 
-    }
-    else if (IN_A15_stop_charging_button_signal == INPUT_OFF)
-    {
 
-        // The digital input is off
-        status = INPUT_OFF;
+/******************************************************************************
+ *
+ *        Name: cvc_input_snapshot_update()
+ *
+ * Description: A digital input is INPUT_ON, INPUT_OFF or
+ *              INPUT_DISABLED, so its state is held in two bitsets.
+ *              Any other IOMap value is taken as INPUT_OFF. The
+ *              analog inputs are copied as they are.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+void cvc_input_snapshot_update()
+{
+    uint32_t on_bits = 0;
+    uint32_t disabled_bits = 0;
+    uint32_t i;
 
-    }
-    else if (IN_A15_stop_charging_button_signal == INPUT_DISABLED)
+    for (i = 0; i < NUM_CVC_DIGITAL_INPUTS; i++)
     {
+        uint16_t state = IOMap[digital_input_iomap_index[i]];
 
-        // The digital input is either not configured, its debounce
-        // time not expired on boot up, or the i/o module it is
-        // assigned to is missing
-        status = INPUT_DISABLED;
-
+        on_bits |= (uint32_t)(state == INPUT_ON) << i;
+        disabled_bits |= (uint32_t)(state == INPUT_DISABLED) << i;
     }
 
-    return status;
+    digital_on_bits = on_bits;
+    digital_disabled_bits = disabled_bits;
 
+    for (i = 0; i < NUM_CVC_ANALOG_INPUTS; i++)
+    {
+        analog_values[i] = IOMap[analog_input_iomap_index[i]];
+    }
 }
 
 
 //=============================================================================
 //
-// IN_A16_dash_e_stop_signal_status()
+// cvc_input_get_digital()
 //
 //=============================================================================
 //
-Input_State_t IN_A16_dash_e_stop_signal_status()
+Input_State_t cvc_input_get_digital(
+    cvc_digital_input_t input)
 {
-    Input_State_t status;
-
-    //
-    // Check the state of pin E01 and return the status of the PIN.
-    // True indicates the presence of 12V at the PIN. False indicates
-    // 0V at the PIN.
-    //
-    if (IN_A16_dash_e_stop_signal == INPUT_ON)
+    if (input >= NUM_CVC_DIGITAL_INPUTS)
     {
-
-        // The digital input is on
-        status = INPUT_ON;
-
+        DEBUG("Invalid digital input");
+        return INPUT_INVALID;
     }
-    else if (IN_A16_dash_e_stop_signal == INPUT_OFF)
-    {
-
-        // The digital input is off
-        status = INPUT_OFF;
 
+    if ((digital_on_bits >> input) & 1)
+    {
+        return INPUT_ON;
     }
-    else if (IN_A16_dash_e_stop_signal == INPUT_DISABLED)
+    else if ((digital_disabled_bits >> input) & 1)
     {
-
-        // The digital input is either not configured, its debounce
-        // time not expired on boot up, or the i/o module it is
-        // assigned to is missing
-        status = INPUT_DISABLED;
-
+        return INPUT_DISABLED;
     }
 
-    return status;
-
+    return INPUT_OFF;
 }
 
 
 //=============================================================================
 //
-// IN_A17_charge_box_e_stop_signal_status()
+// cvc_input_get_digital_on_bits()
 //
 //=============================================================================
 //
-Input_State_t IN_A17_charge_box_e_stop_signal_status()
+uint32_t cvc_input_get_digital_on_bits()
 {
-    Input_State_t status;
-
-    //
-    // Check the state of pin E01 and return the status of the PIN.
-    // True indicates the presence of 12V at the PIN. False indicates
-    // 0V at the PIN.
-    //
-    if (IN_A17_charge_box_e_stop_signal == INPUT_ON)
-    {
+    return digital_on_bits;
+}
 
-        // The digital input is on
-        status = INPUT_ON;
 
-    }
-    else if (IN_A17_charge_box_e_stop_signal == INPUT_OFF)
-    {
+//=============================================================================
+//
+// cvc_input_get_digital_disabled_bits()
+//
+//=============================================================================
+//
+uint32_t cvc_input_get_digital_disabled_bits()
+{
+    return digital_disabled_bits;
+}
 
-        // The digital input is off
-        status = INPUT_OFF;
 
-    }
-    else if (IN_A17_charge_box_e_stop_signal == INPUT_DISABLED)
+//=============================================================================
+//
+// cvc_input_get_analog()
+//
+//=============================================================================
+//
+uint16_t cvc_input_get_analog(
+    cvc_analog_input_t input)
+{
+    if (input >= NUM_CVC_ANALOG_INPUTS)
     {
-
-        // The digital input is either not configured, its debounce
-        // time not expired on boot up, or the i/o module it is
-        // assigned to is missing
-        status = INPUT_DISABLED;
-
+        DEBUG("Invalid analog input");
+        return 0;
     }
 
-    return status;
-
+    return analog_values[input];
 }
 
 
+
 //=============================================================================
 //
-// IN_A18_diagnositic_switch_signal_status()
+// IN_A15_stop_charging_button_signal_status()
 //
 //=============================================================================
 //
-Input_State_t IN_A18_diagnositic_switch_signal_status()
+Input_State_t IN_A15_stop_charging_button_signal_status()
 {
-    Input_State_t status;
-
-    //
-    // Check the state of pin E01 and return the status of the PIN.
-    // True indicates the presence of 12V at the PIN. False indicates
-    // 0V at the PIN.
-    //
-    if (IN_A18_diagnositic_switch_signal == INPUT_ON)
-    {
-
-        // The digital input is on
-        status = INPUT_ON;
-
-    }
-    else if (IN_A18_diagnositic_switch_signal == INPUT_OFF)
-    {
+    return cvc_input_get_digital(CVC_DIN_A15_STOP_CHARGING_BUTTON);
+}
 
-        // The digital input is off
-        status = INPUT_OFF;
 
-    }
-    else if (IN_A18_diagnositic_switch_signal == INPUT_DISABLED)
-    {
+//=============================================================================
+//
+// IN_A16_dash_e_stop_signal_status()
+//
+//=============================================================================
+//
+Input_State_t IN_A16_dash_e_stop_signal_status()
+{
+    return cvc_input_get_digital(CVC_DIN_A16_DASH_E_STOP);
+}
 
-        // The digital input is either not configured, its debounce
-        // time not expired on boot up, or the i/o module it is
-        // assigned to is missing
-        status = INPUT_DISABLED;
 
-    }
+//=============================================================================
+//
+// IN_A17_charge_box_e_stop_signal_status()
+//
+//=============================================================================
+//
+Input_State_t IN_A17_charge_box_e_stop_signal_status()
+{
+    return cvc_input_get_digital(CVC_DIN_A17_CHARGE_BOX_E_STOP);
+}
 
-    return status;
 
+//=============================================================================
+//
+// IN_A18_diagnositic_switch_signal_status()
+//
+//=============================================================================
+//
+Input_State_t IN_A18_diagnositic_switch_signal_status()
+{
+    return cvc_input_get_digital(CVC_DIN_A18_DIAGNOSTIC_SWITCH);
 }
 
 
@@ -211,39 +241,7 @@ Input_State_t IN_A18_diagnositic_switch_signal_status()
 //
 Input_State_t IN_B15_forward_switch_status()
 {
-    Input_State_t status;
-
-    //
-    // Check the state of pin E01 and return the status of the PIN.
-    // True indicates the presence of 12V at the PIN. False indicates
-    // 0V at the PIN.
-    //
-    if (IN_B15_forward_switch == INPUT_ON)
-    {
-
-        // The digital input is on
-        status = INPUT_ON;
-
-    }
-    else if (IN_B15_forward_switch == INPUT_OFF)
-    {
-
-        // The digital input is offxd
-        status = INPUT_OFF;
-
-    }
-    else if (IN_B15_forward_switch == INPUT_DISABLED)
-    {
-
-        // The digital input is either not configured, its debounce
-        // time not expired on boot up, or the i/o module it is
-        // assigned to is missing
-        status = INPUT_DISABLED;
-
-    }
-
-    return status;
-
+    return cvc_input_get_digital(CVC_DIN_B15_FORWARD_SWITCH);
 }
 
 
@@ -255,39 +253,7 @@ Input_State_t IN_B15_forward_switch_status()
 //
 Input_State_t IN_B16_1st_gear_switch_status()
 {
-    Input_State_t status;
-
-    //
-    // Check the state of pin E01 and return the status of the PIN.
-    // True indicates the presence of 12V at the PIN. False indicates
-    // 0V at the PIN.
-    //
-    if (IN_B16_1st_gear_switch == INPUT_ON)
-    {
-
-        // The digital input is on
-        status = INPUT_ON;
-
-    }
-    else if (IN_B16_1st_gear_switch == INPUT_OFF)
-    {
-
-        // The digital input is off
-        status = INPUT_OFF;
-
-    }
-    else if (IN_B16_1st_gear_switch == INPUT_DISABLED)
-    {
-
-        // The digital input is either not configured, its debounce
-        // time not expired on boot up, or the i/o module it is
-        // assigned to is missing
-        status = INPUT_DISABLED;
-
-    }
-
-    return status;
-
+    return cvc_input_get_digital(CVC_DIN_B16_1ST_GEAR_SWITCH);
 }
 
 
@@ -299,39 +265,7 @@ Input_State_t IN_B16_1st_gear_switch_status()
 //
 Input_State_t IN_B17_2nd_gear_switch_status()
 {
-    Input_State_t status;
-
-    //
-    // Check the state of pin E01 and return the status of the PIN.
-    // True indicates the presence of 12V at the PIN. False indicates
-    // 0V at the PIN.
-    //
-    if (IN_B17_2nd_gear_switch == INPUT_ON)
-    {
-
-        // The digital input is on
-        status = INPUT_ON;
-
-    }
-    else if (IN_B17_2nd_gear_switch == INPUT_OFF)
-    {
-
-        // The digital input is off
-        status = INPUT_OFF;
-
-    }
-    else if (IN_B17_2nd_gear_switch == INPUT_DISABLED)
-    {
-
-        // The digital input is either not configured, its debounce
-        // time not expired on boot up, or the i/o module it is
-        // assigned to is missing
-        status = INPUT_DISABLED;
-
-    }
-
-    return status;
-
+    return cvc_input_get_digital(CVC_DIN_B17_2ND_GEAR_SWITCH);
 }
 
 
@@ -343,39 +277,7 @@ Input_State_t IN_B17_2nd_gear_switch_status()
 //
 Input_State_t IN_B18_3rd_gear_switch_status()
 {
-    Input_State_t status;
-
-    //
-    // Check the state of pin E01 and return the status of the PIN.
-    // True indicates the presence of 12V at the PIN. False indicates
-    // 0V at the PIN.
-    //
-    if (IN_B18_3rd_gear_switch == INPUT_ON)
-    {
-
-        // The digital input is on
-        status = INPUT_ON;
-
-    }
-    else if (IN_B18_3rd_gear_switch == INPUT_OFF)
-    {
-
-        // The digital input is off
-        status = INPUT_OFF;
-
-    }
-    else if (IN_B18_3rd_gear_switch == INPUT_DISABLED)
-    {
-
-        // The digital input is either not configured, its debounce
-        // time not expired on boot up, or the i/o module it is
-        // assigned to is missing
-        status = INPUT_DISABLED;
-
-    }
-
-    return status;
-
+    return cvc_input_get_digital(CVC_DIN_B18_3RD_GEAR_SWITCH);
 }
 
 
@@ -387,39 +289,7 @@ Input_State_t IN_B18_3rd_gear_switch_status()
 //
 Input_State_t IN_C11_neutral_switch_status()
 {
-    Input_State_t status;
-
-    //
-    // Check the state of pin E01 and return the status of the PIN.
-    // True indicates the presence of 12V at the PIN. False indicates
-    // 0V at the PIN.
-    //
-    if (IN_C11_neutral_switch == INPUT_ON)
-    {
-
-        // The digital input is on
-        status = INPUT_ON;
-
-    }
-    else if (IN_C11_neutral_switch == INPUT_OFF)
-    {
-
-        // The digital input is off
-        status = INPUT_OFF;
-
-    }
-    else if (IN_C11_neutral_switch == INPUT_DISABLED)
-    {
-
-        // The digital input is either not configured, its debounce
-        // time not expired on boot up, or the i/o module it is
-        // assigned to is missing
-        status = INPUT_DISABLED;
-
-    }
-
-    return status;
-
+    return cvc_input_get_digital(CVC_DIN_C11_NEUTRAL_SWITCH);
 }
 
 
@@ -431,39 +301,7 @@ Input_State_t IN_C11_neutral_switch_status()
 //
 Input_State_t IN_C15_aba_brake_button_signal_status()
 {
-    Input_State_t status;
-
-    //
-    // Check the state of pin E01 and return the status of the PIN.
-    // True indicates the presence of 12V at the PIN. False indicates
-    // 0V at the PIN.
-    //
-    if (IN_C15_aba_brake_button_signal == INPUT_ON)
-    {
-
-        // The digital input is on
-        status = INPUT_ON;
-
-    }
-    else if (IN_C15_aba_brake_button_signal == INPUT_OFF)
-    {
-
-        // The digital input is off
-        status = INPUT_OFF;
-
-    }
-    else if (IN_C15_aba_brake_button_signal == INPUT_DISABLED)
-    {
-
-        // The digital input is either not configured, its debounce
-        // time not expired on boot up, or the i/o module it is
-        // assigned to is missing
-        status = INPUT_DISABLED;
-
-    }
-
-    return status;
-
+    return cvc_input_get_digital(CVC_DIN_C15_ABA_BRAKE_BUTTON);
 }
 
 
@@ -475,39 +313,7 @@ Input_State_t IN_C15_aba_brake_button_signal_status()
 //
 Input_State_t IN_C16_aba_brake_momentary_signal_status()
 {
-    Input_State_t status;
-
-    //
-    // Check the state of pin E01 and return the status of the PIN.
-    // True indicates the presence of 12V at the PIN. False indicates
-    // 0V at the PIN.
-    //
-    if (IN_C16_aba_brake_momentary_signal == INPUT_ON)
-    {
-
-        // The digital input is on
-        status = INPUT_ON;
-
-    }
-    else if (IN_C16_aba_brake_momentary_signal == INPUT_OFF)
-    {
-
-        // The digital input is off
-        status = INPUT_OFF;
-
-    }
-    else if (IN_C16_aba_brake_momentary_signal == INPUT_DISABLED)
-    {
-
-        // The digital input is either not configured, its debounce
-        // time not expired on boot up, or the i/o module it is
-        // assigned to is missing
-        status = INPUT_DISABLED;
-
-    }
-
-    return status;
-
+    return cvc_input_get_digital(CVC_DIN_C16_ABA_BRAKE_MOMENTARY);
 }
 
 
@@ -519,39 +325,7 @@ Input_State_t IN_C16_aba_brake_momentary_signal_status()
 //
 Input_State_t IN_C18_reverse_switch_status()
 {
-    Input_State_t status;
-
-    //
-    // Check the state of pin E01 and return the status of the PIN.
-    // True indicates the presence of 12V at the PIN. False indicates
-    // 0V at the PIN.
-    //
-    if (IN_C18_reverse_switch == INPUT_ON)
-    {
-
-        // The digital input is on
-        status = INPUT_ON;
-
-    }
-    else if (IN_C18_reverse_switch == INPUT_OFF)
-    {
-
-        // The digital input is off
-        status = INPUT_OFF;
-
-    }
-    else if (IN_C18_reverse_switch == INPUT_DISABLED)
-    {
-
-        // The digital input is either not configured, its debounce
-        // time not expired on boot up, or the i/o module it is
-        // assigned to is missing.
-        status = INPUT_DISABLED;
-
-    }
-
-    return status;
-
+    return cvc_input_get_digital(CVC_DIN_C18_REVERSE_SWITCH);
 }
 
 
@@ -571,47 +345,7 @@ Input_State_t IN_C18_reverse_switch_status()
 //
 uint16_t IN_E01_cvc_zener_input_status()
 {
-    Analog_Values_ analog_values;
-    uint16_t analog_reading = 0;
-
-    /*
-     * Call this function to read analog value of input
-     * software_input_number is the input software number of the input
-     * you want to read (since it is on master module it lines up with
-     * the IOMap address) frequency sets the amount of time the input
-     * is sampled over.  For example 50 Hz -> 20 msec, 100 Hz, 10
-     * msec, 200 Hz 5 msec return the Analog_Values_ structure NOTE:
-     * if the frequency is set such that it takes longer to sample the
-     * input than the loop time, the previous value will be reported
-     * until the sampling is finished.  In some cases the inputs on
-     * the module are run through a multiplexer, in these cases having
-     * one long sample time will affect all the inputs since the
-     * multiplexer cannot be flipped until all the inputs have
-     * finished sampling
-     */
-    int16_t frequency = (int16_t)FREQ_100HZ;
-
-    analog_values =  Read_Analog_Value_Inputs(
-         IN_E01_cvc_zener_input, 100);
-
-     // If flag false, the analog value return invalid; if flag true,
-     // the analog value return valid
-     if (analog_values.available_analog_value_flag == TRUE)
-     {
-
-         analog_reading = analog_values.ui16_analog_value;
-
-     }
-     else
-     {
-
-         analog_reading = 0;
-
-     }
-
-
-     return analog_reading;
-
+    return cvc_input_get_analog(CVC_AIN_E01_ZENER_INPUT);
 }
 
 
@@ -623,32 +357,11 @@ uint16_t IN_E01_cvc_zener_input_status()
 //
 uint16_t IN_E03_throttle_position_sensor_signal_status()
 {
-    Analog_Values_ analog_values;
-    static uint16_t analog_reading = 0;
-
-    /*
-     * Call this function to read analog value of input
-     * software_input_number is the input software number of the input
-     * you want to read (since it is on master module it lines up with
-     * the IOMap address) frequency sets the amount of time the input
-     * is sampled over.  For example 50 Hz -> 20 msec, 100 Hz, 10
-     * msec, 200 Hz 5 msec return the Analog_Values_ structure NOTE:
-     * if the frequency is set such that it takes longer to sample the
-     * input than the loop time, the previous value will be reported
-     * until the sampling is finished.  In some cases the inputs on
-     * the module are run through a multiplexer, in these cases having
-     * one long sample time will affect all the inputs since the
-     * multiplexer cannot be flipped until all the inputs have
-     * finished sampling
-     */
-     analog_values =  Read_Analog_Value_Inputs(
-    		 IOMapIndex_IN_E03_throttle_position_sensor_signal,
-    		 10);
-
-     analog_reading = analog_values.ui16_analog_value;
-
-     uint16_t throttle = (uint16_t)(analog_reading * 0.0473260) - 23.663038;
-
-     return throttle;
+    uint16_t analog_reading =
+        cvc_input_get_analog(CVC_AIN_E03_THROTTLE_POSITION_SENSOR);
+
+    uint16_t throttle = (uint16_t)(analog_reading * 0.0473260) - 23.663038;
+
+    return throttle;
 
 }
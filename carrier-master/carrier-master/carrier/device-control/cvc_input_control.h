@@ -26,6 +26,73 @@ typedef enum {
     FREQ_500HZ = 500,
 } sampling_frequency_t;
 
+//
+// The digital inputs of the CVC held in the per loop snapshot. Bit n
+// of the snapshot bitsets is cvc_digital_input_t n.
+//
+typedef enum
+{
+    CVC_DIN_E11_MASTER_SWITCH = 0,
+    CVC_DIN_A15_STOP_CHARGING_BUTTON,
+    CVC_DIN_A16_DASH_E_STOP,
+    CVC_DIN_A17_CHARGE_BOX_E_STOP,
+    CVC_DIN_A18_DIAGNOSTIC_SWITCH,
+    CVC_DIN_B15_FORWARD_SWITCH,
+    CVC_DIN_B16_1ST_GEAR_SWITCH,
+    CVC_DIN_B17_2ND_GEAR_SWITCH,
+    CVC_DIN_B18_3RD_GEAR_SWITCH,
+    CVC_DIN_C11_NEUTRAL_SWITCH,
+    CVC_DIN_C15_ABA_BRAKE_BUTTON,
+    CVC_DIN_C16_ABA_BRAKE_MOMENTARY,
+    CVC_DIN_C18_REVERSE_SWITCH,
+    NUM_CVC_DIGITAL_INPUTS
+} cvc_digital_input_t;
+
+//
+// The analog inputs of the CVC held in the per loop snapshot. The
+// values are the raw IOMap values in mV.
+//
+typedef enum
+{
+    CVC_AIN_E01_ZENER_INPUT = 0,
+    CVC_AIN_E03_THROTTLE_POSITION_SENSOR,
+    CVC_AIN_E10_MAIN_SYS_PRESSURE_SENSOR,
+    CVC_AIN_A11_KEYSWITCH,
+    NUM_CVC_ANALOG_INPUTS
+} cvc_analog_input_t;
+
+/******************************************************************************
+ *
+ *        Name: cvc_input_snapshot_update()
+ *
+ * Description: Reads every CVC input once and latches it for the
+ *              rest of the loop. Must be called at the top of
+ *              User_App(), before any of the control functions. All
+ *              the vehicle control modules read the inputs through
+ *              the getters below, so they all see the same value of
+ *              an input within a loop.
+ *
+ ******************************************************************************
+ */
+void cvc_input_snapshot_update();
+
+//
+// The state of a digital input in this loop's snapshot.
+//
+Input_State_t cvc_input_get_digital(cvc_digital_input_t input);
+
+//
+// Bitsets of the digital inputs that are INPUT_ON and INPUT_DISABLED
+// in this loop's snapshot. Bit n is cvc_digital_input_t n.
+//
+uint32_t cvc_input_get_digital_on_bits();
+uint32_t cvc_input_get_digital_disabled_bits();
+
+//
+// The raw value of an analog input in this loop's snapshot.
+//
+uint16_t cvc_input_get_analog(cvc_analog_input_t input);
+
 //=============================================================================
 //
 // Return the status of the CVC pins that are configured as inputs.
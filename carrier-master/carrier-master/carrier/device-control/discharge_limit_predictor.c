@@ -0,0 +1,458 @@
+/******************************************************************************
+ *
+ *        Name: discharge_limit_predictor.c
+ *
+ * Description: Predictive traction current limit. See
+ *              discharge_limit_predictor.h.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+
+#include <stdlib.h>
+#include "Prototypes.h"
+#include "Constants.h"
+#include "typedefs.h"
+#include "can_service.h"
+#include "time_service.h"
+#include "orion_device.h"
+#include "orion_control.h"
+#include "discharge_limit_predictor.h"
+
+//
+// How far ahead a falling DCL is projected.
+//
+#define DISCHARGE_LIMIT_TREND_HORIZON_MS            2000
+
+//
+// How far ahead the high cell temperature is projected, and the
+// temperatures over which the BMS derates the DCL to nothing. The
+// temperatures are those of the DCL derate of the Orion profile.
+//
+#define DISCHARGE_LIMIT_TEMPERATURE_HORIZON_S       60
+#define DISCHARGE_LIMIT_TEMPERATURE_START_C         50
+#define DISCHARGE_LIMIT_TEMPERATURE_STOP_C          60
+
+//
+// The lowest the low cell is allowed to sag to, in 0.1mV. A margin
+// above the low cell voltage at which the BMS cuts the DCL.
+//
+#define DISCHARGE_LIMIT_LOW_CELL_FLOOR              30500
+
+//
+// Ramp rates of the limit. A drop that was not predicted is followed
+// at the ramp down rate, fast enough to stay with the BMS, slow
+// enough not to jerk the machine.
+//
+#define DISCHARGE_LIMIT_RAMP_DOWN_A_PER_S           500
+#define DISCHARGE_LIMIT_RAMP_UP_A_PER_S             100
+
+//
+// The DCL slope and the temperature rate are smoothed as
+// x += (new - x) / DISCHARGE_LIMIT_FILTER_DIVISOR.
+//
+#define DISCHARGE_LIMIT_FILTER_DIVISOR              4
+
+//
+// The temperature is read in whole degrees, so its rate is measured
+// over periods long enough to see a change.
+//
+#define DISCHARGE_LIMIT_TEMPERATURE_PERIOD_MS       10000
+
+//
+// The sag resistance of a pack is only learned once the sag is large
+// enough to measure, under a real load, in 0.1mV and 0.1A.
+//
+#define DISCHARGE_LIMIT_MIN_SAG                     50
+#define DISCHARGE_LIMIT_MIN_CURRENT                 200
+
+#define DISCHARGE_LIMIT_MAX_STEP_MS                 1000
+#define DISCHARGE_LIMIT_MAX_PACKS                   3
+
+//=============================================================================
+//
+// Static Variables
+//
+//=============================================================================
+//
+static const device_instances_t bms_devices[DISCHARGE_LIMIT_MAX_PACKS] =
+{
+    ONE,
+    TWO,
+    THREE
+};
+
+static uint16_t current_limit = 0;
+static uint32_t predicted_limit[NUM_DISCHARGE_LIMITS];
+
+static uint32_t last_update_ms = 0;
+static uint32_t last_frame_count = 0;
+static uint32_t last_frame_ms = 0;
+
+//
+// Total DCL, in 0.1A, and its smoothed slope in 0.1A per second.
+//
+static int32_t last_dcl = 0;
+static int32_t dcl_slope = 0;
+
+//
+// High cell temperature at the start of the present period, and its
+// smoothed rate of rise in 0.1degC per minute.
+//
+static int32_t period_start_temperature = 0;
+static uint32_t period_start_ms = 0;
+static int32_t temperature_rate = 0;
+
+//
+// The sag of the low cell of each pack per amp of the total current,
+// in uOhm, smoothed. 0 until it has been learned.
+//
+static uint32_t sag_resistance[DISCHARGE_LIMIT_MAX_PACKS];
+
+static void predict_limits(const battery_pack_aggregate_t *aggregate,
+                           uint32_t max_current);
+static uint32_t predict_trend_limit(int32_t dcl);
+static uint32_t predict_temperature_limit(int32_t dcl, int32_t temperature);
+static uint32_t predict_sag_limit(const battery_pack_aggregate_t *aggregate,
+                                  uint32_t max_current);
+
+
+/******************************************************************************
+ *
+ *        Name: discharge_limit_predictor_update()
+ *
+ * Description: Predicts the limits on new BMS data, and ramps the
+ *              limit towards the lowest of them every loop.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+void discharge_limit_predictor_update()
+{
+    static bool_t first_pass = TRUE;
+
+    const battery_pack_aggregate_t *aggregate = get_battery_pack_aggregate();
+    uint32_t max_current = (uint32_t)EEVAR_TRACTION_SKAI_max_battery_current;
+    uint32_t target = max_current;
+    uint32_t step;
+    uint32_t step_ms;
+    uint8_t i;
+
+    if (first_pass)
+    {
+        last_dcl =
+            aggregate->signal[PACK_SIGNAL_DISCHARGE_CURRENT_LIMIT].min
+            * get_number_of_bms() * 10;
+        period_start_temperature =
+            aggregate->signal[PACK_SIGNAL_HIGH_CELL_TEMPERATURE].max;
+        period_start_ms = time_service_get_ms();
+        last_frame_ms = time_service_get_ms();
+        last_update_ms = time_service_get_ms();
+
+        for (i = 0; i < NUM_DISCHARGE_LIMITS; i++)
+        {
+            predicted_limit[i] = max_current;
+        }
+
+        first_pass = FALSE;
+    }
+
+    step_ms = time_service_ms_since(last_update_ms);
+    last_update_ms = time_service_get_ms();
+
+    if (step_ms > DISCHARGE_LIMIT_MAX_STEP_MS)
+    {
+        step_ms = DISCHARGE_LIMIT_MAX_STEP_MS;
+    }
+
+    if (aggregate->frame_count != last_frame_count)
+    {
+        last_frame_count = aggregate->frame_count;
+        predict_limits(aggregate, max_current);
+    }
+
+    for (i = 0; i < NUM_DISCHARGE_LIMITS; i++)
+    {
+        if (predicted_limit[i] < target)
+        {
+            target = predicted_limit[i];
+        }
+    }
+
+    //
+    // Ramp towards the target. The rates are in A per second, the
+    // limit in 0.1A.
+    //
+    if (target < current_limit)
+    {
+        step = (DISCHARGE_LIMIT_RAMP_DOWN_A_PER_S * 10 * step_ms) / 1000;
+
+        current_limit = ((current_limit - target) > step)
+                        ? (uint16_t)(current_limit - step)
+                        : (uint16_t)target;
+    }
+    else
+    {
+        step = (DISCHARGE_LIMIT_RAMP_UP_A_PER_S * 10 * step_ms) / 1000;
+
+        current_limit = ((target - current_limit) > step)
+                        ? (uint16_t)(current_limit + step)
+                        : (uint16_t)target;
+    }
+}
+
+
+//=============================================================================
+//
+// predict_limits()
+//
+//=============================================================================
+//
+static void predict_limits(
+    const battery_pack_aggregate_t *aggregate,
+    uint32_t max_current)
+{
+    //
+    // The packs are in parallel, so they can supply the lowest DCL
+    // once per pack. DCL is in A.
+    //
+    int32_t dcl =
+        aggregate->signal[PACK_SIGNAL_DISCHARGE_CURRENT_LIMIT].min
+        * get_number_of_bms() * 10;
+
+    uint32_t frame_ms = time_service_ms_since(last_frame_ms);
+    last_frame_ms = time_service_get_ms();
+
+    if (frame_ms > DISCHARGE_LIMIT_MAX_STEP_MS)
+    {
+        frame_ms = DISCHARGE_LIMIT_MAX_STEP_MS;
+    }
+    else if (frame_ms == 0)
+    {
+        frame_ms = 1;
+    }
+
+    dcl_slope +=
+        ((((dcl - last_dcl) * 1000) / (int32_t)frame_ms) - dcl_slope)
+        / DISCHARGE_LIMIT_FILTER_DIVISOR;
+
+    last_dcl = dcl;
+
+    predicted_limit[DISCHARGE_LIMIT_TREND] = predict_trend_limit(dcl);
+
+    predicted_limit[DISCHARGE_LIMIT_TEMPERATURE] =
+        predict_temperature_limit(
+            dcl,
+            aggregate->signal[PACK_SIGNAL_HIGH_CELL_TEMPERATURE].max);
+
+    predicted_limit[DISCHARGE_LIMIT_SAG] =
+        predict_sag_limit(aggregate, max_current);
+}
+
+
+//=============================================================================
+//
+// predict_trend_limit()
+//
+// The DCL, projected ahead while it is falling. A rising DCL is not
+// projected, the ramp up follows it.
+//
+//=============================================================================
+//
+static uint32_t predict_trend_limit(int32_t dcl)
+{
+    int32_t limit = dcl;
+
+    if (dcl_slope < 0)
+    {
+        limit += (dcl_slope * (DISCHARGE_LIMIT_TREND_HORIZON_MS / 100)) / 10;
+    }
+
+    return (limit > 0) ? (uint32_t)limit : 0;
+}
+
+
+//=============================================================================
+//
+// predict_temperature_limit()
+//
+// The BMS derates the DCL linearly to nothing between the start and
+// stop temperatures. The DCL already carries the derate at the
+// present temperature, so only the further derate between the present
+// and the projected temperature is applied to it.
+//
+//=============================================================================
+//
+static uint32_t predict_temperature_limit(
+    int32_t dcl,
+    int32_t temperature)
+{
+    int32_t start = DISCHARGE_LIMIT_TEMPERATURE_START_C * 10;
+    int32_t stop = DISCHARGE_LIMIT_TEMPERATURE_STOP_C * 10;
+    int32_t present;
+    int32_t projected;
+
+    uint32_t elapsed_ms = time_service_ms_since(period_start_ms);
+
+    if (elapsed_ms >= DISCHARGE_LIMIT_TEMPERATURE_PERIOD_MS)
+    {
+        //
+        // 0.1degC per minute.
+        //
+        int32_t rate =
+            ((temperature - period_start_temperature) * 600000)
+            / (int32_t)elapsed_ms;
+
+        temperature_rate +=
+            (rate - temperature_rate) / DISCHARGE_LIMIT_FILTER_DIVISOR;
+
+        period_start_temperature = temperature;
+        period_start_ms = time_service_get_ms();
+    }
+
+    if (dcl <= 0)
+    {
+        return 0;
+    }
+
+    present = temperature * 10;
+    projected = present;
+
+    if (temperature_rate > 0)
+    {
+        projected +=
+            (temperature_rate * DISCHARGE_LIMIT_TEMPERATURE_HORIZON_S) / 60;
+    }
+
+    if (present < start)
+    {
+        present = start;
+    }
+
+    if (projected < start)
+    {
+        projected = start;
+    }
+
+    //
+    // Already derated to nothing, the DCL is all there is.
+    //
+    if (present >= stop)
+    {
+        return (uint32_t)dcl;
+    }
+
+    if (projected >= stop)
+    {
+        return 0;
+    }
+
+    return (uint32_t)((dcl * (stop - projected)) / (stop - present));
+}
+
+
+//=============================================================================
+//
+// predict_sag_limit()
+//
+// The low cell of a pack sags below its open voltage in proportion to
+// the current. The sag per amp of the total current is learned while
+// the machine is under load, and held when it is not. The limit is
+// the total current that would sag the low cell of the weakest pack
+// to the floor.
+//
+//=============================================================================
+//
+static uint32_t predict_sag_limit(
+    const battery_pack_aggregate_t *aggregate,
+    uint32_t max_current)
+{
+    int32_t total_current = labs(aggregate->signal[PACK_SIGNAL_CURRENT].sum);
+    uint32_t limit = max_current;
+    uint8_t number_of_bms = get_number_of_bms();
+    uint8_t i;
+
+    if (number_of_bms > DISCHARGE_LIMIT_MAX_PACKS)
+    {
+        number_of_bms = DISCHARGE_LIMIT_MAX_PACKS;
+    }
+
+    for (i = 0; i < number_of_bms; i++)
+    {
+        device_instances_t bms = bms_devices[i];
+
+        int32_t current = abs(orion_get_instantaneous_pack_current(bms));
+
+        int32_t open_voltage = orion_get_low_open_cell_voltage(bms);
+        int32_t sag = open_voltage - orion_get_pack_low_cell_voltage(bms);
+        int32_t headroom = open_voltage - DISCHARGE_LIMIT_LOW_CELL_FLOOR;
+        uint32_t pack_limit;
+
+        if ((current >= DISCHARGE_LIMIT_MIN_CURRENT) &&
+            (sag >= DISCHARGE_LIMIT_MIN_SAG))
+        {
+            //
+            // 0.1mV over 0.1A is mOhm, x 1000 for uOhm.
+            //
+            uint32_t resistance = (uint32_t)((sag * 1000) / total_current);
+
+            if (sag_resistance[i] == 0)
+            {
+                sag_resistance[i] = resistance;
+            }
+            else
+            {
+                sag_resistance[i] = (uint32_t)((int32_t)sag_resistance[i] +
+                    ((int32_t)resistance - (int32_t)sag_resistance[i])
+                    / DISCHARGE_LIMIT_FILTER_DIVISOR);
+            }
+        }
+
+        if (sag_resistance[i] == 0)
+        {
+            continue;
+        }
+
+        //
+        // 0.1mV over uOhm, x 1000, is 0.1A.
+        //
+        pack_limit = (headroom > 0)
+                     ? (uint32_t)((headroom * 1000) / sag_resistance[i])
+                     : 0;
+
+        if (pack_limit < limit)
+        {
+            limit = pack_limit;
+        }
+    }
+
+    return limit;
+}
+
+
+//=============================================================================
+//
+// Getters
+//
+//=============================================================================
+//
+uint16_t discharge_limit_predictor_get_current_limit()
+{
+    return current_limit;
+}
+
+uint16_t discharge_limit_predictor_get_predicted_limit(discharge_limit_t limit)
+{
+    if (limit >= NUM_DISCHARGE_LIMITS)
+    {
+        return 0;
+    }
+
+    return (predicted_limit[limit] > 0xFFFF)
+           ? 0xFFFF
+           : (uint16_t)predicted_limit[limit];
+}
@@ -0,0 +1,74 @@
+/******************************************************************************
+ *
+ *        Name: discharge_limit_predictor.h
+ *
+ * Description: Works out the battery current limit of the traction
+ *              inverter from the discharge current limit (DCL) of the
+ *              BMSs, and ramps it down ahead of a drop in the DCL
+ *              instead of following the drop as a step.
+ *
+ *              Each time the BMSs have sent new data, three limits
+ *              are predicted:
+ *
+ *              TREND:       the DCL, projected
+ *                           DISCHARGE_LIMIT_TREND_HORIZON_MS
+ *                           ahead while it is falling.
+ *              TEMPERATURE: the DCL, less the further temperature
+ *                           derate the BMS will apply once the high
+ *                           cell has warmed for
+ *                           DISCHARGE_LIMIT_TEMPERATURE_HORIZON_S
+ *                           at its present rate of rise.
+ *              SAG:         the current that would pull the low cell
+ *                           of a pack down to
+ *                           DISCHARGE_LIMIT_LOW_CELL_FLOOR, from
+ *                           the sag of its low cell under the present
+ *                           current.
+ *
+ *              The limit follows the lowest of the three and
+ *              EEVAR_TRACTION_SKAI_max_battery_current, at no more
+ *              than DISCHARGE_LIMIT_RAMP_DOWN_A_PER_S down and
+ *              DISCHARGE_LIMIT_RAMP_UP_A_PER_S up.
+ *
+ *              The limit is in the units of the battery current sent
+ *              to the inverter, 0.1A.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+
+#ifndef DISCHARGE_LIMIT_PREDICTOR_H_
+#define DISCHARGE_LIMIT_PREDICTOR_H_
+
+typedef enum
+{
+    DISCHARGE_LIMIT_TREND = 0,
+    DISCHARGE_LIMIT_TEMPERATURE,
+    DISCHARGE_LIMIT_SAG,
+    NUM_DISCHARGE_LIMITS
+} discharge_limit_t;
+
+/******************************************************************************
+ *
+ *        Name: discharge_limit_predictor_update()
+ *
+ * Description: Updates the predicted limits when the BMSs have sent
+ *              new data, and ramps the limit. Called once a loop from
+ *              User_App(), before traction_inverter_control().
+ *
+ ******************************************************************************
+ */
+void discharge_limit_predictor_update();
+
+//
+// The battery current limit of the traction inverter, in 0.1A.
+//
+uint16_t discharge_limit_predictor_get_current_limit();
+
+//
+// One of the predicted limits, in 0.1A.
+//
+uint16_t discharge_limit_predictor_get_predicted_limit(discharge_limit_t limit);
+
+#endif // DISCHARGE_LIMIT_PREDICTOR_H_
@@ -0,0 +1,217 @@
+/******************************************************************************
+ *
+ *        Name: orion_cell_dump.c
+ *
+ * Description: Cell table readout over CAN3. See orion_cell_dump.h.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+
+#include "Prototypes.h"
+#include "Prototypes_CAN.h"
+#include "Constants.h"
+#include "typedefs.h"
+#include "can_service.h"
+#include "can_service_devices.h"
+#include "orion_device.h"
+#include "orion_control.h"
+#include "orion_cell_dump.h"
+
+#define ORION_CELL_DUMP_MAX_BMS  3
+
+//=============================================================================
+//
+// Static Variables
+//
+//=============================================================================
+//
+static const device_instances_t bms_devices[ORION_CELL_DUMP_MAX_BMS] =
+{
+    ONE,
+    TWO,
+    THREE
+};
+
+//
+// The BMS being dumped and the last BMS to dump, as indexes of
+// bms_devices. Not dumping when dump_index is past dump_last.
+//
+static uint8_t dump_index = 1;
+static uint8_t dump_last = 0;
+
+//
+// The copy of the cell table of the BMS being dumped, and the next
+// cell to send. The copy is taken when the dump of the BMS starts.
+//
+static bool_t snapshot_taken = FALSE;
+static uint8_t snapshot_length = 0;
+static uint16_t snapshot_voltage_mv[ORION_CELL_TABLE_MAX_CELLS];
+static uint8_t dump_cell = 0;
+
+static void send_header(device_instances_t device);
+static void send_cells(device_instances_t device);
+
+
+//=============================================================================
+//
+// orion_cell_dump_request()
+//
+//=============================================================================
+//
+void orion_cell_dump_request(uint8_t bms)
+{
+    uint8_t number_of_bms = get_number_of_bms();
+
+    if (number_of_bms > ORION_CELL_DUMP_MAX_BMS)
+    {
+        number_of_bms = ORION_CELL_DUMP_MAX_BMS;
+    }
+
+    if (bms == 0)
+    {
+        dump_index = 0;
+        dump_last = number_of_bms - 1;
+    }
+    else if (bms <= number_of_bms)
+    {
+        dump_index = bms - 1;
+        dump_last = bms - 1;
+    }
+    else
+    {
+        return;
+    }
+
+    snapshot_taken = FALSE;
+}
+
+
+/******************************************************************************
+ *
+ *        Name: orion_cell_dump_update()
+ *
+ * Description: Copies the cell table of the next BMS and sends its
+ *              header, then sends its cells a few messages a loop.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+void orion_cell_dump_update()
+{
+    uint8_t i;
+
+    if (dump_index > dump_last)
+    {
+        return;
+    }
+
+    device_instances_t device = bms_devices[dump_index];
+
+    if (!snapshot_taken)
+    {
+        snapshot_length = orion_get_cell_table_length(device);
+
+        for (i = 0; i < snapshot_length; i++)
+        {
+            snapshot_voltage_mv[i] = orion_get_cell_voltage_mv(device, i);
+        }
+
+        dump_cell = 0;
+        snapshot_taken = TRUE;
+
+        send_header(device);
+    }
+
+    for (i = 0;
+         (i < ORION_CELL_DUMP_MESSAGES_PER_LOOP) && (dump_cell < snapshot_length);
+         i++)
+    {
+        send_cells(device);
+        dump_cell += ORION_CELL_DUMP_CELLS_PER_MESSAGE;
+    }
+
+    if (dump_cell >= snapshot_length)
+    {
+        dump_index++;
+        snapshot_taken = FALSE;
+    }
+}
+
+
+//=============================================================================
+//
+// send_header()
+//
+//=============================================================================
+//
+static void send_header(device_instances_t device)
+{
+    Can_Message_ tx_message;
+    can_data_t *data_ptr = (can_data_t *)tx_message.data;
+    uint8_t received = 0;
+    uint8_t i;
+
+    for (i = 0; i < snapshot_length; i++)
+    {
+        if (snapshot_voltage_mv[i] != ORION_CELL_NO_DATA)
+        {
+            received++;
+        }
+    }
+
+    tx_message.length = 8;
+    tx_message.type = EXTENDED;
+    tx_message.identifier = ORION_CELL_DUMP_HEADER_ID;
+
+    data_ptr->MDL.bit8.BYTE0 = (uint8_t)device;
+    data_ptr->MDL.bit8.BYTE1 = snapshot_length;
+    data_ptr->MDL.bit8.BYTE2 = received;
+    data_ptr->MDL.bit8.BYTE3 = 0;
+    data_ptr->MDH.bit8.BYTE0 = 0;
+    data_ptr->MDH.bit8.BYTE1 = 0;
+    data_ptr->MDH.bit8.BYTE2 = 0;
+    data_ptr->MDH.bit8.BYTE3 = 0;
+
+    Send_CAN_Message(0, CAN3, tx_message);
+}
+
+
+//=============================================================================
+//
+// send_cells()
+//
+// Sends the voltages of the cells from dump_cell. Past the end of the
+// table, the message is padded with ORION_CELL_NO_DATA.
+//
+//=============================================================================
+//
+static void send_cells(device_instances_t device)
+{
+    Can_Message_ tx_message;
+    uint8_t i;
+
+    tx_message.length = 8;
+    tx_message.type = EXTENDED;
+    tx_message.identifier = ORION_CELL_DUMP_CELLS_ID;
+
+    tx_message.data[0] = (uint8_t)device;
+    tx_message.data[1] = dump_cell;
+
+    for (i = 0; i < ORION_CELL_DUMP_CELLS_PER_MESSAGE; i++)
+    {
+        uint16_t cell = (uint16_t)dump_cell + i;
+        uint16_t voltage_mv = (cell < snapshot_length)
+                              ? snapshot_voltage_mv[cell]
+                              : ORION_CELL_NO_DATA;
+
+        tx_message.data[2 + (2 * i)] = (uint8_t)(voltage_mv & 0xFF);
+        tx_message.data[3 + (2 * i)] = (uint8_t)(voltage_mv >> 8);
+    }
+
+    Send_CAN_Message(0, CAN3, tx_message);
+}
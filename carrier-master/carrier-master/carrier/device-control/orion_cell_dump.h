@@ -0,0 +1,54 @@
+/******************************************************************************
+ *
+ *        Name: orion_cell_dump.h
+ *
+ * Description: Reads the cell table of each Orion BMS out over CAN3,
+ *              so the voltage of every cell can be logged from any
+ *              machine with a CAN interface.
+ *
+ *              A message with the id ORION_CELL_DUMP_REQUEST_ID
+ *              starts a dump. Byte 0 of the request is the BMS to
+ *              dump, 1 to 3, or 0 for every BMS. For each BMS, the
+ *              table is copied when its dump starts, so the whole
+ *              dump is of the same instant, and sent as:
+ *
+ *              0xF010: BMS, table length, cells received
+ *              0xF011: BMS, first cell, then the voltage of that cell
+ *                      and the next two, 16 bits each, in mV. 0 is a
+ *                      cell that has not been received.
+ *
+ *              ORION_CELL_DUMP_MESSAGES_PER_LOOP 0xF011 messages are
+ *              sent a loop, so a BMS of 180 cells takes 100ms.
+ *
+ *              16-bit values are little endian, as the other CAN3
+ *              messages.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+
+#ifndef ORION_CELL_DUMP_H_
+#define ORION_CELL_DUMP_H_
+
+#define ORION_CELL_DUMP_REQUEST_ID         0xF00F
+#define ORION_CELL_DUMP_HEADER_ID          0xF010
+#define ORION_CELL_DUMP_CELLS_ID           0xF011
+
+#define ORION_CELL_DUMP_CELLS_PER_MESSAGE  3
+#define ORION_CELL_DUMP_MESSAGES_PER_LOOP  6
+
+//
+// Start a dump of the cell table of a BMS, 0 for every BMS. Called
+// when the dump request message is received.
+//
+void orion_cell_dump_request(uint8_t bms);
+
+//
+// Sends the next messages of a dump in progress. Called once a loop
+// from User_App().
+//
+void orion_cell_dump_update();
+
+#endif // ORION_CELL_DUMP_H_
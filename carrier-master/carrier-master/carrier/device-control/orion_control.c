@@ -23,8 +23,8 @@
 #include "orion_control.h"
 #include "orion_device.h"
 #include "fvt_library.h"
-#include "timer_service.h"
 #include "state_machine.h"
+#include "time_service.h"
 
 #define EEVAR_MAX_BATTERY_PACKS                      3
 #define EEVAR_MAX_HIGH_CELL_TEMP_THRESHOLD           40
@@ -33,140 +33,270 @@
 #define EEVAR_DISPLAY_SOC_SCALER_B_TERM              -28.5
 #define EEVAR_BALANCING_CURRENT_SET_LIMIT            20
 
+//
+// The BMS of each battery pack.
+//
+static const device_instances_t battery_pack_bms[EEVAR_MAX_BATTERY_PACKS] =
+{
+    ONE,
+    TWO,
+    THREE
+};
+
+//
+// The pack aggregate, see get_battery_pack_aggregate().
+//
+static battery_pack_aggregate_t pack_aggregate;
+
 static bool_t differences_in_pack_voltages_within_limit();
+static void update_battery_pack_aggregate();
+static void aggregate_pack_signal(
+    pack_signal_aggregate_t *aggregate,
+    const int32_t values[EEVAR_MAX_BATTERY_PACKS]);
 
 
 /******************************************************************************
  *
- *        Name: get_battery_pack_voltage()
+ *        Name: get_battery_pack_aggregate()
  *
- * Description:
+ * Description: Returns the pack aggregate, updated first if new BMS
+ *              data has been received since it was last computed.
  *
- *        Date: Tuesday, 03 September 2019
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
  *
  ******************************************************************************
  */
-uint16_t get_battery_pack_voltage()
+const battery_pack_aggregate_t *get_battery_pack_aggregate()
 {
+    update_battery_pack_aggregate();
 
-    //
-    // Pack 1 Voltage
-    //
-    uint16_t pack1_voltage =
-        orion_get_instantaneous_pack_voltage(ONE);
-
-    //
-    // Pack 2 Voltage
-    //
-    uint16_t pack2_voltage =
-        orion_get_instantaneous_pack_voltage(TWO);
+    return &pack_aggregate;
+}
 
-    //
-    // Pack 3 Voltage
-    //
-    uint16_t pack3_voltage =
-        orion_get_instantaneous_pack_voltage(THREE);
 
-    //
-    // Average Voltage of three packs
-    //
-    uint16_t average_pack_voltage =
-        (uint16_t)((pack1_voltage + pack2_voltage + pack3_voltage) / EEVAR_MAX_BATTERY_PACKS);
+//=============================================================================
+//
+// get_battery_pack_data_change_count()
+//
+//=============================================================================
+//
+uint32_t get_battery_pack_data_change_count()
+{
+    uint32_t change_count = 0;
+    uint8_t i;
 
-    //
-    // return the average voltage of the packs
-    //
-    return average_pack_voltage;
+    for (i = 0; i < EEVAR_MAX_BATTERY_PACKS; i++)
+    {
+        change_count += orion_get_pack_data_change_count(battery_pack_bms[i]);
+    }
 
+    return change_count;
 }
 
 
 /******************************************************************************
  *
- *        Name: get_instantaneous_battery_pack_current()
+ *        Name: update_battery_pack_aggregate()
  *
- * Description: Returns the total current sourced by the battery pack.
+ * Description: Reads every signal of every BMS once and computes the
+ *              sum, mean, min and max of each signal across the
+ *              packs, with the pack the min and max came from.
  *
- *        Date: Friday, 30 August 2019
+ *              The BMS values only change when a pack data message
+ *              is received or times out, so the aggregate is only
+ *              computed when get_battery_pack_data_change_count()
+ *              has moved, and no more than once a loop.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
  *
  ******************************************************************************
  */
-int16_t get_instantaneous_battery_pack_current()
+static void update_battery_pack_aggregate()
 {
+    static bool_t first_pass = TRUE;
+    static uint32_t last_change_count = 0;
+    static uint32_t last_update_ms = 0;
+    static uint8_t last_rolling_counter[EEVAR_MAX_BATTERY_PACKS];
+
+    int32_t values[NUM_PACK_SIGNALS][EEVAR_MAX_BATTERY_PACKS];
+    uint32_t change_count = get_battery_pack_data_change_count();
+    uint32_t now_ms = time_service_get_ms();
+    uint8_t signal;
+    uint8_t rolling_counter;
+    uint8_t i;
+
+    if (!first_pass &&
+        ((change_count == last_change_count) ||
+         (now_ms == last_update_ms)))
+    {
+        return;
+    }
 
-    //
-    // Instantaneous current of battery pack 1
-    //
-    int16_t instantaneous_pack_1_current =
-        orion_get_instantaneous_pack_current(ONE);
+    first_pass = FALSE;
+    last_change_count = change_count;
+    last_update_ms = now_ms;
 
-    //
-    // Instantaneous current of battery pack 2
-    //
-    int16_t instantaneous_pack_2_current =
-        orion_get_instantaneous_pack_current(TWO);
+    for (i = 0; i < EEVAR_MAX_BATTERY_PACKS; i++)
+    {
+        device_instances_t bms = battery_pack_bms[i];
 
-    //
-    // Instantaneous current of battery pack 3
-    //
-    int16_t instantaneous_pack_3_current =
-        orion_get_instantaneous_pack_current(THREE);
+        values[PACK_SIGNAL_VOLTAGE][i] =
+            orion_get_instantaneous_pack_voltage(bms);
 
-    //
-    // Total Pack Current
-    //
-    int16_t instantaneous_battery_pack_current =
-        (instantaneous_pack_1_current
-         + instantaneous_pack_2_current
-         + instantaneous_pack_3_current);
+        values[PACK_SIGNAL_CURRENT][i] =
+            orion_get_instantaneous_pack_current(bms);
 
-    //
-    // Return the total battery current sourced by the battery pack
-    //
-    return instantaneous_battery_pack_current;
+        values[PACK_SIGNAL_HIGH_CELL_VOLTAGE][i] =
+            orion_get_pack_high_cell_voltage(bms);
+
+        values[PACK_SIGNAL_LOW_CELL_VOLTAGE][i] =
+            orion_get_pack_low_cell_voltage(bms);
 
+        values[PACK_SIGNAL_HIGH_CELL_TEMPERATURE][i] =
+            orion_get_pack_high_cell_temperature(bms);
+
+        values[PACK_SIGNAL_LOW_CELL_TEMPERATURE][i] =
+            orion_get_pack_low_cell_temperature(bms);
+
+        values[PACK_SIGNAL_INTERNAL_TEMPERATURE][i] =
+            orion_get_internal_bms_temperature(bms);
+
+        values[PACK_SIGNAL_SOC][i] =
+            orion_get_state_of_charge(bms);
+
+        values[PACK_SIGNAL_AMP_HOURS][i] =
+            orion_get_pack_amp_hours(bms);
+
+        values[PACK_SIGNAL_CHARGE_CURRENT_LIMIT][i] =
+            orion_get_pack_charge_current_limit(bms);
+
+        values[PACK_SIGNAL_DISCHARGE_CURRENT_LIMIT][i] =
+            orion_get_pack_discharge_current_limit(bms);
+
+        //
+        // The rolling counter goes up by one every broadcast cycle,
+        // and wraps at 255.
+        //
+        rolling_counter = orion_get_rolling_counter(bms);
+        pack_aggregate.frame_count +=
+            (uint8_t)(rolling_counter - last_rolling_counter[i]);
+        last_rolling_counter[i] = rolling_counter;
+    }
+
+    for (signal = 0; signal < NUM_PACK_SIGNALS; signal++)
+    {
+        aggregate_pack_signal(&pack_aggregate.signal[signal],
+                              values[signal]);
+    }
+}
+
+
+//=============================================================================
+//
+// aggregate_pack_signal()
+//
+//=============================================================================
+//
+static void aggregate_pack_signal(
+    pack_signal_aggregate_t *aggregate,
+    const int32_t values[EEVAR_MAX_BATTERY_PACKS])
+{
+    uint8_t i;
+
+    aggregate->sum = values[0];
+    aggregate->min = values[0];
+    aggregate->max = values[0];
+    aggregate->argmin = battery_pack_bms[0];
+    aggregate->argmax = battery_pack_bms[0];
+
+    for (i = 1; i < EEVAR_MAX_BATTERY_PACKS; i++)
+    {
+        aggregate->sum += values[i];
+
+        if (values[i] < aggregate->min)
+        {
+            aggregate->min = values[i];
+            aggregate->argmin = battery_pack_bms[i];
+        }
+
+        if (values[i] > aggregate->max)
+        {
+            aggregate->max = values[i];
+            aggregate->argmax = battery_pack_bms[i];
+        }
+    }
+
+    aggregate->mean = aggregate->sum / EEVAR_MAX_BATTERY_PACKS;
+}
+
+
+//=============================================================================
+//
+// get_number_of_bms()
+//
+//=============================================================================
+//
+uint8_t get_number_of_bms()
+{
+    return EEVAR_MAX_BATTERY_PACKS;
 }
 
 
 /******************************************************************************
  *
- *        Name: get_high_cell_voltage()
+ *        Name: get_battery_pack_voltage()
  *
- * Description: Returns the highest cell voltage of the three battery
+ * Description: Returns the average voltage of the three battery
  *              packs.
  *
- *        Date: Friday, 30 August 2019
+ *        Date: Tuesday, 03 September 2019
  *
  ******************************************************************************
  */
-uint16_t get_pack_high_cell_voltage()
+uint16_t get_battery_pack_voltage()
 {
+    const battery_pack_aggregate_t *aggregate = get_battery_pack_aggregate();
 
-    //
-    // Pack1 High Cell Voltage
-    //
-    uint16_t pack_1_high_cell = orion_get_pack_high_cell_voltage(ONE);
+    return (uint16_t)aggregate->signal[PACK_SIGNAL_VOLTAGE].mean;
+}
 
-    //
-    // Pack2 High Cell Voltage
-    //
-    uint16_t pack_2_high_cell = orion_get_pack_high_cell_voltage(TWO);
 
-    //
-    // Pack3 High Cell Voltage
-    //
-    uint16_t pack_3_high_cell = orion_get_pack_high_cell_voltage(THREE);
+/******************************************************************************
+ *
+ *        Name: get_instantaneous_battery_pack_current()
+ *
+ * Description: Returns the total current sourced by the battery pack.
+ *
+ *        Date: Friday, 30 August 2019
+ *
+ ******************************************************************************
+ */
+int16_t get_instantaneous_battery_pack_current()
+{
+    const battery_pack_aggregate_t *aggregate = get_battery_pack_aggregate();
+
+    return (int16_t)aggregate->signal[PACK_SIGNAL_CURRENT].sum;
+}
 
-    //
-    // Return the min unsigned number
-    //
-    uint16_t pack_high_cell_voltage = max_of_three_uint16_t_values(
-        pack_1_high_cell,
-        pack_2_high_cell,
-        pack_3_high_cell);
 
-    return pack_high_cell_voltage;
+/******************************************************************************
+ *
+ *        Name: get_high_cell_voltage()
+ *
+ * Description: Returns the highest cell voltage of the three battery
+ *              packs.
+ *
+ *        Date: Friday, 30 August 2019
+ *
+ ******************************************************************************
+ */
+uint16_t get_pack_high_cell_voltage()
+{
+    const battery_pack_aggregate_t *aggregate = get_battery_pack_aggregate();
 
+    return (uint16_t)aggregate->signal[PACK_SIGNAL_HIGH_CELL_VOLTAGE].max;
 }
 
 
@@ -183,34 +313,9 @@ uint16_t get_pack_high_cell_voltage()
  */
 uint16_t get_pack_low_cell_voltage()
 {
+    const battery_pack_aggregate_t *aggregate = get_battery_pack_aggregate();
 
-    uint16_t pack_low_cell_voltage = 0;
-
-    //
-    // Pack1 Low Cell Voltage
-    //
-    uint16_t pack_1_low_cell = orion_get_pack_low_cell_voltage(ONE);
-
-    //
-    // Pack2 Low Cell Voltage
-    //
-    uint16_t pack_2_low_cell = orion_get_pack_low_cell_voltage(TWO);
-
-    //
-    // Pack3 Low Cell Voltage
-    //
-    uint16_t pack_3_low_cell = orion_get_pack_low_cell_voltage(THREE);
-
-    //
-    // Return the min unsigned number.
-    //
-    pack_low_cell_voltage = min_of_three_uint16_t_values(
-        pack_1_low_cell,
-        pack_2_low_cell,
-        pack_3_low_cell);
-
-    return pack_low_cell_voltage;
-
+    return (uint16_t)aggregate->signal[PACK_SIGNAL_LOW_CELL_VOLTAGE].min;
 }
 
 
@@ -226,38 +331,9 @@ uint16_t get_pack_low_cell_voltage()
  */
 int8_t get_battery_pack_high_cell_max_temperature()
 {
+    const battery_pack_aggregate_t *aggregate = get_battery_pack_aggregate();
 
-    //
-    // High cell temperature of pack 1
-    //
-    int8_t high_cell_temp_1 =
-        orion_get_pack_high_cell_temperature(ONE);
-
-    //
-    // High cell temperature of pack 2
-    //
-    int8_t high_cell_temp_2 =
-        orion_get_pack_high_cell_temperature(TWO);
-
-    //
-    // High cell temperature of pack 3
-    //
-    int8_t high_cell_temp_3 =
-        orion_get_pack_high_cell_temperature(THREE);
-
-    //
-    // Return the min unsigned number
-    //
-    int8_t pack_max_temperature = max_of_three_int8_t_values(
-        high_cell_temp_1,
-        high_cell_temp_2,
-        high_cell_temp_3);
-
-    //
-    // Return the max cell temprature of the battery pack
-    //
-    return pack_max_temperature;
-
+    return (int8_t)aggregate->signal[PACK_SIGNAL_HIGH_CELL_TEMPERATURE].max;
 }
 
 
@@ -273,39 +349,9 @@ int8_t get_battery_pack_high_cell_max_temperature()
  */
 int8_t get_battery_pack_low_cell_max_temperature()
 {
+    const battery_pack_aggregate_t *aggregate = get_battery_pack_aggregate();
 
-    int8_t pack_max_temperature = 0;
-
-    //
-    // Low cell temperature of pack 1
-    //
-    int8_t low_cell_temp_1 =
-        orion_get_pack_low_cell_temperature(ONE);
-
-    //
-    // Low cell temperature of pack 2
-    //
-    int8_t low_cell_temp_2 =
-        orion_get_pack_low_cell_temperature(TWO);
-
-    //
-    // Low cell temperature of pack 3
-    //
-    int8_t low_cell_temp_3 =
-        orion_get_pack_low_cell_temperature(THREE);
-
-    //
-    // Get the max temperature of three battery packs
-    //
-    pack_max_temperature = max_of_three_int8_t_values(low_cell_temp_1,
-    												  low_cell_temp_2,
-    												  low_cell_temp_3);
-
-    //
-    // Return the pack min temperature of the battery pack.
-    //
-    return pack_max_temperature;
-
+    return (int8_t)aggregate->signal[PACK_SIGNAL_LOW_CELL_TEMPERATURE].max;
 }
 
 
@@ -322,34 +368,9 @@ int8_t get_battery_pack_low_cell_max_temperature()
  */
 uint8_t get_battery_pack_SOC()
 {
-	uint16_t battery_pack_SOC = 0;
-
-    //
-    // Pack 1 Voltage
-    //
-    uint8_t pack_1_SOC =
-        orion_get_state_of_charge(ONE);
-
-    //
-    // Pack 2 SOC
-    //
-    uint8_t pack_2_SOC =
-        orion_get_state_of_charge(TWO);
-
-    //
-    // Pack 3 SOC
-    //
-    uint8_t pack_3_SOC =
-        orion_get_state_of_charge(THREE);
-
-    battery_pack_SOC =
-        (pack_1_SOC + pack_2_SOC + pack_3_SOC) / EEVAR_MAX_BATTERY_PACKS;
-
-    //
-    // Return the average of pack SOCs
-    //
-    return (uint8_t)battery_pack_SOC;
+    const battery_pack_aggregate_t *aggregate = get_battery_pack_aggregate();
 
+    return (uint8_t)aggregate->signal[PACK_SIGNAL_SOC].mean;
 }
 
 
@@ -460,40 +481,23 @@ static bool_t differences_in_pack_voltages_within_limit()
 {
 
     bool_t status = FALSE;
-    uint16_t allowable_voltage_difference = 20;
-
-    //
-    // Pack 1 Voltage
-    //
-    uint16_t pack1_voltage =
-        (uint16_t)orion_get_instantaneous_pack_voltage(ONE);
-
-    //
-    // Pack 2 Voltage
-    //
-    uint16_t pack2_voltage =
-        (uint16_t)orion_get_instantaneous_pack_voltage(TWO);
-
-    //
-    // Pack 3 Voltage
-    //
-    uint16_t pack3_voltage =
-        (uint16_t)orion_get_instantaneous_pack_voltage(THREE);
+    uint16_t allowable_voltage_difference =
+        EEVAR_ALLOWABLE_PACK_VOLTAGE_DIFFERENCE_V;
 
+    const battery_pack_aggregate_t *aggregate = get_battery_pack_aggregate();
 
     //
     // Get the minimum pack voltage between the three packs
     //
-    uint16_t min_of_three_packs = min_of_three_uint16_t_values(pack1_voltage,
-                                                             pack2_voltage,
-                                                             pack3_voltage);
+    uint16_t min_of_three_packs =
+        (uint16_t)aggregate->signal[PACK_SIGNAL_VOLTAGE].min;
 
     //
     // Get the maximum pack voltage between the three packs
     //
-    uint16_t max_of_three_packs = max_of_three_uint16_t_values(pack1_voltage,
-                                                             pack2_voltage,
-                                                             pack3_voltage);
+    uint16_t max_of_three_packs =
+        (uint16_t)aggregate->signal[PACK_SIGNAL_VOLTAGE].max;
+
     //
     // Get the difference between the minimum and max pack voltage.
     //
@@ -531,6 +535,46 @@ static bool_t differences_in_pack_voltages_within_limit()
 }
 
 
+/******************************************************************************
+ *
+ *        Name: battery_pack_voltages_matched()
+ *
+ * Description: Two battery packs may only be connected in parallel
+ *              if their voltages are within the same limit as
+ *              differences_in_pack_voltages_within_limit(), or there
+ *              would be a large circulating current between them.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+bool_t battery_pack_voltages_matched(
+    device_instances_t pack,
+    device_instances_t reference_pack)
+{
+    //
+    // Pack voltages are in 0.1V.
+    //
+    uint16_t pack_voltage =
+        (uint16_t)orion_get_instantaneous_pack_voltage(pack);
+
+    uint16_t reference_voltage =
+        (uint16_t)orion_get_instantaneous_pack_voltage(reference_pack);
+
+    //
+    // The larger less the smaller, so the difference never goes
+    // through a signed int, which is 16 bits on the C2000.
+    //
+    uint16_t difference_in_voltage =
+        (pack_voltage > reference_voltage)
+            ? (uint16_t)((pack_voltage - reference_voltage) / 10)
+            : (uint16_t)((reference_voltage - pack_voltage) / 10);
+
+    return (difference_in_voltage <= EEVAR_ALLOWABLE_PACK_VOLTAGE_DIFFERENCE_V);
+}
+
+
 /******************************************************************************
  *
  *        Name: bms_fan_controls
@@ -555,21 +599,12 @@ bool_t bms_fan_controls()
     int8_t max_high_cell_temp =
         get_battery_pack_high_cell_max_temperature();
 
-    //
-    // Check the max internal temperature of the battery pack.
-    //
-    int8_t pack1_internal_temp = (int8_t)orion_get_internal_bms_temperature(ONE);
-    int8_t pack2_internal_temp = (int8_t)orion_get_internal_bms_temperature(TWO);
-    int8_t pack3_internal_temp = (int8_t)orion_get_internal_bms_temperature(THREE);
-
     //
     // Obtain the max internal tenperatures between the three battery
     // packs.
     //
-    int8_t max_internal_temperature = max_of_three_int8_t_values(
-        pack1_internal_temp,
-        pack2_internal_temp,
-        pack3_internal_temp);
+    int8_t max_internal_temperature = (int8_t)get_battery_pack_aggregate()->
+        signal[PACK_SIGNAL_INTERNAL_TEMPERATURE].max;
 
     //
     // Check to see if the the max high cell temperature and the max
@@ -706,186 +741,26 @@ uint8_t get_screen_SOC()
 }
 
 
-/******************************************************************************
- *
- *        Name: get_range_in_minutes_flats()
- *
- * Description: Calculate the range the vehicle can drive in minutes.
- *
- *        Date: Wednesday, 04 September 2019
- *
- ******************************************************************************
- */
-uint16_t get_range_in_minutes_flats()
-{
-    float range_in_minutes = 0;
-
-    //
-    // Based on Empirical Data
-    //
-    float scaling_factor = 2.1;
-
-    //
-    // Obtain the average SOC of the three battery packs
-    //
-    uint16_t bms_reported_soc = (uint16_t)get_battery_pack_SOC();
-
-    //
-    // Calculate the amount of time left to drive in minutes.
-    //
-    range_in_minutes =
-        bms_reported_soc * scaling_factor * EEVAR_MAX_BATTERY_PACKS;
-
-    //
-    // Return the driving range of the vehicle in minutes.
-    //
-    return (uint16_t)range_in_minutes;
-
-}
-
-
-/******************************************************************************
- *
- *        Name: get_range_in_minutes_slopes()
- *
- * Description: Calculate the range the vehicle can drive in minutes.
- *
- *        Date: Wednesday, 04 September 2019
- *
- ******************************************************************************
- */
-uint16_t get_range_in_minutes_slopes()
-{
-    float range_in_minutes = 0;
-
-    //
-    // Based on Empirical Data
-    //
-    float scaling_factor = 0.6;
-
-    //
-    // Obtain the average SOC of the three battery packs
-    //
-    uint16_t bms_reported_soc = (uint16_t)get_battery_pack_SOC();
-
-    //
-    // Calculate the amount of time left to drive in minutes.
-    //
-    range_in_minutes =
-        bms_reported_soc * scaling_factor * EEVAR_MAX_BATTERY_PACKS;
-
-    //
-    // Return the driving range of the vehicle in minutes.
-    //
-    return (uint16_t)range_in_minutes;
-
-}
-
-
 //=============================================================================
 //
 // bms_fresh_data()
 //
+// TRUE while the rolling counter of the BMS has advanced within
+// BMS_FRESH_DATA_MAX_AGE_MS (orion_get_rx_age_ms()).
+//
 //=============================================================================
 //
 bool_t bms_fresh_data_1()
 {
-
-    static timer_t fresh_data;
-    static bool_t first_pass = TRUE;
-    static uint8_t rolling_counter_prev = 0;
-    bool_t fresh_data_status = TRUE;
-
-
-    if(first_pass == TRUE)
-    {
-        //
-        // five_seconds
-        //
-        fresh_data = timer_setup(get_FIVE_SECONDS(), RISING);
-        first_pass = FALSE;
-
-    }
-
-    uint8_t rolling_counter = orion_get_rolling_counter(ONE);
-
-    fresh_data_status = !timer_operate(&fresh_data,
-                                       (rolling_counter_prev == rolling_counter));
-
-    rolling_counter_prev = rolling_counter;
-
-    return fresh_data_status;
-
+    return (orion_get_rx_age_ms(ONE) < BMS_FRESH_DATA_MAX_AGE_MS);
 }
 
-//=============================================================================
-//
-// bms_fresh_data()
-//
-//=============================================================================
-//
 bool_t bms_fresh_data_2()
 {
-
-    static timer_t fresh_data;
-    static bool_t first_pass = TRUE;
-    static uint8_t rolling_counter_prev = 0;
-    bool_t fresh_data_status = TRUE;
-
-
-    if(first_pass == TRUE)
-    {
-        //
-        // five_seconds
-        //
-        fresh_data = timer_setup(get_FIVE_SECONDS(), RISING);
-        first_pass = FALSE;
-
-    }
-
-    uint8_t rolling_counter = orion_get_rolling_counter(TWO);
-
-    fresh_data_status = !timer_operate(&fresh_data,
-                                       (rolling_counter_prev == rolling_counter));
-
-    rolling_counter_prev = rolling_counter;
-
-    return fresh_data_status;
-
+    return (orion_get_rx_age_ms(TWO) < BMS_FRESH_DATA_MAX_AGE_MS);
 }
 
-//=============================================================================
-//
-// bms_fresh_data()
-//
-//=============================================================================
-//
 bool_t bms_fresh_data_3()
 {
-
-    static timer_t fresh_data;
-    static bool_t first_pass = TRUE;
-    static uint8_t rolling_counter_prev = 0;
-    bool_t fresh_data_status = TRUE;
-
-
-    if(first_pass == TRUE)
-    {
-        //
-        // five_seconds
-        //
-        fresh_data = timer_setup(get_FIVE_SECONDS(), RISING);
-        first_pass = FALSE;
-
-    }
-
-    uint8_t rolling_counter = orion_get_rolling_counter(THREE);
-
-    fresh_data_status = !timer_operate(&fresh_data,
-                                       (rolling_counter_prev == rolling_counter));
-
-    rolling_counter_prev = rolling_counter;
-
-    return fresh_data_status;
-
+    return (orion_get_rx_age_ms(THREE) < BMS_FRESH_DATA_MAX_AGE_MS);
 }
@@ -13,6 +13,74 @@
 #ifndef ORION_CONTROL_H_
 #define ORION_CONTROL_H_
 
+//
+// The battery packs are in parallel, and their voltages must be within
+// this of each other.
+//
+#define EEVAR_ALLOWABLE_PACK_VOLTAGE_DIFFERENCE_V    20
+
+
+//=============================================================================
+//
+// Battery Pack Aggregate
+//
+// Every signal of the three BMSs is read once and combined into one
+// aggregate, recomputed only when new BMS data has been received and
+// no more than once a loop. All the pack getters below read from it.
+//
+//=============================================================================
+//
+typedef enum
+{
+    PACK_SIGNAL_VOLTAGE = 0,                // 0.1V
+    PACK_SIGNAL_CURRENT,                    // 0.1A
+    PACK_SIGNAL_HIGH_CELL_VOLTAGE,          // 0.1mV
+    PACK_SIGNAL_LOW_CELL_VOLTAGE,           // 0.1mV
+    PACK_SIGNAL_HIGH_CELL_TEMPERATURE,      // degC
+    PACK_SIGNAL_LOW_CELL_TEMPERATURE,       // degC
+    PACK_SIGNAL_INTERNAL_TEMPERATURE,       // degC
+    PACK_SIGNAL_SOC,                        // %
+    PACK_SIGNAL_AMP_HOURS,                  // 0.1Ah remaining
+    PACK_SIGNAL_CHARGE_CURRENT_LIMIT,       // A
+    PACK_SIGNAL_DISCHARGE_CURRENT_LIMIT,    // A
+    NUM_PACK_SIGNALS
+} pack_signal_t;
+
+//
+// One signal across the packs. argmin and argmax are the BMS the min
+// and max were read from, the first one on a tie.
+//
+typedef struct
+{
+    int32_t sum;
+    int32_t mean;
+    int32_t min;
+    int32_t max;
+    device_instances_t argmin;
+    device_instances_t argmax;
+} pack_signal_aggregate_t;
+
+typedef struct
+{
+    pack_signal_aggregate_t signal[NUM_PACK_SIGNALS];
+
+    //
+    // Counts the 100ms broadcast cycles of the BMSs, from their
+    // rolling counters, so a consumer can tell when new BMS data has
+    // arrived.
+    //
+    uint32_t frame_count;
+} battery_pack_aggregate_t;
+
+const battery_pack_aggregate_t *get_battery_pack_aggregate();
+
+//
+// The sum of orion_get_pack_data_change_count() over the packs. It
+// moves whenever any of the data the aggregate is computed from may
+// have changed.
+//
+uint32_t get_battery_pack_data_change_count();
+
 
 //=============================================================================
 //
@@ -91,37 +159,45 @@ bool_t get_battery_pack_error_status(device_instances_t device);
 
 //=============================================================================
 //
-// Returns true if any of the BMS thresholds has been exceeded.
+// Returns true if the voltages of the two packs are close enough for
+// them to be connected in parallel.
 //
 //=============================================================================
 //
-bool_t bms_fan_controls();
+bool_t battery_pack_voltages_matched(device_instances_t pack,
+                                     device_instances_t reference_pack);
 
 
 //=============================================================================
 //
-// Enable and disable cell balancing of the three battery packs.
+// Returns true if any of the BMS thresholds has been exceeded.
 //
 //=============================================================================
 //
-void enable_cell_balancing();
+bool_t bms_fan_controls();
 
 
 //=============================================================================
 //
-// Driving Range in minutes
+// Enable and disable cell balancing of the three battery packs.
 //
 //=============================================================================
 //
-uint16_t get_range_in_minutes_flats();
-uint16_t get_range_in_minutes_slopes();
+void enable_cell_balancing();
+
 
 //=============================================================================
 //
 // BMS_Fresh Data
 //
+// The data of a BMS is fresh while the rolling counter in its cycle
+// data has advanced within BMS_FRESH_DATA_MAX_AGE_MS. Until the first
+// message, the age runs from the initialisation of the BMS.
+//
 //=============================================================================
 //
+#define BMS_FRESH_DATA_MAX_AGE_MS  5000
+
 bool_t bms_fresh_data_1();
 bool_t bms_fresh_data_2();
 bool_t bms_fresh_data_3();
@@ -0,0 +1,422 @@
+/******************************************************************************
+ *
+ *        Name: pack_divergence.c
+ *
+ * Description: Online pack divergence statistics. See
+ *              pack_divergence.h.
+ *
+ *              The EWMA has a time constant of about a minute and its
+ *              drift is measured over five minute periods, so the
+ *              noise of the BMS readings is well under the drift
+ *              rates that matter, which are over hours.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include "Prototypes.h"
+#include "Constants.h"
+#include "typedefs.h"
+#include "can_service.h"
+#include "time_service.h"
+#include "orion_device.h"
+#include "orion_control.h"
+#include "pack_divergence.h"
+
+//
+// Limits of each signal, in the units of the signal. The cell spread
+// limit is the cell delta warning of fault_manager.c.
+//
+#define PACK_DIVERGENCE_CELL_SPREAD_MV            175
+#define PACK_DIVERGENCE_RESISTANCE_MOHM           0.5f
+#define PACK_DIVERGENCE_TEMPERATURE_C             10
+
+//
+// A pack is flagged once past PACK_DIVERGENCE_WARN_FRACTION of a
+// limit, or when it is projected to reach the limit within the
+// horizon and is at least PACK_DIVERGENCE_FLOOR_FRACTION of the way
+// there. It is cleared once back under PACK_DIVERGENCE_CLEAR_FRACTION
+// and no longer projected to reach the limit.
+//
+#define PACK_DIVERGENCE_WARN_FRACTION             0.5f
+#define PACK_DIVERGENCE_CLEAR_FRACTION            0.4f
+#define PACK_DIVERGENCE_FLOOR_FRACTION            0.1f
+
+//
+// A projection is only trusted once the drift over the horizon is
+// PACK_DIVERGENCE_NOISE_SIGMAS standard deviations of the samples.
+//
+#define PACK_DIVERGENCE_NOISE_SIGMAS              3.0f
+
+//
+// No flags until five minutes of samples have been taken.
+//
+#define PACK_DIVERGENCE_MIN_SAMPLES               3000
+
+#define PACK_DIVERGENCE_EWMA_ALPHA                (1.0f / 600.0f)
+#define PACK_DIVERGENCE_DRIFT_PERIOD_MS           300000
+#define PACK_DIVERGENCE_DRIFT_ALPHA               0.25f
+
+#define MS_PER_HOUR                               3600000.0f
+
+//=============================================================================
+//
+// Static Variables
+//
+//=============================================================================
+//
+static const device_instances_t pack_bms[PACK_DIVERGENCE_MAX_PACKS] =
+{
+    ONE,
+    TWO,
+    THREE
+};
+
+static const float divergence_limit[NUM_PACK_DIVERGENCE_SIGNALS] =
+{
+    [PACK_DIVERGENCE_VOLTAGE]     = EEVAR_ALLOWABLE_PACK_VOLTAGE_DIFFERENCE_V,
+    [PACK_DIVERGENCE_CELL_SPREAD] = PACK_DIVERGENCE_CELL_SPREAD_MV,
+    [PACK_DIVERGENCE_RESISTANCE]  = PACK_DIVERGENCE_RESISTANCE_MOHM,
+    [PACK_DIVERGENCE_TEMPERATURE] = PACK_DIVERGENCE_TEMPERATURE_C,
+};
+
+typedef struct
+{
+    pack_divergence_stats_t stats;
+
+    //
+    // The EWMA at the start of the drift period.
+    //
+    float drift_reference;
+} divergence_tracker_t;
+
+static divergence_tracker_t trackers[PACK_DIVERGENCE_MAX_PACKS][NUM_PACK_DIVERGENCE_SIGNALS];
+static uint8_t pack_flags[PACK_DIVERGENCE_MAX_PACKS];
+
+static uint32_t last_frame_count = 0;
+static uint32_t drift_period_start_ms = 0;
+
+static float get_median(const float values[PACK_DIVERGENCE_MAX_PACKS]);
+static void add_sample(divergence_tracker_t *tracker, float sample);
+static void update_drift(divergence_tracker_t *tracker, uint32_t period_ms);
+static bool_t evaluate_flag(
+    bool_t flagged,
+    const pack_divergence_stats_t *stats,
+    float limit);
+
+
+/******************************************************************************
+ *
+ *        Name: pack_divergence_update()
+ *
+ * Description: See pack_divergence.h.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+void pack_divergence_update()
+{
+    static bool_t first_pass = TRUE;
+
+    float values[NUM_PACK_DIVERGENCE_SIGNALS][PACK_DIVERGENCE_MAX_PACKS];
+    float medians[NUM_PACK_DIVERGENCE_SIGNALS];
+    uint32_t frame_count = get_battery_pack_aggregate()->frame_count;
+    uint32_t period_ms;
+    uint8_t signal;
+    uint8_t i;
+
+    if (first_pass)
+    {
+        drift_period_start_ms = time_service_get_ms();
+        first_pass = FALSE;
+    }
+
+    if (frame_count == last_frame_count)
+    {
+        return;
+    }
+
+    last_frame_count = frame_count;
+
+    for (i = 0; i < PACK_DIVERGENCE_MAX_PACKS; i++)
+    {
+        device_instances_t bms = pack_bms[i];
+
+        //
+        // 0.1V, 0.1mV and 0.01mOhm to V, mV and mOhm.
+        //
+        values[PACK_DIVERGENCE_VOLTAGE][i] =
+            orion_get_instantaneous_pack_voltage(bms) / 10.0f;
+
+        values[PACK_DIVERGENCE_CELL_SPREAD][i] =
+            ((int32_t)orion_get_pack_high_cell_voltage(bms) -
+             (int32_t)orion_get_pack_low_cell_voltage(bms)) / 10.0f;
+
+        values[PACK_DIVERGENCE_RESISTANCE][i] =
+            orion_get_average_cell_resistance(bms) / 100.0f;
+
+        values[PACK_DIVERGENCE_TEMPERATURE][i] =
+            orion_get_pack_high_cell_temperature(bms);
+    }
+
+    for (signal = 0; signal < NUM_PACK_DIVERGENCE_SIGNALS; signal++)
+    {
+        medians[signal] = get_median(values[signal]);
+    }
+
+    for (i = 0; i < PACK_DIVERGENCE_MAX_PACKS; i++)
+    {
+        for (signal = 0; signal < NUM_PACK_DIVERGENCE_SIGNALS; signal++)
+        {
+            float sample = values[signal][i];
+
+            //
+            // The cell spread is within the pack. The others are
+            // measured against the median of the packs, so a pack
+            // moving away reads the same as the max less the min, and
+            // the packs it moves away from read zero.
+            //
+            if (signal != PACK_DIVERGENCE_CELL_SPREAD)
+            {
+                sample -= medians[signal];
+            }
+
+            add_sample(&trackers[i][signal], sample);
+        }
+    }
+
+    period_ms = time_service_ms_since(drift_period_start_ms);
+
+    if (period_ms >= PACK_DIVERGENCE_DRIFT_PERIOD_MS)
+    {
+        drift_period_start_ms = time_service_get_ms();
+
+        for (i = 0; i < PACK_DIVERGENCE_MAX_PACKS; i++)
+        {
+            for (signal = 0; signal < NUM_PACK_DIVERGENCE_SIGNALS; signal++)
+            {
+                update_drift(&trackers[i][signal], period_ms);
+            }
+        }
+    }
+
+    for (i = 0; i < PACK_DIVERGENCE_MAX_PACKS; i++)
+    {
+        for (signal = 0; signal < NUM_PACK_DIVERGENCE_SIGNALS; signal++)
+        {
+            uint8_t bit = (uint8_t)(1 << signal);
+
+            if (evaluate_flag((pack_flags[i] & bit) != 0,
+                              &trackers[i][signal].stats,
+                              divergence_limit[signal]))
+            {
+                pack_flags[i] |= bit;
+            }
+            else
+            {
+                pack_flags[i] &= (uint8_t)~bit;
+            }
+        }
+    }
+}
+
+
+//=============================================================================
+//
+// get_median()
+//
+//=============================================================================
+//
+static float get_median(const float values[PACK_DIVERGENCE_MAX_PACKS])
+{
+    float sorted[PACK_DIVERGENCE_MAX_PACKS];
+    uint8_t i;
+    uint8_t j;
+
+    //
+    // Insertion sort, there are only a few packs.
+    //
+    for (i = 0; i < PACK_DIVERGENCE_MAX_PACKS; i++)
+    {
+        float value = values[i];
+
+        for (j = i; (j > 0) && (sorted[j - 1] > value); j--)
+        {
+            sorted[j] = sorted[j - 1];
+        }
+
+        sorted[j] = value;
+    }
+
+    if ((PACK_DIVERGENCE_MAX_PACKS % 2) == 0)
+    {
+        return (sorted[(PACK_DIVERGENCE_MAX_PACKS / 2) - 1] +
+                sorted[PACK_DIVERGENCE_MAX_PACKS / 2]) / 2.0f;
+    }
+
+    return sorted[PACK_DIVERGENCE_MAX_PACKS / 2];
+}
+
+
+//=============================================================================
+//
+// add_sample()
+//
+// Welford's update, with the sample count saturated so the mean and
+// variance keep following the pack.
+//
+//=============================================================================
+//
+static void add_sample(divergence_tracker_t *tracker, float sample)
+{
+    pack_divergence_stats_t *stats = &tracker->stats;
+    float delta;
+
+    if (stats->n == 0)
+    {
+        stats->ewma = sample;
+        tracker->drift_reference = sample;
+    }
+    else
+    {
+        stats->ewma += PACK_DIVERGENCE_EWMA_ALPHA * (sample - stats->ewma);
+    }
+
+    if (stats->n < PACK_DIVERGENCE_WELFORD_MAX_N)
+    {
+        stats->n++;
+    }
+
+    delta = sample - stats->mean;
+    stats->mean += delta / stats->n;
+    stats->variance +=
+        ((delta * (sample - stats->mean)) - stats->variance) / stats->n;
+}
+
+
+//=============================================================================
+//
+// update_drift()
+//
+//=============================================================================
+//
+static void update_drift(divergence_tracker_t *tracker, uint32_t period_ms)
+{
+    pack_divergence_stats_t *stats = &tracker->stats;
+
+    float drift_per_hour =
+        (stats->ewma - tracker->drift_reference) * (MS_PER_HOUR / period_ms);
+
+    stats->drift_per_hour +=
+        PACK_DIVERGENCE_DRIFT_ALPHA * (drift_per_hour - stats->drift_per_hour);
+
+    tracker->drift_reference = stats->ewma;
+}
+
+
+//=============================================================================
+//
+// evaluate_flag()
+//
+//=============================================================================
+//
+static bool_t evaluate_flag(
+    bool_t flagged,
+    const pack_divergence_stats_t *stats,
+    float limit)
+{
+    if (stats->n < PACK_DIVERGENCE_MIN_SAMPLES)
+    {
+        return FALSE;
+    }
+
+    float magnitude = fabsf(stats->ewma);
+
+    //
+    // The drift away from the other packs, negative when the pack is
+    // coming back.
+    //
+    float drift_away = (stats->ewma >= 0) ? stats->drift_per_hour
+                                          : -stats->drift_per_hour;
+
+    float drift_over_horizon = drift_away * PACK_DIVERGENCE_HORIZON_H;
+
+    bool_t trending =
+        (magnitude >= (PACK_DIVERGENCE_FLOOR_FRACTION * limit)) &&
+        (drift_over_horizon >= (PACK_DIVERGENCE_NOISE_SIGMAS * sqrtf(stats->variance))) &&
+        ((magnitude + drift_over_horizon) >= limit);
+
+    if (flagged)
+    {
+        return trending ||
+               (magnitude >= (PACK_DIVERGENCE_CLEAR_FRACTION * limit));
+    }
+
+    return trending ||
+           (magnitude >= (PACK_DIVERGENCE_WARN_FRACTION * limit));
+}
+
+
+//=============================================================================
+//
+// Getters
+//
+//=============================================================================
+//
+const pack_divergence_stats_t *pack_divergence_get_stats(
+    device_instances_t device,
+    pack_divergence_signal_t signal)
+{
+    uint8_t i;
+
+    if (signal >= NUM_PACK_DIVERGENCE_SIGNALS)
+    {
+        return NULL;
+    }
+
+    for (i = 0; i < PACK_DIVERGENCE_MAX_PACKS; i++)
+    {
+        if (pack_bms[i] == device)
+        {
+            return &trackers[i][signal].stats;
+        }
+    }
+
+    return NULL;
+}
+
+uint8_t pack_divergence_get_flags(device_instances_t device)
+{
+    uint8_t i;
+
+    for (i = 0; i < PACK_DIVERGENCE_MAX_PACKS; i++)
+    {
+        if (pack_bms[i] == device)
+        {
+            return pack_flags[i];
+        }
+    }
+
+    return 0;
+}
+
+bool_t pack_divergence_get_any_flagged()
+{
+    uint8_t i;
+
+    for (i = 0; i < PACK_DIVERGENCE_MAX_PACKS; i++)
+    {
+        if (pack_flags[i] != 0)
+        {
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
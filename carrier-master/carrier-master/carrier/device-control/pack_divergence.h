@@ -0,0 +1,103 @@
+/******************************************************************************
+ *
+ *        Name: pack_divergence.h
+ *
+ * Description: Online statistics of how far each battery pack is from
+ *              the others, to flag a pack that is trending apart long
+ *              before differences_in_pack_voltages_within_limit() or
+ *              a BMS fault takes high voltage off.
+ *
+ *              Every time the BMSs have sent new data, one sample of
+ *              each signal is taken for each pack:
+ *
+ *              VOLTAGE:     pack voltage, less the median of the
+ *                           packs (V).
+ *              CELL_SPREAD: high cell less low cell voltage of the
+ *                           pack (mV).
+ *              RESISTANCE:  average cell resistance, less the median
+ *                           of the packs (mOhm).
+ *              TEMPERATURE: high cell temperature, less the median
+ *                           of the packs (degC).
+ *
+ *              and folded into:
+ *
+ *              - A Welford running mean and variance. The sample count
+ *                saturates at PACK_DIVERGENCE_WELFORD_MAX_N, after
+ *                which older samples are forgotten exponentially.
+ *              - An EWMA, the smoothed present value.
+ *              - The drift rate of the EWMA, per hour.
+ *
+ *              A pack is flagged on a signal when its EWMA is past
+ *              half the limit of the signal, or when it is drifting
+ *              away from the others, clear of the noise, fast enough
+ *              to reach the limit within PACK_DIVERGENCE_HORIZON_H.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+
+#ifndef PACK_DIVERGENCE_H_
+#define PACK_DIVERGENCE_H_
+
+#define PACK_DIVERGENCE_MAX_PACKS      3
+
+//
+// One hour of samples at the 100ms BMS broadcast rate.
+//
+#define PACK_DIVERGENCE_WELFORD_MAX_N  36000
+
+#define PACK_DIVERGENCE_HORIZON_H      1
+
+typedef enum
+{
+    PACK_DIVERGENCE_VOLTAGE = 0,
+    PACK_DIVERGENCE_CELL_SPREAD,
+    PACK_DIVERGENCE_RESISTANCE,
+    PACK_DIVERGENCE_TEMPERATURE,
+    NUM_PACK_DIVERGENCE_SIGNALS
+} pack_divergence_signal_t;
+
+typedef struct
+{
+    uint32_t n;
+    float    mean;
+    float    variance;
+    float    ewma;
+    float    drift_per_hour;
+} pack_divergence_stats_t;
+
+/******************************************************************************
+ *
+ *        Name: pack_divergence_update()
+ *
+ * Description: Takes a sample of every signal of every pack when the
+ *              BMSs have sent new data, and updates the statistics
+ *              and the flags. Called once a loop from User_App(),
+ *              before fault_manager_update().
+ *
+ ******************************************************************************
+ */
+void pack_divergence_update();
+
+//
+// The statistics of one signal of a pack. NULL for a device that is
+// not a battery pack BMS.
+//
+const pack_divergence_stats_t *pack_divergence_get_stats(
+    device_instances_t device,
+    pack_divergence_signal_t signal);
+
+//
+// The signals a pack is flagged on, bit n is pack_divergence_signal_t
+// n.
+//
+uint8_t pack_divergence_get_flags(device_instances_t device);
+
+//
+// TRUE if any pack is flagged on any signal.
+//
+bool_t pack_divergence_get_any_flagged();
+
+#endif // PACK_DIVERGENCE_H_
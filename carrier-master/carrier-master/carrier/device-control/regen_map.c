@@ -0,0 +1,273 @@
+/******************************************************************************
+ *
+ *        Name: regen_map.c
+ *
+ * Description: Regen scale maps. See regen_map.h.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+
+#include <stdlib.h>
+#include "Prototypes.h"
+#include "typedefs.h"
+#include "regen_map.h"
+
+#define REGEN_MAP_RPM_POINTS        7
+#define REGEN_MAP_SOC_POINTS        5
+#define REGEN_MAP_HIGH_CELL_POINTS  5
+
+//=============================================================================
+//
+// The axes and the maps. They are fixed at build time, as Constants.h
+// has no EEPROM locations for tables. The points of an axis must rise.
+//
+//=============================================================================
+//
+
+//
+// Motor rpm.
+//
+static const uint16_t regen_map_rpm_axis[REGEN_MAP_RPM_POINTS] =
+{
+    0, 500, 1000, 1500, 2000, 2500, 3000
+};
+
+//
+// State of charge, %.
+//
+static const uint16_t regen_map_soc_axis[REGEN_MAP_SOC_POINTS] =
+{
+    80, 85, 90, 95, 100
+};
+
+//
+// High cell voltage, 0.1mV. Regen is gone by the highest voltage the
+// packs are charged to (EEVAR_max_allowable_charging_cell_voltage).
+//
+static const uint16_t regen_map_high_cell_axis[REGEN_MAP_HIGH_CELL_POINTS] =
+{
+    38500, 39000, 39500, 40000, 40400
+};
+
+//
+// Regen scale, Q15, a row for each SOC, a column for each rpm.
+// Regen is limited above 90% SOC.
+//
+static const uint16_t regen_map_soc[REGEN_MAP_SOC_POINTS][REGEN_MAP_RPM_POINTS] =
+{
+    { 32768, 32768, 32768, 32768, 32768, 32768, 32768 },
+    { 32768, 32768, 32768, 32768, 32768, 32768, 32768 },
+    { 32768, 32768, 32768, 32768, 32768, 32768, 32768 },
+    { 16384, 16384, 13107, 11469,  9830,  8192,  6554 },
+    {     0,     0,     0,     0,     0,     0,     0 }
+};
+
+//
+// Regen scale, Q15, a row for each high cell voltage, a column for
+// each rpm.
+//
+static const uint16_t regen_map_high_cell[REGEN_MAP_HIGH_CELL_POINTS][REGEN_MAP_RPM_POINTS] =
+{
+    { 32768, 32768, 32768, 32768, 32768, 32768, 32768 },
+    { 32768, 32768, 32768, 32768, 32768, 32768, 32768 },
+    { 32768, 32768, 29491, 26214, 22938, 19661, 16384 },
+    { 16384, 16384, 13107, 11469,  9830,  8192,  6554 },
+    {     0,     0,     0,     0,     0,     0,     0 }
+};
+
+//
+// Where a value falls on an axis: the point below it, and how far it
+// is from there to the next point, in Q15.
+//
+typedef struct
+{
+    uint8_t index;
+    uint16_t fraction_q15;
+} axis_position_t;
+
+//=============================================================================
+//
+// Static Variables
+//
+//=============================================================================
+//
+
+//
+// 2^31 / the distance between each pair of points of an axis, so
+// finding a position on an axis is a multiply and a shift. Worked
+// out on the first call.
+//
+static bool_t first_pass = TRUE;
+static uint32_t rpm_reciprocal[REGEN_MAP_RPM_POINTS - 1];
+static uint32_t soc_reciprocal[REGEN_MAP_SOC_POINTS - 1];
+static uint32_t high_cell_reciprocal[REGEN_MAP_HIGH_CELL_POINTS - 1];
+
+static void axis_reciprocals(const uint16_t *axis,
+                             uint8_t points,
+                             uint32_t *reciprocal);
+static axis_position_t axis_position(const uint16_t *axis,
+                                     const uint32_t *reciprocal,
+                                     uint8_t points,
+                                     uint16_t value);
+static uint16_t bilinear(const uint16_t *map,
+                         axis_position_t row,
+                         axis_position_t column);
+
+
+/******************************************************************************
+ *
+ *        Name: regen_map_get_scale_q15()
+ *
+ * Description: Finds the position on each axis, then interpolates
+ *              both maps. The rpm position is shared by the maps.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+uint16_t regen_map_get_scale_q15(
+    int16_t motor_rpm,
+    uint8_t state_of_charge,
+    uint16_t high_cell_voltage)
+{
+    if (first_pass)
+    {
+        axis_reciprocals(regen_map_rpm_axis,
+                         REGEN_MAP_RPM_POINTS,
+                         rpm_reciprocal);
+
+        axis_reciprocals(regen_map_soc_axis,
+                         REGEN_MAP_SOC_POINTS,
+                         soc_reciprocal);
+
+        axis_reciprocals(regen_map_high_cell_axis,
+                         REGEN_MAP_HIGH_CELL_POINTS,
+                         high_cell_reciprocal);
+
+        first_pass = FALSE;
+    }
+
+    axis_position_t rpm =
+        axis_position(regen_map_rpm_axis,
+                      rpm_reciprocal,
+                      REGEN_MAP_RPM_POINTS,
+                      (uint16_t)abs(motor_rpm));
+
+    axis_position_t soc =
+        axis_position(regen_map_soc_axis,
+                      soc_reciprocal,
+                      REGEN_MAP_SOC_POINTS,
+                      state_of_charge);
+
+    axis_position_t high_cell =
+        axis_position(regen_map_high_cell_axis,
+                      high_cell_reciprocal,
+                      REGEN_MAP_HIGH_CELL_POINTS,
+                      high_cell_voltage);
+
+    uint16_t soc_scale =
+        bilinear(&regen_map_soc[0][0], soc, rpm);
+
+    uint16_t high_cell_scale =
+        bilinear(&regen_map_high_cell[0][0], high_cell, rpm);
+
+    return (soc_scale < high_cell_scale) ? soc_scale : high_cell_scale;
+}
+
+
+//=============================================================================
+//
+// axis_reciprocals()
+//
+//=============================================================================
+//
+static void axis_reciprocals(const uint16_t *axis,
+                             uint8_t points,
+                             uint32_t *reciprocal)
+{
+    uint8_t i;
+
+    for (i = 0; i < (points - 1); i++)
+    {
+        uint32_t distance = (axis[i + 1] > axis[i])
+                            ? (uint32_t)(axis[i + 1] - axis[i])
+                            : 1;
+
+        reciprocal[i] = 0x80000000UL / distance;
+    }
+}
+
+
+//=============================================================================
+//
+// axis_position()
+//
+// The axes are short, so the point below the value is found by a
+// scan. The value is less than the distance to the next point when
+// it is multiplied by the reciprocal, so the product fits 32 bits.
+//
+//=============================================================================
+//
+static axis_position_t axis_position(const uint16_t *axis,
+                                     const uint32_t *reciprocal,
+                                     uint8_t points,
+                                     uint16_t value)
+{
+    axis_position_t position;
+    uint8_t i = 0;
+
+    if (value <= axis[0])
+    {
+        position.index = 0;
+        position.fraction_q15 = 0;
+        return position;
+    }
+
+    if (value >= axis[points - 1])
+    {
+        position.index = points - 2;
+        position.fraction_q15 = REGEN_MAP_Q15_ONE;
+        return position;
+    }
+
+    while (value >= axis[i + 1])
+    {
+        i++;
+    }
+
+    position.index = i;
+    position.fraction_q15 =
+        (uint16_t)(((uint32_t)(value - axis[i]) * reciprocal[i]) >> 16);
+
+    return position;
+}
+
+
+//=============================================================================
+//
+// bilinear()
+//
+// Interpolates along the columns on the two rows either side of the
+// row position, then between the two rows.
+//
+//=============================================================================
+//
+static uint16_t bilinear(const uint16_t *map,
+                         axis_position_t row,
+                         axis_position_t column)
+{
+    const uint16_t *low_row = &map[row.index * REGEN_MAP_RPM_POINTS + column.index];
+    const uint16_t *high_row = low_row + REGEN_MAP_RPM_POINTS;
+
+    int32_t low = (int32_t)low_row[0]
+                  + ((((int32_t)low_row[1] - low_row[0]) * column.fraction_q15) >> 15);
+
+    int32_t high = (int32_t)high_row[0]
+                   + ((((int32_t)high_row[1] - high_row[0]) * column.fraction_q15) >> 15);
+
+    return (uint16_t)(low + (((high - low) * row.fraction_q15) >> 15));
+}
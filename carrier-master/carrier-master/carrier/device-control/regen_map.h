@@ -0,0 +1,54 @@
+/******************************************************************************
+ *
+ *        Name: regen_map.h
+ *
+ * Description: Works out how much of the regen of the traction
+ *              inverter to allow as the battery packs fill, from two
+ *              maps:
+ *
+ *              SOC:       motor rpm x pack state of charge.
+ *              HIGH CELL: motor rpm x high cell voltage.
+ *
+ *              Each map is interpolated bilinearly between its
+ *              points, in fixed point, so the regen fades out
+ *              smoothly instead of stepping at a threshold. The
+ *              lower of the two is the regen scale. The rpm axis
+ *              lets the regen at speed, where its power is highest,
+ *              be taken off sooner than at a crawl.
+ *
+ *              The maps and the scale are in Q15, REGEN_MAP_Q15_ONE
+ *              is all of the regen set in the EEPROM.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+
+#ifndef REGEN_MAP_H_
+#define REGEN_MAP_H_
+
+#define REGEN_MAP_Q15_ONE  32768
+
+//
+// A regen level scaled by a Q15 regen scale.
+//
+#define REGEN_MAP_SCALE(level, scale_q15) \
+    ((uint16_t)(((uint32_t)(level) * (scale_q15)) >> 15))
+
+/******************************************************************************
+ *
+ *        Name: regen_map_get_scale_q15()
+ *
+ * Description: The regen scale at a motor rpm (either direction), a
+ *              pack state of charge (%) and a high cell voltage
+ *              (0.1mV). Outside a map, the edge of the map holds.
+ *
+ ******************************************************************************
+ */
+uint16_t regen_map_get_scale_q15(
+    int16_t motor_rpm,
+    uint8_t state_of_charge,
+    uint16_t high_cell_voltage);
+
+#endif // REGEN_MAP_H_
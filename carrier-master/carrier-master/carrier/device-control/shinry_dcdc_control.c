@@ -20,6 +20,8 @@
 #include "state_machine.h"
 #include "pdm_control_2.h"
 
+#define ENABLE_DCDC_DELAY_MS 2000
+
 /******************************************************************************
  *
  *        Name: shinry_dc_dc_control();
@@ -40,18 +42,11 @@
 bool_t shinry_dc_dc_control()
 {
 
-    static timer_t enable_dcdc_timer;
-    static bool_t first_pass = TRUE;
-
-    if(first_pass == TRUE)
-    {
-        //
-        // five_seconds
-        //
-        enable_dcdc_timer = timer_setup(get_TWO_SECONDS(), RISING);
-        first_pass = FALSE;
-
-    }
+    //
+    // two seconds
+    //
+    static timer_t enable_dcdc_timer =
+        TIMER_INIT_MS(ENABLE_DCDC_DELAY_MS, RISING);
 
 
     //
@@ -0,0 +1,294 @@
+/******************************************************************************
+ *
+ *        Name: throttle_pipeline.c
+ *
+ * Description: Fixed point throttle pedal pipeline. See
+ *              throttle_pipeline.h.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+
+#include "Prototypes.h"
+#include "Constants.h"
+#include "typedefs.h"
+#include "cvc_input_control.h"
+#include "throttle_pipeline.h"
+
+//
+// The deadbands at the released and the depressed end of the travel,
+// in Q15 of the travel. 0 keeps the response of the fixed line the
+// throttle was worked out from before.
+//
+#define EEVAR_THROTTLE_DEADBAND_RELEASED_Q15   0
+#define EEVAR_THROTTLE_DEADBAND_DEPRESSED_Q15  0
+
+//
+// The filter is demand += (position - demand) / 2^THROTTLE_FILTER_SHIFT
+// each loop. 1 is a time constant of about 15ms at the 10ms loop,
+// against noise only, as the inverter filters the throttle as well.
+//
+#define THROTTLE_FILTER_SHIFT                  1
+
+//
+// The calibration used until the pedal has been calibrated from the
+// CL712, or when the calibration spans less than THROTTLE_MIN_SPAN.
+// It is the fixed line f(x) = 0.03278x - 22.95 the throttle was
+// worked out from before.
+//
+#define THROTTLE_DEFAULT_RELEASED              700
+#define THROTTLE_DEFAULT_DEPRESSED             3751
+#define THROTTLE_MIN_SPAN                      200
+
+//
+// The calibration multiplies the travel by the reciprocal of the
+// span, in Q(15 + THROTTLE_RECIPROCAL_SHIFT), so there is no divide
+// a loop. The travel is less than the span when it is multiplied, so
+// the product stays within 2^30.
+//
+#define THROTTLE_RECIPROCAL_SHIFT              15
+
+//
+// The filter keeps THROTTLE_FILTER_FRACTION_BITS more bits than Q15,
+// so it settles on the position exactly.
+//
+#define THROTTLE_FILTER_FRACTION_BITS          8
+
+#define THROTTLE_RESPONSE_POINTS               17
+#define THROTTLE_RESPONSE_STEP_SHIFT           11
+
+//=============================================================================
+//
+// Static Variables
+//
+//=============================================================================
+//
+
+//
+// The demand at each sixteenth of the pedal travel. Linear, so the
+// demand is the position. Shape it for finer control at low speed.
+//
+static const uint16_t throttle_response[THROTTLE_RESPONSE_POINTS] =
+{
+        0,  2048,  4096,  6144,  8192, 10240, 12288, 14336,
+    16384, 18432, 20480, 22528, 24576, 26624, 28672, 30720,
+    THROTTLE_Q15_ONE
+};
+
+//
+// The EEVAR values the calibration was worked out from, so it is
+// only worked out again when they change.
+//
+static bool_t calibrated = FALSE;
+static uint16_t calibrated_released = 0;
+static uint16_t calibrated_depressed = 0;
+
+//
+// The reading at the end of the released deadband, the span of the
+// reading from there to the start of the depressed deadband, and its
+// reciprocal.
+//
+static int32_t zero_reading = 0;
+static int32_t span = 1;
+static int32_t span_reciprocal = 0;
+static bool_t inverted = FALSE;
+
+static uint32_t filter_state = 0;
+static uint16_t demand_q15 = 0;
+
+static void update_calibration();
+static uint16_t response_curve(uint16_t position_q15);
+
+
+/******************************************************************************
+ *
+ *        Name: throttle_pipeline_update()
+ *
+ * Description: Calibrates the reading of the pedal, filters it and
+ *              looks up the demand on the response curve.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+void throttle_pipeline_update()
+{
+    uint16_t position_q15 = throttle_pipeline_get_position_q15(
+        cvc_input_get_analog(CVC_AIN_E03_THROTTLE_POSITION_SENSOR));
+
+    //
+    // Unsigned throughout, as the state - state / 2^n form never
+    // takes the state below 0.
+    //
+    filter_state = filter_state
+                   - (filter_state >> THROTTLE_FILTER_SHIFT)
+                   + (((uint32_t)position_q15 << THROTTLE_FILTER_FRACTION_BITS)
+                      >> THROTTLE_FILTER_SHIFT);
+
+    uint16_t filtered_q15 = (uint16_t)((filter_state
+                                        + (1 << (THROTTLE_FILTER_FRACTION_BITS - 1)))
+                                       >> THROTTLE_FILTER_FRACTION_BITS);
+
+    if (filtered_q15 > THROTTLE_Q15_ONE)
+    {
+        filtered_q15 = THROTTLE_Q15_ONE;
+    }
+
+    demand_q15 = response_curve(filtered_q15);
+}
+
+
+//=============================================================================
+//
+// throttle_pipeline_get_position_q15()
+//
+//=============================================================================
+//
+uint16_t throttle_pipeline_get_position_q15(uint16_t analog_reading)
+{
+    update_calibration();
+
+    int32_t travel = (int32_t)analog_reading - zero_reading;
+
+    if (inverted)
+    {
+        travel = -travel;
+    }
+
+    if (travel <= 0)
+    {
+        return 0;
+    }
+
+    if (travel >= span)
+    {
+        return THROTTLE_Q15_ONE;
+    }
+
+    return (uint16_t)((travel * span_reciprocal
+                       + (1 << (THROTTLE_RECIPROCAL_SHIFT - 1)))
+                      >> THROTTLE_RECIPROCAL_SHIFT);
+}
+
+//=============================================================================
+//
+// throttle_pipeline_get_demand_q15()
+//
+//=============================================================================
+//
+uint16_t throttle_pipeline_get_demand_q15()
+{
+    return demand_q15;
+}
+
+//=============================================================================
+//
+// throttle_pipeline_get_percent()
+//
+//=============================================================================
+//
+uint16_t throttle_pipeline_get_percent()
+{
+    return THROTTLE_Q15_TO_PERCENT(demand_q15);
+}
+
+
+/******************************************************************************
+ *
+ *        Name: update_calibration()
+ *
+ * Description: Works out the calibration again when the released or
+ *              depressed reading in the EEPROM has changed. The
+ *              deadbands are taken off the span here, so the
+ *              calibration of a reading is a subtraction and a
+ *              multiply.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+static void update_calibration()
+{
+    uint16_t eeprom_released = (uint16_t)EEVAR_THROTTLE_RELEASED;
+    uint16_t eeprom_depressed = (uint16_t)EEVAR_THROTTLE_DEPRESSED;
+
+    if (calibrated
+        && (eeprom_released == calibrated_released)
+        && (eeprom_depressed == calibrated_depressed))
+    {
+        return;
+    }
+
+    calibrated = TRUE;
+    calibrated_released = eeprom_released;
+    calibrated_depressed = eeprom_depressed;
+
+    int32_t released = eeprom_released;
+    int32_t depressed = eeprom_depressed;
+    int32_t full_span = depressed - released;
+
+    if (full_span < 0)
+    {
+        full_span = -full_span;
+    }
+
+    //
+    // Not calibrated, or not a usable calibration.
+    //
+    if ((released == 0) || (depressed == 0) || (full_span < THROTTLE_MIN_SPAN))
+    {
+        released = THROTTLE_DEFAULT_RELEASED;
+        depressed = THROTTLE_DEFAULT_DEPRESSED;
+        full_span = THROTTLE_DEFAULT_DEPRESSED - THROTTLE_DEFAULT_RELEASED;
+    }
+
+    inverted = (depressed < released);
+
+    int32_t released_deadband =
+        (full_span * EEVAR_THROTTLE_DEADBAND_RELEASED_Q15) >> 15;
+    int32_t depressed_deadband =
+        (full_span * EEVAR_THROTTLE_DEADBAND_DEPRESSED_Q15) >> 15;
+
+    zero_reading = inverted ? (released - released_deadband)
+                            : (released + released_deadband);
+
+    span = full_span - released_deadband - depressed_deadband;
+
+    if (span < 1)
+    {
+        span = 1;
+    }
+
+    span_reciprocal =
+        (int32_t)((((uint32_t)THROTTLE_Q15_ONE << THROTTLE_RECIPROCAL_SHIFT)
+                   + (uint32_t)(span / 2)) / (uint32_t)span);
+}
+
+
+//=============================================================================
+//
+// response_curve()
+//
+// Interpolates the demand between the two points of the table either
+// side of the position.
+//
+//=============================================================================
+//
+static uint16_t response_curve(uint16_t position_q15)
+{
+    if (position_q15 >= THROTTLE_Q15_ONE)
+    {
+        return throttle_response[THROTTLE_RESPONSE_POINTS - 1];
+    }
+
+    uint16_t index = position_q15 >> THROTTLE_RESPONSE_STEP_SHIFT;
+    int32_t fraction = position_q15 & ((1 << THROTTLE_RESPONSE_STEP_SHIFT) - 1);
+    int32_t low = throttle_response[index];
+    int32_t high = throttle_response[index + 1];
+
+    return (uint16_t)(low + (((high - low) * fraction) >> THROTTLE_RESPONSE_STEP_SHIFT));
+}
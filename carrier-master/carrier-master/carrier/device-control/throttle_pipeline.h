@@ -0,0 +1,65 @@
+/******************************************************************************
+ *
+ *        Name: throttle_pipeline.h
+ *
+ * Description: Turns the reading of the throttle pedal into the
+ *              throttle demand of the traction inverter, in fixed
+ *              point. Once a loop, the reading goes through:
+ *
+ *              CALIBRATION: the pedal position, 0 at
+ *                           EEVAR_THROTTLE_RELEASED and full travel at
+ *                           EEVAR_THROTTLE_DEPRESSED. A pedal that
+ *                           reads lower when depressed is handled.
+ *              DEADBAND:    the first and last part of the travel read
+ *                           as released and fully depressed. The
+ *                           deadband is folded into the calibration,
+ *                           so it costs nothing a loop.
+ *              FILTER:      a first order low pass filter, against
+ *                           noise on the reading.
+ *              RESPONSE:    a curve from pedal position to demand,
+ *                           interpolated from a table.
+ *
+ *              Positions and demands are fractions of full travel in
+ *              Q15, THROTTLE_Q15_ONE is full travel.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+
+#ifndef THROTTLE_PIPELINE_H_
+#define THROTTLE_PIPELINE_H_
+
+#define THROTTLE_Q15_ONE  32768
+
+//
+// A Q15 position or demand in whole percent, rounded down.
+//
+#define THROTTLE_Q15_TO_PERCENT(q15)  ((uint16_t)(((uint32_t)(q15) * 100) >> 15))
+
+/******************************************************************************
+ *
+ *        Name: throttle_pipeline_update()
+ *
+ * Description: Reads the throttle pedal and updates the demand. Called
+ *              once a loop from User_App(), before
+ *              traction_inverter_control().
+ *
+ ******************************************************************************
+ */
+void throttle_pipeline_update();
+
+//
+// The calibrated position of a reading of the pedal, with the
+// deadband, before the filter and the response curve.
+//
+uint16_t throttle_pipeline_get_position_q15(uint16_t analog_reading);
+
+//
+// The throttle demand, in Q15 and in whole percent.
+//
+uint16_t throttle_pipeline_get_demand_q15();
+uint16_t throttle_pipeline_get_percent();
+
+#endif // THROTTLE_PIPELINE_H_
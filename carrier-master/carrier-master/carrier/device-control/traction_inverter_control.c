@@ -34,6 +34,10 @@
 #include "cvc_input_control.h"
 #include "state_machine.h"
 #include "can_switches.h"
+#include "emergency_stop.h"
+#include "discharge_limit_predictor.h"
+#include "throttle_pipeline.h"
+#include "regen_map.h"
 
 static uint16_t traction_inverter_enable = FALSE;
 
@@ -96,6 +100,20 @@ void traction_inverter_control(
         max_allowable_battery_current =
             EEVAR_TRACTION_SKAI_max_battery_current;
     }
+
+    //
+    // Keep under the discharge current limit of the BMSs, ramping
+    // down ahead of a drop in it rather than cutting the torque when
+    // it drops. See discharge_limit_predictor.h.
+    //
+    uint16_t predicted_current_limit =
+        discharge_limit_predictor_get_current_limit();
+
+    if (max_allowable_battery_current > predicted_current_limit)
+    {
+        max_allowable_battery_current = predicted_current_limit;
+    }
+
     //
     // PACK_STATE_OF_CHARGE
     //
@@ -116,6 +134,19 @@ void traction_inverter_control(
     uint16_t pack_high_cell_voltage = get_pack_high_cell_voltage();
 
 
+    //
+    // REGEN SCALE
+    //
+    // The regen levels of the EEPROM are scaled down from the maps of
+    // motor rpm against SOC and high cell voltage, so the regen fades
+    // out as the packs fill. See regen_map.h.
+    //
+    uint16_t regen_scale_q15 =
+        regen_map_get_scale_q15((int16_t)skai_get_vissim_motor_rpm(device),
+                                (uint8_t)pack_state_of_charge,
+                                pack_high_cell_voltage);
+
+
     //
     // DETERMINE THE DIRECTION OF OPERATION
     //
@@ -195,12 +226,14 @@ void traction_inverter_control(
     //
     // This information is obtained from the state machine. The state
     // machine would determine if the inverter must be enabled or
-    // disabled.
+    // disabled. The fast path (emergency_stop.c) holds it disabled
+    // while an E-stop is pressed or the master switch is open.
     //
     state_t sm_state = get_sm_current_state();
     bool_t sm_enable_hv_system =  get_sm_status_enable_hv_systems();
 
     traction_inverter_enable = (sm_state == READY_TO_DRIVE
+                                && !emergency_stop_get_inverters_disabled()
                                 && !get_sm_precharge_failure_status()
                                 && get_sm_precharge_success_status()
                                 && (sm_state != POST_CHARGE_IDLE)
@@ -271,6 +304,13 @@ void traction_inverter_control(
         1000,
         0);
 
+    skai2_set_vissim_tx_msg7_regen_scale(
+        device,
+        EEVAR_TRACTION_SKAI_regen_scale_p1,
+        EEVAR_TRACTION_SKAI_regen_scale_p2,
+        REGEN_MAP_SCALE(EEVAR_TRACTION_SKAI_regen_scale_l1, regen_scale_q15),
+        REGEN_MAP_SCALE(EEVAR_TRACTION_SKAI_regen_scale_l2, regen_scale_q15));
+
     //
     // Transmit CAN Messages
     //
@@ -280,6 +320,12 @@ void traction_inverter_control(
 
     tx_skai2_vissim_rpm_settings_outgain_pgainramptime(device, EVERY_50MS);
 
+    //
+    // The regen scale follows the maps, so is sent faster than the
+    // other EEPROM messages.
+    //
+    tx_skai2_vissim_regen_scale(device, EVERY_100MS);
+
 }
 
 
@@ -369,13 +415,6 @@ static void update_traction_inverter_eeproms(
             EEVAR_TRACTION_SKAI_motor_scale_l1,
             EEVAR_TRACTION_SKAI_motor_scale_l2);
 
-        skai2_set_vissim_tx_msg7_regen_scale(
-            device,
-            EEVAR_TRACTION_SKAI_regen_scale_p1,
-            EEVAR_TRACTION_SKAI_regen_scale_p2,
-            EEVAR_TRACTION_SKAI_regen_scale_l1,
-            EEVAR_TRACTION_SKAI_regen_scale_l2);
-
         skai2_set_vissim_tx_msg8_throttle_filter_dqf_gains(
             device,
             EEVAR_TRACTION_SKAI_throttle_gain_1,
@@ -420,8 +459,6 @@ static void update_traction_inverter_eeproms(
 
     tx_skai2_vissim_motor_scale(device, EVERY_1000MS);
 
-    tx_skai2_vissim_regen_scale(device, EVERY_1000MS);
-
     tx_skai2_vissim_throttle_filter_dq_df_gains(device, EVERY_1000MS);
 
     tx_skai2_vissim_rpm_settings_outgain_pgainramptime(device, EVERY_1000MS);
@@ -440,13 +477,12 @@ static void update_traction_inverter_eeproms(
  *              but a potentiometer. The output from the pedal is a 0
  *              - 5V signal. The signal is fed into port E of the
  *              CVC.
- *q
- *              This module is responsible for the calibration of the
- *              william controls pedal. It is also responsible to
- *              scale the input signal to a value between 0 - 100%,
- *              which can be used by the inverter. This scaled value
- *              is transmitted over can to the inverter driving the
- *              traction motor.
+ *
+ *              The reading is calibrated and scaled to a value
+ *              between 0 - 100% by the throttle pipeline, which is
+ *              updated from User_App() before this runs. This scaled
+ *              value is transmitted over can to the inverter driving
+ *              the traction motor.
  *
  *
  *        Date: Thursday, 05 September 2019
@@ -455,62 +491,7 @@ static void update_traction_inverter_eeproms(
  */
 static uint16_t inverter_throttle_control()
 {
-
-	static uint16_t analog_reading = 0;
-    static uint16_t throttle_percent = 0;
-
-    //
-    // Call this function to read analog value of input
-    // software_input_number is the input software number of the input
-    // you want to read (since it is on master module it lines up with
-    // the IOMap address) frequency sets the amount of time the input
-    // is sampled over.  For example 50 Hz -> 20 msec, 100 Hz, 10
-    // msec, 200 Hz 5 msec return the Analog_Values_ structure NOTE:
-    // if the frequency is set such that it takes longer to sample the
-    // input than the loop time, the previous value will be reported
-    // until the sampling is finished.  In some cases the inputs on
-    // the module are run through a multiplexer, in these cases having
-    // one long sample time will affect all the inputs since the
-    // multiplexer cannot be flipped until all the inputs have
-    // finished sampling
-    //
-    //
-    // Read the analog result
-    //
-    analog_reading = IN_E03_throttle_position_sensor_signal;
-
-    //
-    // Convert the received analog value to a value usable by the
-    // inverter to drive the motor.
-    //
-    // f(x) = 0.0473260x - 23.663038
-    //
-    throttle_percent = (uint16_t)((analog_reading * 0.03278) - 22.95);
-
-    if(throttle_percent > 100)
-    {
-
-    	//
-    	// force throttle percent to 100
-    	//
-    	throttle_percent = 100;
-
-    }
-
-    if(throttle_percent <= 0)
-    {
-    	//
-    	// force throttle percent to 0
-    	//
-    	throttle_percent = 0;
-
-    }
-
-    //
-    // return the calculated throttle percent
-    //
-    return throttle_percent;
-
+    return throttle_pipeline_get_percent();
 }
 
 //=============================================================================
@@ -524,86 +505,17 @@ bool_t traction_inverter_state()
     return (bool_t)traction_inverter_enable;
 }
 
-#warning "Comment this a bit better"
-
 //=============================================================================
 //
 // Throttle Scaling: depending on throttle released and depressed values
 //
+// The position of a raw reading of the pedal, in 0 - 100%, from the
+// calibration in the EEPROM.
+//
 //=============================================================================
 //
 uint8_t throttle_scaling(uint16_t raw_adc_value)
 {
-
-    double raw_adc_input = (((double)raw_adc_value)/4096.0);
-
-//    double throttle_released_value = 625 * 1.0;
-//    double throttle_depressed_value = 3846 * 1.0;
-
-    double throttle_released_value = (double)EEVAR_THROTTLE_RELEASED * 1.0;
-    double throttle_depressed_value = (double)EEVAR_THROTTLE_DEPRESSED * 1.0;
-
-    double throttle_released = (throttle_released_value /4096.0);
-    double throttle_depressed = throttle_depressed_value /4096.0;
-    double denominator = 0;
-
-    //
-    // Default Settings
-    //
-    if(throttle_released == 0)
-    {
-        throttle_released = 0.781;
-    }
-
-    if(throttle_depressed == 0)
-    {
-        throttle_depressed = 0.253;
-    }
-
-    //
-    // Calculations
-    //
-    double numerator =
-        (double)raw_adc_input - throttle_released - 0.00976565;
-
-    //
-    // Calculation for the denominator
-    //
-    double temp1 =  throttle_released - throttle_depressed;
-
-    if(temp1 < 0.0)
-    {
-    	temp1 = temp1 * -1.0;
-    }
-    else
-    {
-    	temp1 = temp1 * 1.0;
-    }
-    double temp2 = temp1 - 0.0245;
-
-    if(temp2 > 0.0)
-    {
-        denominator = temp2;
-    }
-    else
-    {
-        denominator = 0.571;
-    }
-
-    double output = numerator / denominator;
-
-    uint8_t throttle = (uint8_t)(output * 100);
-
-    if (throttle > 100)
-    {
-        throttle = 100;
-    }
-
-    if (throttle < 0)
-    {
-        throttle = 0;
-    }
-
-    return throttle;
-
+    return (uint8_t)THROTTLE_Q15_TO_PERCENT(
+        throttle_pipeline_get_position_q15(raw_adc_value));
 }
@@ -112,6 +112,13 @@ const uint32_t BEL_TXID_J1939_BASE = 0x18ef0000;
 //
 device_data_t *bel_charger_first_device_data_ptr = NULL;
 
+//
+// The record of each device instance, indexed by device instance -
+// 1. Resolved once, by bel_charger_init(). NULL for an instance that
+// has not been initialised. See bel_charger_get_device_data_ptr().
+//
+static device_data_t *bel_charger_device_data_ptrs[FVT_MAX_DEVICE_INSTANCES];
+
 //
 // This is incremented each for each device instance
 //
@@ -204,6 +211,19 @@ bel_charger_init(
         		&device_instance_counter,
                 sizeof(device_data_t));
 
+    //
+    // The record could not be created. This is counted by can_service,
+    // so fvt_can_validate_device_registrations() fails and the vehicle
+    // control is not run. The instance is left unresolved, and its
+    // getters return their defaults.
+    //
+    if (device_data_ptr == NULL)
+    {
+        return;
+    }
+
+    bel_charger_device_data_ptrs[device - ONE] = device_data_ptr;
+
     //
     // Register an interest in this device instance's receive CAN
     // messages.
@@ -216,6 +236,12 @@ bel_charger_init(
         bel_rx_can_status,
         status_rx_timeout);
 
+    device_data_ptr->status_rx_handle =
+        fvt_can_get_receive_handle(
+            module_id,
+            can_line,
+            BEL_RXID_CHARGER_STATUS + get_rx_instance_offset(device));
+
     fvt_can_register_receive_id(
         device,
         module_id,
@@ -295,6 +321,32 @@ bel_charger_init(
 }
 
 
+/******************************************************************************
+ *
+ *        Name: bel_charger_get_device_data_ptr()
+ *
+ * Description: The record of a device instance, as resolved by
+ *              bel_charger_init(). NULL if the instance has not been
+ *              initialised or is out of range.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+device_data_t *
+bel_charger_get_device_data_ptr(
+    device_instances_t device)
+{
+    if ((device < ONE) || (device > FVT_MAX_DEVICE_INSTANCES))
+    {
+        return NULL;
+    }
+
+    return bel_charger_device_data_ptrs[device - ONE];
+}
+
+
 //////////////////////////////////////////////////////////////////////////////
 //
 // These functions are called by can_rx_check_message_timeouts() in
@@ -336,8 +388,8 @@ void status_rx_timeout(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        bel_charger_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Mark this message as having timed out.
@@ -380,8 +432,8 @@ void measured_values_rx_timeout(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        bel_charger_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Mark this message as having timed out.
@@ -424,8 +476,8 @@ void primary_values_rx_timeout(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        bel_charger_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Mark this message as having timed out.
@@ -468,10 +520,8 @@ void secondary_values_rx_timeout(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(
-            device,
-            bel_charger_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        bel_charger_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Mark this message as having timed out.
@@ -525,7 +575,7 @@ static void bel_rx_can_status(
 	int16_t *receive_timeout_counter)
 {
     // Check can_data_ptr is not NULL.
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // This will be a pointer to the device's receive data structure
@@ -537,15 +587,15 @@ static void bel_rx_can_status(
     // Get a pointer to this device's data record.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        bel_charger_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Have the pointer to this device's data record, not get a
     // pointer to the appropriate receive data structure.
     //
     dest_ptr = &(device_data_ptr->status);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     //
     // Copy the data from the received CAN message to the designated
@@ -592,7 +642,7 @@ static void bel_rx_can_measured_values(
 	int16_t *receive_timeout_counter)
 {
     // Check can_data_ptr is not NULL.
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // This will be a pointer to the device's receive data structure
@@ -604,15 +654,15 @@ static void bel_rx_can_measured_values(
     // Get a pointer to this device's data record.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        bel_charger_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Have the pointer to this device's data record, not get a
     // pointer to the appropriate receive data structure.
     //
     dest_ptr = &(device_data_ptr->measured_values);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     //
     // Copy the data from the received CAN message to the designated
@@ -665,7 +715,7 @@ static void bel_rx_can_primary_values(
 	int16_t *receive_timeout_counter)
 {
     // Check can_data_ptr is not NULL.
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // This will be a pointer to the device's receive data structure
@@ -677,15 +727,15 @@ static void bel_rx_can_primary_values(
     // Get a pointer to this device's data record.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        bel_charger_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Have the pointer to this device's data record, not get a
     // pointer to the appropriate receive data structure.
     //
     dest_ptr = &(device_data_ptr->primary_values);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     //
     // Copy the data from the received CAN message to the designated
@@ -742,7 +792,7 @@ static void bel_rx_can_secondary_values(
 	int16_t *receive_timeout_counter)
 {
     // Check can_data_ptr is not NULL.
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // This will be a pointer to the device's receive data structure
@@ -754,15 +804,15 @@ static void bel_rx_can_secondary_values(
     // Get a pointer to this device's data record.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        bel_charger_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Have the pointer to this device's data record, not get a
     // pointer to the appropriate receive data structure.
     //
     dest_ptr = &(device_data_ptr->secondary_values);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     //
     // Copy the data from the received CAN message to the designated
@@ -876,8 +926,8 @@ void bel_tx_can_setpoint(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        bel_charger_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -885,7 +935,7 @@ void bel_tx_can_setpoint(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_setpoint_j1939_can_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -899,19 +949,17 @@ void bel_tx_can_setpoint(
     //
     bel_charger_tx_setpoint_t *can_data_ptr =
         (bel_charger_tx_setpoint_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     // Send the CAN message if time to do so.
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get a
         // pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->setpoints);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit buffer.
@@ -954,8 +1002,8 @@ void bel_tx_can_gpio(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        bel_charger_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -963,7 +1011,7 @@ void bel_tx_can_gpio(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_gpio_setting_j1939_can_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -975,20 +1023,18 @@ void bel_tx_can_gpio(
     // represents the data that this function is sending over CAN.
     bel_charger_tx_gpio_t *can_data_ptr =
         (bel_charger_tx_gpio_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
 
     // Send the CAN message if time to do so.
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get a
         // pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->gpios);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit buffer.
@@ -1031,8 +1077,8 @@ void bel_tx_can_battery_under_over_voltage_limits(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        bel_charger_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -1040,7 +1086,7 @@ void bel_tx_can_battery_under_over_voltage_limits(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_battery_voltage_limits_j1939_can_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -1052,19 +1098,17 @@ void bel_tx_can_battery_under_over_voltage_limits(
     // represents the data that this function is sending over CAN.
     bel_charger_tx_battery_under_over_voltage_limits_t *can_data_ptr =
         (bel_charger_tx_battery_under_over_voltage_limits_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     // Send the CAN message if time to do so.
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get a
         // pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->limits);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit buffer.
@@ -1095,8 +1139,8 @@ void bel_tx_can_led_duty_cycle(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        bel_charger_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -1104,7 +1148,7 @@ void bel_tx_can_led_duty_cycle(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_led_setting_j1939_can_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -1116,19 +1160,17 @@ void bel_tx_can_led_duty_cycle(
     // represents the data that this function is sending over CAN.
     bel_charger_tx_led_t *can_data_ptr =
         (bel_charger_tx_led_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     // Send the CAN message if time to do so.
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get a
         // pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->leds);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit buffer.
@@ -116,6 +116,7 @@ bool_t bel_get_pilot_signal_ok(device_instances_t device);
 bool_t bel_get_proximity_signal_ok(device_instances_t device);
 uint8_t bel_get_chg_state(device_instances_t device);
 bool_t bel_get_can_rx_ok(device_instances_t device);
+uint32_t bel_get_rx_age_ms(device_instances_t device);
 
 
 //=============================================================================
@@ -11,8 +11,6 @@
  */
 #include "bel_charger_device_private.h"
 
-extern device_data_t *bel_charger_first_device_data_ptr;
-
 //=============================================================================
 //
 // Getters for Bel Charger measured_values.
@@ -22,16 +20,16 @@ extern device_data_t *bel_charger_first_device_data_ptr;
 uint16_t bel_get_pin_17_vtd_v_20(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
+        bel_charger_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, 0);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     bel_charger_measured_values_t *source_ptr = &(device_data_ptr->measured_values);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (uint16_t)source_ptr->pin_17_vtd_v_20;
 }
@@ -39,16 +37,16 @@ uint16_t bel_get_pin_17_vtd_v_20(device_instances_t device)
 uint16_t bel_get_max_charging_current_ava(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
+        bel_charger_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, 0);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     bel_charger_measured_values_t *source_ptr = &(device_data_ptr->measured_values);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
 
     return (uint8_t)source_ptr->max_charging_current_ava;
@@ -63,16 +61,16 @@ uint16_t bel_get_max_charging_current_ava(device_instances_t device)
 uint16_t bel_get_input_voltage_rms_phase_1_2_v(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
+        bel_charger_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, 0);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     bel_charger_primary_values_t *source_ptr = &(device_data_ptr->primary_values);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (uint16_t)source_ptr->input_voltage_rms_phase_1_2_v;
 }
@@ -80,16 +78,16 @@ uint16_t bel_get_input_voltage_rms_phase_1_2_v(device_instances_t device)
 uint16_t bel_get_input_voltage_rms_phase_2_3_v(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
+        bel_charger_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, 0);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     bel_charger_primary_values_t *source_ptr = &(device_data_ptr->primary_values);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (uint16_t)source_ptr->input_voltage_rms_phase_2_3_v;
 }
@@ -97,16 +95,16 @@ uint16_t bel_get_input_voltage_rms_phase_2_3_v(device_instances_t device)
 uint16_t bel_get_input_voltage_rms_phase_3_1_v(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
+        bel_charger_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, 0);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     bel_charger_primary_values_t *source_ptr = &(device_data_ptr->primary_values);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (uint16_t)source_ptr->input_voltage_rms_phase_3_1_v;
 }
@@ -114,16 +112,16 @@ uint16_t bel_get_input_voltage_rms_phase_3_1_v(device_instances_t device)
 uint16_t bel_get_input_voltage_frequency_hz_20(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
+        bel_charger_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, 0);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     bel_charger_primary_values_t *source_ptr = &(device_data_ptr->primary_values);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (uint16_t)source_ptr->input_voltage_frequency_hz_20;
 }
@@ -137,16 +135,16 @@ uint16_t bel_get_input_voltage_frequency_hz_20(device_instances_t device)
 uint16_t bel_get_output_voltage_v_20(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
+        bel_charger_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, 0);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     bel_charger_secondary_values_t *source_ptr = &(device_data_ptr->secondary_values);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (uint16_t)source_ptr->output_voltage_v_20;
 }
@@ -154,16 +152,16 @@ uint16_t bel_get_output_voltage_v_20(device_instances_t device)
 uint16_t bel_get_output_current_a_20(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
+        bel_charger_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, 0);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     bel_charger_secondary_values_t *source_ptr = &(device_data_ptr->secondary_values);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (uint16_t)source_ptr->output_current_a_20;
 }
@@ -171,16 +169,16 @@ uint16_t bel_get_output_current_a_20(device_instances_t device)
 int8_t bel_get_chassis_temperature_c(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
+        bel_charger_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, 0);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     bel_charger_secondary_values_t *source_ptr = &(device_data_ptr->secondary_values);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (int8_t)(source_ptr->chassis_temperature_c - 40);
 }
@@ -188,16 +186,16 @@ int8_t bel_get_chassis_temperature_c(device_instances_t device)
 uint16_t bel_get_aux_battery_voltage_v_20(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
+        bel_charger_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, 0);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     bel_charger_secondary_values_t *source_ptr = &(device_data_ptr->secondary_values);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (uint16_t)source_ptr->aux_battery_voltage_v_20;
 }
@@ -205,16 +203,16 @@ uint16_t bel_get_aux_battery_voltage_v_20(device_instances_t device)
 int8_t bel_get_internal_ambient_temperature_c(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
+        bel_charger_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, 0);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     bel_charger_secondary_values_t *source_ptr = &(device_data_ptr->secondary_values);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (int8_t)(source_ptr->internal_ambient_temperature_c - 40);
 }
@@ -228,16 +226,16 @@ int8_t bel_get_internal_ambient_temperature_c(device_instances_t device)
 bool_t bel_get_input_voltage_ok(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
+        bel_charger_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     bel_charger_status_t *source_ptr = &(device_data_ptr->status);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (bool_t)source_ptr->input_voltage_ok;
 }
@@ -245,16 +243,16 @@ bool_t bel_get_input_voltage_ok(device_instances_t device)
 bool_t bel_get_input_frequency_ok(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
+        bel_charger_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     bel_charger_status_t *source_ptr = &(device_data_ptr->status);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (bool_t)source_ptr->input_frequency_ok;
 }
@@ -262,16 +260,16 @@ bool_t bel_get_input_frequency_ok(device_instances_t device)
 bool_t bel_get_hv_battery_undervoltage(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
+        bel_charger_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     bel_charger_status_t *source_ptr = &(device_data_ptr->status);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (bool_t)source_ptr->hv_battery_undervoltage;
 }
@@ -279,16 +277,16 @@ bool_t bel_get_hv_battery_undervoltage(device_instances_t device)
 bool_t bel_get_hv_battery_overvoltage(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
+        bel_charger_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     bel_charger_status_t *source_ptr = &(device_data_ptr->status);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (bool_t)source_ptr->hv_battery_overvoltage;
 }
@@ -296,16 +294,16 @@ bool_t bel_get_hv_battery_overvoltage(device_instances_t device)
 bool_t bel_get_hv_battery_voltage_in_range(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
+        bel_charger_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     bel_charger_status_t *source_ptr = &(device_data_ptr->status);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (bool_t)source_ptr->hv_battery_voltage_in_range;
 }
@@ -313,16 +311,16 @@ bool_t bel_get_hv_battery_voltage_in_range(device_instances_t device)
 bool_t bel_get_output_overcurrent(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
+        bel_charger_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     bel_charger_status_t *source_ptr = &(device_data_ptr->status);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (bool_t)source_ptr->output_overcurrent;
 }
@@ -330,16 +328,16 @@ bool_t bel_get_output_overcurrent(device_instances_t device)
 bool_t bel_get_unit_overtemperature(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
+        bel_charger_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     bel_charger_status_t *source_ptr = &(device_data_ptr->status);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (bool_t)source_ptr->unit_overtemperature;
 }
@@ -347,16 +345,16 @@ bool_t bel_get_unit_overtemperature(device_instances_t device)
 bool_t bel_get_i2c_fault(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
+        bel_charger_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     bel_charger_status_t *source_ptr = &(device_data_ptr->status);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (bool_t)source_ptr->i2c_fault;
 }
@@ -364,16 +362,16 @@ bool_t bel_get_i2c_fault(device_instances_t device)
 bool_t bel_get_can_bus_fault(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
+        bel_charger_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     bel_charger_status_t *source_ptr = &(device_data_ptr->status);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (bool_t)source_ptr->can_bus_fault;
 }
@@ -381,16 +379,16 @@ bool_t bel_get_can_bus_fault(device_instances_t device)
 bool_t bel_get_eeprom_memory_fault(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
+        bel_charger_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     bel_charger_status_t *source_ptr = &(device_data_ptr->status);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (bool_t)source_ptr->eeprom_memory_fault;
 }
@@ -398,16 +396,16 @@ bool_t bel_get_eeprom_memory_fault(device_instances_t device)
 bool_t bel_get_unit_thermistor_fault(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
+        bel_charger_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     bel_charger_status_t *source_ptr = &(device_data_ptr->status);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (bool_t)source_ptr->unit_thermistor_fault;
 }
@@ -415,16 +413,16 @@ bool_t bel_get_unit_thermistor_fault(device_instances_t device)
 bool_t bel_get_lv_battery_in_range(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
+        bel_charger_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     bel_charger_status_t *source_ptr = &(device_data_ptr->status);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (bool_t)source_ptr->lv_battery_in_range;
 }
@@ -432,16 +430,16 @@ bool_t bel_get_lv_battery_in_range(device_instances_t device)
 bool_t bel_get_unit_enabled(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
+        bel_charger_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     bel_charger_status_t *source_ptr = &(device_data_ptr->status);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (bool_t)source_ptr->unit_enabled;
 }
@@ -449,16 +447,16 @@ bool_t bel_get_unit_enabled(device_instances_t device)
 bool_t bel_get_key_switch_voltage_in_range(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
+        bel_charger_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     bel_charger_status_t *source_ptr = &(device_data_ptr->status);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (bool_t)source_ptr->key_switch_voltage_in_range;
 }
@@ -466,16 +464,16 @@ bool_t bel_get_key_switch_voltage_in_range(device_instances_t device)
 bool_t bel_get_output_off_fault_bit_set(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
+        bel_charger_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     bel_charger_status_t *source_ptr = &(device_data_ptr->status);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (bool_t)source_ptr->output_off_fault_bit_set;
 }
@@ -483,16 +481,16 @@ bool_t bel_get_output_off_fault_bit_set(device_instances_t device)
 bool_t bel_get_converter_latched_off_due_to_fault(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
+        bel_charger_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     bel_charger_status_t *source_ptr = &(device_data_ptr->status);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (bool_t)source_ptr->converter_latched_off_due_to_fault;
 }
@@ -500,16 +498,16 @@ bool_t bel_get_converter_latched_off_due_to_fault(device_instances_t device)
 bool_t bel_get_converter_commanded_off(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
+        bel_charger_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     bel_charger_status_t *source_ptr = &(device_data_ptr->status);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (bool_t)source_ptr->converter_commanded_off;
 }
@@ -517,16 +515,16 @@ bool_t bel_get_converter_commanded_off(device_instances_t device)
 bool_t bel_get_start_up_init_done_self_test_passed(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
+        bel_charger_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     bel_charger_status_t *source_ptr = &(device_data_ptr->status);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (bool_t)source_ptr->start_up_init_done_self_test_passed;
 }
@@ -534,16 +532,16 @@ bool_t bel_get_start_up_init_done_self_test_passed(device_instances_t device)
 bool_t bel_get_output_off_control_dsp_module_failure(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
+        bel_charger_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     bel_charger_status_t *source_ptr = &(device_data_ptr->status);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (bool_t)source_ptr->output_off_control_dsp_module_failure;
 }
@@ -551,16 +549,16 @@ bool_t bel_get_output_off_control_dsp_module_failure(device_instances_t device)
 bool_t bel_get_control_dsp_in_bootloader(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
+        bel_charger_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     bel_charger_status_t *source_ptr = &(device_data_ptr->status);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (bool_t)source_ptr->control_dsp_in_bootloader;
 }
@@ -568,16 +566,16 @@ bool_t bel_get_control_dsp_in_bootloader(device_instances_t device)
 bool_t bel_get_proprietary_a(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
+        bel_charger_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     bel_charger_status_t *source_ptr = &(device_data_ptr->status);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (bool_t)source_ptr->proprietary_a;
 }
@@ -585,16 +583,16 @@ bool_t bel_get_proprietary_a(device_instances_t device)
 bool_t bel_get_signal_dsp_uploading_firmware_to_control_dsp(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
+        bel_charger_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     bel_charger_status_t *source_ptr = &(device_data_ptr->status);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (bool_t)source_ptr->signal_dsp_uploading_firmware_to_control_dsp;
 }
@@ -602,16 +600,16 @@ bool_t bel_get_signal_dsp_uploading_firmware_to_control_dsp(device_instances_t d
 bool_t bel_get_gpi_signal_on_external_signal_conenctor(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
+        bel_charger_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     bel_charger_status_t *source_ptr = &(device_data_ptr->status);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (bool_t)source_ptr->gpi_signal_on_external_signal_conenctor;
 }
@@ -619,16 +617,16 @@ bool_t bel_get_gpi_signal_on_external_signal_conenctor(device_instances_t device
 bool_t bel_get_wake_up_power_switch_failure(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
+        bel_charger_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     bel_charger_status_t *source_ptr = &(device_data_ptr->status);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (bool_t)source_ptr->wake_up_power_switch_failure;
 }
@@ -636,16 +634,16 @@ bool_t bel_get_wake_up_power_switch_failure(device_instances_t device)
 bool_t bel_get_gpo_up_power_switch_failure(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
+        bel_charger_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     bel_charger_status_t *source_ptr = &(device_data_ptr->status);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (bool_t)source_ptr->gpo_up_power_switch_failure;
 }
@@ -653,16 +651,16 @@ bool_t bel_get_gpo_up_power_switch_failure(device_instances_t device)
 bool_t bel_get_hvil_loop_disconnected(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
+        bel_charger_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     bel_charger_status_t *source_ptr = &(device_data_ptr->status);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (bool_t)source_ptr->hvil_loop_disconnected;
 }
@@ -670,16 +668,16 @@ bool_t bel_get_hvil_loop_disconnected(device_instances_t device)
 bool_t bel_get_buck_undervoltage(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
+        bel_charger_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     bel_charger_status_t *source_ptr = &(device_data_ptr->status);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (bool_t)source_ptr->buck_undervoltage;
 }
@@ -687,16 +685,16 @@ bool_t bel_get_buck_undervoltage(device_instances_t device)
 bool_t bel_get_proximity_and_pilot_enabled(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
+        bel_charger_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     bel_charger_status_t *source_ptr = &(device_data_ptr->status);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (bool_t)source_ptr->proximity_and_pilot_enabled;
 }
@@ -704,16 +702,16 @@ bool_t bel_get_proximity_and_pilot_enabled(device_instances_t device)
 bool_t bel_get_pilot_signal_ok(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
+        bel_charger_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     bel_charger_status_t *source_ptr = &(device_data_ptr->status);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (bool_t)source_ptr->pilot_signal_ok;
 }
@@ -721,16 +719,16 @@ bool_t bel_get_pilot_signal_ok(device_instances_t device)
 bool_t bel_get_proximity_signal_ok(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
+        bel_charger_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     bel_charger_status_t *source_ptr = &(device_data_ptr->status);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (bool_t)source_ptr->proximity_signal_ok;
 }
@@ -738,16 +736,39 @@ bool_t bel_get_proximity_signal_ok(device_instances_t device)
 uint8_t bel_get_chg_state(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
+        bel_charger_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, 0);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     bel_charger_status_t *source_ptr = &(device_data_ptr->status);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (uint8_t)source_ptr->chg_state;
 }
+
+//=============================================================================
+//
+// bel_get_rx_age_ms()
+//
+// The ms since the status was last received, or since the device was
+// initialised if it has not been received. FVT_CAN_RX_AGE_UNKNOWN if
+// the device is not fitted.
+//
+//=============================================================================
+//
+uint32_t bel_get_rx_age_ms(device_instances_t device)
+{
+    device_data_t *device_data_ptr =
+        bel_charger_get_device_data_ptr(device);
+
+    if (device_data_ptr == NULL)
+    {
+        return FVT_CAN_RX_AGE_UNKNOWN;
+    }
+
+    return fvt_can_get_receive_age_ms(device_data_ptr->status_rx_handle);
+}
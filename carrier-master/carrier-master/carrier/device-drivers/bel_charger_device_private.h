@@ -204,6 +204,9 @@ typedef struct device_data_s {
     can_tx_registration_t *send_led_setting_j1939_can_ptr;
     can_tx_registration_t *send_battery_voltage_limits_j1939_can_ptr;
 
+    // The receive record of the status, for the age of the data.
+    can_rx_handle_t status_rx_handle;
+
 } device_data_t;
 
 
@@ -241,6 +244,15 @@ get_device_linked_data_record_instance_ptr(
     device_data_t *first_device_data_ptr);
 
 
+//
+// The record of a device instance, resolved once by bel_charger_init().
+// NULL if the instance has not been initialised.
+//
+device_data_t *
+bel_charger_get_device_data_ptr(
+    device_instances_t device);
+
+
 #endif
 
 
@@ -12,8 +12,6 @@
 
 #include "bel_charger_device_private.h"
 
-extern device_data_t *bel_charger_first_device_data_ptr;
-
 //=============================================================================
 //
 // void bel_set_charger_setpoint(
@@ -36,14 +34,14 @@ void bel_set_setpoint(
     // Get a pointer to the proper device data structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        bel_charger_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->setpoints);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -51,14 +49,7 @@ void bel_set_setpoint(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_setpoint_j1939_can_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
-
-    // Cast our pointer to the 8-byte Can_Message_ tx message data to
-    // be a pointer to the Bel charger's 8-byte structure that
-    // represents the data that this function is sending over CAN.
-    bel_charger_tx_setpoint_t *can_data_ptr =
-        (bel_charger_tx_setpoint_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Populate the PDM's unique identifier with the j1939_word.
@@ -95,14 +86,14 @@ void bel_set_gpio(
     // Get a pointer to the proper device data structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        bel_charger_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->gpios);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -110,14 +101,7 @@ void bel_set_gpio(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_gpio_setting_j1939_can_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
-
-    // Cast our pointer to the 8-byte Can_Message_ tx message data to
-    // be a pointer to the Bel charger's 8-byte structure that
-    // represents the data that this function is sending over CAN.
-    bel_charger_tx_gpio_t *can_data_ptr =
-        (bel_charger_tx_gpio_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Populate the PDM's unique identifier with the j1939_byte.
@@ -157,14 +141,14 @@ void bel_set_battery_under_over_voltage_limits(
     // Get a pointer to the proper device data structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        bel_charger_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->limits);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -172,14 +156,7 @@ void bel_set_battery_under_over_voltage_limits(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_battery_voltage_limits_j1939_can_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
-
-    // Cast our pointer to the 8-byte Can_Message_ tx message data to
-    // be a pointer to the Bel charger's 8-byte structure that
-    // represents the data that this function is sending over CAN.
-    bel_charger_tx_battery_under_over_voltage_limits_t *can_data_ptr =
-        (bel_charger_tx_battery_under_over_voltage_limits_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Populate the PDM's unique identifier with the j1939_byte.
@@ -208,14 +185,14 @@ void bel_set_led_duty_cycle(
     // Get a pointer to the proper device data structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, bel_charger_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        bel_charger_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->leds);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -223,14 +200,7 @@ void bel_set_led_duty_cycle(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_led_setting_j1939_can_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
-
-    // Cast our pointer to the 8-byte Can_Message_ tx message data to
-    // be a pointer to the Bel charger's 8-byte structure that
-    // represents the data that this function is sending over CAN.
-    bel_charger_tx_led_t *can_data_ptr =
-        (bel_charger_tx_led_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Populate the PDM's unique identifier with the j1939_byte.
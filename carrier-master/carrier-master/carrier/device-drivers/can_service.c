@@ -36,6 +36,7 @@
 #include "Prototypes_CAN.h"
 #include "can_service_private.h"
 #include "can_service_devices.h"
+#include "time_service.h"
 #include "string.h"
 
 //
@@ -65,6 +66,12 @@ typedef struct can_rx_registration_s
     // transmit methods.
     can_rate_t receive_timeout_counter_limit;
     bool_t timeout_enabled;
+    // time_service ms stamp of the last receive, or of the
+    // registration until the first receive.
+    uint32_t last_receive_ms;
+    // Incremented each time the handler or the timeout function of
+    // this record is called, as rx_change_count is.
+    uint32_t change_count;
     // J1939 byte (optional)
     uint8_t j1939_byte;
     // The device_index is zero-indexed. Use the enums ONE, TWO,
@@ -91,6 +98,60 @@ typedef struct can_rx_registration_s
 static can_rx_registration_t *first_j1939_byte_rx_registration_record_p;
 static can_rx_registration_t *first_rx_registration_record_p;
 
+//
+// Number of device records and CAN registrations that could not be
+// created during initialisation, and the result of validating them.
+//
+static uint16_t registration_failure_count = 0;
+static bool_t device_registrations_valid = FALSE;
+
+//
+// Incremented each time received device data changes.
+//
+static uint32_t rx_change_count = 0;
+
+//
+// J1939 transport protocol. Registrations for multi-packet PGNs, and
+// a fixed pool of sessions, each with its own reassembly buffer. A
+// session is one transfer from one source address, either a BAM to
+// the global address or an RTS/CTS transfer to the CVC.
+//
+typedef struct
+{
+    device_instances_t device;
+    uint8_t module_id;
+    CANLINE_ can_line;
+    uint32_t pgn;
+    // J1939_GLOBAL_ADDRESS to accept the PGN from any source.
+    uint8_t source_address;
+    p_rx_tp_f_t handler_function_p;
+} can_tp_registration_t;
+
+typedef struct
+{
+    bool_t in_use;
+    const can_tp_registration_t *registration_p;
+    uint8_t module_id;
+    CANLINE_ can_line;
+    uint8_t source_address;
+    uint8_t destination_address;
+    uint32_t pgn;
+    uint16_t size;
+    uint8_t packets;
+    // Sequence number of the next TP.DT expected.
+    uint8_t next_packet;
+    // RTS/CTS only: the last packet cleared by the last CTS, and the
+    // most packets the sender will take per CTS.
+    uint8_t last_cts_packet;
+    uint8_t max_packets_per_cts;
+    uint32_t last_packet_ms;
+    uint8_t data[FVT_CAN_TP_MAX_SIZE];
+} can_tp_session_t;
+
+static can_tp_registration_t tp_registrations[FVT_CAN_TP_MAX_REGISTRATIONS];
+static uint8_t tp_registration_count = 0;
+static can_tp_session_t tp_sessions[FVT_CAN_TP_MAX_SESSIONS];
+
 
 //
 // Private functions for internal use only
@@ -121,6 +182,17 @@ search_matching_rx_registration_record(
     uint8_t module_id,
     CANLINE_ can_line);
 
+//
+// For the J1939 transport protocol.
+//
+static bool_t
+j1939_tp_process_rx_message(
+    const Can_Message_ *received_can_message,
+    uint8_t module_id,
+    CANLINE_ can_line);
+
+static void j1939_tp_check_session_timeouts();
+
 //
 // For handling device_data records.
 //
@@ -178,6 +250,7 @@ fvt_can_register_receive_id(
         // Report an error. The specified can_id has already been
         // registered.
         //
+        registration_failure_count++;
         DEBUG("Registration record already exists!");
         return FALSE;
     }
@@ -228,6 +301,7 @@ fvt_can_register_receive_id(
             // Not enough space on the heap to satisfy our
             // request. This never returns.
             //
+            registration_failure_count++;
             DEBUG("Malloc error, no space on heap!");
             return FALSE;
         }
@@ -246,6 +320,8 @@ fvt_can_register_receive_id(
 		rx_registration_record_p->receive_timeout_counter = 0;
 		rx_registration_record_p->receive_timeout_counter_limit = NO_TIME_OUT;
 		rx_registration_record_p->timeout_enabled = FALSE;
+		rx_registration_record_p->last_receive_ms = time_service_get_ms();
+		rx_registration_record_p->change_count = 0;
     }
 
     return TRUE;
@@ -290,6 +366,7 @@ fvt_can_register_receive_id_j1939_byte(
         // Report an error. The specified can_id has already been
         // registered.
         //
+        registration_failure_count++;
         DEBUG("Registration record already exists!");
         return FALSE;
     }
@@ -340,6 +417,7 @@ fvt_can_register_receive_id_j1939_byte(
             // Not enough space on the heap to satisfy our
             // request. This never returns.
             //
+            registration_failure_count++;
             DEBUG("Malloc error, no space on heap!");
             return FALSE;
         }
@@ -358,6 +436,8 @@ fvt_can_register_receive_id_j1939_byte(
 		rx_registration_record_p->receive_timeout_counter = 0;
 		rx_registration_record_p->receive_timeout_counter_limit = NO_TIME_OUT;
 		rx_registration_record_p->timeout_enabled = FALSE;
+		rx_registration_record_p->last_receive_ms = time_service_get_ms();
+		rx_registration_record_p->change_count = 0;
     }
 
 
@@ -403,6 +483,18 @@ fvt_can_process_rx_message(
     can_data_t *can_data_ptr;
     can_rx_registration_t *rx_registration_record_p = NULL;
 
+    //
+    // J1939 transport protocol messages are reassembled into their
+    // registered multi-packet PGN, and never reach the registration
+    // records below.
+    //
+    if (j1939_tp_process_rx_message(&received_can_message,
+                                    module_id,
+                                    can_line))
+    {
+        return;
+    }
+
     //
     // Search our linked list of can_rx_registration_t records for a
     // record that matches the provided CAN identifier and
@@ -432,6 +524,10 @@ fvt_can_process_rx_message(
             rx_registration_record_p->device,
             can_data_ptr,
             &(rx_registration_record_p->receive_timeout_counter));
+
+        rx_registration_record_p->last_receive_ms = time_service_get_ms();
+        rx_registration_record_p->change_count++;
+        rx_change_count++;
      }
 }
 
@@ -1045,8 +1141,9 @@ fvt_can_get_timeout_status_for_receive_id(
  *
  *              Each time this function is called, it walks through
  *              both the j1939_byte linked list and the normal linked
- *              list of CAN receive registration records, incrementing
- *              each record's receive_timeout_counter. If the record's
+ *              list of CAN receive registration records, advancing
+ *              each record's receive_timeout_counter by the elapsed
+ *              milliseconds of the loop. If the record's
  *              receive_timeout_counter is greater than the
  *              receive_timeout_counter_limit, a structure identifying
  *              the receive CAN message is returned. It is then up to
@@ -1101,6 +1198,11 @@ void can_rx_check_message_timeouts()
     can_rx_timeout_status_t can_rx_timeout_status;
 	can_rx_timeout_status.can_id = NO_RX_TIMEOUT_FOUND;
 
+    //
+    // Drop any J1939 transport protocol session that has stopped.
+    //
+    j1939_tp_check_session_timeouts();
+
     //
     // Walk through both linked lists of registration records.
     //
@@ -1134,9 +1236,12 @@ void can_rx_check_message_timeouts()
                 {
                     //
                     // This record has not been marked as
-                    // TIMED_OUT. Increment its receive_timeout_counter.
+                    // TIMED_OUT. Advance its receive_timeout_counter
+                    // by the milliseconds elapsed since the previous
+                    // loop.
                     //
-                    rx_registration_record_p[i]->receive_timeout_counter++;
+                    rx_registration_record_p[i]->receive_timeout_counter +=
+                        (int16_t)time_service_get_elapsed_ms();
                 }
 
             }
@@ -1175,6 +1280,9 @@ void can_rx_check_message_timeouts()
                         rx_registration_record_p[i]->can_id,
                         rx_registration_record_p[i]->j1939_byte);
 
+                    rx_registration_record_p[i]->change_count++;
+                    rx_change_count++;
+
                     //
                     // Mark this record's receive timeout counter as
                     // TIMED_OUT, break out of the loop, and return the
@@ -1289,6 +1397,7 @@ fvt_can_register_transmit_id(
         // Not enough space on the heap to satisfy our
         // request. This never returns.
         //
+        registration_failure_count++;
         DEBUG("Malloc error, no space on heap!");
         return NULL;
     }
@@ -1348,6 +1457,7 @@ fvt_can_register_transmit_id_j1939(
         // Not enough space on the heap to satisfy our request. This
         // never returns.
         //
+        registration_failure_count++;
         DEBUG("Malloc error, no space on heap!");
         return NULL;
     }
@@ -1364,11 +1474,11 @@ fvt_can_register_transmit_id_j1939(
     tx_registration_record_p->j1939_word = j1939_word;
 
     //
-    // A counter that is incremented when any of a device's CAN
-    // transmit methods are called. This will occur at the rate that
-    // User_App() is called by the underlying HED system services. The
-    // specific message registered will be transmitted only when this
-    // counter exceeds the transmit_counter_limit.
+    // A counter that is advanced by the milliseconds elapsed since
+    // the previous loop when any of a device's CAN transmit methods
+    // are called (see fvt_can_transmit_due()). The specific message
+    // registered will be transmitted only when this counter reaches
+    // the transmit_counter_limit.
     //
     tx_registration_record_p->transmit_counter = 0;
 
@@ -1424,6 +1534,7 @@ fvt_can_register_transmit_id_j1939_byte(
         // Not enough space on the heap to satisfy our request. This
         // never returns.
         //
+        registration_failure_count++;
         DEBUG("Malloc error, no space on heap!");
         return NULL;
     }
@@ -1440,11 +1551,11 @@ fvt_can_register_transmit_id_j1939_byte(
     tx_registration_record_p->j1939_byte = j1939_byte;
 
     //
-    // A counter that is incremented when any of a device's CAN
-    // transmit methods are called. This will occur at the rate that
-    // User_App() is called by the underlying HED system services. The
-    // specific message registered will be transmitted only when this
-    // counter exceeds the transmit_counter_limit.
+    // A counter that is advanced by the milliseconds elapsed since
+    // the previous loop when any of a device's CAN transmit methods
+    // are called (see fvt_can_transmit_due()). The specific message
+    // registered will be transmitted only when this counter reaches
+    // the transmit_counter_limit.
     //
     tx_registration_record_p->transmit_counter = 0;
 
@@ -1461,6 +1572,277 @@ fvt_can_register_transmit_id_j1939_byte(
 }
 
 
+/******************************************************************************
+ *
+ *        Name: fvt_can_transmit_due()
+ *
+ * Description: Called from a device driver's CAN transmit methods,
+ *              once per loop. Advances the transmit counter by the
+ *              milliseconds elapsed since the previous loop and
+ *              returns TRUE when the counter reaches the
+ *              transmit_counter_limit.
+ *
+ *              The counter is wound back by one period rather than
+ *              zeroed, so loop jitter does not stretch the transmit
+ *              rate. If the counter is still over the limit (a
+ *              stalled loop) it is zeroed, so missed messages are not
+ *              sent in a burst.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+bool_t fvt_can_transmit_due(
+    can_tx_registration_t *tx_registration_record_p)
+{
+    uint32_t counter;
+    uint32_t limit;
+
+    NULL_CHECK_RETURN(tx_registration_record_p, FALSE);
+
+    counter = (uint32_t)tx_registration_record_p->transmit_counter
+        + time_service_get_elapsed_ms();
+    limit = (uint32_t)tx_registration_record_p->transmit_counter_limit;
+
+    if (counter < limit)
+    {
+        tx_registration_record_p->transmit_counter = (uint16_t)counter;
+        return FALSE;
+    }
+
+    counter -= limit;
+
+    if (counter >= limit)
+    {
+        counter = 0;
+    }
+
+    tx_registration_record_p->transmit_counter = (uint16_t)counter;
+
+    return TRUE;
+}
+
+
+/******************************************************************************
+ *
+ *        Name: fvt_can_validate_device_registrations()
+ *
+ * Description: Called once at the end of User_Init(), after every
+ *              device driver has been initialised. Every device
+ *              record and CAN registration is created through this
+ *              module, and each failure to create one (no heap,
+ *              duplicate CAN ID or device instance out of order) is
+ *              counted as it happens.
+ *
+ *              If there were no failures, every device instance that
+ *              was initialised has a valid record and valid tx
+ *              registrations, and the per call NULL checks in the
+ *              device drivers can be left out of release builds.
+ *
+ *              This is the one place the failure is reported with
+ *              DEBUG(), which blocks, but only during start up.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+bool_t fvt_can_validate_device_registrations()
+{
+    device_registrations_valid = (registration_failure_count == 0);
+
+    if (device_registrations_valid == FALSE)
+    {
+        DEBUG("Device validation failed, %d registration errors",
+              registration_failure_count);
+    }
+
+    return device_registrations_valid;
+}
+
+
+//=============================================================================
+//
+// fvt_can_get_device_registrations_valid()
+//
+//=============================================================================
+//
+bool_t fvt_can_get_device_registrations_valid()
+{
+    return device_registrations_valid;
+}
+
+
+//=============================================================================
+//
+// fvt_can_get_rx_change_count()
+//
+//=============================================================================
+//
+uint32_t fvt_can_get_rx_change_count()
+{
+    return rx_change_count;
+}
+
+
+/******************************************************************************
+ *
+ *        Name: fvt_can_get_receive_handle()
+ *
+ * Description: Searches for a receive registration record and
+ *              returns it as a handle, so that the age of the
+ *              message can be read without searching again. Called
+ *              once, after the message has been registered. Returns
+ *              NULL if there is no such record.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+can_rx_handle_t
+fvt_can_get_receive_handle(
+    uint8_t module_id,
+    CANLINE_ can_line,
+    uint32_t can_id)
+{
+    can_rx_registration_t *rx_registration_record_p =
+        search_rx_registration_records_for_can_id(
+            can_id,
+            module_id,
+            can_line);
+
+    if (rx_registration_record_p == NULL)
+    {
+        registration_failure_count++;
+        DEBUG("Receive handle for an unregistered message!");
+    }
+
+    return rx_registration_record_p;
+}
+
+can_rx_handle_t
+fvt_can_get_receive_handle_j1939_byte(
+    uint8_t module_id,
+    CANLINE_ can_line,
+    uint32_t can_id,
+    uint8_t j1939_byte)
+{
+    can_rx_registration_t *rx_registration_record_p =
+        search_rx_registration_records_for_can_id_j1939_byte(
+            can_id,
+            j1939_byte,
+            module_id,
+            can_line);
+
+    if (rx_registration_record_p == NULL)
+    {
+        registration_failure_count++;
+        DEBUG("Receive handle for an unregistered message!");
+    }
+
+    return rx_registration_record_p;
+}
+
+
+//=============================================================================
+//
+// fvt_can_get_receive_age_ms()
+//
+//=============================================================================
+//
+uint32_t fvt_can_get_receive_age_ms(can_rx_handle_t handle)
+{
+    //
+    // Not NULL_CHECK_RETURN(), as the handle of a device that is not
+    // fitted is NULL in normal running, and is not reported.
+    //
+    if (handle == NULL)
+    {
+        return FVT_CAN_RX_AGE_UNKNOWN;
+    }
+
+    return time_service_ms_since(handle->last_receive_ms);
+}
+
+
+//=============================================================================
+//
+// fvt_can_get_receive_change_count()
+//
+//=============================================================================
+//
+uint32_t fvt_can_get_receive_change_count(can_rx_handle_t handle)
+{
+    if (handle == NULL)
+    {
+        return 0;
+    }
+
+    return handle->change_count;
+}
+
+
+/******************************************************************************
+ *
+ *        Name: fvt_can_get_timed_out_receive_ids()
+ *
+ * Description: Walks both linked lists of receive registration
+ *              records and copies the identity of each record that is
+ *              currently TIMED_OUT into timeouts, up to
+ *              max_timeouts. Returns the number copied.
+ *
+ *              A record stays TIMED_OUT from the call of its timeout
+ *              function until its message is received again.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+uint8_t fvt_can_get_timed_out_receive_ids(
+    can_rx_timeout_status_t *timeouts,
+    uint8_t max_timeouts)
+{
+    const int linked_list_cnt = 2;
+    can_rx_registration_t *rx_registration_record_p[linked_list_cnt];
+    uint8_t count = 0;
+
+    rx_registration_record_p[0] = first_rx_registration_record_p;
+    rx_registration_record_p[1] = first_j1939_byte_rx_registration_record_p;
+
+    NULL_CHECK_RETURN(timeouts, 0);
+
+    for (int i = 0; i < linked_list_cnt; ++i)
+    {
+        while ((rx_registration_record_p[i] != NULL) &&
+               (count < max_timeouts))
+        {
+            if (rx_registration_record_p[i]->timeout_enabled &&
+                (rx_registration_record_p[i]->receive_timeout_counter == TIMED_OUT))
+            {
+                timeouts[count].module_id =
+                    rx_registration_record_p[i]->module_id;
+                timeouts[count].can_line =
+                    rx_registration_record_p[i]->can_line;
+                timeouts[count].can_id =
+                    rx_registration_record_p[i]->can_id;
+                timeouts[count].j1939_byte =
+                    rx_registration_record_p[i]->j1939_byte;
+                timeouts[count].device =
+                    rx_registration_record_p[i]->device;
+                count++;
+            }
+
+            rx_registration_record_p[i] = rx_registration_record_p[i]->next_ptr;
+        }
+    }
+
+    return count;
+}
+
+
 /******************************************************************************
  *
  *        Name: canPrintf()
@@ -1566,6 +1948,588 @@ canPrintf(
 
 
 
+//=============================================================================
+//=============================================================================
+//=============================================================================
+//
+// J1939 Transport Protocol Support Functions
+//
+//=============================================================================
+//=============================================================================
+//=============================================================================
+
+//
+// TP.CM control bytes, other than J1939_TP_CM_BAM, and the
+// connection abort reasons used.
+//
+#define J1939_TP_CM_RTS                 16
+#define J1939_TP_CM_CTS                 17
+#define J1939_TP_CM_END_OF_MSG_ACK      19
+#define J1939_TP_CM_ABORT               255
+
+#define J1939_TP_ABORT_NO_RESOURCES     2
+#define J1939_TP_ABORT_TIMEOUT          3
+#define J1939_TP_ABORT_BAD_SEQUENCE     7
+
+//
+// A session is dropped if no TP.DT arrives for this long: T1 of
+// J1939-21 for a BAM, T2 for an RTS/CTS transfer, which waits on
+// the CTS just sent.
+//
+#define J1939_TP_BAM_TIMEOUT_MS         750
+#define J1939_TP_CTS_TIMEOUT_MS         1250
+
+#define J1939_TP_BYTES_PER_PACKET       7
+
+#define J1939_PF(can_id)  ((uint8_t)(((can_id) >> 16) & 0xFF))
+#define J1939_PS(can_id)  ((uint8_t)(((can_id) >> 8) & 0xFF))
+#define J1939_SA(can_id)  ((uint8_t)((can_id) & 0xFF))
+
+static void
+j1939_tp_send_cm(
+    uint8_t module_id,
+    CANLINE_ can_line,
+    uint8_t destination_address,
+    uint32_t pgn,
+    const uint8_t *bytes);
+
+static void j1939_tp_abort(const can_tp_session_t *session_p, uint8_t reason);
+
+static void j1939_tp_send_cts(can_tp_session_t *session_p);
+
+
+/******************************************************************************
+ *
+ *        Name: fvt_can_register_receive_pgn_tp()
+ *
+ * Description: This function, typically called from a FVT device
+ *              driver, registers an interest in a PGN that is sent
+ *              with the J1939 transport protocol, either as a BAM or
+ *              with RTS/CTS to the CVC. Once every packet of a
+ *              transfer has been received, the handler function is
+ *              called once with the complete payload.
+ *
+ *              The registrations are kept in a fixed table of
+ *              FVT_CAN_TP_MAX_REGISTRATIONS entries.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+bool_t
+fvt_can_register_receive_pgn_tp(
+    device_instances_t device_instance,
+    uint8_t module_id,
+    CANLINE_ can_line,
+    uint32_t pgn,
+    uint8_t source_address,
+    p_rx_tp_f_t handler_function_p)
+{
+    can_tp_registration_t *registration_p;
+    uint8_t i;
+
+    for (i = 0; i < tp_registration_count; i++)
+    {
+        if ((tp_registrations[i].module_id == module_id) &&
+            (tp_registrations[i].can_line == can_line) &&
+            (tp_registrations[i].pgn == pgn) &&
+            (tp_registrations[i].source_address == source_address))
+        {
+            registration_failure_count++;
+            DEBUG("TP registration already exists!");
+            return FALSE;
+        }
+    }
+
+    if (tp_registration_count >= FVT_CAN_TP_MAX_REGISTRATIONS)
+    {
+        registration_failure_count++;
+        DEBUG("No TP registration left!");
+        return FALSE;
+    }
+
+    registration_p = &tp_registrations[tp_registration_count];
+
+    registration_p->device = device_instance;
+    registration_p->module_id = module_id;
+    registration_p->can_line = can_line;
+    registration_p->pgn = pgn;
+    registration_p->source_address = source_address;
+    registration_p->handler_function_p = handler_function_p;
+
+    tp_registration_count++;
+
+    return TRUE;
+}
+
+
+//=============================================================================
+//
+// j1939_tp_search_registration(): the registration for a PGN from a
+// source address, or NULL.
+//
+//=============================================================================
+//
+static const can_tp_registration_t *
+j1939_tp_search_registration(
+    uint8_t module_id,
+    CANLINE_ can_line,
+    uint32_t pgn,
+    uint8_t source_address)
+{
+    uint8_t i;
+
+    for (i = 0; i < tp_registration_count; i++)
+    {
+        if ((tp_registrations[i].module_id == module_id) &&
+            (tp_registrations[i].can_line == can_line) &&
+            (tp_registrations[i].pgn == pgn) &&
+            ((tp_registrations[i].source_address == source_address) ||
+             (tp_registrations[i].source_address == J1939_GLOBAL_ADDRESS)))
+        {
+            return &tp_registrations[i];
+        }
+    }
+
+    return NULL;
+}
+
+
+//=============================================================================
+//
+// j1939_tp_search_session(): the session in use for a source and
+// destination address, or NULL.
+//
+//=============================================================================
+//
+static can_tp_session_t *
+j1939_tp_search_session(
+    uint8_t module_id,
+    CANLINE_ can_line,
+    uint8_t source_address,
+    uint8_t destination_address)
+{
+    uint8_t i;
+
+    for (i = 0; i < FVT_CAN_TP_MAX_SESSIONS; i++)
+    {
+        if (tp_sessions[i].in_use &&
+            (tp_sessions[i].module_id == module_id) &&
+            (tp_sessions[i].can_line == can_line) &&
+            (tp_sessions[i].source_address == source_address) &&
+            (tp_sessions[i].destination_address == destination_address))
+        {
+            return &tp_sessions[i];
+        }
+    }
+
+    return NULL;
+}
+
+
+//=============================================================================
+//
+// j1939_tp_allocate_session(): a free session, or NULL if every
+// session is in use.
+//
+//=============================================================================
+//
+static can_tp_session_t *j1939_tp_allocate_session()
+{
+    uint8_t i;
+
+    for (i = 0; i < FVT_CAN_TP_MAX_SESSIONS; i++)
+    {
+        if (!tp_sessions[i].in_use)
+        {
+            return &tp_sessions[i];
+        }
+    }
+
+    return NULL;
+}
+
+
+/******************************************************************************
+ *
+ *        Name: j1939_tp_process_cm()
+ *
+ * Description: Handles a TP.CM. A BAM or an RTS for a registered PGN
+ *              starts a session, replacing any session already open
+ *              between the same two addresses, as J1939-21 requires.
+ *              An RTS that cannot be taken is answered with an abort.
+ *              An abort from the sender closes its session.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+static void
+j1939_tp_process_cm(
+    const Can_Message_ *received_can_message,
+    uint8_t module_id,
+    CANLINE_ can_line)
+{
+    const uint8_t *data = received_can_message->data;
+    uint8_t source_address = J1939_SA(received_can_message->identifier);
+    uint8_t destination_address = J1939_PS(received_can_message->identifier);
+    uint8_t control = data[0];
+    uint16_t size = (uint16_t)(data[1] | ((uint16_t)data[2] << 8));
+    uint8_t packets = data[3];
+    uint32_t pgn = (uint32_t)data[5] |
+                   ((uint32_t)data[6] << 8) |
+                   ((uint32_t)data[7] << 16);
+    const can_tp_registration_t *registration_p;
+    can_tp_session_t *session_p;
+
+    if ((control != J1939_TP_CM_BAM) &&
+        (control != J1939_TP_CM_RTS) &&
+        (control != J1939_TP_CM_ABORT))
+    {
+        return;
+    }
+
+    session_p = j1939_tp_search_session(module_id,
+                                        can_line,
+                                        source_address,
+                                        destination_address);
+
+    if (session_p != NULL)
+    {
+        session_p->in_use = FALSE;
+    }
+
+    if (control == J1939_TP_CM_ABORT)
+    {
+        return;
+    }
+
+    registration_p =
+        j1939_tp_search_registration(module_id, can_line, pgn, source_address);
+
+    if (registration_p == NULL)
+    {
+        return;
+    }
+
+    //
+    // A BAM is sent to the global address, and an RTS to the CVC.
+    //
+    if (((control == J1939_TP_CM_BAM) &&
+         (destination_address != J1939_GLOBAL_ADDRESS)) ||
+        ((control == J1939_TP_CM_RTS) &&
+         (destination_address != J1939_CVC_SOURCE_ADDRESS)))
+    {
+        return;
+    }
+
+    session_p = j1939_tp_allocate_session();
+
+    if ((session_p == NULL) ||
+        (size > FVT_CAN_TP_MAX_SIZE) ||
+        (packets == 0) ||
+        (packets != (size + J1939_TP_BYTES_PER_PACKET - 1) / J1939_TP_BYTES_PER_PACKET))
+    {
+        if (control == J1939_TP_CM_RTS)
+        {
+            const uint8_t bytes[] =
+                { J1939_TP_CM_ABORT, J1939_TP_ABORT_NO_RESOURCES, 0xFF, 0xFF, 0xFF };
+
+            j1939_tp_send_cm(module_id, can_line, source_address, pgn, bytes);
+        }
+
+        return;
+    }
+
+    session_p->module_id = module_id;
+    session_p->can_line = can_line;
+    session_p->source_address = source_address;
+    session_p->destination_address = destination_address;
+    session_p->pgn = pgn;
+    session_p->size = size;
+    session_p->packets = packets;
+    session_p->in_use = TRUE;
+    session_p->registration_p = registration_p;
+    session_p->next_packet = 1;
+    session_p->last_cts_packet = packets;
+    session_p->max_packets_per_cts =
+        ((control == J1939_TP_CM_RTS) && (data[4] != 0)) ? data[4] : 0xFF;
+    session_p->last_packet_ms = time_service_get_ms();
+
+    if (control == J1939_TP_CM_RTS)
+    {
+        j1939_tp_send_cts(session_p);
+    }
+}
+
+
+/******************************************************************************
+ *
+ *        Name: j1939_tp_process_dt()
+ *
+ * Description: Copies a TP.DT into its session. When the last packet
+ *              has been received, an RTS/CTS transfer is acknowledged
+ *              and the registered handler function is called with the
+ *              payload. A packet out of sequence ends the session.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+static void
+j1939_tp_process_dt(
+    const Can_Message_ *received_can_message,
+    uint8_t module_id,
+    CANLINE_ can_line)
+{
+    const uint8_t *data = received_can_message->data;
+    can_tp_session_t *session_p;
+    uint16_t offset;
+    uint8_t i;
+
+    session_p = j1939_tp_search_session(module_id,
+                                        can_line,
+                                        J1939_SA(received_can_message->identifier),
+                                        J1939_PS(received_can_message->identifier));
+
+    if (session_p == NULL)
+    {
+        return;
+    }
+
+    if (data[0] != session_p->next_packet)
+    {
+        if (session_p->destination_address != J1939_GLOBAL_ADDRESS)
+        {
+            j1939_tp_abort(session_p, J1939_TP_ABORT_BAD_SEQUENCE);
+        }
+
+        session_p->in_use = FALSE;
+        return;
+    }
+
+    offset = (uint16_t)(data[0] - 1) * J1939_TP_BYTES_PER_PACKET;
+
+    for (i = 0; (i < J1939_TP_BYTES_PER_PACKET) && (offset + i < session_p->size); i++)
+    {
+        session_p->data[offset + i] = data[i + 1];
+    }
+
+    session_p->next_packet++;
+    session_p->last_packet_ms = time_service_get_ms();
+
+    if (data[0] < session_p->packets)
+    {
+        //
+        // Clear the next packets once the last packet of the last
+        // CTS has been received.
+        //
+        if ((session_p->destination_address != J1939_GLOBAL_ADDRESS) &&
+            (data[0] == session_p->last_cts_packet))
+        {
+            j1939_tp_send_cts(session_p);
+        }
+
+        return;
+    }
+
+    if (session_p->destination_address != J1939_GLOBAL_ADDRESS)
+    {
+        const uint8_t bytes[] =
+            { J1939_TP_CM_END_OF_MSG_ACK,
+              (uint8_t)(session_p->size & 0xFF),
+              (uint8_t)(session_p->size >> 8),
+              session_p->packets,
+              0xFF };
+
+        j1939_tp_send_cm(session_p->module_id,
+                         session_p->can_line,
+                         session_p->source_address,
+                         session_p->pgn,
+                         bytes);
+    }
+
+    session_p->in_use = FALSE;
+
+    session_p->registration_p->handler_function_p(
+        session_p->registration_p->device,
+        session_p->pgn,
+        session_p->source_address,
+        session_p->data,
+        session_p->size);
+
+    rx_change_count++;
+}
+
+
+//=============================================================================
+//
+// j1939_tp_process_rx_message(): Returns TRUE if the message is a
+// TP.CM or TP.DT, which has been handled here. While no multi-packet
+// PGN is registered, they are passed on like any other message.
+//
+//=============================================================================
+//
+static bool_t
+j1939_tp_process_rx_message(
+    const Can_Message_ *received_can_message,
+    uint8_t module_id,
+    CANLINE_ can_line)
+{
+    uint8_t pf = J1939_PF(received_can_message->identifier);
+
+    if ((tp_registration_count == 0) ||
+        (received_can_message->type != EXTENDED) ||
+        (received_can_message->length < 8))
+    {
+        return FALSE;
+    }
+
+    if (pf == (uint8_t)(J1939_PGN_TP_CM >> 8))
+    {
+        j1939_tp_process_cm(received_can_message, module_id, can_line);
+        return TRUE;
+    }
+
+    if (pf == (uint8_t)(J1939_PGN_TP_DT >> 8))
+    {
+        j1939_tp_process_dt(received_can_message, module_id, can_line);
+        return TRUE;
+    }
+
+    return FALSE;
+}
+
+
+//=============================================================================
+//
+// j1939_tp_check_session_timeouts(): called each loop from
+// can_rx_check_message_timeouts(). An RTS/CTS transfer that times
+// out is aborted.
+//
+//=============================================================================
+//
+static void j1939_tp_check_session_timeouts()
+{
+    uint8_t i;
+
+    for (i = 0; i < FVT_CAN_TP_MAX_SESSIONS; i++)
+    {
+        can_tp_session_t *session_p = &tp_sessions[i];
+
+        if (!session_p->in_use)
+        {
+            continue;
+        }
+
+        if (session_p->destination_address == J1939_GLOBAL_ADDRESS)
+        {
+            if (time_service_ms_since(session_p->last_packet_ms) >
+                J1939_TP_BAM_TIMEOUT_MS)
+            {
+                session_p->in_use = FALSE;
+            }
+        }
+        else if (time_service_ms_since(session_p->last_packet_ms) >
+                 J1939_TP_CTS_TIMEOUT_MS)
+        {
+            j1939_tp_abort(session_p, J1939_TP_ABORT_TIMEOUT);
+            session_p->in_use = FALSE;
+        }
+    }
+}
+
+
+//=============================================================================
+//
+// j1939_tp_send_cts(): clears the next packets of an RTS/CTS
+// transfer, as many as the sender will take.
+//
+//=============================================================================
+//
+static void j1939_tp_send_cts(can_tp_session_t *session_p)
+{
+    uint8_t remaining = (uint8_t)(session_p->packets - session_p->next_packet + 1);
+    uint8_t count = remaining;
+
+    if (count > session_p->max_packets_per_cts)
+    {
+        count = session_p->max_packets_per_cts;
+    }
+
+    const uint8_t bytes[] =
+        { J1939_TP_CM_CTS, count, session_p->next_packet, 0xFF, 0xFF };
+
+    session_p->last_cts_packet = (uint8_t)(session_p->next_packet + count - 1);
+
+    j1939_tp_send_cm(session_p->module_id,
+                     session_p->can_line,
+                     session_p->source_address,
+                     session_p->pgn,
+                     bytes);
+}
+
+
+//=============================================================================
+//
+// j1939_tp_abort(): aborts an RTS/CTS transfer.
+//
+//=============================================================================
+//
+static void j1939_tp_abort(const can_tp_session_t *session_p, uint8_t reason)
+{
+    const uint8_t bytes[] = { J1939_TP_CM_ABORT, reason, 0xFF, 0xFF, 0xFF };
+
+    j1939_tp_send_cm(session_p->module_id,
+                     session_p->can_line,
+                     session_p->source_address,
+                     session_p->pgn,
+                     bytes);
+}
+
+
+//=============================================================================
+//
+// j1939_tp_send_cm(): sends a TP.CM from the CVC, with the control
+// byte and the next four bytes from bytes, followed by the PGN.
+//
+//=============================================================================
+//
+static void
+j1939_tp_send_cm(
+    uint8_t module_id,
+    CANLINE_ can_line,
+    uint8_t destination_address,
+    uint32_t pgn,
+    const uint8_t *bytes)
+{
+    Can_Message_ tx_message;
+    uint8_t i;
+
+    tx_message.identifier = ((uint32_t)7 << 26) |
+                            ((uint32_t)J1939_PGN_TP_CM << 8) |
+                            ((uint32_t)destination_address << 8) |
+                            J1939_CVC_SOURCE_ADDRESS;
+    tx_message.length = 8;
+    tx_message.type = EXTENDED;
+
+    for (i = 0; i < 5; i++)
+    {
+        tx_message.data[i] = bytes[i];
+    }
+
+    tx_message.data[5] = (uint8_t)(pgn & 0xFF);
+    tx_message.data[6] = (uint8_t)((pgn >> 8) & 0xFF);
+    tx_message.data[7] = (uint8_t)((pgn >> 16) & 0xFF);
+
+    Send_CAN_Message(module_id, can_line, tx_message);
+}
+
+
+
 //=============================================================================
 //=============================================================================
 //=============================================================================
@@ -1620,6 +2584,19 @@ create_device_linked_data_record(
 {
     device_data_t *device_data_ptr;
 
+    //
+    // Each driver resolves the records of its instances into a table
+    // of FVT_MAX_DEVICE_INSTANCES, so an instance outside of it can
+    // never be found.
+    //
+    if ((device_instance < ONE) ||
+        (device_instance > FVT_MAX_DEVICE_INSTANCES))
+    {
+        registration_failure_count++;
+        DEBUG("Device instance out of range!");
+        return NULL;
+    }
+
     //
     // Check if a linked data record for this device has already been
     // created.
@@ -1656,7 +2633,6 @@ create_device_linked_data_record(
         //
         device_data_ptr =
             (device_data_t *)malloc(sizeof_device_data_t);
-        memset((uint8_t *)device_data_ptr, 0, sizeof_device_data_t);
 
         *first_device_data_ptr = device_data_ptr;
     }
@@ -1669,8 +2645,6 @@ create_device_linked_data_record(
         device_data_ptr->next_ptr =
             (device_data_t *)malloc(sizeof_device_data_t);
 
-        memset((uint8_t *)device_data_ptr->next_ptr, 0, sizeof_device_data_t);
-
         //
         // Set out data record pointer to point to this newly created
         // record.
@@ -1692,10 +2666,13 @@ create_device_linked_data_record(
         //
         // Not enough space on the heap to satisfy our request.
         //
+        registration_failure_count++;
         DEBUG("Malloc error, no space on heap!");
         return NULL;
     }
 
+    memset((uint8_t *)device_data_ptr, 0, sizeof_device_data_t);
+
     //
     // The device rx data record pointer is now pointing to a newly
     // created record. Since a 'new device' has been instantiated,
@@ -1706,6 +2683,17 @@ create_device_linked_data_record(
     device_data_ptr->device_instance_number =
         *device_instance_counter;
 
+    //
+    // The records are looked up by device_instance_number, so the
+    // instances of a device must be initialised in order (ONE, TWO,
+    // ...). Otherwise the record for this device can never be found.
+    //
+    if (device_data_ptr->device_instance_number != device_instance)
+    {
+        registration_failure_count++;
+        DEBUG("Device instance initialised out of order!");
+    }
+
     //
     // Set this newly created data record's next pointer to NULL.
     //
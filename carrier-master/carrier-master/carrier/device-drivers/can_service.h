@@ -16,6 +16,18 @@
 #define NO_RX_TIMEOUT_FOUND 0
 #define NO_RX_MESSAGES_REGISTERED 0xffffffff
 
+//
+// J1939: the source address of the CVC, the DM1 (active diagnostic
+// trouble codes) PGN, and the transport protocol PGNs and control
+// bytes for messages longer than 8 bytes.
+//
+#define J1939_CVC_SOURCE_ADDRESS 0x27
+#define J1939_GLOBAL_ADDRESS     0xFF
+#define J1939_PGN_DM1            0xFECA
+#define J1939_PGN_TP_CM          0xEC00
+#define J1939_PGN_TP_DT          0xEB00
+#define J1939_TP_CM_BAM          32
+
 typedef enum {NONE=0,
               ONE=1,
               TWO=2,
@@ -28,38 +40,47 @@ typedef enum {NONE=0,
               ALL=255
 } device_instances_t;
 
+//
+// The highest device instance a driver can be initialised for. Each
+// driver resolves the records of its instances into a table of this
+// size, see e.g. pdm_get_device_data_ptr().
+//
+#define FVT_MAX_DEVICE_INSTANCES EIGHT
+
 //
 // CAN transmit frequency and expected CAN receive message rates.
 //
-// NOTE: These enum values assume a User_App() call period of 10ms, as
-//       defined in Orchestra.
+// NOTE: These enum values are in milliseconds. Transmit counters and
+//       receive timeout counters advance by the time elapsed since
+//       the previous User_App() loop (time_service.h), so the rates
+//       hold whatever loop period is set in Orchestra.
 //
 typedef enum {
 	TIMED_OUT = -1,
 	NO_TIME_OUT = 0,
     TX_SEND_EACH_CALL = 0,
-    EVERY_10MS = 1,
-    EVERY_20MS = 2,
-    EVERY_30MS = 3,
-    EVERY_40MS = 4,
-    EVERY_50MS = 5,
-    EVERY_60MS = 6,
-    EVERY_70MS = 7,
-    EVERY_80MS = 8,
-    EVERY_90MS = 9,
-    EVERY_100MS = 10,
-    EVERY_200MS = 20,
-    EVERY_300MS = 30,
-    EVERY_400MS = 40,
-    EVERY_500MS = 50,
-    EVERY_600MS = 60,
-    EVERY_700MS = 70,
-    EVERY_800MS = 80,
-    EVERY_900MS = 90,
-    EVERY_1000MS = 100,
-	EVERY_2S = 200,
-	EVERY_5S = 500,
-	EVERY_10S = 1000,
+    EVERY_10MS = 10,
+    EVERY_20MS = 20,
+    EVERY_30MS = 30,
+    EVERY_40MS = 40,
+    EVERY_50MS = 50,
+    EVERY_60MS = 60,
+    EVERY_70MS = 70,
+    EVERY_80MS = 80,
+    EVERY_90MS = 90,
+    EVERY_100MS = 100,
+    EVERY_200MS = 200,
+    EVERY_300MS = 300,
+    EVERY_400MS = 400,
+    EVERY_500MS = 500,
+    EVERY_600MS = 600,
+    EVERY_700MS = 700,
+    EVERY_800MS = 800,
+    EVERY_900MS = 900,
+    EVERY_1000MS = 1000,
+	EVERY_2S = 2000,
+	EVERY_5S = 5000,
+	EVERY_10S = 10000,
 } can_rate_t;
 
 
@@ -139,6 +160,78 @@ void fvt_can_process_rx_message(
     CANLINE_ can_line);
 
 
+//////////////////////////////////////////////////////////////////////////////
+//
+// This function must be called once, at the end of User_Init(), after
+// every device driver has been initialised. Returns FALSE if any
+// device record or CAN registration could not be created, or if a
+// device instance was initialised out of order.
+//
+//////////////////////////////////////////////////////////////////////////////
+//
+bool_t fvt_can_validate_device_registrations();
+
+//
+// The result of fvt_can_validate_device_registrations().
+//
+bool_t fvt_can_get_device_registrations_valid();
+
+//
+// A count of the changes made to received device data: incremented
+// each time a received CAN message is handed to a device rx handler
+// and each time a receive timeout function is called. Consumers keep
+// the last count they saw and only recompute values derived from
+// received data when it has changed.
+//
+uint32_t fvt_can_get_rx_change_count();
+
+//
+// The age of a received message: the ms since it was last received,
+// or since it was registered if it has not been received yet. The
+// age is kept in the registration record, so a driver looks up a
+// handle to the record once, at init, and every read of the age is
+// a subtraction.
+//
+#define FVT_CAN_RX_AGE_UNKNOWN 0xFFFFFFFF
+
+typedef const struct can_rx_registration_s *can_rx_handle_t;
+
+can_rx_handle_t
+fvt_can_get_receive_handle(
+    uint8_t module_id,
+    CANLINE_ can_line,
+    uint32_t can_id);
+
+can_rx_handle_t
+fvt_can_get_receive_handle_j1939_byte(
+    uint8_t module_id,
+    CANLINE_ can_line,
+    uint32_t can_id,
+    uint8_t j1939_byte);
+
+//
+// FVT_CAN_RX_AGE_UNKNOWN for a NULL handle.
+//
+uint32_t fvt_can_get_receive_age_ms(can_rx_handle_t handle);
+
+//
+// The rx_change_count of a single receive message: incremented each
+// time that message is handed to its rx handler or times out. A
+// consumer that reads only some devices sums the counts of their
+// messages, so it is not woken by traffic it does not read. 0 for a
+// NULL handle.
+//
+uint32_t fvt_can_get_receive_change_count(can_rx_handle_t handle);
+
+//
+// The registered receive messages that are currently timed out, up
+// to max_timeouts of them. Returns the number found.
+//
+uint8_t fvt_can_get_timed_out_receive_ids(
+    can_rx_timeout_status_t *timeouts,
+    uint8_t max_timeouts);
+
+
 int canPrintf(
     uint8_t module_id,
     CANLINE_ can_line,
@@ -174,6 +267,52 @@ int canPrintf(
     } \
 
 
+// NULL pointer checks for the device drivers.
+//
+// NULL_CHECK() is an assertion, for a pointer that cannot be NULL
+// once the driver has been initialised, such as the address of a
+// message in a device record or the data handed to an rx handler. It
+// reports a NULL pointer with DEBUG() in a debug build
+// (FVT_DEBUG_BUILD > 0) and compiles out of a release build.
+//
+// NULL_CHECK_RETURN() and NULL_CHECK_RETURN_VOID() are for a pointer
+// that is NULL when a device instance or CAN registration could not
+// be created, or was never initialised: the device record returned by
+// a driver's xxx_get_device_data_ptr() and the tx registrations held
+// in it. They return in both builds, a getter with its default value,
+// so a missing instance reads as no data instead of dereferencing
+// NULL. A debug build also reports it with DEBUG(). The failures are
+// counted when they happen, and fvt_can_validate_device_registrations()
+// at the end of User_Init() stops User_App() running the vehicle
+// control if there were any.
+//
+// USAGE: 1) NULL_CHECK(source_ptr);
+//        2) NULL_CHECK_RETURN(device_data_ptr, FALSE);
+//        3) NULL_CHECK_RETURN_VOID(device_data_ptr);
+#ifndef FVT_DEBUG_BUILD
+#define FVT_DEBUG_BUILD 0
+#endif
+
+#if (FVT_DEBUG_BUILD > 0)
+#define NULL_CHECK(ptr)                                                 \
+    if ((ptr) == NULL) {DEBUG("NULL Pointer");}
+
+#define NULL_CHECK_RETURN(ptr, ret)                                     \
+    if ((ptr) == NULL) {DEBUG("NULL Pointer"); return (ret);}
+
+#define NULL_CHECK_RETURN_VOID(ptr)                                     \
+    if ((ptr) == NULL) {DEBUG("NULL Pointer"); return;}
+#else
+#define NULL_CHECK(ptr)
+
+#define NULL_CHECK_RETURN(ptr, ret)                                     \
+    if ((ptr) == NULL) {return (ret);}
+
+#define NULL_CHECK_RETURN_VOID(ptr)                                     \
+    if ((ptr) == NULL) {return;}
+#endif
+
+
 #if(defined LITTLE_ENDIAN)
 #define BYTE_SWAP16(a) 	(a)
 #else
@@ -96,11 +96,11 @@ typedef struct can_tx_registration_s
     uint8_t module_id;
     // One of three CAN interfaces
     CANLINE_ can_line;
-    // A counter that is incremented when any of a device's CAN
-    // transmit methods are called. This will occur at the rate that
-    // User_App() is called by the underlying HED system services. The
-    // specific message registered will be transmitted only when this
-    // counter exceeds the transmit_counter_limit.
+    // A counter that is advanced by the milliseconds elapsed since
+    // the previous loop when any of a device's CAN transmit methods
+    // are called (see fvt_can_transmit_due()). The specific message
+    // registered will be transmitted only when this counter reaches
+    // the transmit_counter_limit.
     uint16_t transmit_counter;
     // See comment above. This value is set for each particular CAN
     // transmit message, with the transmit_counter_limit argument, to
@@ -127,6 +127,24 @@ typedef struct can_tx_registration_s
 typedef void (*p_rx_f_t)(device_instances_t, can_data_t *, int16_t *);
 typedef void (*p_rx_not_ok)(device_instances_t, uint8_t, CANLINE_, uint32_t, uint8_t);
 
+//
+// Typedef of the function called with the complete payload of a PGN
+// received with the J1939 transport protocol: device instance, PGN,
+// source address, payload and payload length.
+//
+typedef void (*p_rx_tp_f_t)(device_instances_t, uint32_t, uint8_t, const uint8_t *, uint16_t);
+
+//
+// J1939 transport protocol reassembly. The number of PGNs that can be
+// registered, the number of transfers that can be in progress at
+// once, and the largest payload of a transfer. Each session has its
+// own FVT_CAN_TP_MAX_SIZE buffer. A larger RTS is aborted; a larger
+// BAM is ignored.
+//
+#define FVT_CAN_TP_MAX_REGISTRATIONS 8
+#define FVT_CAN_TP_MAX_SESSIONS      4
+#define FVT_CAN_TP_MAX_SIZE          256
+
 //
 // Function prototypes visible only to device drivers.
 //
@@ -147,6 +165,14 @@ bool_t fvt_can_register_receive_id_j1939_byte(
     p_rx_f_t handler_function_p,
     p_rx_not_ok timeout_function_p);
 
+bool_t fvt_can_register_receive_pgn_tp(
+    device_instances_t device_instance,
+    uint8_t module_id,
+    CANLINE_ can_line,
+    uint32_t pgn,
+    uint8_t source_address,
+    p_rx_tp_f_t handler_function_p);
+
 can_tx_registration_t *
 fvt_can_register_transmit_id(
     device_instances_t device_instance,
@@ -173,6 +199,15 @@ fvt_can_register_transmit_id_j1939_byte(
     IDENTIFIER_TYPE_ type,
     uint8_t j1939_byte);
 
+//
+// Advances the transmit counter of a registration record by the time
+// elapsed since the previous loop. Returns TRUE when the message is
+// due to be sent, in which case the counter has already been wound
+// back by one period. Must be called once per loop per message.
+//
+bool_t fvt_can_transmit_due(
+    can_tx_registration_t *tx_registration_record_p);
+
 void rx_message_timeout(
     device_instances_t device,
     uint8_t module_id,
@@ -118,6 +118,13 @@ typedef enum {
 //
 device_data_t *first_cl712_device_data_ptr = NULL;
 
+//
+// The record of each device instance, indexed by device instance -
+// 1. Resolved once, by cl712_init(). NULL for an instance that
+// has not been initialised. See cl712_get_device_data_ptr().
+//
+static device_data_t *cl712_device_data_ptrs[FVT_MAX_DEVICE_INSTANCES];
+
 //
 // This is incremented each for each device instance
 //
@@ -200,6 +207,19 @@ cl712_init(
         		&device_instance_counter,
                 sizeof(device_data_t));
 
+    //
+    // The record could not be created. This is counted by can_service,
+    // so fvt_can_validate_device_registrations() fails and the vehicle
+    // control is not run. The instance is left unresolved, and its
+    // getters return their defaults.
+    //
+    if (device_data_ptr == NULL)
+    {
+        return;
+    }
+
+    cl712_device_data_ptrs[device - ONE] = device_data_ptr;
+
     fvt_can_register_receive_id(
         device,
         module_id,
@@ -426,6 +446,32 @@ cl712_init(
 
 }
 
+
+/******************************************************************************
+ *
+ *        Name: cl712_get_device_data_ptr()
+ *
+ * Description: The record of a device instance, as resolved by
+ *              cl712_init(). NULL if the instance has not been
+ *              initialised or is out of range.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+device_data_t *
+cl712_get_device_data_ptr(
+    device_instances_t device)
+{
+    if ((device < ONE) || (device > FVT_MAX_DEVICE_INSTANCES))
+    {
+        return NULL;
+    }
+
+    return cl712_device_data_ptrs[device - ONE];
+}
+
 static void pump_fan_control_rx_timeout(
     device_instances_t device,
     uint8_t module_id,
@@ -439,8 +485,8 @@ static void pump_fan_control_rx_timeout(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        cl712_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Mark this message as having timed out.
@@ -469,8 +515,8 @@ static void throttle_calibaration_rx_timeout(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        cl712_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Mark this message as having timed out.
@@ -499,8 +545,8 @@ static void service_timer_rx_timeout(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        cl712_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Mark this message as having timed out.
@@ -535,7 +581,7 @@ static void cl712_rx_pump_fan_control(
 	int16_t *receive_timeout_counter)
 {
     // Check can_data_ptr is not NULL.
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // This will be a pointer to the device's receive data structure
@@ -547,15 +593,15 @@ static void cl712_rx_pump_fan_control(
     // Get a pointer to this device's data record.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        cl712_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Have the pointer to this device's data record, not get a
     // pointer to the appropriate receive data structure.
     //
     dest_ptr = &(device_data_ptr->rx_message_1);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     //
     // Copy the data from the received CAN message to the designated
@@ -591,7 +637,7 @@ static void cl712_rx_throttle_calibaration(
 	int16_t *receive_timeout_counter)
 {
     // Check can_data_ptr is not NULL.
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // This will be a pointer to the device's receive data structure
@@ -603,15 +649,15 @@ static void cl712_rx_throttle_calibaration(
     // Get a pointer to this device's data record.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        cl712_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Have the pointer to this device's data record, not get a
     // pointer to the appropriate receive data structure.
     //
     dest_ptr = &(device_data_ptr->rx_message_2);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     //
     // Copy the data from the received CAN message to the designated
@@ -683,7 +729,7 @@ static void cl712_rx_service_time_setting(
 {
 
     // Check can_data_ptr is not NULL.
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // This will be a pointer to the device's receive data structure
@@ -695,15 +741,15 @@ static void cl712_rx_service_time_setting(
     // Get a pointer to this device's data record.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        cl712_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Have the pointer to this device's data record, not get a
     // pointer to the appropriate receive data structure.
     //
     dest_ptr = &(device_data_ptr->rx_message_3);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     //
     // Copy the data from the received CAN message to the designated
@@ -810,8 +856,8 @@ void cl712_tx_can_message1(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        cl712_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -819,7 +865,7 @@ void cl712_tx_can_message1(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_tx_data1_can_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -833,19 +879,17 @@ void cl712_tx_can_message1(
     //
     cl712_tx_main_screen_message1_t *can_data_ptr =
         (cl712_tx_main_screen_message1_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     // Send the CAN message if time to do so.
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get a
         // pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->tx_message1);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit buffer.
@@ -882,8 +926,8 @@ void cl712_tx_can_message2(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        cl712_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -891,7 +935,7 @@ void cl712_tx_can_message2(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_tx_data2_can_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -905,19 +949,17 @@ void cl712_tx_can_message2(
     //
     cl712_tx_main_screen_message2_t *can_data_ptr =
         (cl712_tx_main_screen_message2_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     // Send the CAN message if time to do so.
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get a
         // pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->tx_message2);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit buffer.
@@ -954,8 +996,8 @@ void cl712_tx_can_message3(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        cl712_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -963,7 +1005,7 @@ void cl712_tx_can_message3(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_tx_data3_can_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -977,19 +1019,17 @@ void cl712_tx_can_message3(
     //
     cl712_tx_main_screen_message3_t *can_data_ptr =
         (cl712_tx_main_screen_message3_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     // Send the CAN message if time to do so.
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get a
         // pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->tx_message3);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit buffer.
@@ -1026,8 +1066,8 @@ void cl712_tx_can_message4(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        cl712_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -1035,7 +1075,7 @@ void cl712_tx_can_message4(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_tx_data4_can_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -1049,19 +1089,17 @@ void cl712_tx_can_message4(
     //
     cl712_tx_main_screen_message4_t *can_data_ptr =
         (cl712_tx_main_screen_message4_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     // Send the CAN message if time to do so.
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get a
         // pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->tx_message4);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit buffer.
@@ -1098,8 +1136,8 @@ void cl712_tx_can_message5(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        cl712_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -1107,7 +1145,7 @@ void cl712_tx_can_message5(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_tx_data5_can_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -1121,19 +1159,17 @@ void cl712_tx_can_message5(
     //
     cl712_tx_bms_message1_t *can_data_ptr =
         (cl712_tx_bms_message1_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     // Send the CAN message if time to do so.
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get a
         // pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->tx_message5);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit buffer.
@@ -1171,8 +1207,8 @@ void cl712_tx_can_message6(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        cl712_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -1180,7 +1216,7 @@ void cl712_tx_can_message6(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_tx_data6_can_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -1194,19 +1230,17 @@ void cl712_tx_can_message6(
     //
     cl712_tx_bms_message2_t *can_data_ptr =
         (cl712_tx_bms_message2_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     // Send the CAN message if time to do so.
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get a
         // pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->tx_message6);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit buffer.
@@ -1243,8 +1277,8 @@ void cl712_tx_can_message7(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        cl712_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -1252,7 +1286,7 @@ void cl712_tx_can_message7(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_tx_data7_can_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -1266,19 +1300,17 @@ void cl712_tx_can_message7(
     //
     cl712_tx_bms_message3_t *can_data_ptr =
         (cl712_tx_bms_message3_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     // Send the CAN message if time to do so.
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get a
         // pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->tx_message7);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit buffer.
@@ -1315,8 +1347,8 @@ void cl712_tx_can_message8(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        cl712_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -1324,7 +1356,7 @@ void cl712_tx_can_message8(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_tx_data8_can_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -1338,19 +1370,17 @@ void cl712_tx_can_message8(
     //
     cl712_tx_bms_message4_t *can_data_ptr =
         (cl712_tx_bms_message4_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     // Send the CAN message if time to do so.
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get a
         // pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->tx_message8);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit buffer.
@@ -1387,8 +1417,8 @@ void cl712_tx_can_message9(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        cl712_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -1396,7 +1426,7 @@ void cl712_tx_can_message9(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_tx_data9_can_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -1410,19 +1440,17 @@ void cl712_tx_can_message9(
     //
     cl712_tx_bms_message5_t *can_data_ptr =
         (cl712_tx_bms_message5_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     // Send the CAN message if time to do so.
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get a
         // pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->tx_message9);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit buffer.
@@ -1459,8 +1487,8 @@ void cl712_tx_can_message10(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        cl712_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -1468,7 +1496,7 @@ void cl712_tx_can_message10(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_tx_data10_can_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -1482,19 +1510,17 @@ void cl712_tx_can_message10(
     //
     cl712_tx_bms_message6_t *can_data_ptr =
         (cl712_tx_bms_message6_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     // Send the CAN message if time to do so.
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get a
         // pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->tx_message10);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit buffer.
@@ -1531,8 +1557,8 @@ void cl712_tx_can_message11(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        cl712_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -1540,7 +1566,7 @@ void cl712_tx_can_message11(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_tx_data11_can_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -1554,19 +1580,17 @@ void cl712_tx_can_message11(
     //
     cl712_tx_pdm_voltage_status_message1_t *can_data_ptr =
         (cl712_tx_pdm_voltage_status_message1_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     // Send the CAN message if time to do so.
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get a
         // pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->tx_message11);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit buffer.
@@ -1603,8 +1627,8 @@ void cl712_tx_can_message12(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        cl712_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -1612,7 +1636,7 @@ void cl712_tx_can_message12(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_tx_data12_can_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -1626,19 +1650,17 @@ void cl712_tx_can_message12(
     //
     cl712_tx_pdm_voltage_status_message2_t *can_data_ptr =
         (cl712_tx_pdm_voltage_status_message2_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     // Send the CAN message if time to do so.
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get a
         // pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->tx_message12);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit buffer.
@@ -1676,8 +1698,8 @@ void cl712_tx_can_message13(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        cl712_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -1685,7 +1707,7 @@ void cl712_tx_can_message13(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_tx_data13_can_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -1699,19 +1721,17 @@ void cl712_tx_can_message13(
     //
     cl712_tx_pdm_1_status_message1_t *can_data_ptr =
         (cl712_tx_pdm_1_status_message1_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     // Send the CAN message if time to do so.
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get a
         // pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->tx_message13);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit buffer.
@@ -1749,8 +1769,8 @@ void cl712_tx_can_message14(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        cl712_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -1758,7 +1778,7 @@ void cl712_tx_can_message14(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_tx_data14_can_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -1772,19 +1792,17 @@ void cl712_tx_can_message14(
     //
     cl712_tx_pdm_1_status_and_current_message2_t *can_data_ptr =
         (cl712_tx_pdm_1_status_and_current_message2_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     // Send the CAN message if time to do so.
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get a
         // pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->tx_message14);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit buffer.
@@ -1822,8 +1840,8 @@ void cl712_tx_can_message15(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        cl712_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -1831,7 +1849,7 @@ void cl712_tx_can_message15(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_tx_data15_can_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -1845,19 +1863,17 @@ void cl712_tx_can_message15(
     //
     cl712_tx_pdm_1_current_message3_t *can_data_ptr =
         (cl712_tx_pdm_1_current_message3_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     // Send the CAN message if time to do so.
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get a
         // pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->tx_message15);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit buffer.
@@ -1895,8 +1911,8 @@ void cl712_tx_can_message16(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        cl712_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -1904,7 +1920,7 @@ void cl712_tx_can_message16(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_tx_data16_can_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -1918,19 +1934,17 @@ void cl712_tx_can_message16(
     //
     cl712_tx_pdm_2_status_message1_t *can_data_ptr =
         (cl712_tx_pdm_2_status_message1_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     // Send the CAN message if time to do so.
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get a
         // pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->tx_message16);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit buffer.
@@ -1968,8 +1982,8 @@ void cl712_tx_can_message17(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        cl712_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -1977,7 +1991,7 @@ void cl712_tx_can_message17(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_tx_data17_can_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -1991,19 +2005,17 @@ void cl712_tx_can_message17(
     //
     cl712_tx_pdm_2_status_and_current_message2_t *can_data_ptr =
         (cl712_tx_pdm_2_status_and_current_message2_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     // Send the CAN message if time to do so.
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get a
         // pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->tx_message17);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit buffer.
@@ -2041,8 +2053,8 @@ void cl712_tx_can_message18(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        cl712_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -2050,7 +2062,7 @@ void cl712_tx_can_message18(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_tx_data18_can_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -2064,19 +2076,17 @@ void cl712_tx_can_message18(
     //
     cl712_tx_pdm_2_current_message3_t *can_data_ptr =
         (cl712_tx_pdm_2_current_message3_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     // Send the CAN message if time to do so.
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get a
         // pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->tx_message18);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit buffer.
@@ -2113,8 +2123,8 @@ void cl712_tx_can_message19(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        cl712_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -2122,7 +2132,7 @@ void cl712_tx_can_message19(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_tx_data19_can_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -2136,19 +2146,17 @@ void cl712_tx_can_message19(
     //
     cl712_tx_pdm_3_status_message1_t *can_data_ptr =
         (cl712_tx_pdm_3_status_message1_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     // Send the CAN message if time to do so.
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get a
         // pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->tx_message19);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit buffer.
@@ -2186,8 +2194,8 @@ void cl712_tx_can_message20(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        cl712_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -2195,7 +2203,7 @@ void cl712_tx_can_message20(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_tx_data20_can_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -2209,19 +2217,17 @@ void cl712_tx_can_message20(
     //
     cl712_tx_pdm_3_status_and_current_message2_t *can_data_ptr =
         (cl712_tx_pdm_3_status_and_current_message2_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     // Send the CAN message if time to do so.
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get a
         // pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->tx_message20);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit buffer.
@@ -2259,8 +2265,8 @@ void cl712_tx_can_message21(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        cl712_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -2268,7 +2274,7 @@ void cl712_tx_can_message21(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_tx_data21_can_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -2282,19 +2288,17 @@ void cl712_tx_can_message21(
     //
     cl712_tx_pdm_3_current_message3_t *can_data_ptr =
         (cl712_tx_pdm_3_current_message3_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     // Send the CAN message if time to do so.
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get a
         // pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->tx_message21);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit buffer.
@@ -2332,8 +2336,8 @@ void cl712_tx_can_message22(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        cl712_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -2341,7 +2345,7 @@ void cl712_tx_can_message22(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_tx_data22_can_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -2355,19 +2359,17 @@ void cl712_tx_can_message22(
     //
     cl712_tx_traction_drive_message1_t *can_data_ptr =
         (cl712_tx_traction_drive_message1_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     // Send the CAN message if time to do so.
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get a
         // pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->tx_message22);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit buffer.
@@ -2405,8 +2407,8 @@ void cl712_tx_can_message23(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        cl712_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -2414,7 +2416,7 @@ void cl712_tx_can_message23(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_tx_data23_can_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -2428,19 +2430,17 @@ void cl712_tx_can_message23(
     //
     cl712_tx_traction_drive_message2_t *can_data_ptr =
         (cl712_tx_traction_drive_message2_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     // Send the CAN message if time to do so.
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get a
         // pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->tx_message23);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit buffer.
@@ -2477,8 +2477,8 @@ void cl712_tx_can_message24(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        cl712_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -2486,7 +2486,7 @@ void cl712_tx_can_message24(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_tx_data24_can_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -2500,19 +2500,17 @@ void cl712_tx_can_message24(
     //
     cl712_tx_hydraulic_drive_message1_t *can_data_ptr =
         (cl712_tx_hydraulic_drive_message1_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     // Send the CAN message if time to do so.
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get a
         // pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->tx_message24);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit buffer.
@@ -2549,8 +2547,8 @@ void cl712_tx_can_message25(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        cl712_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -2558,7 +2556,7 @@ void cl712_tx_can_message25(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_tx_data25_can_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -2572,19 +2570,17 @@ void cl712_tx_can_message25(
     //
     cl712_tx_system_pressure_message1_t *can_data_ptr =
         (cl712_tx_system_pressure_message1_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     // Send the CAN message if time to do so.
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get a
         // pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->tx_message25);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit buffer.
@@ -2621,8 +2617,8 @@ void cl712_tx_can_message26(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        cl712_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -2630,7 +2626,7 @@ void cl712_tx_can_message26(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_tx_data26_can_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -2644,19 +2640,17 @@ void cl712_tx_can_message26(
     //
     cl712_tx_system_pressure_message2_t *can_data_ptr =
         (cl712_tx_system_pressure_message2_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     // Send the CAN message if time to do so.
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get a
         // pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->tx_message26);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit buffer.
@@ -2694,8 +2688,8 @@ void cl712_tx_can_message27(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        cl712_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -2703,7 +2697,7 @@ void cl712_tx_can_message27(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_tx_data27_can_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -2717,19 +2711,17 @@ void cl712_tx_can_message27(
     //
     cl712_tx_pump_fan_status *can_data_ptr =
         (cl712_tx_pump_fan_status *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     // Send the CAN message if time to do so.
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get a
         // pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->tx_message27);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit buffer.
@@ -2766,8 +2758,8 @@ void cl712_tx_can_message28(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        cl712_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -2775,7 +2767,7 @@ void cl712_tx_can_message28(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_tx_data28_can_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -2789,19 +2781,17 @@ void cl712_tx_can_message28(
     //
     cl712_tx_pump_fan_override_status *can_data_ptr =
         (cl712_tx_pump_fan_override_status *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     // Send the CAN message if time to do so.
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get a
         // pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->tx_message28);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit buffer.
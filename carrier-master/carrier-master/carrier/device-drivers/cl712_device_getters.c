@@ -12,19 +12,13 @@
 
 #include "cl712_device_private.h"
 
-extern device_data_t *first_cl712_device_data_ptr;
-
 bool_t get_hydraulic_motor_pump_override(device_instances_t device)
 {
 
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
+        cl712_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)((device_data_ptr->rx_message_1.hydraulic_motor_pump_override));
 
@@ -34,13 +28,9 @@ bool_t get_traction_motor_pump_override(device_instances_t device)
 {
 
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
+        cl712_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)((device_data_ptr->rx_message_1.traction_motor_pump_override));
 
@@ -50,13 +40,9 @@ bool_t pe_pump_override(device_instances_t device)
 {
 
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
+        cl712_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)((device_data_ptr->rx_message_1.pe_pump_override));
 
@@ -65,13 +51,9 @@ bool_t pe_pump_override(device_instances_t device)
 bool_t charger_pump_override(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
+        cl712_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)((device_data_ptr->rx_message_1.charger_pump_override));
 
@@ -81,13 +63,9 @@ bool_t charger_fan_override(device_instances_t device)
 {
 
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
+        cl712_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)((device_data_ptr->rx_message_1.charger_fan_override));
 
@@ -96,13 +74,9 @@ bool_t charger_fan_override(device_instances_t device)
 bool_t pe_fan_override(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
+        cl712_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)((device_data_ptr->rx_message_1.pe_fan_override));
 }
@@ -497,6 +497,15 @@ get_device_linked_data_record_instance_ptr(
     device_data_t *first_device_data_ptr);
 
 
+//
+// The record of a device instance, resolved once by cl712_init().
+// NULL if the instance has not been initialised.
+//
+device_data_t *
+cl712_get_device_data_ptr(
+    device_instances_t device);
+
+
 #endif
 
 
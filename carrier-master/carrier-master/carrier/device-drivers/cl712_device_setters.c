@@ -12,8 +12,6 @@
 #include "Prototypes.h"
 #include "cl712_device_private.h"
 
-extern device_data_t *first_cl712_device_data_ptr;
-
 /******************************************************************************
  *
  *        Name: cl712_set_tx_message1()
@@ -38,15 +36,15 @@ void cl712_set_tx_main_screen_message1(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
+		cl712_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->tx_message1);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
 	dest_ptr->odometer_m = BYTE_SWAP32(odometer_m);
     dest_ptr->hourmeter_s = BYTE_SWAP32(hourmeter_s);
@@ -73,15 +71,15 @@ void cl712_set_tx_main_screen_message2(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
+		cl712_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->tx_message2);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
 
     dest_ptr->time_until_service_s = BYTE_SWAP32(time_until_service_s);
@@ -112,15 +110,15 @@ void cl712_set_tx_main_screen_message3(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
+		cl712_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->tx_message3);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
 
     dest_ptr->gear_ratio = gear_ratio;
@@ -150,15 +148,15 @@ void cl712_set_tx_main_screen_message4(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
+		cl712_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->tx_message4);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
 	dest_ptr->crit_fail_hv_off_reason = BYTE_SWAP32(crit_fail_hv_off_reason);
     dest_ptr->crit_fail_hv_on_reason = BYTE_SWAP32(crit_fail_hv_on_reason);
@@ -185,15 +183,15 @@ void cl712_set_tx_bms_screen_message1(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
+		cl712_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->tx_message5);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     dest_ptr->battery_1_high_cell_voltage_mv = BYTE_SWAP16(battery_1_high_cell_voltage_mv);
     dest_ptr->battery_1_low_cell_voltage_mv = BYTE_SWAP16(battery_1_low_cell_voltage_mv);
@@ -224,15 +222,15 @@ void cl712_set_tx_bms_screen_message2(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
+		cl712_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->tx_message6);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
 	dest_ptr->battery_1_temperature_c = BYTE_SWAP16(battery_1_temperature_c);
     dest_ptr->battery_1_pack_current_v10 = BYTE_SWAP16(battery_1_pack_current_v10);
@@ -263,15 +261,15 @@ void cl712_set_tx_bms_screen_message3(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
+		cl712_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->tx_message7);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     dest_ptr->battery_2_high_cell_voltage_mv = BYTE_SWAP16(battery_2_high_cell_voltage_mv);
     dest_ptr->battery_2_low_cell_voltage_mv = BYTE_SWAP16(battery_2_low_cell_voltage_mv);
@@ -301,15 +299,15 @@ void cl712_set_tx_bms_screen_message4(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
+		cl712_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->tx_message8);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
 	dest_ptr->battery_2_temperature_c = BYTE_SWAP16(battery_2_temperature_c);
     dest_ptr->battery_2_pack_current_v10 = BYTE_SWAP16(battery_2_pack_current_v10);
@@ -341,15 +339,15 @@ void cl712_set_tx_bms_screen_message5(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
+		cl712_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->tx_message9);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     dest_ptr->battery_3_high_cell_voltage_mv = BYTE_SWAP16(battery_3_high_cell_voltage_mv);
     dest_ptr->battery_3_low_cell_voltage_mv = BYTE_SWAP16(battery_3_low_cell_voltage_mv);
@@ -381,15 +379,15 @@ void cl712_set_tx_bms_screen_message6(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
+		cl712_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->tx_message10);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
 	dest_ptr->battery_3_temperature_c = BYTE_SWAP16(battery_3_temperature_c);
     dest_ptr->battery_3_pack_current_v10 = BYTE_SWAP16(battery_3_pack_current_v10);
@@ -421,15 +419,15 @@ void cl712_set_tx_pdm_status_screen_message1(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
+		cl712_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->tx_message11);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
 	dest_ptr->pdm_1_supply_voltage_v10 = BYTE_SWAP16(pdm_1_supply_voltage_v10);
     dest_ptr->pdm_2_supply_voltage_v10 = BYTE_SWAP16(pdm_2_supply_voltage_v10);
@@ -462,15 +460,15 @@ void cl712_set_tx_pdm_status_screen_message2(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
+		cl712_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->tx_message12);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
 	dest_ptr->pdm_3_status = pdm_3_status;
     dest_ptr->data2 = arg2;
@@ -507,15 +505,15 @@ void cl712_set_tx_pdm_1_status_screen_message1(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
+		cl712_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->tx_message13);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
 
     dest_ptr->pdm_1_reverse_lights_status = pdm_1_reverse_lights_status;
@@ -552,15 +550,15 @@ void cl712_set_tx_pdm_1_status_and_current_screen_message2(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
+		cl712_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->tx_message14);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     dest_ptr->pdm_1_left_spray_selenoid_status = pdm_1_left_spray_selenoid_status;
     dest_ptr->pdm_1_spare_status = pdm_1_spare_status;
@@ -597,15 +595,15 @@ void cl712_set_tx_pdm_1_current_screen_message3(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
+		cl712_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->tx_message15);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
 
     dest_ptr->pdm_1_reverse_beeper_current = pdm_1_reverse_beeper_current;
@@ -643,15 +641,15 @@ void cl712_set_tx_pdm_2_status_screen_message1(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
+		cl712_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->tx_message16);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     dest_ptr->pdm_2_start_drain_selenoid_status = pdm_2_start_drain_selenoid_status;
     dest_ptr->pdm_2_aux_hydraulics_12v_bussbar_status = pdm_2_aux_hydraulics_12v_bussbar_status;
@@ -688,15 +686,15 @@ void cl712_set_tx_pdm_2_status_and_current_screen_message2(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
+		cl712_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->tx_message17);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     dest_ptr->pdm_2_brake_release_selenoid_status = pdm_2_brake_release_selenoid_status;
     dest_ptr->pdm_2_service_brake_selenoid_status = pdm_2_service_brake_selenoid_status;
@@ -732,15 +730,15 @@ void cl712_set_tx_pdm_2_current_screen_message3(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
+		cl712_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->tx_message18);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
 
     dest_ptr->pdm_2_gear_3_selenoid_current = pdm_2_gear_3_selenoid_current;
@@ -778,15 +776,15 @@ void cl712_set_tx_pdm_3_status_screen_message1(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
+		cl712_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->tx_message19);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     dest_ptr->pdm_3_work_lights_status = pdm_3_work_lights_status;
     dest_ptr->pdm_3_beacon_status = pdm_3_beacon_status;
@@ -823,15 +821,15 @@ void cl712_set_tx_pdm_3_status_and_current_screen_message2(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
+		cl712_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->tx_message20);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     dest_ptr->pdm_3_pump_charger_1_cooling_status = pdm_3_pump_charger_1_cooling_status;
     dest_ptr->pdm_3_pump_charger_2_cooling_status = pdm_3_pump_charger_2_cooling_status;
@@ -868,15 +866,15 @@ void cl712_set_tx_pdm_3_current_screen_message3(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
+		cl712_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->tx_message21);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     dest_ptr->pdm_3_charger_1_bussbar_current = pdm_3_charger_1_bussbar_current;
     dest_ptr->pdm_3_drive_motor_cooling_pump_current = pdm_3_drive_motor_cooling_pump_current;
@@ -913,15 +911,15 @@ void cl712_set_tx_drive_system_screen_message1(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
+		cl712_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->tx_message22);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     dest_ptr->drive_dc_voltage_v10 = BYTE_SWAP16(drive_dc_voltage_v10);
     dest_ptr->drive_motor_rpm = BYTE_SWAP16(drive_motor_rpm);
@@ -951,15 +949,15 @@ void cl712_set_tx_drive_system_screen_message2(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
+		cl712_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->tx_message23);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     dest_ptr->throttle_adc_raw = BYTE_SWAP16(throttle_adc_raw);
     dest_ptr->throttle_released = BYTE_SWAP16(throttle_released);
@@ -989,15 +987,15 @@ void cl712_set_tx_hydraulic_drive_system_screen_message1(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
+		cl712_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->tx_message24);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     dest_ptr->ehs_dc_voltage_v10 = BYTE_SWAP16(ehs_dc_voltage_v10);
     dest_ptr->ehs_motor_rpm = BYTE_SWAP16(ehs_motor_rpm);
@@ -1028,15 +1026,15 @@ void cl712_set_tx_system_pressures_screen_message1(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
+		cl712_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->tx_message25);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     dest_ptr->main_pressure_psi = BYTE_SWAP16(main_pressure_psi);
     dest_ptr->front_brake_pressure_psi = BYTE_SWAP16(front_brake_pressure_psi);
@@ -1065,15 +1063,15 @@ void cl712_set_tx_system_pressures_screen_message2(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
+		cl712_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->tx_message26);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     dest_ptr->front_parking_brake_psi = BYTE_SWAP16(front_parking_brake_psi);
     dest_ptr->front_accumulator_pressure_psi = BYTE_SWAP16(front_accumulator_pressure_psi);
@@ -1104,15 +1102,15 @@ void cl712_set_pump_fan_status_message1(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
+		cl712_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->tx_message27);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     dest_ptr->traction_pump_status = traction_pump_status;
     dest_ptr->hydraulic_pump_status = hydraulic_pump_status;
@@ -1145,15 +1143,15 @@ void cl712_set_pump_fan_override_status_message1(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_cl712_device_data_ptr);
+		cl712_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->tx_message28);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     dest_ptr->traction_pump_override_status = traction_pump_override_status;
     dest_ptr->hydraulic_pump_override_status = hydraulic_pump_override_status;
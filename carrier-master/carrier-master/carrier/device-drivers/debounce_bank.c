@@ -0,0 +1,245 @@
+/******************************************************************************
+ *
+ *        Name: debounce_bank.c
+ *
+ * Description: A bank of debounces evaluated in one pass per loop.
+ *              Each channel behaves like a timer_service timer set
+ *              up with timer_setup_ms():
+ *
+ *              RISING : The output goes true once the input has been
+ *                       true for the period. The output follows the
+ *                       input going false right away.
+ *
+ *              FALLING: The output goes false once the input has
+ *                       been false for the period. The output follows
+ *                       the input going true right away.
+ *
+ *              A FALLING channel is a RISING channel on the inverted
+ *              input with an inverted output, so both are handled by
+ *              the same loop by XORing with the falling mask.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+
+#include <stdlib.h>
+#include "Prototypes.h"
+#include "Constants.h"
+#include "typedefs.h"
+#include "can_service.h"
+#include "timer_service.h"
+#include "time_service.h"
+#include "debounce_bank.h"
+
+//
+// The output bitset is 32 bits wide.
+//
+typedef char debounce_bank_channel_count_check[
+    (NUM_DEBOUNCE_CHANNELS <= 32) ? 1 : -1];
+
+//=============================================================================
+//
+// Channel table: debounce period in milliseconds and timer type. The
+// fault channels are left out; they are RISING, and their periods
+// are copied from the fault table on the first pass.
+//
+//=============================================================================
+//
+static const uint32_t input_period_ms[NUM_DEBOUNCE_CHANNELS] =
+{
+    [DEBOUNCE_CHARGER_1_BEGIN_CHARGING]    = 500,
+    [DEBOUNCE_CHARGER_2_BEGIN_CHARGING]    = 500,
+};
+
+static const timer_type_t debounce_type[NUM_DEBOUNCE_CHANNELS] =
+{
+    [DEBOUNCE_CHARGER_1_BEGIN_CHARGING]    = RISING,
+    [DEBOUNCE_CHARGER_2_BEGIN_CHARGING]    = RISING,
+};
+
+//=============================================================================
+//
+// Static Variables
+//
+//=============================================================================
+//
+static uint32_t debounce_period_ms[NUM_DEBOUNCE_CHANNELS];
+static uint32_t debounce_counter_ms[NUM_DEBOUNCE_CHANNELS];
+
+static uint32_t debounce_inputs = 0;
+static uint32_t debounce_outputs = 0;
+static uint32_t debounce_falling_mask = 0;
+
+
+/******************************************************************************
+ *
+ *        Name: debounce_bank_update()
+ *
+ * Description: For every channel, the counter counts up by the
+ *              elapsed time while the (possibly inverted) input is
+ *              active and is cleared when it is not. The counter
+ *              stops at the period. A channel is done when its input
+ *              is active and its counter has reached the period.
+ *
+ *              The only branch in the loop is the saturation at the
+ *              period, which compiles to a conditional move.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+void debounce_bank_update()
+{
+    static bool_t first_pass = TRUE;
+
+    uint32_t elapsed = time_service_get_elapsed_ms();
+    uint32_t active_inputs;
+    uint32_t done = 0;
+    uint32_t i;
+
+    if (first_pass)
+    {
+        //
+        // Build the period table and the falling mask. A falling
+        // channel starts with its counter at the period, so its
+        // output starts low, same as timer_setup().
+        //
+        for (i = 0; i < NUM_DEBOUNCE_CHANNELS; i++)
+        {
+            if ((i >= DEBOUNCE_FAULT_FIRST) && (i <= DEBOUNCE_FAULT_LAST))
+            {
+                debounce_period_ms[i] = fault_manager_get_definition(
+                    (fault_id_t)(i - DEBOUNCE_FAULT_FIRST))->debounce_ms;
+            }
+            else
+            {
+                debounce_period_ms[i] = input_period_ms[i];
+            }
+
+            if (debounce_type[i] == FALLING)
+            {
+                debounce_falling_mask |= ((uint32_t)1 << i);
+                debounce_counter_ms[i] = debounce_period_ms[i];
+            }
+            else
+            {
+                debounce_counter_ms[i] = 0;
+            }
+        }
+
+        first_pass = FALSE;
+    }
+
+    active_inputs = debounce_inputs ^ debounce_falling_mask;
+
+    for (i = 0; i < NUM_DEBOUNCE_CHANNELS; i++)
+    {
+        uint32_t active = (active_inputs >> i) & 1;
+        uint32_t period = debounce_period_ms[i];
+
+        //
+        // Count up while active, clear when not.
+        //
+        uint32_t counter = (debounce_counter_ms[i] + elapsed) & (0 - active);
+
+        counter = (counter > period) ? period : counter;
+
+        debounce_counter_ms[i] = counter;
+
+        done |= (active & (uint32_t)(counter >= period)) << i;
+    }
+
+    debounce_outputs = done ^ debounce_falling_mask;
+}
+
+
+//=============================================================================
+//
+// debounce_bank_set_input()
+//
+//=============================================================================
+//
+void debounce_bank_set_input(
+    debounce_channel_t channel,
+    bool_t input)
+{
+    if (channel >= NUM_DEBOUNCE_CHANNELS)
+    {
+        DEBUG("Invalid debounce channel");
+        return;
+    }
+
+    if (input)
+    {
+        debounce_inputs |= ((uint32_t)1 << channel);
+    }
+    else
+    {
+        debounce_inputs &= ~((uint32_t)1 << channel);
+    }
+}
+
+
+//=============================================================================
+//
+// debounce_bank_get_output()
+//
+//=============================================================================
+//
+bool_t debounce_bank_get_output(
+    debounce_channel_t channel)
+{
+    if (channel >= NUM_DEBOUNCE_CHANNELS)
+    {
+        DEBUG("Invalid debounce channel");
+        return FALSE;
+    }
+
+    return (bool_t)((debounce_outputs >> channel) & 1);
+}
+
+
+//=============================================================================
+//
+// debounce_bank_get_outputs()
+//
+//=============================================================================
+//
+uint32_t debounce_bank_get_outputs()
+{
+    return debounce_outputs;
+}
+
+
+//=============================================================================
+//
+// debounce_bank_get_inputs()
+//
+//=============================================================================
+//
+uint32_t debounce_bank_get_inputs()
+{
+    return debounce_inputs;
+}
+
+
+//=============================================================================
+//
+// debounce_bank_get_counter()
+//
+//=============================================================================
+//
+uint32_t debounce_bank_get_counter(
+    debounce_channel_t channel)
+{
+    if (channel >= NUM_DEBOUNCE_CHANNELS)
+    {
+        DEBUG("Invalid debounce channel");
+        return 0;
+    }
+
+    return debounce_counter_ms[channel];
+}
@@ -0,0 +1,88 @@
+/******************************************************************************
+ *
+ *        Name: debounce_bank.h
+ *
+ * Description: All the fault and input debounces of the vehicle in
+ *              one place. The inputs, counters and periods are kept
+ *              in parallel arrays indexed by debounce_channel_t and
+ *              are evaluated together in a single pass by
+ *              debounce_bank_update(), once per loop. The debounced
+ *              outputs are returned as a bitset.
+ *
+ *              Producers latch their raw input with
+ *              debounce_bank_set_input() anywhere in the loop. The
+ *              inputs are debounced at the top of the next loop, so
+ *              an output lags its input by one loop on top of the
+ *              debounce period.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+
+#ifndef DEBOUNCE_BANK_H_
+#define DEBOUNCE_BANK_H_
+
+//
+// For NUM_FAULTS.
+//
+#include "fault_manager.h"
+
+//
+// One entry per debounce. The period and type of each channel are
+// set in the channel table in debounce_bank.c. There can be no more
+// than 32 channels, one per bit of the output bitset.
+//
+typedef enum
+{
+    //
+    // One RISING channel per fault, in fault_id_t order. Their
+    // periods are the debounce_ms of the fault table in
+    // fault_manager.c.
+    //
+    DEBOUNCE_FAULT_FIRST = 0,
+    DEBOUNCE_FAULT_LAST = DEBOUNCE_FAULT_FIRST + NUM_FAULTS - 1,
+
+    DEBOUNCE_CHARGER_1_BEGIN_CHARGING,
+    DEBOUNCE_CHARGER_2_BEGIN_CHARGING,
+    NUM_DEBOUNCE_CHANNELS
+} debounce_channel_t;
+
+/******************************************************************************
+ *
+ *        Name: debounce_bank_update()
+ *
+ * Description: Debounces every channel in one pass, using the time
+ *              elapsed since the previous loop. Must be called once
+ *              at the top of User_App(), after time_service_update().
+ *
+ ******************************************************************************
+ */
+void debounce_bank_update();
+
+//
+// Latch the raw input of a channel. The last value set in a loop is
+// the one debounced.
+//
+void debounce_bank_set_input(debounce_channel_t channel, bool_t input);
+
+//
+// The debounced output of a single channel.
+//
+bool_t debounce_bank_get_output(debounce_channel_t channel);
+
+//
+// Bitsets of all the debounced outputs and latched raw inputs. Bit n
+// is debounce_channel_t n.
+//
+uint32_t debounce_bank_get_outputs();
+uint32_t debounce_bank_get_inputs();
+
+//
+// Milliseconds the input of a channel has been in its active state,
+// stopping at the period of the channel.
+//
+uint32_t debounce_bank_get_counter(debounce_channel_t channel);
+
+#endif // DEBOUNCE_BANK_H_
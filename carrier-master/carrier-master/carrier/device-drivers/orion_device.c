@@ -89,6 +89,13 @@ void bms_data9_rx_timeout(
     uint32_t can_id,
     uint8_t j1939_byte);
 
+void cell_broadcast_rx_timeout(
+    device_instances_t device,
+    uint8_t module_id,
+    CANLINE_ can_line,
+    uint32_t can_id,
+    uint8_t j1939_byte);
+
 //
 // These functions are private in that they are called only from HED's
 // User_Can_Receive() via a pointer that is obtained from a call to
@@ -139,6 +146,11 @@ static void rx_orion_pack_cycle_data(
     can_data_t *can_data_ptr,
     int16_t *receive_counter);
 
+static void rx_orion_cell_broadcast(
+    device_instances_t device,
+    can_data_t *can_data_ptr,
+    int16_t *receive_counter);
+
 //
 // A pointer to the first structure in the linked list compound
 // structures that represent all of the skai inverter received data
@@ -147,6 +159,13 @@ static void rx_orion_pack_cycle_data(
 //
 device_data_t *first_orion_device_data_ptr = NULL;
 
+//
+// The record of each device instance, indexed by device instance -
+// 1. Resolved once, by init_orion_bms(). NULL for an instance that
+// has not been initialised. See orion_get_device_data_ptr().
+//
+static device_data_t *orion_device_data_ptrs[FVT_MAX_DEVICE_INSTANCES];
+
 //
 // This is incremented each for each device instance
 //
@@ -165,6 +184,7 @@ typedef enum {
 	ORION_BMS_CELL_DATA_2 = 0x001B5007,
 	ORION_BMS_PACK_ISO_FAULT = 0x001B5008,
 	ORION_BMS_CYCLE_DATA = 0x001B5009,
+	ORION_BMS_CELL_BROADCAST = 0x001B500A,
 } ORION_BMS_RECEIVE_IDS;
 
 
@@ -257,6 +277,20 @@ void init_orion_bms(
         		&first_orion_device_data_ptr,
         		&device_instance_counter,
                 sizeof(device_data_t));
+
+    //
+    // The record could not be created. This is counted by can_service,
+    // so fvt_can_validate_device_registrations() fails and the vehicle
+    // control is not run. The instance is left unresolved, and its
+    // getters return their defaults.
+    //
+    if (device_data_ptr == NULL)
+    {
+        return;
+    }
+
+    orion_device_data_ptrs[device - ONE] = device_data_ptr;
+
     //
     // Register an interest to receive the following CAN messages from
     // the skai2 device instance.
@@ -333,7 +367,70 @@ void init_orion_bms(
         rx_orion_pack_cycle_data,
         bms_data9_rx_timeout);
 
+    fvt_can_register_receive_id(
+        device,
+        module_id,
+        can_line,
+        ORION_BMS_CELL_BROADCAST + get_instance_offset(device),
+        rx_orion_cell_broadcast,
+        cell_broadcast_rx_timeout);
+
+    device_data_ptr->cycle_data_rx_handle =
+        fvt_can_get_receive_handle(
+            module_id,
+            can_line,
+            ORION_BMS_CYCLE_DATA + get_instance_offset(device));
+
+    //
+    // The age of the BMS data runs from here until the first cycle
+    // data.
+    //
+    device_data_ptr->counter_advance_ms = time_service_get_ms();
+
+    device_data_ptr->inst_data_rx_handle =
+        fvt_can_get_receive_handle(
+            module_id,
+            can_line,
+            ORION_BMS_INST_DATA + get_instance_offset(device));
+
+    device_data_ptr->dcl_ccl_temp_rx_handle =
+        fvt_can_get_receive_handle(
+            module_id,
+            can_line,
+            ORION_BMS_DCL_CCL_TEMP + get_instance_offset(device));
+
+    device_data_ptr->misc_data_rx_handle =
+        fvt_can_get_receive_handle(
+            module_id,
+            can_line,
+            ORION_BMS_MISC_DATA + get_instance_offset(device));
+
+}
+
 
+/******************************************************************************
+ *
+ *        Name: orion_get_device_data_ptr()
+ *
+ * Description: The record of a device instance, as resolved by
+ *              init_orion_bms(). NULL if the instance has not been
+ *              initialised or is out of range.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+device_data_t *
+orion_get_device_data_ptr(
+    device_instances_t device)
+{
+    if ((device < ONE) || (device > FVT_MAX_DEVICE_INSTANCES))
+    {
+        return NULL;
+    }
+
+    return orion_device_data_ptrs[device - ONE];
 }
 
 
@@ -364,8 +461,8 @@ void bms_data1_rx_timeout(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        orion_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Mark this message as having timed out.
@@ -408,8 +505,8 @@ void bms_data2_rx_timeout(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        orion_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Mark this message as having timed out.
@@ -452,8 +549,8 @@ void bms_data3_rx_timeout(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        orion_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Mark this message as having timed out.
@@ -496,8 +593,8 @@ void custom_faults_rx_timeout(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        orion_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Mark this message as having timed out.
@@ -540,8 +637,8 @@ void bms_data5_rx_timeout(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        orion_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Mark this message as having timed out.
@@ -584,8 +681,8 @@ void bms_data6_rx_timeout(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        orion_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Mark this message as having timed out.
@@ -628,8 +725,8 @@ void bms_data7_rx_timeout(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        orion_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Mark this message as having timed out.
@@ -672,8 +769,8 @@ void bms_data8_rx_timeout(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        orion_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Mark this message as having timed out.
@@ -716,8 +813,8 @@ void bms_data9_rx_timeout(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        orion_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Mark this message as having timed out.
@@ -733,6 +830,50 @@ void bms_data9_rx_timeout(
 }
 
 
+/******************************************************************************
+ *
+ *        Name: cell_broadcast_rx_timeout()
+ *
+ * Description: This function, registered with can_service and will be
+ *              called when the received CAN message assocoated with
+ *              this function, by registration, times out due to not
+ *              having been received with the the timeout limit, if
+ *              one has been set.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+void cell_broadcast_rx_timeout(
+    device_instances_t device,
+    uint8_t module_id,
+    CANLINE_ can_line,
+    uint32_t can_id,
+    uint8_t j1939_byte)
+{
+    //
+    // Get a pointer to this device instance's device_data_t
+    // structure.
+    //
+    device_data_t *device_data_ptr =
+        orion_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
+
+    //
+    // Mark this message as having timed out.
+    //
+    device_data_ptr->cell_broadcast_rx_ok = FALSE;
+
+    //
+    // Call this function in can_service.c which is used as a common
+    // location where a breakpoint may be placed to catch all receive
+    // CAN message timeouts.
+    //
+    rx_message_timeout(device, module_id, can_line, can_id, j1939_byte);
+}
+
+
 
 
 
@@ -753,7 +894,7 @@ static void rx_orion_inst_data(device_instances_t device,
 								int16_t *receive_counter)
 {
     // Check can_data_ptr is not NULL.
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // This will be a pointer to the device's receive data structure
@@ -764,15 +905,15 @@ static void rx_orion_inst_data(device_instances_t device,
     // Get a pointer to this device's data record.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        orion_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Have the pointer to this device's data record, not get a
     // pointer to the appropriate receive data structure.
     //
     dest_ptr = &(device_data_ptr->bms_data1);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     //
     // Copy the data from the received CAN message to the designated
@@ -816,7 +957,7 @@ static void rx_orion_dcl_ccl_temp(device_instances_t device,
 								  int16_t *receive_counter)
 {
     // Check can_data_ptr is not NULL.
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // This will be a pointer to the device's receive data structure
@@ -828,15 +969,15 @@ static void rx_orion_dcl_ccl_temp(device_instances_t device,
     // Get a pointer to this device's data record.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        orion_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Have the pointer to this device's data record, not get a
     // pointer to the appropriate receive data structure.
     //
     dest_ptr = &(device_data_ptr->bms_data2);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     //
     // Copy the data from the received CAN message to the designated
@@ -876,7 +1017,7 @@ static void rx_orion_bms_data(device_instances_t device,
 								  int16_t *receive_counter)
 {
     // Check can_data_ptr is not NULL.
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // This will be a pointer to the device's receive data structure
@@ -888,15 +1029,15 @@ static void rx_orion_bms_data(device_instances_t device,
     // Get a pointer to this device's data record.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        orion_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Have the pointer to this device's data record, not get a
     // pointer to the appropriate receive data structure.
     //
     dest_ptr = &(device_data_ptr->bms_data3);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     //
     // Copy the data from the received CAN message to the designated
@@ -939,7 +1080,7 @@ static void rx_orion_faults_with_identifiers(device_instances_t device,
 								  int16_t *receive_counter)
 {
     // Check can_data_ptr is not NULL.
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // This will be a pointer to the device's receive data structure
@@ -951,15 +1092,15 @@ static void rx_orion_faults_with_identifiers(device_instances_t device,
     // Get a pointer to this device's data record.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        orion_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Have the pointer to this device's data record, not get a
     // pointer to the appropriate receive data structure.
     //
     dest_ptr = &(device_data_ptr->bms_data5);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     //
     // Copy the data from the received CAN message to the designated
@@ -992,7 +1133,7 @@ static void rx_orion_cell_data_1(device_instances_t device,
 								  int16_t *receive_counter)
 {
     // Check can_data_ptr is not NULL.
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // This will be a pointer to the device's receive data structure
@@ -1004,15 +1145,15 @@ static void rx_orion_cell_data_1(device_instances_t device,
     // Get a pointer to this device's data record.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        orion_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Have the pointer to this device's data record, not get a
     // pointer to the appropriate receive data structure.
     //
     dest_ptr = &(device_data_ptr->bms_data6);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     //
     // Copy the data from the received CAN message to the designated
@@ -1055,7 +1196,7 @@ static void rx_orion_cell_data_2(device_instances_t device,
 								  int16_t *receive_counter)
 {
     // Check can_data_ptr is not NULL.
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // This will be a pointer to the device's receive data structure
@@ -1067,15 +1208,15 @@ static void rx_orion_cell_data_2(device_instances_t device,
     // Get a pointer to this device's data record.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        orion_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Have the pointer to this device's data record, not get a
     // pointer to the appropriate receive data structure.
     //
     dest_ptr = &(device_data_ptr->bms_data7);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     //
     // Copy the data from the received CAN message to the designated
@@ -1116,7 +1257,7 @@ static void rx_orion_pack_isolation_fault(device_instances_t device,
 								  int16_t *receive_counter)
 {
     // Check can_data_ptr is not NULL.
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // This will be a pointer to the device's receive data structure
@@ -1128,15 +1269,15 @@ static void rx_orion_pack_isolation_fault(device_instances_t device,
     // Get a pointer to this device's data record.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        orion_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Have the pointer to this device's data record, not get a
     // pointer to the appropriate receive data structure.
     //
     dest_ptr = &(device_data_ptr->bms_data8);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     //
     // Copy the data from the received CAN message to the designated
@@ -1178,7 +1319,7 @@ static void rx_orion_pack_cycle_data(device_instances_t device,
 								  int16_t *receive_counter)
 {
     // Check can_data_ptr is not NULL.
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // This will be a pointer to the device's receive data structure
@@ -1190,15 +1331,17 @@ static void rx_orion_pack_cycle_data(device_instances_t device,
     // Get a pointer to this device's data record.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        orion_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Have the pointer to this device's data record, not get a
     // pointer to the appropriate receive data structure.
     //
     dest_ptr = &(device_data_ptr->bms_data9);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
+
+    uint8_t last_rolling_counter = (uint8_t)dest_ptr->rolling_counter;
 
     //
     // Copy the data from the received CAN message to the designated
@@ -1207,6 +1350,15 @@ static void rx_orion_pack_cycle_data(device_instances_t device,
     memcpy(dest_ptr, can_data_ptr,
            sizeof(bms_pack_data9_t));
 
+    //
+    // The data is only fresh while the rolling counter advances. A
+    // repeated counter, even after a receive timeout, does not count.
+    //
+    if ((uint8_t)dest_ptr->rolling_counter != last_rolling_counter)
+    {
+        device_data_ptr->counter_advance_ms = time_service_get_ms();
+    }
+
     //
     // All 16-bit values need to be byte swapped as this is a big
     // endian uP and CAN is little endian.
@@ -1227,7 +1379,7 @@ static void rx_orion_custom_faults(device_instances_t device,
 								  int16_t *receive_counter)
 {
     // Check can_data_ptr is not NULL.
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // This will be a pointer to the device's receive data structure
@@ -1239,15 +1391,15 @@ static void rx_orion_custom_faults(device_instances_t device,
     // Get a pointer to this device's data record.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        orion_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Have the pointer to this device's data record, not get a
     // pointer to the appropriate receive data structure.
     //
     dest_ptr = &(device_data_ptr->custom_faults);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     //
     // Copy the data from the received CAN message to the designated
@@ -1265,6 +1417,68 @@ static void rx_orion_custom_faults(device_instances_t device,
 }
 
 
+/******************************************************************************
+ *
+ *        Name: rx_orion_cell_broadcast()
+ *
+ * Description: Stores the instant voltage of one cell in the cell
+ *              table, as a difference from the base voltage of the
+ *              table. The first cell received sets the base, until
+ *              the average cell voltage moves it.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+static void rx_orion_cell_broadcast(device_instances_t device,
+                                    can_data_t *can_data_ptr,
+                                    int16_t *receive_counter)
+{
+    // Check can_data_ptr is not NULL.
+    NULL_CHECK(can_data_ptr);
+
+    //
+    // Get a pointer to this device's data record.
+    //
+    device_data_t *device_data_ptr =
+        orion_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
+
+    orion_cell_table_t *table = &(device_data_ptr->cell_table);
+
+    uint8_t cell = (uint8_t)can_data_ptr->MDL.bit8.BYTE0;
+
+    //
+    // Units 0.1mV, MSB first.
+    //
+    uint16_t voltage =
+        (uint16_t)((can_data_ptr->MDL.bit8.BYTE1 << 8) |
+                   can_data_ptr->MDL.bit8.BYTE2);
+
+    uint16_t voltage_mv = (uint16_t)((voltage + 5) / 10);
+
+	*receive_counter = 0;
+    //
+    // Indicate that this message has been received.
+    //
+    device_data_ptr->cell_broadcast_rx_ok = TRUE;
+
+    //
+    // The table is as long as the maximum number of cells of the BMS.
+    // Until the BMS has reported that, the cells are dropped. They
+    // come round again with the next cycle of the broadcast.
+    //
+    if ((cell >= ORION_CELL_TABLE_MAX_CELLS) ||
+        (cell >= device_data_ptr->bms_data7.maximum_number_of_cells))
+    {
+        return;
+    }
+
+    table->voltage_mv[cell] = voltage_mv;
+}
+
+
 /******************************************************************************
  *
  *        Name: Set_RX_CAN_TIMEOUT
@@ -1398,3 +1612,16 @@ void orion_bms_set_timeout_orion_bms_cycle_data(
         ORION_BMS_CYCLE_DATA + get_instance_offset(device),
         receive_timeout_counter_limit);
 }
+
+void orion_bms_set_timeout_orion_bms_cell_broadcast(
+    device_instances_t device,
+    uint8_t module_id,
+    CANLINE_ can_line,
+    can_rate_t receive_timeout_counter_limit)
+{
+    fvt_can_set_timeout_receive_id(
+        module_id,
+        can_line,
+        ORION_BMS_CELL_BROADCAST + get_instance_offset(device),
+        receive_timeout_counter_limit);
+}
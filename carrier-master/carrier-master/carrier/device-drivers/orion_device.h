@@ -13,6 +13,17 @@
 #ifndef ORION_DEVICE_H_
 #define ORION_DEVICE_H_
 
+//
+// The most cells an Orion BMS 2 supports, and so the size of the cell
+// table of each BMS.
+//
+#define ORION_CELL_TABLE_MAX_CELLS  180
+
+//
+// The voltage of a cell that has not been received.
+//
+#define ORION_CELL_NO_DATA          0
+
 //=============================================================================
 //
 // Description: ORION BMS Initialisation Function
@@ -84,6 +95,12 @@ void orion_bms_set_timeout_orion_bms_cycle_data(
     CANLINE_ can_line,
     can_rate_t receive_timeout_counter_limit);
 
+void orion_bms_set_timeout_orion_bms_cell_broadcast(
+    device_instances_t device,
+    uint8_t module_id,
+    CANLINE_ can_line,
+    can_rate_t receive_timeout_counter_limit);
+
 
 /******************************************************************************
  * Current: Units = 0.1A This is the current pack amperage value for
@@ -294,6 +311,21 @@ uint16_t orion_get_pack_total_cycles(device_instances_t device);
  */
 uint8_t orion_get_rolling_counter(device_instances_t device);
 
+//
+// The ms since the rolling counter in the cycle data last advanced,
+// or since the BMS was initialised if it has not been received.
+// FVT_CAN_RX_AGE_UNKNOWN if the BMS is not fitted.
+//
+uint32_t orion_get_rx_age_ms(device_instances_t device);
+
+//
+// Goes up each time the instantaneous, DCL/CCL/temperature, misc or
+// cycle data of the BMS is received or times out. Those are the
+// messages the battery pack getters of orion_control.c read. 0 if
+// the BMS is not fitted.
+//
+uint32_t orion_get_pack_data_change_count(device_instances_t device);
+
 
 //=============================================================================
 //
@@ -392,4 +424,29 @@ bool_t orion_get_current_status_charge_current_limit_alternate_current_limit(dev
 
 bool_t orion_get_can_rx_ok(device_instances_t device);
 
+//=============================================================================
+//
+//
+// Cell Table
+//
+// The voltage of every cell, from the cell broadcast, in mV. The
+// length of the table is the maximum number of cells of the BMS, up
+// to ORION_CELL_TABLE_MAX_CELLS, and is 0 until the BMS has reported
+// it.
+//
+//
+//=============================================================================
+//
+uint8_t orion_get_cell_table_length(device_instances_t device);
+
+//
+// Units = mV. ORION_CELL_NO_DATA if the cell has not been received.
+//
+uint16_t orion_get_cell_voltage_mv(device_instances_t device, uint8_t cell);
+
+//
+// Units = 0.0001V, to 1mV. 0 if the cell has not been received.
+//
+uint16_t orion_get_cell_voltage(device_instances_t device, uint8_t cell);
+
 #endif
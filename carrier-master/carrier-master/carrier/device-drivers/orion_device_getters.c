@@ -14,8 +14,6 @@
 #include "orion_device_private.h"
 #include "orion_device.h"
 
-extern device_data_t *first_orion_device_data_ptr;
-
 //=============================================================================
 //
 // CAN ID: 0x00N5001
@@ -32,13 +30,9 @@ extern device_data_t *first_orion_device_data_ptr;
 int16_t orion_get_instantaneous_pack_current(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // Units 0.1A
@@ -56,13 +50,9 @@ int16_t orion_get_instantaneous_pack_current(device_instances_t device)
 uint16_t orion_get_instantaneous_pack_voltage(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // Units = 0.1V
@@ -80,13 +70,9 @@ uint16_t orion_get_instantaneous_pack_voltage(device_instances_t device)
 uint16_t orion_get_pack_high_cell_voltage(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     // The transmitted value is multiplied by 10, hence the received value
     // is multiplied by 0.0001.
@@ -103,13 +89,9 @@ uint16_t orion_get_pack_high_cell_voltage(device_instances_t device)
 uint16_t orion_get_pack_low_cell_voltage(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     // The transmitted value is multiplied by 10, hence the received value
     // is multiplied by 0.0001.
@@ -133,13 +115,9 @@ uint16_t orion_get_pack_low_cell_voltage(device_instances_t device)
 uint16_t orion_get_pack_discharge_current_limit(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (uint16_t)(device_data_ptr->bms_data2.pack_discharge_current_limit);
 }
@@ -153,13 +131,9 @@ uint16_t orion_get_pack_discharge_current_limit(device_instances_t device)
 uint16_t orion_get_pack_charge_current_limit(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (uint16_t)(device_data_ptr->bms_data2.pack_charge_current_limit);
 }
@@ -173,13 +147,9 @@ uint16_t orion_get_pack_charge_current_limit(device_instances_t device)
 int8_t orion_get_pack_high_cell_temperature(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (int8_t)(device_data_ptr->bms_data2.pack_high_temperature);
 }
@@ -193,13 +163,9 @@ int8_t orion_get_pack_high_cell_temperature(device_instances_t device)
 int8_t orion_get_pack_low_cell_temperature(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (int8_t)(device_data_ptr->bms_data2.pack_low_temperature);
 }
@@ -213,13 +179,9 @@ int8_t orion_get_pack_low_cell_temperature(device_instances_t device)
 int8_t orion_get_pack_average_cell_temperature(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (int8_t)(device_data_ptr->bms_data2.pack_average_temperature);
 }
@@ -233,13 +195,9 @@ int8_t orion_get_pack_average_cell_temperature(device_instances_t device)
 int8_t orion_get_internal_bms_temperature(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (int8_t)(device_data_ptr->bms_data2.internal_temperature);
 }
@@ -260,13 +218,9 @@ int8_t orion_get_internal_bms_temperature(device_instances_t device)
 uint8_t orion_get_state_of_charge(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     // The transmitted value is multipled by 2, hence the received value
     // is multiplied by 0.5.
@@ -282,13 +236,9 @@ uint8_t orion_get_state_of_charge(device_instances_t device)
 uint16_t orion_get_pack_total_resiatance(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     // The transmitted value is multiplied by 10, hence the received value
     // is multiplied by 0.0010.
@@ -304,13 +254,9 @@ uint16_t orion_get_pack_total_resiatance(device_instances_t device)
 uint16_t orion_get_pack_open_voltage(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     // The transmitted value is multiplied by 10, hence the received value
     // is multiplied by 0.1.
@@ -326,13 +272,9 @@ uint16_t orion_get_pack_open_voltage(device_instances_t device)
 uint16_t orion_get_pack_amp_hours(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     // The transmitted value is multiplied by 10, hence the received value
     // is multiplied by 0.1.
@@ -355,13 +297,9 @@ uint16_t orion_get_pack_amp_hours(device_instances_t device)
 uint8_t orion_get_pack_health(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (uint8_t)(device_data_ptr->custom_faults.pack_health);
 }
@@ -375,13 +313,9 @@ uint8_t orion_get_pack_health(device_instances_t device)
 uint8_t orion_get_pack_relay_status(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (uint8_t)(device_data_ptr->custom_faults.pack_relay_status);
 }
@@ -402,13 +336,9 @@ uint8_t orion_get_pack_relay_status(device_instances_t device)
 uint16_t orion_get_average_cell_voltage(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     // The transmitted value is multiplied by 10, hence the received value
     // is multiplied by 0.0001.
@@ -424,13 +354,9 @@ uint16_t orion_get_average_cell_voltage(device_instances_t device)
 uint16_t orion_get_high_cell_resistance(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     // The transmitted value is multiplied by 10, hence the received value
     // is multiplied by 0.0001.
@@ -446,13 +372,9 @@ uint16_t orion_get_high_cell_resistance(device_instances_t device)
 uint16_t orion_get_low_cell_resistance(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     // The transmitted value is multiplied by 10, hence the received value
     // is multiplied by 0.01.
@@ -468,13 +390,9 @@ uint16_t orion_get_low_cell_resistance(device_instances_t device)
 uint16_t orion_get_average_cell_resistance(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     // The transmitted value is multiplied by 10, hence the received value
     // is multiplied by 0.01.
@@ -496,13 +414,9 @@ uint16_t orion_get_average_cell_resistance(device_instances_t device)
 uint16_t orion_get_high_open_cell_voltage(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (uint16_t)(device_data_ptr->bms_data7.high_open_cell_voltage);
 }
@@ -516,13 +430,9 @@ uint16_t orion_get_high_open_cell_voltage(device_instances_t device)
 uint16_t orion_get_low_open_cell_voltage(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (uint16_t)(device_data_ptr->bms_data7.low_open_cell_voltage);
 }
@@ -536,13 +446,9 @@ uint16_t orion_get_low_open_cell_voltage(device_instances_t device)
 uint16_t orion_get_low_power_supply_indicator(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     // The transmitted value is multiplied by 10, hence the received value
     // is multiplied by 0.1.
@@ -558,13 +464,9 @@ uint16_t orion_get_low_power_supply_indicator(device_instances_t device)
 uint8_t orion_get_maximum_number_of_cells(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (uint8_t)(device_data_ptr->bms_data7.maximum_number_of_cells);
 }
@@ -578,13 +480,9 @@ uint8_t orion_get_maximum_number_of_cells(device_instances_t device)
 uint8_t orion_get_number_of_populated_cells(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (uint8_t)(device_data_ptr->bms_data7.number_of_populated_cells);
 }
@@ -605,13 +503,9 @@ uint8_t orion_get_number_of_populated_cells(device_instances_t device)
 uint16_t orion_get_pack_total_cycles(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (uint16_t)(device_data_ptr->bms_data9.pack_total_cycles);
 }
@@ -625,17 +519,54 @@ uint16_t orion_get_pack_total_cycles(device_instances_t device)
 uint8_t orion_get_rolling_counter(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (uint8_t)(device_data_ptr->bms_data9.rolling_counter);
 }
 
+//=============================================================================
+//
+// orion_get_rx_age_ms()
+//
+//=============================================================================
+//
+uint32_t orion_get_rx_age_ms(device_instances_t device)
+{
+    device_data_t *device_data_ptr =
+        orion_get_device_data_ptr(device);
+
+    if (device_data_ptr == NULL)
+    {
+        return FVT_CAN_RX_AGE_UNKNOWN;
+    }
+
+    return time_service_ms_since(device_data_ptr->counter_advance_ms);
+}
+
+//=============================================================================
+//
+// orion_get_pack_data_change_count()
+//
+//=============================================================================
+//
+uint32_t orion_get_pack_data_change_count(device_instances_t device)
+{
+    device_data_t *device_data_ptr =
+        orion_get_device_data_ptr(device);
+
+    if (device_data_ptr == NULL)
+    {
+        return 0;
+    }
+
+    return fvt_can_get_receive_change_count(device_data_ptr->inst_data_rx_handle)
+        + fvt_can_get_receive_change_count(device_data_ptr->dcl_ccl_temp_rx_handle)
+        + fvt_can_get_receive_change_count(device_data_ptr->misc_data_rx_handle)
+        + fvt_can_get_receive_change_count(device_data_ptr->cycle_data_rx_handle);
+}
+
 
 //=============================================================================
 //
@@ -657,13 +588,9 @@ uint8_t orion_get_rolling_counter(device_instances_t device)
 uint8_t orion_get_pack_high_temperature_ID(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (uint8_t)(device_data_ptr->bms_data5.pack_high_temperature_ID);
 }
@@ -677,13 +604,9 @@ uint8_t orion_get_pack_high_temperature_ID(device_instances_t device)
 uint8_t orion_get_pack_low_temperature_ID(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (uint8_t)(device_data_ptr->bms_data5.pack_low_temperature_ID);
 }
@@ -697,13 +620,9 @@ uint8_t orion_get_pack_low_temperature_ID(device_instances_t device)
 uint8_t orion_get_pack_high_cell_voltage_ID(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (uint8_t)(device_data_ptr->bms_data5.pack_high_cell_voltage_ID);
 }
@@ -717,13 +636,9 @@ uint8_t orion_get_pack_high_cell_voltage_ID(device_instances_t device)
 uint8_t orion_get_pack_low_cell_voltage_ID(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (uint8_t)(device_data_ptr->bms_data5.pack_low_cell_voltage_ID);
 }
@@ -737,13 +652,9 @@ uint8_t orion_get_pack_low_cell_voltage_ID(device_instances_t device)
 uint8_t orion_get_pack_high_internal_resistance_ID(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (uint8_t)(device_data_ptr->bms_data5.pack_high_internal_resistance_ID);
 }
@@ -757,13 +668,9 @@ uint8_t orion_get_pack_high_internal_resistance_ID(device_instances_t device)
 uint8_t orion_get_pack_low_internal_resistance_ID(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (uint8_t)(device_data_ptr->bms_data5.pack_low_internal_resistance_ID);
 }
@@ -777,13 +684,9 @@ uint8_t orion_get_pack_low_internal_resistance_ID(device_instances_t device)
 uint8_t orion_get_pack_high_open_cell_voltage_ID(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (uint8_t)(device_data_ptr->bms_data5.pack_high_open_cell_voltage_ID);
 }
@@ -797,13 +700,9 @@ uint8_t orion_get_pack_high_open_cell_voltage_ID(device_instances_t device)
 uint8_t orion_get_pack_low_open_cell_voltage_ID(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (uint8_t)(device_data_ptr->bms_data5.pack_low_open_cell_voltage_ID);
 }
@@ -815,13 +714,9 @@ uint8_t orion_get_pack_low_open_cell_voltage_ID(device_instances_t device)
 bool_t orion_get_flag0_discharge_relay(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->custom_faults.discharge_relay);
 }
@@ -829,13 +724,9 @@ bool_t orion_get_flag0_discharge_relay(device_instances_t device)
 bool_t orion_get_flag0_charge_relay(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->custom_faults.charge_relay);
 }
@@ -843,13 +734,9 @@ bool_t orion_get_flag0_charge_relay(device_instances_t device)
 bool_t orion_get_flag0_charger_safety(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->custom_faults.charger_safety);
 }
@@ -857,13 +744,9 @@ bool_t orion_get_flag0_charger_safety(device_instances_t device)
 bool_t orion_get_flag0_voltage_fail_safe(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->custom_faults.voltage_fail_safe);
 }
@@ -871,13 +754,9 @@ bool_t orion_get_flag0_voltage_fail_safe(device_instances_t device)
 bool_t orion_get_flag0_current_fail_safe(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->custom_faults.current_fail_safe);
 }
@@ -885,13 +764,9 @@ bool_t orion_get_flag0_current_fail_safe(device_instances_t device)
 bool_t orion_get_flag0_power_supply_failure(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->custom_faults.power_supply_failure);
 }
@@ -899,13 +774,9 @@ bool_t orion_get_flag0_power_supply_failure(device_instances_t device)
 bool_t orion_get_flag0_multipurpose_input_state(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->custom_faults.multipurpose_input_state);
 }
@@ -917,13 +788,9 @@ bool_t orion_get_flag0_multipurpose_input_state(device_instances_t device)
 bool_t orion_get_flag1_internal_communication_fault(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->custom_faults.internal_communication_fault);
 }
@@ -931,13 +798,9 @@ bool_t orion_get_flag1_internal_communication_fault(device_instances_t device)
 bool_t orion_get_flag1_internal_conversion_fault(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->custom_faults.internal_conversion_fault);
 }
@@ -945,13 +808,9 @@ bool_t orion_get_flag1_internal_conversion_fault(device_instances_t device)
 bool_t orion_get_flag1_weak_cell_fault(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->custom_faults.weak_cell_fault);
 }
@@ -959,13 +818,9 @@ bool_t orion_get_flag1_weak_cell_fault(device_instances_t device)
 bool_t orion_get_flag1_low_cell_voltage_fault(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->custom_faults.low_cell_voltage_fault);
 }
@@ -973,13 +828,9 @@ bool_t orion_get_flag1_low_cell_voltage_fault(device_instances_t device)
 bool_t orion_get_flag1_open_cell_voltage_fault(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->custom_faults.open_cell_voltage_fault);
 }
@@ -987,13 +838,9 @@ bool_t orion_get_flag1_open_cell_voltage_fault(device_instances_t device)
 bool_t orion_get_flag1_current_sensor_fault(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->custom_faults.current_sensor_fault);
 }
@@ -1001,13 +848,9 @@ bool_t orion_get_flag1_current_sensor_fault(device_instances_t device)
 bool_t orion_get_flag1_voltage_redundancy_fault(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->custom_faults.voltage_redundancy_fault);
 }
@@ -1019,13 +862,9 @@ bool_t orion_get_flag1_voltage_redundancy_fault(device_instances_t device)
 bool_t orion_get_flag2_weak_pack_fault(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->custom_faults.weak_pack_fault);
 }
@@ -1033,13 +872,9 @@ bool_t orion_get_flag2_weak_pack_fault(device_instances_t device)
 bool_t orion_get_flag2_fan_monitor_fault(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->custom_faults.fan_monitor_fault);
 }
@@ -1047,13 +882,9 @@ bool_t orion_get_flag2_fan_monitor_fault(device_instances_t device)
 bool_t orion_get_flag2_thermistor_fault(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->custom_faults.thermistor_fault);
 }
@@ -1061,13 +892,9 @@ bool_t orion_get_flag2_thermistor_fault(device_instances_t device)
 bool_t orion_get_flag2_communication_fault(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->custom_faults.communication_fault);
 }
@@ -1075,13 +902,9 @@ bool_t orion_get_flag2_communication_fault(device_instances_t device)
 bool_t orion_get_flag2_always_on_power_supply_fault(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->custom_faults.always_on_power_supply_fault);
 }
@@ -1089,13 +912,9 @@ bool_t orion_get_flag2_always_on_power_supply_fault(device_instances_t device)
 bool_t orion_get_flag2_high_voltage_isolation_fault(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->custom_faults.high_voltage_isolation_fault);
 }
@@ -1103,13 +922,9 @@ bool_t orion_get_flag2_high_voltage_isolation_fault(device_instances_t device)
 bool_t orion_get_flag2_power_supply_fault(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->custom_faults.power_supply_fault);
 }
@@ -1117,13 +932,9 @@ bool_t orion_get_flag2_power_supply_fault(device_instances_t device)
 bool_t orion_get_flag2_charger_enable_relay_fault(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->custom_faults.charger_enable_relay_fault);
 }
@@ -1135,13 +946,9 @@ bool_t orion_get_flag2_charger_enable_relay_fault(device_instances_t device)
 bool_t orion_get_flag3_discharge_enable_relay_fault(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->custom_faults.discharge_enable_relay_fault);
 }
@@ -1149,13 +956,9 @@ bool_t orion_get_flag3_discharge_enable_relay_fault(device_instances_t device)
 bool_t orion_get_flag3_charger_safety_relay_fault(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->custom_faults.charger_safety_relay_fault);
 }
@@ -1163,13 +966,9 @@ bool_t orion_get_flag3_charger_safety_relay_fault(device_instances_t device)
 bool_t orion_get_flag3_internal_thermistor_fault(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->custom_faults.internal_thermistor_fault);
 }
@@ -1177,13 +976,9 @@ bool_t orion_get_flag3_internal_thermistor_fault(device_instances_t device)
 bool_t orion_get_flag3_internal_logic_fault(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->custom_faults.internal_logic_fault);
 }
@@ -1191,13 +986,9 @@ bool_t orion_get_flag3_internal_logic_fault(device_instances_t device)
 bool_t orion_get_flag3_internal_memory_fault(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->custom_faults.internal_memory_fault);
 
@@ -1210,13 +1001,9 @@ bool_t orion_get_flag3_internal_memory_fault(device_instances_t device)
 bool_t orion_get_current_status_discharge_current_limit_low_soc(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->custom_faults.discharge_current_limit_low_soc);
 }
@@ -1224,13 +1011,9 @@ bool_t orion_get_current_status_discharge_current_limit_low_soc(device_instances
 bool_t orion_get_current_status_discharge_current_limit_high_cell_resistance(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->custom_faults.discharge_current_limit_high_cell_resistance);
 }
@@ -1238,13 +1021,9 @@ bool_t orion_get_current_status_discharge_current_limit_high_cell_resistance(dev
 bool_t orion_get_current_status_discharge_current_limit_temperature(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->custom_faults.discharge_current_limit_temperature);
 }
@@ -1252,13 +1031,9 @@ bool_t orion_get_current_status_discharge_current_limit_temperature(device_insta
 bool_t orion_get_current_status_discharge_current_limit_low_cell_voltage(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->custom_faults.discharge_current_limit_low_cell_voltage);
 }
@@ -1266,13 +1041,9 @@ bool_t orion_get_current_status_discharge_current_limit_low_cell_voltage(device_
 bool_t orion_get_current_status_discharge_current_limit_low_pack_voltage(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->custom_faults.discharge_current_limit_low_pack_voltage);
 }
@@ -1280,13 +1051,9 @@ bool_t orion_get_current_status_discharge_current_limit_low_pack_voltage(device_
 bool_t orion_get_current_status_discharge_current_limit_voltage_failsafe(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->custom_faults.discharge_current_limit_voltage_failsafe);
 }
@@ -1294,13 +1061,9 @@ bool_t orion_get_current_status_discharge_current_limit_voltage_failsafe(device_
 bool_t orion_get_current_status_discharge_current_limit_communication_failsafe(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->custom_faults.discharge_current_limit_communication_failsafe);
 }
@@ -1308,13 +1071,9 @@ bool_t orion_get_current_status_discharge_current_limit_communication_failsafe(d
 bool_t orion_get_current_status_charge_current_limit_high_soc(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->custom_faults.charge_current_limit_high_soc);
 }
@@ -1322,13 +1081,9 @@ bool_t orion_get_current_status_charge_current_limit_high_soc(device_instances_t
 bool_t orion_get_current_status_charge_current_limit_high_cell_resistance(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->custom_faults.charge_current_limit_high_cell_resistance);
 }
@@ -1336,13 +1091,9 @@ bool_t orion_get_current_status_charge_current_limit_high_cell_resistance(device
 bool_t orion_get_current_status_charge_current_limit_high_cell_voltage(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->custom_faults.charge_current_limit_high_cell_voltage);
 }
@@ -1350,13 +1101,9 @@ bool_t orion_get_current_status_charge_current_limit_high_cell_voltage(device_in
 bool_t orion_get_current_status_charge_current_limit_high_pack_voltage(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->custom_faults.charge_current_limit_high_pack_voltage);
 }
@@ -1364,13 +1111,9 @@ bool_t orion_get_current_status_charge_current_limit_high_pack_voltage(device_in
 bool_t orion_get_current_status_charger_latch(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->custom_faults.charger_latch);
 }
@@ -1378,13 +1121,9 @@ bool_t orion_get_current_status_charger_latch(device_instances_t device)
 bool_t orion_get_current_status_charge_current_limit_alternate_current_limit(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->custom_faults.charge_current_limit_alternate_current_limit);
 }
@@ -1393,13 +1132,9 @@ bool_t orion_get_current_status_charge_current_limit_alternate_current_limit(dev
 bool_t orion_get_current_status_charge_current_limit_temperature(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
+        orion_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->custom_faults.charge_current_limit_temperature);
 }
@@ -1431,8 +1166,8 @@ bool_t orion_get_can_rx_ok(device_instances_t device)
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_orion_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        orion_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // By default, receive CAN message timeouts are disabled.
@@ -1454,3 +1189,68 @@ bool_t orion_get_can_rx_ok(device_instances_t device)
         return FALSE;
     }
 }
+
+//=============================================================================
+//
+// CAN ID: 0x00NB00A
+//
+//=============================================================================
+//
+
+//=============================================================================
+//
+// orion_get_cell_table_length()
+//
+//=============================================================================
+//
+uint8_t orion_get_cell_table_length(device_instances_t device)
+{
+    device_data_t *device_data_ptr =
+        orion_get_device_data_ptr(device);
+
+    NULL_CHECK_RETURN(device_data_ptr, 0);
+
+    uint8_t length = (uint8_t)(device_data_ptr->bms_data7.maximum_number_of_cells);
+
+    if (length > ORION_CELL_TABLE_MAX_CELLS)
+    {
+        length = ORION_CELL_TABLE_MAX_CELLS;
+    }
+
+    return length;
+}
+
+//=============================================================================
+//
+// orion_get_cell_voltage_mv()
+//
+//=============================================================================
+//
+uint16_t orion_get_cell_voltage_mv(device_instances_t device, uint8_t cell)
+{
+    device_data_t *device_data_ptr =
+        orion_get_device_data_ptr(device);
+
+    NULL_CHECK_RETURN(device_data_ptr, ORION_CELL_NO_DATA);
+
+    if (cell >= ORION_CELL_TABLE_MAX_CELLS)
+    {
+        return ORION_CELL_NO_DATA;
+    }
+
+    return device_data_ptr->cell_table.voltage_mv[cell];
+}
+
+//=============================================================================
+//
+// orion_get_cell_voltage()
+//
+//=============================================================================
+//
+uint16_t orion_get_cell_voltage(device_instances_t device, uint8_t cell)
+{
+    //
+    // Units 0.1mV
+    //
+    return orion_get_cell_voltage_mv(device, cell) * 10;
+}
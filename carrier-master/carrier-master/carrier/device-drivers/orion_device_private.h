@@ -16,6 +16,7 @@
 #include <string.h>
 #include "can_service_devices.h"
 #include "timer_service.h"
+#include "time_service.h"
 #include "orion_device.h"
 
 
@@ -209,6 +210,29 @@ typedef struct bms_pack_data9_s
 	uint32_t unused3: 16;
 } bms_pack_data9_t;
 
+// Can ID: 0x00NB00A
+// The cell broadcast. The BMS sends one cell per message, cycling
+// through all of its cells:
+//
+//   byte 0:    cell id, from 0
+//   bytes 1-2: instant voltage, 0.1mV, MSB first
+//   bytes 3-4: internal resistance, bit 15 set while shunting
+//   bytes 5-6: open voltage, 0.1mV, MSB first
+//   byte 7:    checksum
+//
+// The 16-bit values are not on a 16-bit boundary, so the message is
+// read a byte at a time rather than through a structure. Only the
+// instant voltage is kept, in the cell table below.
+//
+// The cell voltages are kept in mV, one word per cell. A char is 16
+// bits on the C28x, so a table of 8-bit differences would take the
+// same RAM.
+//
+typedef struct orion_cell_table_s
+{
+	uint16_t voltage_mv[ORION_CELL_TABLE_MAX_CELLS];
+} orion_cell_table_t;
+
 
 // A compound structure that encompasses all the RX CAN messages
 // related to the Murphy PDM. One of these is allocated for each
@@ -227,6 +251,7 @@ typedef struct device_data_s {
 	bms_pack_data7_t bms_data7;
 	bms_pack_data8_t bms_data8;
 	bms_pack_data9_t bms_data9;
+	orion_cell_table_t cell_table;
 
     //
     // Each of the BMS CAN receive functions sets bool associated with
@@ -241,6 +266,29 @@ typedef struct device_data_s {
 	bool_t bms_data7_rx_ok;
 	bool_t bms_data8_rx_ok;
 	bool_t bms_data9_rx_ok;
+	bool_t cell_broadcast_rx_ok;
+
+    //
+    // The receive record of the cycle data, the message that carries
+    // the rolling counter, for the change count of the pack data.
+    //
+    can_rx_handle_t cycle_data_rx_handle;
+
+    //
+    // When the rolling counter of the cycle data last advanced, for
+    // the age of the BMS data. A BMS that has locked up can keep
+    // sending the same counter, so a frame that does not advance it
+    // does not count.
+    //
+    uint32_t counter_advance_ms;
+
+    //
+    // The receive records of the other pack data messages, for the
+    // change count of the pack data.
+    //
+    can_rx_handle_t inst_data_rx_handle;
+    can_rx_handle_t dcl_ccl_temp_rx_handle;
+    can_rx_handle_t misc_data_rx_handle;
 
 } device_data_t;
 
@@ -267,4 +315,13 @@ get_device_linked_data_record_instance_ptr(
     device_instances_t device,
     device_data_t *first_device_data_ptr);
 
+
+//
+// The record of a device instance, resolved once by init_orion_bms().
+// NULL if the instance has not been initialised.
+//
+device_data_t *
+orion_get_device_data_ptr(
+    device_instances_t device);
+
 #endif
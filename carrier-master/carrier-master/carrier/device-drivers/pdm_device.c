@@ -129,6 +129,23 @@ static void rx_can_output_configuration_7_12_handshake(
     can_data_t *can_data_ptr,
 	int16_t *receive_counter);
 
+static void rx_can_dm1(
+    device_instances_t device,
+    can_data_t *can_data_ptr,
+	int16_t *receive_counter);
+
+static void rx_tp_dm1(
+    device_instances_t device,
+    uint32_t pgn,
+    uint8_t source_address,
+    const uint8_t *data,
+    uint16_t size);
+
+static void store_dm1(
+    device_instances_t device,
+    const uint8_t *data,
+    uint16_t size);
+
 
 //
 // This is the BASE CAN ID we use to receive messages from the
@@ -151,6 +168,15 @@ static uint32_t get_rx_instance_offset(device_instances_t device)
 }
 
 
+//
+// This is the BASE CAN ID of the DM1, PGN 0xFECA, that the pdm
+// broadcasts when it has no or one active DTC. It is modified by
+// summing with the result of get_rx_instance_offset(device). With
+// more DTCs, the DM1 is sent with the J1939 transport protocol.
+//
+const uint32_t PDM_DM1_BASE_RXID = 0x18feca00;
+
+
 //
 // This is the BASE CAN ID we use to send messages to the pdm. It
 // is modified by summing with the result of
@@ -221,6 +247,13 @@ typedef enum {
 //
 device_data_t *pdm_first_device_data_ptr = NULL;
 
+//
+// The record of each device instance, indexed by device instance -
+// 1. Resolved once, by pdm_init(). NULL for an instance that
+// has not been initialised. See pdm_get_device_data_ptr().
+//
+static device_data_t *pdm_device_data_ptrs[FVT_MAX_DEVICE_INSTANCES];
+
 
 //
 // This is incremented each for each device instance
@@ -289,6 +322,19 @@ pdm_init(
         		&device_instance_counter,
                 sizeof(device_data_t));
 
+    //
+    // The record could not be created. This is counted by can_service,
+    // so fvt_can_validate_device_registrations() fails and the vehicle
+    // control is not run. The instance is left unresolved, and its
+    // getters return their defaults.
+    //
+    if (device_data_ptr == NULL)
+    {
+        return;
+    }
+
+    pdm_device_data_ptrs[device - ONE] = device_data_ptr;
+
     //
     // Register an interest to receive the following CAN messages from
     // the pdm device instance.
@@ -302,6 +348,13 @@ pdm_init(
         rx_can_analog_in_1_2_digital_in_feedback,
         analog_in_1_2_digital_in_feedback_rx_timeout);
 
+    device_data_ptr->analog_in_1_2_digital_in_feedback_rx_handle =
+        fvt_can_get_receive_handle_j1939_byte(
+            module_id,
+            can_line,
+            PDM_BASE_RXID + get_rx_instance_offset(device),
+            ANALOG_IN_1_2_DIGITAL_IN_FEEDBACK);
+
     fvt_can_register_receive_id_j1939_byte(
         device,
         module_id,
@@ -374,6 +427,26 @@ pdm_init(
         rx_can_output_configuration_7_12_handshake,
         output_configuration_7_12_handshake_rx_timeout);
 
+    //
+    // The DM1, in a single frame or reassembled by can_service from
+    // the transport protocol.
+    //
+    fvt_can_register_receive_id(
+        device,
+        module_id,
+        can_line,
+        PDM_DM1_BASE_RXID + get_rx_instance_offset(device),
+        rx_can_dm1,
+        rx_message_timeout);
+
+    fvt_can_register_receive_pgn_tp(
+        device,
+        module_id,
+        can_line,
+        J1939_PGN_DM1,
+        (uint8_t)get_rx_instance_offset(device),
+        rx_tp_dm1);
+
     //
     // Register an intent to transmit the following CAN messages to
     // the pdm device instance.
@@ -426,6 +499,32 @@ pdm_init(
 }
 
 
+/******************************************************************************
+ *
+ *        Name: pdm_get_device_data_ptr()
+ *
+ * Description: The record of a device instance, as resolved by
+ *              pdm_init(). NULL if the instance has not been
+ *              initialised or is out of range.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+device_data_t *
+pdm_get_device_data_ptr(
+    device_instances_t device)
+{
+    if ((device < ONE) || (device > FVT_MAX_DEVICE_INSTANCES))
+    {
+        return NULL;
+    }
+
+    return pdm_device_data_ptrs[device - ONE];
+}
+
+
 
 //////////////////////////////////////////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////
@@ -468,10 +567,8 @@ static void analog_in_1_2_digital_in_feedback_rx_timeout(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(
-            device,
-            pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Mark this message as having timed out.
@@ -514,10 +611,8 @@ static void analog_in_3_4_digital_out_feedback_rx_timeout(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(
-            device,
-            pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Mark this message as having timed out.
@@ -560,10 +655,8 @@ static void analog_in_5_6_battery_sensor_supply_feedback_rx_timeout(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(
-            device,
-            pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Mark this message as having timed out.
@@ -613,10 +706,8 @@ static void analog_in_7_8_power_version_feedback_rx_timeout(
     //
 
 	device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(
-            device,
-            pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Mark this message as having timed out.
@@ -665,10 +756,8 @@ static void output_current_1_6_feedback_rx_timeout(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(
-            device,
-            pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Mark this message as having timed out.
@@ -717,10 +806,8 @@ static void output_current_7_12_feedback_rx_timeout(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(
-            device,
-            pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Mark this message as having timed out.
@@ -764,10 +851,8 @@ static void output_function_handshake_rx_timeout(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(
-            device,
-            pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Mark this message as having timed out.
@@ -811,10 +896,8 @@ static void output_configuration_1_6_handshake_rx_timeout(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(
-            device,
-            pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Mark this message as having timed out.
@@ -858,10 +941,8 @@ static void output_configuration_7_12_handshake_rx_timeout(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(
-            device,
-            pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Mark this message as having timed out.
@@ -918,7 +999,7 @@ static void rx_can_analog_in_1_2_digital_in_feedback(
 	int16_t *receive_counter)
 {
     // Check can_data_ptr is not NULL.
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // This will be a pointer to the device's receive data structure
@@ -930,10 +1011,8 @@ static void rx_can_analog_in_1_2_digital_in_feedback(
     // Get a pointer to this device's data record.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(
-            device,
-            pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Have the pointer to this device's data record, not get a
@@ -941,7 +1020,7 @@ static void rx_can_analog_in_1_2_digital_in_feedback(
     //
     dest_ptr = &(device_data_ptr->
                  analog_in_1_2_digital_in_feedback);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     //
     // Copy the data from the received CAN message to the designated
@@ -996,7 +1075,7 @@ static void rx_can_analog_in_3_4_digital_out_feedback(
 	int16_t *receive_counter)
 {
     // Check can_data_ptr is not NULL.
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // This will be a pointer to the device's receive data structure
@@ -1008,17 +1087,15 @@ static void rx_can_analog_in_3_4_digital_out_feedback(
     // Get a pointer to this device's data record.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(
-            device,
-            pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Have the pointer to this device's data record, not get a
     // pointer to the appropriate receive data structure.
     //
     dest_ptr = &(device_data_ptr->analog_in_3_4_digital_out_feedback);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     //
     // Copy the data from the received CAN message to the designated
@@ -1069,7 +1146,7 @@ static void rx_can_analog_in_5_6_battery_sensor_supply_feedback(
 	int16_t *receive_counter)
 {
     // Check can_data_ptr is not NULL.
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // This will be a pointer to the device's receive data structure
@@ -1081,15 +1158,15 @@ static void rx_can_analog_in_5_6_battery_sensor_supply_feedback(
     // Get a pointer to this device's data record.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Have the pointer to this device's data record, not get a
     // pointer to the appropriate receive data structure.
     //
     dest_ptr = &(device_data_ptr->analog_in_5_6_battery_sensor_supply_feedback);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     //
     // Copy the data from the received CAN message to the designated
@@ -1141,7 +1218,7 @@ static void rx_can_analog_in_7_8_power_version_feedback(
 	int16_t *receive_counter)
 {
     // Check can_data_ptr is not NULL.
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // This will be a pointer to the device's receive data structure
@@ -1153,10 +1230,8 @@ static void rx_can_analog_in_7_8_power_version_feedback(
     // Get a pointer to this device's data record.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(
-            device,
-            pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Have the pointer to this device's data record, not get a
@@ -1164,7 +1239,7 @@ static void rx_can_analog_in_7_8_power_version_feedback(
     //
     dest_ptr = &(device_data_ptr->
                  analog_in_7_8_power_version_feedback);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     //
     // Copy the data from the received CAN message to the designated
@@ -1221,7 +1296,7 @@ static void rx_can_output_current_1_6_feedback(
 	int16_t *receive_counter)
 {
     // Check can_data_ptr is not NULL.
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // This will be a pointer to the device's receive data structure
@@ -1233,15 +1308,15 @@ static void rx_can_output_current_1_6_feedback(
     // Get a pointer to this device's data record.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Have the pointer to this device's data record, not get a
     // pointer to the appropriate receive data structure.
     //
     dest_ptr = &(device_data_ptr->output_current_1_6_feedback);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     //
     // Copy the data from the received CAN message to the designated
@@ -1285,7 +1360,7 @@ static void rx_can_output_current_7_12_feedback(
 	int16_t *receive_counter)
 {
     // Check can_data_ptr is not NULL.
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // This will be a pointer to the device's receive data structure
@@ -1297,15 +1372,15 @@ static void rx_can_output_current_7_12_feedback(
     // Get a pointer to this device's data record.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Have the pointer to this device's data record, not get a
     // pointer to the appropriate receive data structure.
     //
     dest_ptr = &(device_data_ptr->output_current_7_12_feedback);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     //
     // Copy the data from the received CAN message to the designated
@@ -1349,7 +1424,7 @@ static void rx_can_output_function_handshake(
 	int16_t *receive_counter)
 {
     // Check can_data_ptr is not NULL.
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // This will be a pointer to the CAN messsage data structure that
@@ -1364,8 +1439,8 @@ static void rx_can_output_function_handshake(
     // Get a pointer to this device's data record.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Have the pointer to this device's data record, not get a
@@ -1373,7 +1448,7 @@ static void rx_can_output_function_handshake(
     //
     output_function_handshake_t *dest_ptr =
         &(device_data_ptr->output_function_handshake[channel]);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     //
     // Copy the data from the received CAN message to the designated
@@ -1417,7 +1492,7 @@ static void rx_can_output_configuration_1_6_handshake(
 	int16_t *receive_counter)
 {
     // Check can_data_ptr is not NULL.
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // This will be a pointer to the device's receive data structure
@@ -1429,15 +1504,15 @@ static void rx_can_output_configuration_1_6_handshake(
     // Get a pointer to this device's data record.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Have the pointer to this device's data record, not get a
     // pointer to the appropriate receive data structure.
     //
     dest_ptr = &(device_data_ptr->output_configuration_1_6_handshake);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     //
     // Copy the data from the received CAN message to the designated
@@ -1481,7 +1556,7 @@ static void rx_can_output_configuration_7_12_handshake(
 	int16_t *receive_counter)
 {
     // Check can_data_ptr is not NULL.
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // This will be a pointer to the device's receive data structure
@@ -1493,15 +1568,15 @@ static void rx_can_output_configuration_7_12_handshake(
     // Get a pointer to this device's data record.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Have the pointer to this device's data record, not get a
     // pointer to the appropriate receive data structure.
     //
     dest_ptr = &(device_data_ptr->output_configuration_7_12_handshake);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     //
     // Copy the data from the received CAN message to the designated
@@ -1519,6 +1594,120 @@ static void rx_can_output_configuration_7_12_handshake(
 }
 
 
+/******************************************************************************
+ *
+ *        Name: rx_can_dm1()
+ *
+ * Description: This function is called by
+ *              fvt_can_process_rx_message() with a DM1 sent in a
+ *              single frame, with no or one active DTC.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+static void rx_can_dm1(
+    device_instances_t device,
+    can_data_t *can_data_ptr,
+	int16_t *receive_counter)
+{
+    uint8_t data[8];
+
+    // Check can_data_ptr is not NULL.
+    NULL_CHECK(can_data_ptr);
+
+    data[0] = (uint8_t)can_data_ptr->MDL.bit8.BYTE0;
+    data[1] = (uint8_t)can_data_ptr->MDL.bit8.BYTE1;
+    data[2] = (uint8_t)can_data_ptr->MDL.bit8.BYTE2;
+    data[3] = (uint8_t)can_data_ptr->MDL.bit8.BYTE3;
+    data[4] = (uint8_t)can_data_ptr->MDH.bit8.BYTE0;
+    data[5] = (uint8_t)can_data_ptr->MDH.bit8.BYTE1;
+    data[6] = (uint8_t)can_data_ptr->MDH.bit8.BYTE2;
+    data[7] = (uint8_t)can_data_ptr->MDH.bit8.BYTE3;
+
+    store_dm1(device, data, sizeof(data));
+
+	*receive_counter = 0;
+}
+
+
+/******************************************************************************
+ *
+ *        Name: rx_tp_dm1()
+ *
+ * Description: This function is called by can_service once every
+ *              packet of a DM1 sent with the J1939 transport protocol
+ *              has been received, with the complete payload.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+static void rx_tp_dm1(
+    device_instances_t device,
+    uint32_t pgn,
+    uint8_t source_address,
+    const uint8_t *data,
+    uint16_t size)
+{
+    store_dm1(device, data, size);
+}
+
+
+/******************************************************************************
+ *
+ *        Name: store_dm1()
+ *
+ * Description: Keeps the lamp status and the active DTCs of a DM1:
+ *              two bytes of lamp status, then four bytes for each
+ *              DTC, with the SPN in the first 19 bits and the FMI in
+ *              the next 5. SPN 0 with FMI 0 is sent when there is no
+ *              active DTC.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+static void store_dm1(
+    device_instances_t device,
+    const uint8_t *data,
+    uint16_t size)
+{
+    uint16_t offset;
+
+    device_data_t *device_data_ptr =
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
+
+    pdm_dm1_t *dm1_ptr = &(device_data_ptr->dm1);
+
+    dm1_ptr->lamp_status = data[0];
+    dm1_ptr->dtc_count = 0;
+
+    for (offset = 2;
+         (offset + 4 <= size) && (dm1_ptr->dtc_count < PDM_DM1_MAX_DTCS);
+         offset += 4)
+    {
+        uint32_t spn = (uint32_t)data[offset] |
+                       ((uint32_t)data[offset + 1] << 8) |
+                       ((uint32_t)(data[offset + 2] & 0xE0) << 11);
+        uint8_t fmi = (uint8_t)(data[offset + 2] & 0x1F);
+
+        if ((spn == 0) && (fmi == 0))
+        {
+            continue;
+        }
+
+        dm1_ptr->spn[dm1_ptr->dtc_count] = spn;
+        dm1_ptr->fmi[dm1_ptr->dtc_count] = fmi;
+        dm1_ptr->dtc_count++;
+    }
+}
+
+
 /******************************************************************************
  *
  *        Name: pdm_tx_can_configure_output_function()
@@ -1592,8 +1781,8 @@ void pdm_tx_can_configure_output_function(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -1601,7 +1790,7 @@ void pdm_tx_can_configure_output_function(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_configure_output_function_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Handle the transmit_counter_limit so that this function's CAN
@@ -1620,9 +1809,9 @@ void pdm_tx_can_configure_output_function(
         // parameter value is, send this function's CAN message
         // immediately the very first time this function is
         // called. After this initial send of the CAN message, the
-        // next send of the CAN message will not happen until this
-        // function has been called at least the number of times
-        // specified in the transmit_counter_limit parameter.
+        // next send of the CAN message will not happen until the
+        // time specified in the transmit_counter_limit parameter
+        // has elapsed.
         //
         tx_ptr->transmit_counter_limit = TX_SEND_EACH_CALL;
         tx_ptr->transmit_message_sent_first_time = TRUE;
@@ -1642,15 +1831,13 @@ void pdm_tx_can_configure_output_function(
     //
     configure_output_function_t *can_data_ptr =
         (configure_output_function_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // Send the CAN message if time to do so.
     //
-    if (++(tx_ptr->transmit_counter) > tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         for (int channel = PDM_CHANNEL_1; channel <= PDM_CHANNEL_12 ; ++channel)
         {
             //
@@ -1658,7 +1845,7 @@ void pdm_tx_can_configure_output_function(
             // pointer to the appropriate receive data structure.
             //
             source_ptr = &(device_data_ptr->configure_output_function[channel - 1]);
-            if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+            NULL_CHECK(source_ptr);
 
             //
             // Copy data from our local structure to the CAN transmit buffer.
@@ -1702,15 +1889,15 @@ void pdm_tx_can_configure_output_channels_1_6(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Have the pointer to this device's data record, not get a
     // pointer to the appropriate receive data structure.
     //
     source_ptr = &(device_data_ptr->configure_output_channels_1_6);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -1718,7 +1905,7 @@ void pdm_tx_can_configure_output_channels_1_6(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_configure_output_channels_1_6_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Handle the transmit_counter_limit so that this function's CAN
@@ -1737,9 +1924,9 @@ void pdm_tx_can_configure_output_channels_1_6(
         // parameter value is, send this function's CAN message
         // immediately the very first time this function is
         // called. After this initial send of the CAN message, the
-        // next send of the CAN message will not happen until this
-        // function has been called at least the number of times
-        // specified in the transmit_counter_limit parameter.
+        // next send of the CAN message will not happen until the
+        // time specified in the transmit_counter_limit parameter
+        // has elapsed.
         //
         tx_ptr->transmit_counter_limit = TX_SEND_EACH_CALL;
         tx_ptr->transmit_message_sent_first_time = TRUE;
@@ -1759,15 +1946,13 @@ void pdm_tx_can_configure_output_channels_1_6(
     //
     configure_output_channels_t *can_data_ptr =
         (configure_output_channels_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // Send the CAN message if time to do so.
     //
-    if (++(tx_ptr->transmit_counter) > tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = TX_SEND_EACH_CALL;
-
         //
         // Copy data from our local structure to the CAN transmit buffer.
         //
@@ -1810,15 +1995,15 @@ void pdm_tx_can_configure_output_channels_7_12(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     source_ptr = &(device_data_ptr->configure_output_channels_7_12);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -1826,7 +2011,7 @@ void pdm_tx_can_configure_output_channels_7_12(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_configure_output_channels_7_12_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Handle the transmit_counter_limit so that this function's CAN
@@ -1845,9 +2030,9 @@ void pdm_tx_can_configure_output_channels_7_12(
         // parameter value is, send this function's CAN message
         // immediately the very first time this function is
         // called. After this initial send of the CAN message, the
-        // next send of the CAN message will not happen until this
-        // function has been called at least the number of times
-        // specified in the transmit_counter_limit parameter.
+        // next send of the CAN message will not happen until the
+        // time specified in the transmit_counter_limit parameter
+        // has elapsed.
         //
         tx_ptr->transmit_counter_limit = TX_SEND_EACH_CALL;
         tx_ptr->transmit_message_sent_first_time = TRUE;
@@ -1867,13 +2052,11 @@ void pdm_tx_can_configure_output_channels_7_12(
     //
     configure_output_channels_t *can_data_ptr =
         (configure_output_channels_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     // Send the CAN message if time to do so.
-    if (++(tx_ptr->transmit_counter) > tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Copy data from our local structure to the CAN transmit buffer.
         //
@@ -1917,15 +2100,15 @@ void pdm_tx_can_command_output_channels_1_6(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Have the pointer to this device's data record, not get a
     // pointer to the appropriate receive data structure.
     //
     source_ptr = &(device_data_ptr->command_output_channels_1_6);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -1933,7 +2116,7 @@ void pdm_tx_can_command_output_channels_1_6(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_command_output_channels_1_6_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Handle the transmit_counter_limit so that this function's CAN
@@ -1952,9 +2135,9 @@ void pdm_tx_can_command_output_channels_1_6(
         // parameter value is, send this function's CAN message
         // immediately the very first time this function is
         // called. After this initial send of the CAN message, the
-        // next send of the CAN message will not happen until this
-        // function has been called at least the number of times
-        // specified in the transmit_counter_limit parameter.
+        // next send of the CAN message will not happen until the
+        // time specified in the transmit_counter_limit parameter
+        // has elapsed.
         //
         tx_ptr->transmit_counter_limit = TX_SEND_EACH_CALL;
         tx_ptr->transmit_message_sent_first_time = TRUE;
@@ -1974,13 +2157,11 @@ void pdm_tx_can_command_output_channels_1_6(
     //
     command_output_channels_t *can_data_ptr =
         (command_output_channels_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     // Send the CAN message if time to do so.
-    if (++(tx_ptr->transmit_counter) > tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Copy data from our local structure to the CAN transmit buffer.
         //
@@ -2023,15 +2204,15 @@ void pdm_tx_can_command_output_channels_7_12(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Have the pointer to this device's data record, not get a
     // pointer to the appropriate receive data structure.
     //
     source_ptr = &(device_data_ptr->command_output_channels_7_12);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -2039,7 +2220,7 @@ void pdm_tx_can_command_output_channels_7_12(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_command_output_channels_7_12_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Handle the transmit_counter_limit so that this function's CAN
@@ -2058,9 +2239,9 @@ void pdm_tx_can_command_output_channels_7_12(
         // parameter value is, send this function's CAN message
         // immediately the very first time this function is
         // called. After this initial send of the CAN message, the
-        // next send of the CAN message will not happen until this
-        // function has been called at least the number of times
-        // specified in the transmit_counter_limit parameter.
+        // next send of the CAN message will not happen until the
+        // time specified in the transmit_counter_limit parameter
+        // has elapsed.
         //
         tx_ptr->transmit_counter_limit = TX_SEND_EACH_CALL;
         tx_ptr->transmit_message_sent_first_time = TRUE;
@@ -2080,12 +2261,11 @@ void pdm_tx_can_command_output_channels_7_12(
     //
     command_output_channels_t *can_data_ptr =
         (command_output_channels_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     // Send the CAN message if time to do so.
-    if (++(tx_ptr->transmit_counter) > tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
         //
         // Copy data from our local structure to the CAN transmit buffer.
         //
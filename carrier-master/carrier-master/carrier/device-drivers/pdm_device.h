@@ -242,7 +242,12 @@ uint8_t pdm_get_feedback_type_output(device_instances_t device, pdm_dio_channels
 uint8_t pdm_get_automatic_reset_output(device_instances_t device, pdm_dio_channels_t channel);
 uint8_t pdm_get_highside_or_hbridge_ouput(device_instances_t device, pdm_dio_channels_t channel);
 bool_t pdm_get_can_rx_ok(device_instances_t device);
+uint32_t pdm_get_rx_age_ms(device_instances_t device);
 bool_t pdm_get_output_channel_command_state(device_instances_t device, pdm_dio_channels_t channel);
+uint8_t pdm_get_dm1_lamp_status(device_instances_t device);
+uint8_t pdm_get_dm1_dtc_count(device_instances_t device);
+uint32_t pdm_get_dm1_spn(device_instances_t device, uint8_t index);
+uint8_t pdm_get_dm1_fmi(device_instances_t device, uint8_t index);
 
 //
 //
@@ -14,8 +14,6 @@
  */
 #include "pdm_device_private.h"
 
-extern device_data_t *pdm_first_device_data_ptr;
-
 
 //=============================================================================
 //
@@ -43,15 +41,15 @@ pdm_get_digital_input_feedback(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, digital_input);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     analog_in_1_2_digital_in_feedback_t *source_ptr = &(device_data_ptr->analog_in_1_2_digital_in_feedback);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     //
     // Read the digital input from the specified channel.
@@ -135,8 +133,8 @@ uint8_t pdm_get_digital_output_dignostic(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, output_diagnostic);
 
     //
     // Have the pointer to this device's data record, now get a
@@ -144,7 +142,7 @@ uint8_t pdm_get_digital_output_dignostic(
     //
     analog_in_3_4_digital_out_feedback_t *source_ptr =
         &(device_data_ptr->analog_in_3_4_digital_out_feedback);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     //
     // Read the specified channel's output diagnostic.
@@ -219,8 +217,8 @@ uint8_t pdm_get_sensor_supply_high(device_instances_t device)
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, 0);
 
     //
     // Have the pointer to this device's data record, now get a
@@ -228,7 +226,7 @@ uint8_t pdm_get_sensor_supply_high(device_instances_t device)
     //
     analog_in_5_6_battery_sensor_supply_feedback_t *source_ptr =
         &(device_data_ptr->analog_in_5_6_battery_sensor_supply_feedback);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (uint8_t)(source_ptr->sensor_supply_high);
 }
@@ -248,8 +246,8 @@ uint8_t pdm_get_sensor_supply_low(device_instances_t device)
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, 0);
 
     //
     // Have the pointer to this device's data record, now get a
@@ -257,7 +255,7 @@ uint8_t pdm_get_sensor_supply_low(device_instances_t device)
     //
     analog_in_5_6_battery_sensor_supply_feedback_t *source_ptr =
         &(device_data_ptr->analog_in_5_6_battery_sensor_supply_feedback);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (uint8_t)(source_ptr->sensor_supply_low);
 }
@@ -277,8 +275,8 @@ uint16_t pdm_get_battery_voltage_mv(device_instances_t device)
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, 0);
 
     //
     // Have the pointer to this device's data record, now get a
@@ -286,7 +284,7 @@ uint16_t pdm_get_battery_voltage_mv(device_instances_t device)
     //
     analog_in_5_6_battery_sensor_supply_feedback_t *source_ptr =
         &(device_data_ptr->analog_in_5_6_battery_sensor_supply_feedback);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return source_ptr->battery_voltage;
 }
@@ -307,8 +305,8 @@ uint8_t pdm_get_power_supply_status(device_instances_t device)
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, 0);
 
     //
     // Have the pointer to this device's data record, now get a
@@ -316,7 +314,7 @@ uint8_t pdm_get_power_supply_status(device_instances_t device)
     //
     analog_in_7_8_power_version_feedback_t *source_ptr =
         &(device_data_ptr->analog_in_7_8_power_version_feedback);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (uint8_t)(source_ptr->power_supply_status);
 }
@@ -337,8 +335,8 @@ uint8_t pdm_get_total_current_status(device_instances_t device)
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, 0);
 
     //
     // Have the pointer to this device's data record, now get a
@@ -346,7 +344,7 @@ uint8_t pdm_get_total_current_status(device_instances_t device)
     //
     analog_in_7_8_power_version_feedback_t *source_ptr =
         &(device_data_ptr->analog_in_7_8_power_version_feedback);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (uint8_t)(source_ptr->total_current_status);
 }
@@ -366,8 +364,8 @@ uint16_t pdm_get_software_version(device_instances_t device)
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, 0);
 
     //
     // Have the pointer to this device's data record, now get a
@@ -375,7 +373,7 @@ uint16_t pdm_get_software_version(device_instances_t device)
     //
     analog_in_7_8_power_version_feedback_t *source_ptr =
         &(device_data_ptr->analog_in_7_8_power_version_feedback);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (uint16_t)(source_ptr->software_version);
 }
@@ -407,8 +405,8 @@ uint8_t pdm_get_output_current_feedback(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, output_feedback);
 
     if (channel < 7)
     {
@@ -418,7 +416,7 @@ uint8_t pdm_get_output_current_feedback(
         // 1 to 6.
         //
         source_ptr = &(device_data_ptr->output_current_1_6_feedback);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
     }
     else
     {
@@ -428,7 +426,7 @@ uint8_t pdm_get_output_current_feedback(
         // 7 to 12.
         //
         source_ptr = &(device_data_ptr->output_current_7_12_feedback);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
     }
 
     //
@@ -491,8 +489,8 @@ uint8_t pdm_get_soft_start_step_size(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, 0);
 
     //
     // Have the pointer to this device's data record, now get a
@@ -500,7 +498,7 @@ uint8_t pdm_get_soft_start_step_size(
     //
     output_function_handshake_t *source_ptr =
         &(device_data_ptr->output_function_handshake[channel]);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (uint8_t)(source_ptr->soft_start_step_size);
 }
@@ -525,8 +523,8 @@ uint8_t pdm_get_motor_lamp_mode(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, 0);
 
     //
     // Have the pointer to this device's data record, now get a
@@ -534,7 +532,7 @@ uint8_t pdm_get_motor_lamp_mode(
     //
     output_function_handshake_t *source_ptr =
         &(device_data_ptr->output_function_handshake[channel]);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (uint8_t)(source_ptr->motor_lamp_mode);
 }
@@ -559,8 +557,8 @@ uint8_t pdm_get_loss_of_communication(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, 0);
 
     //
     // Have the pointer to this device's data record, now get a
@@ -568,7 +566,7 @@ uint8_t pdm_get_loss_of_communication(
     //
     output_function_handshake_t *source_ptr =
         &(device_data_ptr->output_function_handshake[channel]);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (uint8_t)(source_ptr->loss_of_communication);
 }
@@ -593,16 +591,8 @@ uint8_t pdm_get_power_on_reset_command(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
-
-    //
-    // Have the pointer to this device's data record, now get a
-    // pointer to the appropriate receive data structure.
-    //
-    output_function_handshake_t *source_ptr =
-        &(device_data_ptr->output_function_handshake[channel]);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, 0);
 
     return (uint8_t)(device_data_ptr->output_function_handshake[channel].power_on_reset_command);
 }
@@ -627,8 +617,8 @@ bool_t pdm_get_power_on_reset_enable(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // Have the pointer to this device's data record, now get a
@@ -636,7 +626,7 @@ bool_t pdm_get_power_on_reset_enable(
     //
     output_function_handshake_t *source_ptr =
         &(device_data_ptr->output_function_handshake[channel]);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (bool_t)(source_ptr->power_on_reset_enable);
 }
@@ -661,8 +651,8 @@ bool_t pdm_get_command_type(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // Have the pointer to this device's data record, now get a
@@ -670,7 +660,7 @@ bool_t pdm_get_command_type(
     //
     output_function_handshake_t *source_ptr =
         &(device_data_ptr->output_function_handshake[channel]);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (bool_t)(source_ptr->command_type);
 }
@@ -695,8 +685,8 @@ bool_t pdm_get_motor_braking(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // Have the pointer to this device's data record, now get a
@@ -704,7 +694,7 @@ bool_t pdm_get_motor_braking(
     //
     output_function_handshake_t *source_ptr =
         &(device_data_ptr->output_function_handshake[channel]);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (bool_t)(source_ptr->motor_braking);
 }
@@ -729,8 +719,8 @@ uint8_t pdm_get_digital_input(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, 0);
 
     //
     // Have the pointer to this device's data record, now get a
@@ -738,7 +728,7 @@ uint8_t pdm_get_digital_input(
     //
     output_function_handshake_t *source_ptr =
         &(device_data_ptr->output_function_handshake[channel]);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (uint8_t)(source_ptr->digital_input);
 }
@@ -763,8 +753,8 @@ uint8_t pdm_get_calibration_time(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, 0);
 
     //
     // Have the pointer to this device's data record, now get a
@@ -772,7 +762,7 @@ uint8_t pdm_get_calibration_time(
     //
     output_function_handshake_t *source_ptr =
         &(device_data_ptr->output_function_handshake[channel]);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (uint8_t)(source_ptr->calibration_time);
 }
@@ -797,8 +787,8 @@ uint8_t pdm_get_response(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, 0);
 
     //
     // Have the pointer to this device's data record, now get a
@@ -806,7 +796,7 @@ uint8_t pdm_get_response(
     //
     output_function_handshake_t *source_ptr =
         &(device_data_ptr->output_function_handshake[channel]);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     return (uint8_t)(source_ptr->response);
 }
@@ -834,27 +824,27 @@ uint16_t pdm_get_analog_input(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, analog_input);
 
     //
     // Get the required source pointers
     //
     analog_in_1_2_digital_in_feedback_t * source_1_2_ptr =
         &(device_data_ptr->analog_in_1_2_digital_in_feedback);
-    if (source_1_2_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_1_2_ptr);
 
     analog_in_3_4_digital_out_feedback_t * source_3_4_ptr =
         &(device_data_ptr->analog_in_3_4_digital_out_feedback);
-    if (source_3_4_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_3_4_ptr);
 
     analog_in_5_6_battery_sensor_supply_feedback_t * source_5_6_ptr =
         &(device_data_ptr->analog_in_5_6_battery_sensor_supply_feedback);
-    if (source_5_6_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_5_6_ptr);
 
     analog_in_7_8_power_version_feedback_t * source_7_8_ptr =
         &(device_data_ptr->analog_in_7_8_power_version_feedback);
-    if (source_7_8_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_7_8_ptr);
 
     //
     // Get the data from the specified channel.
@@ -921,8 +911,8 @@ uint8_t pdm_get_current_limit_output(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, current_limit_output);
 
     if (channel < 7)
     {
@@ -932,7 +922,7 @@ uint8_t pdm_get_current_limit_output(
         // 1 to 6.
         //
         source_ptr = &(device_data_ptr->output_configuration_1_6_handshake);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
     }
     else
     {
@@ -942,7 +932,7 @@ uint8_t pdm_get_current_limit_output(
         // 7 to 12.
         //
         source_ptr = &(device_data_ptr->output_configuration_7_12_handshake);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
     }
 
     //
@@ -1009,8 +999,8 @@ uint8_t pdm_get_feedback_type_output(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, feedback_type_output);
 
     //
     // Get the proper source pointer based on the channel.
@@ -1023,7 +1013,7 @@ uint8_t pdm_get_feedback_type_output(
         // 1 to 6.
         //
         source_ptr = &(device_data_ptr->output_configuration_1_6_handshake);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
     }
     else
     {
@@ -1033,7 +1023,7 @@ uint8_t pdm_get_feedback_type_output(
         // 7 to 12.
         //
         source_ptr = &(device_data_ptr->output_configuration_7_12_handshake);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
     }
 
     //
@@ -1100,8 +1090,8 @@ uint8_t pdm_get_automatic_reset_output(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, automatic_reset_output);
 
     if (channel < 7)
     {
@@ -1111,7 +1101,7 @@ uint8_t pdm_get_automatic_reset_output(
         // 1 to 6.
         //
         source_ptr = &(device_data_ptr->output_configuration_1_6_handshake);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
     }
     else
     {
@@ -1121,7 +1111,7 @@ uint8_t pdm_get_automatic_reset_output(
         // 7 to 12.
         //
         source_ptr = &(device_data_ptr->output_configuration_7_12_handshake);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
     }
 
     //
@@ -1187,8 +1177,8 @@ uint8_t pdm_get_highside_or_hbridge_ouput(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, highside_or_hbridge_ouput);
 
     if (channel < 7)
     {
@@ -1198,7 +1188,7 @@ uint8_t pdm_get_highside_or_hbridge_ouput(
         // 1 to 6.
         //
         source_ptr = &(device_data_ptr->output_configuration_1_6_handshake);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
     }
     else
     {
@@ -1208,7 +1198,7 @@ uint8_t pdm_get_highside_or_hbridge_ouput(
         // 7 to 12.
         //
         source_ptr = &(device_data_ptr->output_configuration_7_12_handshake);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
     }
     //
     // Read the appropriate data from this channel.
@@ -1276,8 +1266,8 @@ bool_t pdm_get_can_rx_ok(device_instances_t device)
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // By default, receive CAN message timeouts are disabled.
@@ -1301,6 +1291,30 @@ bool_t pdm_get_can_rx_ok(device_instances_t device)
 }
 
 
+//=============================================================================
+//
+// pdm_get_rx_age_ms()
+//
+// The ms since the analog in 1-2 and digital in feedback was last received, or since the device was
+// initialised if it has not been received. FVT_CAN_RX_AGE_UNKNOWN if
+// the device is not fitted.
+//
+//=============================================================================
+//
+uint32_t pdm_get_rx_age_ms(device_instances_t device)
+{
+    device_data_t *device_data_ptr =
+        pdm_get_device_data_ptr(device);
+
+    if (device_data_ptr == NULL)
+    {
+        return FVT_CAN_RX_AGE_UNKNOWN;
+    }
+
+    return fvt_can_get_receive_age_ms(device_data_ptr->analog_in_1_2_digital_in_feedback_rx_handle);
+}
+
+
 /******************************************************************************
  *
  *        Name: pdm_compare_analog_in_1_2_digital_in_feedback_rx_cnt()
@@ -1330,8 +1344,8 @@ bool_t pdm_compare_analog_in_1_2_digital_in_feedback_rx_cnt(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     if (device_data_ptr->analog_in_1_2_digital_in_feedback_rx_cnt % compare_cnt == 0)
     {
@@ -1372,8 +1386,8 @@ bool_t pdm_compare_analog_in_3_4_digital_out_feedback_rx_cnt(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     if (device_data_ptr->analog_in_3_4_digital_out_feedback_rx_cnt % compare_cnt == 0)
     {
@@ -1415,8 +1429,8 @@ bool_t pdm_compare_analog_in_5_6_battery_sensor_supply_feedback_rx_cnt(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     if (device_data_ptr->analog_in_5_6_battery_sensor_supply_feedback_rx_cnt % compare_cnt == 0)
     {
@@ -1458,8 +1472,8 @@ bool_t pdm_compare_analog_in_7_8_power_version_feedback_rx_cnt(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     if (device_data_ptr->analog_in_7_8_power_version_feedback_rx_cnt % compare_cnt == 0)
     {
@@ -1501,8 +1515,8 @@ bool_t pdm_compare_output_current_1_6_feedback_rx_cnt(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     if (device_data_ptr->output_current_1_6_feedback_rx_cnt % compare_cnt == 0)
     {
@@ -1544,8 +1558,8 @@ bool_t pdm_compare_output_current_7_12_feedback_rx_cnt(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     if (device_data_ptr->output_current_7_12_feedback_rx_cnt % compare_cnt == 0)
     {
@@ -1587,8 +1601,8 @@ bool_t pdm_compare_output_function_handshake_rx_cnt(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     if (device_data_ptr->output_function_handshake_rx_cnt % compare_cnt == 0)
     {
@@ -1630,8 +1644,8 @@ bool_t pdm_compare_output_configuration_1_6_handshake_rx_cnt(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     if (device_data_ptr->output_configuration_1_6_handshake_rx_cnt % compare_cnt == 0)
     {
@@ -1673,8 +1687,8 @@ bool_t pdm_compare_output_configuration_7_12_handshake_rx_cnt(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     if (device_data_ptr->output_configuration_7_12_handshake_rx_cnt % compare_cnt == 0)
     {
@@ -1685,3 +1699,78 @@ bool_t pdm_compare_output_configuration_7_12_handshake_rx_cnt(
         return FALSE;
     }
 }
+
+
+//=============================================================================
+//
+// pdm_get_dm1_lamp_status()
+//
+// The first byte of the last DM1, the malfunction, red stop, amber
+// warning and protect lamps, two bits each.
+//
+//=============================================================================
+//
+uint8_t pdm_get_dm1_lamp_status(device_instances_t device)
+{
+    device_data_t *device_data_ptr =
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, 0);
+
+    return device_data_ptr->dm1.lamp_status;
+}
+
+
+//=============================================================================
+//
+// pdm_get_dm1_dtc_count()
+//
+// The number of active DTCs in the last DM1, up to PDM_DM1_MAX_DTCS.
+//
+//=============================================================================
+//
+uint8_t pdm_get_dm1_dtc_count(device_instances_t device)
+{
+    device_data_t *device_data_ptr =
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, 0);
+
+    return device_data_ptr->dm1.dtc_count;
+}
+
+
+//=============================================================================
+//
+// pdm_get_dm1_spn() and pdm_get_dm1_fmi()
+//
+// The SPN and FMI of an active DTC, index below
+// pdm_get_dm1_dtc_count(). 0 for any other index.
+//
+//=============================================================================
+//
+uint32_t pdm_get_dm1_spn(device_instances_t device, uint8_t index)
+{
+    device_data_t *device_data_ptr =
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, 0);
+
+    if (index >= device_data_ptr->dm1.dtc_count)
+    {
+        return 0;
+    }
+
+    return device_data_ptr->dm1.spn[index];
+}
+
+uint8_t pdm_get_dm1_fmi(device_instances_t device, uint8_t index)
+{
+    device_data_t *device_data_ptr =
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, 0);
+
+    if (index >= device_data_ptr->dm1.dtc_count)
+    {
+        return 0;
+    }
+
+    return device_data_ptr->dm1.fmi[index];
+}
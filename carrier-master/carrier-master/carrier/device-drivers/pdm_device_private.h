@@ -394,6 +394,23 @@ typedef struct output_configuration_handshake_s
 
 
 
+//
+// The active DTCs of the last DM1 received from the PDM. The DM1 is
+// a single frame with no or one DTC, and is sent with the J1939
+// transport protocol with more. Only the first PDM_DM1_MAX_DTCS
+// DTCs are kept.
+//
+#define PDM_DM1_MAX_DTCS 8
+
+typedef struct pdm_dm1_s
+{
+    uint8_t lamp_status;
+    uint8_t dtc_count;
+    uint32_t spn[PDM_DM1_MAX_DTCS];
+    uint8_t fmi[PDM_DM1_MAX_DTCS];
+} pdm_dm1_t;
+
+
 //
 // A compound structure that encompasses all the RX CAN messages
 // related to the Murphy PDM. One of these is allocated for each
@@ -413,6 +430,7 @@ typedef struct device_data_s {
     output_function_handshake_t output_function_handshake[12];
     output_configuration_handshake_t output_configuration_1_6_handshake;
     output_configuration_handshake_t output_configuration_7_12_handshake;
+    pdm_dm1_t dm1;
 
     // Each of the PDM CAN receive functions sets bool associated with
     // itself to TRUE when its message is received.
@@ -451,6 +469,10 @@ typedef struct device_data_s {
     can_tx_registration_t *send_configure_output_channels_7_12_ptr;
     can_tx_registration_t *send_command_output_channels_1_6_ptr;
     can_tx_registration_t *send_command_output_channels_7_12_ptr;
+
+    // The receive record of the analog in 1-2 and digital in
+    // feedback, for the age of the data.
+    can_rx_handle_t analog_in_1_2_digital_in_feedback_rx_handle;
 } device_data_t;
 
 
@@ -504,6 +526,15 @@ get_device_linked_data_record_instance_ptr(
     device_data_t *first_device_data_ptr);
 
 
+//
+// The record of a device instance, resolved once by pdm_init().
+// NULL if the instance has not been initialised.
+//
+device_data_t *
+pdm_get_device_data_ptr(
+    device_instances_t device);
+
+
 #endif
 
 
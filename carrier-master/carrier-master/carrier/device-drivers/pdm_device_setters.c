@@ -12,8 +12,6 @@
 
 #include "pdm_device_private.h"
 
-extern device_data_t *pdm_first_device_data_ptr;
-
 //=============================================================================
 //
 // void pdm_set_configure_output_function(device_instances_t device,
@@ -90,14 +88,14 @@ void pdm_set_configure_output_function(
     // Get a pointer to the proper device data structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->configure_output_function[channel - 1]);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -105,16 +103,7 @@ void pdm_set_configure_output_function(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_configure_output_function_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
-
-    //
-    // Cast our pointer to the 8-byte Can_Message_ tx message data to
-    // be a pointer to be of the type that's associated with this
-    // function's transmit obkect.
-    //
-    configure_output_function_t *can_data_ptr =
-        (configure_output_function_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Populate the PDM's unique identifier.
@@ -179,8 +168,8 @@ void pdm_set_configure_output_channel(
     // Get a pointer to the proper device data structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the proper output configure structure. There are
@@ -190,12 +179,12 @@ void pdm_set_configure_output_channel(
     if (channel <= 6)
     {
         dest_ptr = &(device_data_ptr->configure_output_channels_1_6);
-        if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(dest_ptr);
     }
     else
     {
         dest_ptr = &(device_data_ptr->configure_output_channels_7_12);
-        if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(dest_ptr);
     }
 
     //
@@ -207,24 +196,15 @@ void pdm_set_configure_output_channel(
     {
         // Yes, use the _1_6 structure pointer.
         tx_ptr = device_data_ptr->send_configure_output_channels_1_6_ptr;
-        if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK_RETURN_VOID(tx_ptr);
     }
     else
     {
         // No, use the _7_12 structure pointer.
         tx_ptr = device_data_ptr->send_configure_output_channels_7_12_ptr;
-        if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK_RETURN_VOID(tx_ptr);
     }
 
-    //
-    // Cast our pointer to the 8-byte Can_Message_ tx message data to
-    // be a pointer to be of the type that's associated with this
-    // function's transmit object.
-    //
-        configure_output_channels_t *can_data_ptr =
-            (configure_output_channels_t *)tx_ptr->tx_message.data;
-        if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
-
     //
     // Populate the PDM's unique identifier with the j1939_byte.
     //
@@ -349,8 +329,8 @@ void pdm_set_command_output_channel(
     // Get a pointer to the proper device data structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the proper output command structure. There are
@@ -360,12 +340,12 @@ void pdm_set_command_output_channel(
     if (channel <= 6)
     {
         dest_ptr = &(device_data_ptr->command_output_channels_1_6);
-        if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(dest_ptr);
     }
     else
     {
         dest_ptr = &(device_data_ptr->command_output_channels_7_12);
-        if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(dest_ptr);
     }
 
     //
@@ -377,24 +357,15 @@ void pdm_set_command_output_channel(
     {
         // Yes, use the _1_6 structure pointer.
         tx_ptr = device_data_ptr->send_command_output_channels_1_6_ptr;
-        if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK_RETURN_VOID(tx_ptr);
     }
     else
     {
         // No, use the _7_12 structure pointer.
         tx_ptr = device_data_ptr->send_command_output_channels_7_12_ptr;
-        if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK_RETURN_VOID(tx_ptr);
     }
 
-    //
-    // Cast our pointer to the 8-byte Can_Message_ tx message data to
-    // be a pointer to be of the type that's associated with this
-    // function's transmit object.
-    //
-    command_output_channels_t *can_data_ptr =
-        (command_output_channels_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
-
     //
     // Populate the PDM's unique identifier with the j1939_byte.
     //
@@ -488,8 +459,8 @@ void pdm_zero_analog_in_1_2_digital_in_feedback_rx_cnt(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     device_data_ptr->analog_in_1_2_digital_in_feedback_rx_cnt = 0;
 }
@@ -523,8 +494,8 @@ void pdm_zero_analog_in_3_4_digital_out_feedback_rx_cnt(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     device_data_ptr->analog_in_3_4_digital_out_feedback_rx_cnt = 0;
 }
@@ -559,8 +530,8 @@ void pdm_zero_analog_in_5_6_battery_sensor_supply_feedback_rx_cnt(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     device_data_ptr->analog_in_5_6_battery_sensor_supply_feedback_rx_cnt = 0;
 }
@@ -595,8 +566,8 @@ void pdm_zero_analog_in_7_8_power_version_feedback_rx_cnt(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     device_data_ptr->analog_in_7_8_power_version_feedback_rx_cnt = 0;
 }
@@ -631,8 +602,8 @@ void pdm_zero_output_current_1_6_feedback_rx_cnt(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     device_data_ptr->output_current_1_6_feedback_rx_cnt = 0;
 }
@@ -667,8 +638,8 @@ void pdm_zero_output_current_7_12_feedback_rx_cnt(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     device_data_ptr->output_current_7_12_feedback_rx_cnt = 0;
 }
@@ -703,8 +674,8 @@ void pdm_zero_output_function_handshake_rx_cnt(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     device_data_ptr->output_function_handshake_rx_cnt = 0;
 }
@@ -739,8 +710,8 @@ void pdm_zero_output_configuration_1_6_handshake_rx_cnt(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     device_data_ptr->output_configuration_1_6_handshake_rx_cnt = 0;
 }
@@ -775,8 +746,8 @@ void pdm_zero_output_configuration_7_12_handshake_rx_cnt(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     device_data_ptr->output_configuration_7_12_handshake_rx_cnt = 0;
 }
@@ -799,14 +770,13 @@ bool_t pdm_get_output_channel_command_state(
         DEBUG("Invalid channel");
 
     command_output_channels_t *dest_ptr = NULL;
-    can_tx_registration_t *tx_ptr = NULL;
 
     //
     // Get a pointer to the proper device data structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, pdm_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pdm_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, enable_state);
 
     //
     // Get a pointer to the proper output command structure. There are
@@ -816,12 +786,12 @@ bool_t pdm_get_output_channel_command_state(
     if (channel <= 6)
     {
         dest_ptr = &(device_data_ptr->command_output_channels_1_6);
-        if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(dest_ptr);
     }
     else
     {
         dest_ptr = &(device_data_ptr->command_output_channels_7_12);
-        if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(dest_ptr);
     }
 
     //
@@ -79,6 +79,13 @@ typedef enum {
 //
 device_data_t *can_switches_pku2400_first_device_data_ptr = NULL;
 
+//
+// The record of each device instance, indexed by device instance -
+// 1. Resolved once, by pku2400_init(). NULL for an instance that
+// has not been initialised. See pku2400_get_device_data_ptr().
+//
+static device_data_t *pku2400_device_data_ptrs[FVT_MAX_DEVICE_INSTANCES];
+
 
 //=============================================================================
 //
@@ -170,6 +177,19 @@ pku2400_init(
             &device_instance_counter,
             sizeof(device_data_t));
 
+    //
+    // The record could not be created. This is counted by can_service,
+    // so fvt_can_validate_device_registrations() fails and the vehicle
+    // control is not run. The instance is left unresolved, and its
+    // getters return their defaults.
+    //
+    if (device_data_ptr == NULL)
+    {
+        return;
+    }
+
+    pku2400_device_data_ptrs[device - ONE] = device_data_ptr;
+
     //
     // Register an interest in this device instance's receive CAN
     // messages.
@@ -212,6 +232,32 @@ pku2400_init(
 }
 
 
+/******************************************************************************
+ *
+ *        Name: pku2400_get_device_data_ptr()
+ *
+ * Description: The record of a device instance, as resolved by
+ *              pku2400_init(). NULL if the instance has not been
+ *              initialised or is out of range.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+device_data_t *
+pku2400_get_device_data_ptr(
+    device_instances_t device)
+{
+    if ((device < ONE) || (device > FVT_MAX_DEVICE_INSTANCES))
+    {
+        return NULL;
+    }
+
+    return pku2400_device_data_ptrs[device - ONE];
+}
+
+
 //////////////////////////////////////////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////
@@ -253,10 +299,8 @@ static void rx_can_switch_status_rx_timeout(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(
-            device,
-            can_switches_pku2400_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pku2400_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Mark this message as having timed out.
@@ -314,7 +358,7 @@ static void rx_can_switch_status(
     //
     // Check can_data_ptr is not NULL.
     //
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // This will be a pointer to the device's receive data structure
@@ -326,17 +370,15 @@ static void rx_can_switch_status(
     // Get a pointer to this device's data record.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(
-            device,
-            can_switches_pku2400_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pku2400_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Have the pointer to this device's data record, not get a
     // pointer to the appropriate receive data structure.
     //
     dest_ptr = &(device_data_ptr->can_switch_status);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     //
     // Copy the data from the received CAN message to the designated
@@ -481,10 +523,8 @@ void pku2400_tx_led_controls(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(
-            device,
-            can_switches_pku2400_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pku2400_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -492,7 +532,7 @@ void pku2400_tx_led_controls(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_can_switch_led_control_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Handle the transmit_counter_limit so that this function's CAN
@@ -511,9 +551,9 @@ void pku2400_tx_led_controls(
         // parameter value is, send this function's CAN message
         // immediately the very first time this function is
         // called. After this initial send of the CAN message, the
-        // next send of the CAN message will not happen until this
-        // function has been called at least the number of times
-        // specified in the transmit_counter_limit parameter.
+        // next send of the CAN message will not happen until the
+        // time specified in the transmit_counter_limit parameter
+        // has elapsed.
         //
         tx_ptr->transmit_counter_limit = TX_SEND_EACH_CALL;
         tx_ptr->transmit_message_sent_first_time = TRUE;
@@ -533,19 +573,17 @@ void pku2400_tx_led_controls(
     //
     can_switches_pku2400_tx_led_control_t *can_data_ptr =
         (can_switches_pku2400_tx_led_control_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     // Send the CAN message if time to do so.
-    if (++(tx_ptr->transmit_counter) > tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get a
         // pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->can_switch_led_control);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
 
         source_ptr->unused1 = 0x0;
@@ -605,10 +643,8 @@ void pku2400_set_led_initial_state(device_instances_t device, led_state_t state)
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(
-            device,
-            can_switches_pku2400_first_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        pku2400_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     device_data_ptr->can_switch_led_control.green_led_top_switch_1 = state;
     device_data_ptr->can_switch_led_control.green_led_top_switch_2 = state;
@@ -11,14 +11,6 @@
  */
 #include "pku2400_device_private.h"
 
-//=============================================================================
-//
-// pointer of the first registration record of the PKU2400 module
-//
-//=============================================================================
-//
-extern device_data_t *can_switches_pku2400_first_device_data_ptr;
-
 /******************************************************************************
  *
  *        Name: get_status_momemtary_input_state()
@@ -39,15 +31,9 @@ bool_t pku2400_get_status_momentary_input_state(device_instances_t device,
 	bool_t momentary_state = FALSE;
 
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(
-            device,
-            can_switches_pku2400_first_device_data_ptr);
+        pku2400_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // Depending on the can_switch_number, return the instantenous  state
@@ -116,15 +102,9 @@ bool_t pku2400_get_status_switch_toggle_state(device_instances_t device,
     bool_t toggle_state = 0;
 
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(
-            device,
-            can_switches_pku2400_first_device_data_ptr);
+        pku2400_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // Depending on the can_switch_number, return the toggle state
@@ -201,9 +181,7 @@ bool_t pku2400_get_switch_previous_state(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(
-            device,
-            can_switches_pku2400_first_device_data_ptr);
+        pku2400_get_device_data_ptr(device);
 
     bool_t previous_state =
         device_data_ptr->switch_states[can_switch_name].previous_state;
@@ -230,9 +208,7 @@ bool_t pku2400_get_switch_toggled_state(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(
-            device,
-            can_switches_pku2400_first_device_data_ptr);
+        pku2400_get_device_data_ptr(device);
 
     bool_t toggled_state =
         device_data_ptr->switch_states[can_switch_name].toggled;
@@ -162,4 +162,13 @@ get_device_linked_data_record_instance_ptr(
     device_data_t *first_device_data_ptr);
 
 
+//
+// The record of a device instance, resolved once by pku2400_init().
+// NULL if the instance has not been initialised.
+//
+device_data_t *
+pku2400_get_device_data_ptr(
+    device_instances_t device);
+
+
 #endif
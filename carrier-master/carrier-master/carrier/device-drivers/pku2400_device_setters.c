@@ -13,14 +13,6 @@
 #include "pku2400_device_private.h"
 
 
-//=============================================================================
-//
-// A pointer to the first registeration record of the pku2400
-//
-//=============================================================================
-//
-extern device_data_t *can_switches_pku2400_first_device_data_ptr;
-
 
 //=============================================================================
 //
@@ -35,25 +27,13 @@ void pku2400_set_change_led_colour(
     can_switch_t switch_name,
     can_switch_colour_t colour)
 {
-
-	can_switches_pku2400_tx_led_control_t *dest_ptr = NULL;
-
 	//
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(
-            device,
-            can_switches_pku2400_first_device_data_ptr);
-
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
-
-	//
-    // Get a pointer to the output command structure.
-    //
-    dest_ptr = &(device_data_ptr->can_switch_led_control);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+		pku2400_get_device_data_ptr(device);
 
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     // Based on the switch, change colour of the desired LED
     switch (switch_name)
@@ -130,17 +110,15 @@ void pku2400_set_led_colour_top_switch_1(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(
-            device,
-            can_switches_pku2400_first_device_data_ptr);
+		pku2400_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->can_switch_led_control);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     switch (colour)
     {
@@ -188,17 +166,15 @@ void pku2400_set_led_colour_top_switch_2(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(
-            device,
-            can_switches_pku2400_first_device_data_ptr);
+		pku2400_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->can_switch_led_control);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     switch (colour)
     {
@@ -240,17 +216,15 @@ void pku2400_set_led_colour_top_switch_3(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(
-            device,
-            can_switches_pku2400_first_device_data_ptr);
+		pku2400_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->can_switch_led_control);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     switch (colour)
     {
@@ -290,17 +264,15 @@ void pku2400_set_led_colour_top_switch_4(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(
-            device,
-            can_switches_pku2400_first_device_data_ptr);
+		pku2400_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->can_switch_led_control);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     switch (colour)
     {
@@ -342,17 +314,15 @@ void pku2400_set_led_colour_bottom_switch_1(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(
-            device,
-            can_switches_pku2400_first_device_data_ptr);
+		pku2400_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->can_switch_led_control);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     switch (colour)
     {
@@ -393,17 +363,15 @@ void pku2400_set_led_colour_bottom_switch_2(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(
-            device,
-            can_switches_pku2400_first_device_data_ptr);
+		pku2400_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->can_switch_led_control);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     switch (colour)
     {
@@ -445,17 +413,15 @@ void pku2400_set_led_colour_bottom_switch_3(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(
-            device,
-            can_switches_pku2400_first_device_data_ptr);
+		pku2400_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->can_switch_led_control);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     switch (colour)
     {
@@ -497,17 +463,15 @@ void pku2400_set_led_colour_bottom_switch_4(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(
-            device,
-            can_switches_pku2400_first_device_data_ptr);
+		pku2400_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->can_switch_led_control);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     switch (colour)
     {
@@ -569,9 +533,7 @@ void pku2400_toggle_led_based_on_state(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(
-            device,
-            can_switches_pku2400_first_device_data_ptr);
+		pku2400_get_device_data_ptr(device);
 
     // Check to see if a change in state has occured
     if (device_data_ptr->switch_states[0].previous_state != bottom1)
@@ -702,9 +664,7 @@ void pku2400_set_switch_toggled_state(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(
-            device,
-            can_switches_pku2400_first_device_data_ptr);
+        pku2400_get_device_data_ptr(device);
 
     device_data_ptr->switch_states[can_switch_name].toggled = state;
 
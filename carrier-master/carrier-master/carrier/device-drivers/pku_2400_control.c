@@ -28,6 +28,7 @@
 #include "can_service_private.h"
 #include "can_service_devices.h"
 #include "pku2400_device.h"
+#include "cvc_input_control.h"
 
 
 /******************************************************************************
@@ -423,7 +424,7 @@ void pku2400_check_switches(device_instances_t device)
             }
             else
             {
-                if(IN_A11_keyswitch < 4000)
+                if(cvc_input_get_analog(CVC_AIN_A11_KEYSWITCH) < 4000)
                 {
                     pku2400_set_change_led_colour(
                         device,
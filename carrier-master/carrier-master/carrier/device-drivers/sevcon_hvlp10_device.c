@@ -72,6 +72,13 @@ typedef enum {
 //
 device_data_t *first_sevcon_device_data_ptr = NULL;
 
+//
+// The record of each device instance, indexed by device instance -
+// 1. Resolved once, by sevcon_hvlp10_init(). NULL for an instance that
+// has not been initialised. See sevcon_get_device_data_ptr().
+//
+static device_data_t *sevcon_device_data_ptrs[FVT_MAX_DEVICE_INSTANCES];
+
 //
 // This is incremented each for each device instance
 //
@@ -143,6 +150,19 @@ sevcon_hvlp10_init(
         		&device_instance_counter,
                 sizeof(device_data_t));
 
+    //
+    // The record could not be created. This is counted by can_service,
+    // so fvt_can_validate_device_registrations() fails and the vehicle
+    // control is not run. The instance is left unresolved, and its
+    // getters return their defaults.
+    //
+    if (device_data_ptr == NULL)
+    {
+        return;
+    }
+
+    sevcon_device_data_ptrs[device - ONE] = device_data_ptr;
+
     //
     // Register an interest in this device instance's receive CAN
     // messages.
@@ -202,6 +222,32 @@ sevcon_hvlp10_init(
 }
 
 
+/******************************************************************************
+ *
+ *        Name: sevcon_get_device_data_ptr()
+ *
+ * Description: The record of a device instance, as resolved by
+ *              sevcon_hvlp10_init(). NULL if the instance has not been
+ *              initialised or is out of range.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+device_data_t *
+sevcon_get_device_data_ptr(
+    device_instances_t device)
+{
+    if ((device < ONE) || (device > FVT_MAX_DEVICE_INSTANCES))
+    {
+        return NULL;
+    }
+
+    return sevcon_device_data_ptrs[device - ONE];
+}
+
+
 //////////////////////////////////////////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////
@@ -243,8 +289,8 @@ static void parameters_rx_timeout(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_sevcon_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        sevcon_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Mark this message as having timed out.
@@ -298,7 +344,7 @@ static void sevcon_hvlp10_rx_can_parameters(
 	int16_t *receive_timeout_counter)
 {
     // Check can_data_ptr is not NULL.
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // This will be a pointer to the device's receive data structure
@@ -310,15 +356,15 @@ static void sevcon_hvlp10_rx_can_parameters(
     // Get a pointer to this device's data record.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_sevcon_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        sevcon_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Have the pointer to this device's data record, not get a
     // pointer to the appropriate receive data structure.
     //
     dest_ptr = &(device_data_ptr->parameters);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     //
     // Copy the data from the received CAN message to the designated
@@ -360,7 +406,7 @@ static void sevcon_hvlp10_rx_can_motor_rpm(
 	int16_t *receive_timeout_counter)
 {
     // Check can_data_ptr is not NULL.
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // This will be a pointer to the device's receive data structure
@@ -372,16 +418,15 @@ static void sevcon_hvlp10_rx_can_motor_rpm(
     // Get a pointer to this device's data record.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device,
-                                                   first_sevcon_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        sevcon_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Have the pointer to this device's data record, not get a
     // pointer to the appropriate receive data structure.
     //
     dest_ptr = &(device_data_ptr->motor_rpm);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     //
     // Copy the data from the received CAN message to the designated
@@ -499,8 +544,8 @@ void sevcon_hvlp10_tx_can_set_drive_limits_and_inverter_enable(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_sevcon_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        sevcon_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -508,7 +553,7 @@ void sevcon_hvlp10_tx_can_set_drive_limits_and_inverter_enable(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_data1_can_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -522,19 +567,17 @@ void sevcon_hvlp10_tx_can_set_drive_limits_and_inverter_enable(
     //
     sevcon_hvlp10_tx_data1_t *can_data_ptr =
         (sevcon_hvlp10_tx_data1_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     // Send the CAN message if time to do so.
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get a
         // pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->data1);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit buffer.
@@ -585,8 +628,8 @@ void sevcon_hvlp10_tx_can_set_operational_limits(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_sevcon_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        sevcon_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -594,7 +637,7 @@ void sevcon_hvlp10_tx_can_set_operational_limits(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_data2_can_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -608,19 +651,17 @@ void sevcon_hvlp10_tx_can_set_operational_limits(
     //
     sevcon_hvlp10_tx_data2_t *can_data_ptr =
         (sevcon_hvlp10_tx_data2_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     // Send the CAN message if time to do so.
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get a
         // pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->data2);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit buffer.
@@ -672,8 +713,8 @@ void sevcon_hvlp10_tx_can_battery_current_limits_and_voltage_limits(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_sevcon_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        sevcon_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -681,7 +722,7 @@ void sevcon_hvlp10_tx_can_battery_current_limits_and_voltage_limits(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_data3_can_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -695,19 +736,17 @@ void sevcon_hvlp10_tx_can_battery_current_limits_and_voltage_limits(
     //
     sevcon_hvlp10_tx_data3_t *can_data_ptr =
         (sevcon_hvlp10_tx_data3_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     // Send the CAN message if time to do so.
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get a
         // pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->data3);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit buffer.
@@ -753,10 +792,8 @@ void sevcon_hvlp10_tx_can_heartbeat(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(
-            device,
-            first_sevcon_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        sevcon_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -764,7 +801,7 @@ void sevcon_hvlp10_tx_can_heartbeat(
     //
     can_tx_registration_t *tx_ptr =
         device_data_ptr->send_data4_can_ptr;
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -778,20 +815,17 @@ void sevcon_hvlp10_tx_can_heartbeat(
     //
     sevcon_hvlp10_tx_data4_t *can_data_ptr =
         (sevcon_hvlp10_tx_data4_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     // Send the CAN message if time to do so.
-    if (++(tx_ptr->transmit_counter) >=
-        tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get a
         // pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->data4);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit buffer.
@@ -11,8 +11,6 @@
  */
 #include "sevcon_hvlp10_device_private.h"
 
-extern device_data_t *first_sevcon_device_data_ptr;
-
 //=============================================================================
 //
 // Getters for sevcon_hvlp10
@@ -23,15 +21,9 @@ uint16_t sevcon_hvlp10_get_sevcon_dc_link_voltage(
     device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(
-            device,
-            first_sevcon_device_data_ptr);
+        sevcon_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // Return the dc voltage present at the input of the sevcon
@@ -57,10 +49,8 @@ uint16_t sevcon_hvlp10_get_sevcon_heatsink_temperature(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(
-            device,
-            first_sevcon_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        sevcon_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, 0);
 
     //
     // Have the pointer to this device's data record, now get a
@@ -68,7 +58,7 @@ uint16_t sevcon_hvlp10_get_sevcon_heatsink_temperature(
     //
     sevcon_hvlp10_rx_parameters_t *source_ptr =
         &(device_data_ptr->parameters);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     //
     // scaling: 0.0625Nm/bit -> (1/0.0625 = 16)
@@ -89,13 +79,9 @@ uint16_t sevcon_hvlp10_get_sevcon_current(
     device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_sevcon_device_data_ptr);
+        sevcon_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     // scaling: 0.0625Nm/bit -> (1/0.0625 = 16)
     return (uint16_t)(device_data_ptr->parameters.sevcon_current / 16);
@@ -111,13 +97,9 @@ uint16_t sevcon_hvlp10_get_stepper_motor_temperature(
     device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_sevcon_device_data_ptr);
+        sevcon_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     // scaling: 0.0625Nm/bit -> (1/0.0625 = 16)
     return (uint16_t)(device_data_ptr->parameters.stepper_motor_temperature / 16);
@@ -134,13 +116,9 @@ sevcon_hvlp10_get_stepper_motor_rpm(
 {
 
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_sevcon_device_data_ptr);
+        sevcon_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     // scaling: 0.0625Nm/bit -> (1/0.0625 = 16)
     return (uint16_t)(device_data_ptr->motor_rpm.motor_rpm);
@@ -173,8 +151,8 @@ bool_t sevcon_hvlp10_get_can_rx_ok(device_instances_t device)
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_sevcon_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        sevcon_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // By default, receive CAN message timeouts are disabled.
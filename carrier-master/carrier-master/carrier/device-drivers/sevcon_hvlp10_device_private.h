@@ -150,6 +150,15 @@ get_device_linked_data_record_instance_ptr(
     device_instances_t device,
     device_data_t *first_device_data_ptr);
 
+
+//
+// The record of a device instance, resolved once by sevcon_hvlp10_init().
+// NULL if the instance has not been initialised.
+//
+device_data_t *
+sevcon_get_device_data_ptr(
+    device_instances_t device);
+
 #endif
 
 
@@ -11,8 +11,6 @@
 #include "Prototypes.h"
 #include "sevcon_hvlp10_device_private.h"
 
-extern device_data_t *first_sevcon_device_data_ptr;
-
 /******************************************************************************
  *
  *        Name: skai2_power_on/skai2_power_off
@@ -28,7 +26,7 @@ extern device_data_t *first_sevcon_device_data_ptr;
 void sevcon_hvlp10_set_12V_power(device_instances_t device, uint16_t state)
 {
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_sevcon_device_data_ptr);
+		sevcon_get_device_data_ptr(device);
 
 	if (device_data_ptr == NULL)
 	{DEBUG("NULL POINTER");}
@@ -70,15 +68,15 @@ void sevcon_hvlp10_set_drive_limits_and_inverter_enable(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_sevcon_device_data_ptr);
+		sevcon_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->data1);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     // The output torque that inverter will attempt to produce when
     // enabled is denoted by the variable set_output_torque.
@@ -123,15 +121,15 @@ void sevcon_hvlp10_can_operational_limits(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_sevcon_device_data_ptr);
+		sevcon_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->data2);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     // For negative value, use 2's compliment to transmit the
     // message.
@@ -180,15 +178,15 @@ void sevcon_hvlp10_set_battery_current_limits_and_voltage_limits(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_sevcon_device_data_ptr);
+		sevcon_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->data3);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     // Maximum allowed battery discharge
     // scaling: 1A/bit
@@ -54,6 +54,13 @@ const uint32_t SHINRY_BASE_TXID = 0x10262B2;
 //
 device_data_t *first_shinry_device_data_ptr = NULL;
 
+//
+// The record of each device instance, indexed by device instance -
+// 1. Resolved once, by init_shinry_dcdc(). NULL for an instance that
+// has not been initialised. See shinry_get_device_data_ptr().
+//
+static device_data_t *shinry_device_data_ptrs[FVT_MAX_DEVICE_INSTANCES];
+
 //
 // This is incremented each for each device instance
 //
@@ -132,6 +139,19 @@ init_shinry_dcdc(
         		&device_instance_counter,
                 sizeof(device_data_t));
 
+    //
+    // The record could not be created. This is counted by can_service,
+    // so fvt_can_validate_device_registrations() fails and the vehicle
+    // control is not run. The instance is left unresolved, and its
+    // getters return their defaults.
+    //
+    if (device_data_ptr == NULL)
+    {
+        return;
+    }
+
+    shinry_device_data_ptrs[device - ONE] = device_data_ptr;
+
     //
     // Register an interest to receive the following CAN messages from
     // the skai2 device instance.
@@ -144,6 +164,12 @@ init_shinry_dcdc(
         rx_shinry_dcdc_status,
         status_rx_timeout);
 
+    device_data_ptr->status_rx_handle =
+        fvt_can_get_receive_handle(
+            module_id,
+            can_line,
+            SHINRY_BASE_RXID);
+
     //
     // Register an intent to transmit the following CAN messages to
     // the skai2 device instance.
@@ -164,6 +190,32 @@ init_shinry_dcdc(
 }
 
 
+/******************************************************************************
+ *
+ *        Name: shinry_get_device_data_ptr()
+ *
+ * Description: The record of a device instance, as resolved by
+ *              init_shinry_dcdc(). NULL if the instance has not been
+ *              initialised or is out of range.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+device_data_t *
+shinry_get_device_data_ptr(
+    device_instances_t device)
+{
+    if ((device < ONE) || (device > FVT_MAX_DEVICE_INSTANCES))
+    {
+        return NULL;
+    }
+
+    return shinry_device_data_ptrs[device - ONE];
+}
+
+
 //////////////////////////////////////////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////
@@ -205,8 +257,8 @@ static void status_rx_timeout(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_shinry_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        shinry_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Mark this message as having timed out.
@@ -259,7 +311,7 @@ static void rx_shinry_dcdc_status(
     int16_t *receive_counter)
 {
     // Check can_data_ptr is not NULL.
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // This will be a pointer to the device's receive data structure
@@ -271,16 +323,15 @@ static void rx_shinry_dcdc_status(
     // Get a pointer to this device's data record.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(
-            device, first_shinry_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        shinry_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Have the pointer to this device's data record, not get a
     // pointer to the appropriate receive data structure.
     //
     dest_ptr = &(device_data_ptr->status);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     //
     // Copy the data from the received CAN message to the designated
@@ -371,10 +422,8 @@ void tx_shinry_dcdc_control(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(
-            device,
-            first_shinry_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        shinry_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -383,7 +432,7 @@ void tx_shinry_dcdc_control(
 	can_tx_registration_t *tx_ptr =
         device_data_ptr->send_dcdc_control_ptr;
 
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -397,21 +446,19 @@ void tx_shinry_dcdc_control(
     //
     shinry_dcdc_tx_control_t *can_data_ptr =
         (shinry_dcdc_tx_control_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // Send the CAN message if time to do so.
     //
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get
         // a pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->control);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit
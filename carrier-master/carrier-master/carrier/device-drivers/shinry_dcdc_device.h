@@ -223,6 +223,12 @@ bool_t shinry_get_output_under_voltage(device_instances_t device);
 
 bool_t shinry_get_can_rx_ok(device_instances_t device);
 
+/******************************************************************************
+ * Description: ms since the status was last received.
+ ******************************************************************************
+ */
+uint32_t shinry_get_rx_age_ms(device_instances_t device);
+
 
 
 
@@ -12,19 +12,13 @@
 
 #include "shinry_dcdc_device_private.h"
 
-extern device_data_t *first_shinry_device_data_ptr;
-
 
 uint8_t shinry_get_software_version(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_shinry_device_data_ptr);
+        shinry_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (uint8_t)(device_data_ptr->status.software_version);
 }
@@ -33,13 +27,9 @@ uint8_t shinry_get_software_version(device_instances_t device)
 uint16_t shinry_get_instantaneous_input_voltage(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_shinry_device_data_ptr);
+        shinry_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (uint16_t)(device_data_ptr->status.instantaneous_input_voltage);
 }
@@ -48,13 +38,9 @@ uint16_t shinry_get_instantaneous_input_voltage(device_instances_t device)
 uint16_t shinry_get_instantaneous_output_voltage(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_shinry_device_data_ptr);
+        shinry_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     // The transmitted value is multiplied by 10, hence the received value
     // is multiplied by 0.1.
@@ -65,13 +51,9 @@ uint16_t shinry_get_instantaneous_output_voltage(device_instances_t device)
 uint16_t shinry_get_instantaneous_temperature(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_shinry_device_data_ptr);
+        shinry_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     // The received value must be Offseted by -40.
     return (uint16_t)((device_data_ptr->status.instantaneous_temperature - 40));
@@ -81,13 +63,9 @@ uint16_t shinry_get_instantaneous_temperature(device_instances_t device)
 uint16_t shinry_get_instantaneous_current_voltage(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_shinry_device_data_ptr);
+        shinry_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     // The transmitted value is multiplied by 10, hence the received value
     // is multiplied by 0.1.
@@ -98,13 +76,9 @@ uint16_t shinry_get_instantaneous_current_voltage(device_instances_t device)
 bool_t shinry_get_over_current_fault(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_shinry_device_data_ptr);
+        shinry_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->status.over_current_fault);
 }
@@ -113,13 +87,9 @@ bool_t shinry_get_over_current_fault(device_instances_t device)
 bool_t shinry_get_over_temperature_fault(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_shinry_device_data_ptr);
+        shinry_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->status.over_temperature_fault);
 }
@@ -128,13 +98,9 @@ bool_t shinry_get_over_temperature_fault(device_instances_t device)
 bool_t shinry_get_derating(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_shinry_device_data_ptr);
+        shinry_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->status.derating);
 }
@@ -143,13 +109,9 @@ bool_t shinry_get_derating(device_instances_t device)
 dcdc_mode_t shinry_get_operation_mode(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_shinry_device_data_ptr);
+        shinry_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return STANDBY;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, STANDBY);
 
     dcdc_mode_t mode = (dcdc_mode_t)device_data_ptr->status.operation_mode;
 
@@ -160,13 +122,9 @@ dcdc_mode_t shinry_get_operation_mode(device_instances_t device)
 bool_t shinry_get_can_cmd_lost(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_shinry_device_data_ptr);
+        shinry_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     return (bool_t)(device_data_ptr->status.can_cmd_lost);
 }
@@ -175,13 +133,9 @@ bool_t shinry_get_can_cmd_lost(device_instances_t device)
 bool_t shinry_get_input_over_voltage(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_shinry_device_data_ptr);
+        shinry_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     // The transmitted value is multiplied by 10, hence the received value
     // is multiplied by 0.1.
@@ -192,13 +146,9 @@ bool_t shinry_get_input_over_voltage(device_instances_t device)
 bool_t shinry_get_input_under_voltage(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_shinry_device_data_ptr);
+        shinry_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     // The transmitted value is multiplied by 10, hence the received value
     // is multiplied by 0.1.
@@ -209,13 +159,9 @@ bool_t shinry_get_input_under_voltage(device_instances_t device)
 bool_t shinry_get_output_over_voltage(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_shinry_device_data_ptr);
+        shinry_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     // The transmitted value is multiplied by 10, hence the received value
     // is multiplied by 0.1.
@@ -226,13 +172,9 @@ bool_t shinry_get_output_over_voltage(device_instances_t device)
 bool_t shinry_get_output_under_voltage(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_shinry_device_data_ptr);
+        shinry_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     // The transmitted value is multiplied by 10, hence the received value
     // is multiplied by 0.1.
@@ -265,8 +207,8 @@ bool_t shinry_get_can_rx_ok(device_instances_t device)
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_shinry_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        shinry_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // By default, receive CAN message timeouts are disabled.
@@ -280,3 +222,27 @@ bool_t shinry_get_can_rx_ok(device_instances_t device)
         return FALSE;
     }
 }
+
+
+//=============================================================================
+//
+// shinry_get_rx_age_ms()
+//
+// The ms since the status was last received, or since the device was
+// initialised if it has not been received. FVT_CAN_RX_AGE_UNKNOWN if
+// the device is not fitted.
+//
+//=============================================================================
+//
+uint32_t shinry_get_rx_age_ms(device_instances_t device)
+{
+    device_data_t *device_data_ptr =
+        shinry_get_device_data_ptr(device);
+
+    if (device_data_ptr == NULL)
+    {
+        return FVT_CAN_RX_AGE_UNKNOWN;
+    }
+
+    return fvt_can_get_receive_age_ms(device_data_ptr->status_rx_handle);
+}
@@ -179,6 +179,9 @@ typedef struct device_data_s {
     // These are pointers to CAN tx registration records
 	can_tx_registration_t *send_dcdc_control_ptr;
 
+    // The receive record of the status, for the age of the data.
+    can_rx_handle_t status_rx_handle;
+
     // power pin
     uint8_t dcdc_power_pin;
 } device_data_t;
@@ -205,4 +208,13 @@ get_device_linked_data_record_instance_ptr(
     device_instances_t device,
     device_data_t *first_device_data_ptr);
 
+
+//
+// The record of a device instance, resolved once by init_shinry_dcdc().
+// NULL if the instance has not been initialised.
+//
+device_data_t *
+shinry_get_device_data_ptr(
+    device_instances_t device);
+
 //#endif // SKAI2_INVERTER_PRIVATE_H_
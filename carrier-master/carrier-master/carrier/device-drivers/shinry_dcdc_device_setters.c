@@ -13,8 +13,6 @@
 #include "Prototypes.h"
 #include "shinry_dcdc_device_private.h"
 
-extern device_data_t *first_shinry_device_data_ptr;
-
 /******************************************************************************
  *
  *        Name: shinry_dcdc_enable_signal_to_pin3_on_connector()
@@ -27,7 +25,7 @@ extern device_data_t *first_shinry_device_data_ptr;
 void shinry_dcdc_enable_signal_to_pin3_on_connector(device_instances_t device, uint16_t state)
 {
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_shinry_device_data_ptr);
+		shinry_get_device_data_ptr(device);
 
 	if (device_data_ptr == NULL)
 	{DEBUG("NULL POINTER");}
@@ -67,15 +65,15 @@ void shinry_set_dcdc_control(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_shinry_device_data_ptr);
+		shinry_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->control);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     // 0.125V/bit
     // Example: desired output voltage = 13.5V
@@ -12,8 +12,6 @@
 
 #include "skai2_inverter_private.h"
 
-extern device_data_t *first_skai2_device_data_ptr;
-
 //=============================================================================
 //
 // A set of Functions that return the temperatures of phase A, phase
@@ -35,16 +33,16 @@ uint16_t skai_get_temperature_dcb_phase_L1(device_instances_t device)
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_device_data_ptr);
+        skai2_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, 0);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     skai2_inverter_temperature_t *source_ptr = &(device_data_ptr->temperature);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
 
     // The transmitted value is multiplied by 10, hence the received value
@@ -68,16 +66,16 @@ uint16_t skai_get_temperature_dcb_phase_L2(device_instances_t device)
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_device_data_ptr);
+        skai2_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, 0);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     skai2_inverter_temperature_t *source_ptr = &(device_data_ptr->temperature);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
 
     // The transmitted value is multiplied by 10, hence the received value
@@ -101,16 +99,16 @@ uint16_t skai_get_temperature_dcb_phase_L3(device_instances_t device)
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_device_data_ptr);
+        skai2_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, 0);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     skai2_inverter_temperature_t *source_ptr = &(device_data_ptr->temperature);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
 
     // The transmitted value is multiplied by 10, hence the received value
@@ -134,16 +132,16 @@ uint16_t skai_get_temperature_pcb(device_instances_t device)
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_device_data_ptr);
+        skai2_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, 0);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     skai2_inverter_temperature_t *source_ptr = &(device_data_ptr->temperature);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     // The transmitted value is multiplied by 10, hence the received value
     // is multiplied by 0.1.
@@ -166,16 +164,16 @@ uint16_t skai_get_electrical_offset_ccw(device_instances_t device)
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_device_data_ptr);
+        skai2_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, 0);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     skai2_inverter_eleAngle_RPM_t *source_ptr = &(device_data_ptr->ElectricalAngle_RPM);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     // The transmitted value is multiplied by 10, hence the received value
     // is multiplied by 0.1.
@@ -198,16 +196,16 @@ uint16_t skai_get_electrical_offset_cw(device_instances_t device)
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_device_data_ptr);
+        skai2_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, 0);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     skai2_inverter_eleAngle_RPM_t *source_ptr = &(device_data_ptr->ElectricalAngle_RPM);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     // The transmitted value is multiplied by 10, hence the received value
     // is multiplied by 0.1.
@@ -230,16 +228,16 @@ uint16_t skai_get_motor_rpm(device_instances_t device)
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_device_data_ptr);
+        skai2_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, 0);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     skai2_inverter_eleAngle_RPM_t *source_ptr = &(device_data_ptr->ElectricalAngle_RPM);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     uint16_t motor_rpm = (uint16_t)(source_ptr->motor_rpm);
 
@@ -260,16 +258,16 @@ uint16_t skai_get_max_temperature(device_instances_t device)
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_device_data_ptr);
+        skai2_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, 0);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     skai2_inverter_eleAngle_RPM_t *source_ptr = &(device_data_ptr->ElectricalAngle_RPM);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     // The transmitted value is multiplied by 10, hence the received value
     // is multiplied by 0.1.
@@ -292,16 +290,16 @@ uint16_t skai_get_torque(device_instances_t device)
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_device_data_ptr);
+        skai2_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, 0);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     skai2_inverter_torque_t *source_ptr = &(device_data_ptr->motor_torque);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     // The transmitted value is multiplied by 10, hence the received value
     // is multiplied by 0.1.
@@ -325,16 +323,16 @@ uint16_t skai_get_MotorTemp_C(device_instances_t device)
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_device_data_ptr);
+        skai2_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, 0);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     skai2_inverter_status_t *source_ptr = &(device_data_ptr->status);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     // The transmitted value is multiplied by 10, hence the received value
     // is multiplied by 0.1.
@@ -357,16 +355,16 @@ uint16_t skai_get_DCLink_Voltage(device_instances_t device)
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_device_data_ptr);
+        skai2_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, 0);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     skai2_inverter_status_t *source_ptr = &(device_data_ptr->status);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     // The transmitted value is multiplied by 10, hence the received value
     // is multiplied by 0.1.
@@ -392,16 +390,16 @@ bool_t skai_get_inverter_error_status(device_instances_t device)
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_device_data_ptr);
+        skai2_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN(device_data_ptr, error_status);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     skai2_inverter_status_t *source_ptr = &(device_data_ptr->status);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     uint16_t error_feedback1 =
         (uint16_t)source_ptr->error_feedback_1;
@@ -451,8 +449,8 @@ bool_t skai2_get_can_rx_ok(device_instances_t device)
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        skai2_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // By default, receive CAN message timeouts are disabled.
@@ -12,8 +12,6 @@
 
 #include "skai2_inverter_private_vissim.h"
 
-extern device_data_t *first_skai2_vissim_device_data_ptr;
-
 //////////////////////////////////////////////////////////////////////
 // Rx_Msg1_Data Structure
 //////////////////////////////////////////////////////////////////////
@@ -23,20 +21,16 @@ bool_t skai_get_vissim_error_status(device_instances_t device)
     bool_t error_status = FALSE;
 
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
+        skai2_vissim_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     skai2_inverter_rx_msg1_t *source_ptr = &(device_data_ptr->rx_msg1_data);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     uint16_t error_feedback1 =
         (uint16_t)source_ptr->error_feedback_1;
@@ -63,20 +57,16 @@ uint16_t skai_get_vissim_DCLink_Voltage(device_instances_t device)
     bool_t error_status = FALSE;
 
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
+        skai2_vissim_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     skai2_inverter_rx_msg1_t *source_ptr = &(device_data_ptr->rx_msg1_data);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     uint16_t dc_link_voltage = (uint16_t)(source_ptr->DCLink_Voltage * 0.1);
 
@@ -90,20 +80,16 @@ uint16_t skai_get_vissim_motor_temp_C(device_instances_t device)
     bool_t error_status = FALSE;
 
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
+        skai2_vissim_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // Have the pointer to this device's data record, now get a
     // pointer to the appropriate receive data structure.
     //
     skai2_inverter_rx_msg1_t *source_ptr = &(device_data_ptr->rx_msg1_data);
-    if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(source_ptr);
 
     uint16_t motor_temp = (uint16_t)(source_ptr->MotorTemp_C * 0.1);
 
@@ -117,13 +103,9 @@ uint16_t skai_get_vissim_motor_temp_C(device_instances_t device)
 uint16_t skai_get_vissim_auxilary_input_voltage(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
+        skai2_vissim_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     // The transmitted value is multiplied by 10, hence the received value
     // is multiplied by 0.1.
@@ -133,13 +115,9 @@ uint16_t skai_get_vissim_auxilary_input_voltage(device_instances_t device)
 uint16_t skai_get_vissim_throttle(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
+        skai2_vissim_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     // The transmitted value is multiplied by 10, hence the received value
     // is multiplied by 0.1.
@@ -149,19 +127,42 @@ uint16_t skai_get_vissim_throttle(device_instances_t device)
 uint16_t skai_get_vissim_version_number(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
+        skai2_vissim_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     // The transmitted value is multiplied by 10, hence the received value
     // is multiplied by 0.1.
     return (uint16_t)(device_data_ptr->rx_msg2_data.version_number);
 }
 
+uint32_t skai_get_vissim_rx_age_ms(device_instances_t device)
+{
+    device_data_t *device_data_ptr =
+        skai2_vissim_get_device_data_ptr(device);
+
+    if (device_data_ptr == NULL)
+    {
+        return FVT_CAN_RX_AGE_UNKNOWN;
+    }
+
+    return fvt_can_get_receive_age_ms(device_data_ptr->msg1_rx_handle);
+}
+
+uint32_t skai_get_vissim_rx_change_count(device_instances_t device)
+{
+    device_data_t *device_data_ptr =
+        skai2_vissim_get_device_data_ptr(device);
+
+    if (device_data_ptr == NULL)
+    {
+        return 0;
+    }
+
+    return fvt_can_get_receive_change_count(device_data_ptr->msg1_rx_handle)
+        + fvt_can_get_receive_change_count(device_data_ptr->msg3_rx_handle);
+}
+
 //////////////////////////////////////////////////////////////////////
 // Rx_Msg3_Data Structure
 //////////////////////////////////////////////////////////////////////
@@ -169,13 +170,9 @@ uint16_t skai_get_vissim_version_number(device_instances_t device)
 uint16_t skai_get_vissim_torque(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
+        skai2_vissim_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     // The transmitted value is multiplied by 10, hence the received value
     // is multiplied by 0.1.
@@ -185,13 +182,9 @@ uint16_t skai_get_vissim_torque(device_instances_t device)
 uint16_t skai_get_vissim_motor_rpm(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
+        skai2_vissim_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     // The transmitted value is multiplied by 10, hence the received value
     // is multiplied by 0.1.
@@ -201,13 +194,9 @@ uint16_t skai_get_vissim_motor_rpm(device_instances_t device)
 uint16_t skai_get_vissim_encoder_feedback(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
+        skai2_vissim_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     // The transmitted value is multiplied by 10, hence the received value
     // is multiplied by 0.1.
@@ -220,13 +209,9 @@ uint16_t skai_get_vissim_encoder_feedback(device_instances_t device)
 uint16_t skai_get_vissim_throttle_pedal_adc(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
+        skai2_vissim_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     // The transmitted value is multiplied by 10, hence the received value
     // is multiplied by 0.1.
@@ -236,13 +221,9 @@ uint16_t skai_get_vissim_throttle_pedal_adc(device_instances_t device)
 uint16_t skai_get_vissim_IO_status(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
+        skai2_vissim_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     // The transmitted value is multiplied by 10, hence the received value
     // is multiplied by 0.1.
@@ -252,13 +233,9 @@ uint16_t skai_get_vissim_IO_status(device_instances_t device)
 uint16_t skai_get_vissim_electrical_angle(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
+        skai2_vissim_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     // The transmitted value is multiplied by 10, hence the received value
     // is multiplied by 0.1.
@@ -272,13 +249,9 @@ uint16_t skai_get_vissim_electrical_angle(device_instances_t device)
 uint16_t skai_get_vissim_dcb_phase1_temperature(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
+        skai2_vissim_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     // The transmitted value is multiplied by 10, hence the received value
     // is multiplied by 0.1.
@@ -288,13 +261,9 @@ uint16_t skai_get_vissim_dcb_phase1_temperature(device_instances_t device)
 uint16_t skai_get_vissim_dcb_phase2_temperature(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
+        skai2_vissim_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     // The transmitted value is multiplied by 10, hence the received value
     // is multiplied by 0.1.
@@ -304,13 +273,9 @@ uint16_t skai_get_vissim_dcb_phase2_temperature(device_instances_t device)
 uint16_t skai_get_vissim_dcb_phase3_temperature(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
+        skai2_vissim_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     // The transmitted value is multiplied by 10, hence the received value
     // is multiplied by 0.1.
@@ -320,13 +285,9 @@ uint16_t skai_get_vissim_dcb_phase3_temperature(device_instances_t device)
 uint16_t skai_get_vissim_pcb_temperature(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
+        skai2_vissim_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     // The transmitted value is multiplied by 10, hence the received value
     // is multiplied by 0.1.
@@ -340,13 +301,9 @@ uint16_t skai_get_vissim_pcb_temperature(device_instances_t device)
 uint16_t skai_get_vissim_power_consumned(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
+        skai2_vissim_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     // The transmitted value is multiplied by 10, hence the received value
     // is multiplied by 0.1.
@@ -356,13 +313,9 @@ uint16_t skai_get_vissim_power_consumned(device_instances_t device)
 uint16_t skai_get_vissim_max_temperature(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
+        skai2_vissim_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     // The transmitted value is multiplied by 10, hence the received value
     // is multiplied by 0.1.
@@ -372,13 +325,9 @@ uint16_t skai_get_vissim_max_temperature(device_instances_t device)
 uint16_t skai_get_vissim_inverter_enable(device_instances_t device)
 {
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
+        skai2_vissim_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL)
-	{
-		DEBUG("NULL Pointer");
-		return FALSE;
-	}
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     // The transmitted value is multiplied by 10, hence the received value
     // is multiplied by 0.1.
@@ -412,10 +361,8 @@ bool_t skai_get_vissim_inverter_can_rx_ok(device_instances_t device)
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(
-            device,
-            first_skai2_vissim_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        skai2_vissim_get_device_data_ptr(device);
+    NULL_CHECK_RETURN(device_data_ptr, FALSE);
 
     //
     // By default, receive CAN message timeouts are disabled.
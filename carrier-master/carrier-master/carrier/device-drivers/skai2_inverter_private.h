@@ -183,4 +183,13 @@ get_device_linked_data_record_instance_ptr(
     device_instances_t device,
     device_data_t *first_device_data_ptr);
 
+
+//
+// The record of a device instance, resolved once by init_skai2_inverter().
+// NULL if the instance has not been initialised.
+//
+device_data_t *
+skai2_get_device_data_ptr(
+    device_instances_t device);
+
 #endif // SKAI2_INVERTER_PRIVATE_H_
@@ -286,6 +286,12 @@ typedef struct device_data_s {
     bool_t skai2_vissim_msg5_rx_ok;
     bool_t skai2_vissim_msg9_rx_ok;
 
+    // The receive record of msg1, for the age of the inverter data.
+    can_rx_handle_t msg1_rx_handle;
+
+    // The receive record of msg3, for the change count with msg1.
+    can_rx_handle_t msg3_rx_handle;
+
 	uint8_t inverter_power_pin;
 } device_data_t;
 
@@ -311,4 +317,13 @@ get_device_linked_data_record_instance_ptr(
     device_instances_t device,
     device_data_t *first_device_data_ptr);
 
+
+//
+// The record of a device instance, resolved once by init_skai2_inverter_vissim().
+// NULL if the instance has not been initialised.
+//
+device_data_t *
+skai2_vissim_get_device_data_ptr(
+    device_instances_t device);
+
 #endif // SKAI2_INVERTER_PRIVATE_H_
@@ -13,8 +13,6 @@
 #include "Prototypes.h"
 #include "skai2_inverter_private.h"
 
-extern device_data_t *first_skai2_device_data_ptr;
-
 /******************************************************************************
  *
  *        Name: skai2_power_on/skai2_power_off
@@ -30,7 +28,7 @@ extern device_data_t *first_skai2_device_data_ptr;
 void skai2_set_12V_power(device_instances_t device, uint16_t state)
 {
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_skai2_device_data_ptr);
+		skai2_get_device_data_ptr(device);
 
 	if (device_data_ptr == NULL)
 	{DEBUG("NULL POINTER");}
@@ -73,15 +71,15 @@ void skai2_set_inverter_control(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_skai2_device_data_ptr);
+		skai2_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->control);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
 	dest_ptr->motor_switch_enable = motor_switch;
 	dest_ptr->commanded_motor_direction = direction;
@@ -122,15 +120,15 @@ void skai2_set_inverter_limits(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_skai2_device_data_ptr);
+		skai2_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->limits);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
 
 	dest_ptr->max_battery_current = max_battery_current;
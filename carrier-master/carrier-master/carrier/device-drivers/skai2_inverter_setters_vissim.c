@@ -13,8 +13,6 @@
 #include "Prototypes.h"
 #include "skai2_inverter_private_vissim.h"
 
-extern device_data_t *first_skai2_vissim_device_data_ptr;
-
 void skai2_set_vissim_tx_msg1_data_d_gains(
 	device_instances_t device,
 	uint16_t d_proportional_gain,
@@ -29,15 +27,15 @@ void skai2_set_vissim_tx_msg1_data_d_gains(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
+		skai2_vissim_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->tx_msg1_data_d_gains);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
 
 	dest_ptr->d_proportional_gain = d_proportional_gain;
@@ -61,15 +59,15 @@ void skai2_set_vissim_tx_msg2_data_q_gains(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
+		skai2_vissim_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->tx_msg2_data_q_gains);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
 
 	dest_ptr->q_proportional_gain = q_proportional_gain;
@@ -92,15 +90,15 @@ void skai2_set_vissim_tx_msg3_data_speed_gains(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
+		skai2_vissim_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->tx_msg3_data_speed_gains);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
 
 	dest_ptr->speed_proportional_gain = speed_proportional_gain;
@@ -123,15 +121,15 @@ void skai2_set_vissim_tx_msg4_data_electrical_angle(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
+		skai2_vissim_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->tx_msg4_data_electrical_angle);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
 
 	dest_ptr->electrical_angle_forward = electrical_angle_forward;
@@ -154,15 +152,15 @@ void skai2_set_vissim_tx_msg5_enable_max_current_soc_high_cell(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
+		skai2_vissim_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->tx_msg5_enable_max_current_soc_high_cell);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
 
 	dest_ptr->inverter_enable = inverter_enable;
@@ -185,15 +183,15 @@ void skai2_set_vissim_tx_msg6_motor_scale(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
+		skai2_vissim_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->tx_msg6_motor_scale);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
 
 	dest_ptr->motor_scale_P1 = motor_scale_P1;
@@ -216,15 +214,15 @@ void skai2_set_vissim_tx_msg7_regen_scale(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
+		skai2_vissim_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->tx_msg7_regen_scale);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
 
 	dest_ptr->regen_scale_P1 = regen_scale_P1;
@@ -247,15 +245,15 @@ void skai2_set_vissim_tx_msg8_throttle_filter_dqf_gains(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
+		skai2_vissim_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->tx_msg8_throttle_filter_dqf_gains);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
 
 	dest_ptr->throttle_gain_1 = throttle_gain_1;
@@ -278,15 +276,15 @@ void skai2_set_vissim_tx_msg9_battery_current_mode_direction_hyd_throttle(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
+		skai2_vissim_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->tx_msg9_battery_current_mode_direction_hyd_throttle);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
 
 	dest_ptr->battery_current = battery_current;
@@ -310,15 +308,15 @@ void skai2_set_vissim_tx_msg10_pedal_calibration_motor_scale(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
+		skai2_vissim_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->tx_msg10_pedal_calibration_motor_scale);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
 
 	dest_ptr->throttle_released = throttle_released;
@@ -339,15 +337,15 @@ void skai2_set_vissim_tx_msg11_throttle_override(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
+		skai2_vissim_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->tx_msg11_throttle_override);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
 
 	dest_ptr->unused1 = 0;
@@ -370,15 +368,15 @@ void skai2_set_vissim_tx_msg12_rpm_outgain_ramptime(
     // Get a pointer to the proper device data structure.
     //
 	device_data_t *device_data_ptr =
-		get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
+		skai2_vissim_get_device_data_ptr(device);
 
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
 	//
     // Get a pointer to the output command structure.
     //
     dest_ptr = &(device_data_ptr->tx_msg12_rpm_outgain_ramptime);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
 
 	dest_ptr->idle_motor_rpm = idle_motor_rpm;
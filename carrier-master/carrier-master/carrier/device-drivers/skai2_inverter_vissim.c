@@ -126,6 +126,13 @@ static void rx_skai2_vissim_msg9(device_instances_t device,
 //
 device_data_t *first_skai2_vissim_device_data_ptr = NULL;
 
+//
+// The record of each device instance, indexed by device instance -
+// 1. Resolved once, by init_skai2_inverter_vissim(). NULL for an instance that
+// has not been initialised. See skai2_vissim_get_device_data_ptr().
+//
+static device_data_t *skai2_vissim_device_data_ptrs[FVT_MAX_DEVICE_INSTANCES];
+
 //
 // This is incremented each for each device instance
 //
@@ -250,6 +257,19 @@ init_skai2_inverter_vissim(
         		&device_instance_counter,
                 sizeof(device_data_t));
 
+    //
+    // The record could not be created. This is counted by can_service,
+    // so fvt_can_validate_device_registrations() fails and the vehicle
+    // control is not run. The instance is left unresolved, and its
+    // getters return their defaults.
+    //
+    if (device_data_ptr == NULL)
+    {
+        return;
+    }
+
+    skai2_vissim_device_data_ptrs[device - ONE] = device_data_ptr;
+
     uint32_t foo = (uint32_t)get_instance_offset(device);
 
     //
@@ -266,6 +286,12 @@ init_skai2_inverter_vissim(
         rx_skai2_vissim_msg1,
         skai2_vissim_msg1_rx_timeout);
 
+    device_data_ptr->msg1_rx_handle =
+        fvt_can_get_receive_handle(
+            module_id,
+            can_line,
+            SKAI2_RXID_MSG1 + get_instance_offset(device));
+
 	// Aux input voltage, throttle (0 - 100), version number, direction
 	fvt_can_register_receive_id(
         device,
@@ -284,6 +310,12 @@ init_skai2_inverter_vissim(
         rx_skai2_vissim_msg3,
         skai2_vissim_msg3_rx_timeout);
 
+    device_data_ptr->msg3_rx_handle =
+        fvt_can_get_receive_handle(
+            module_id,
+            can_line,
+            SKAI2_RXID_MSG3 + get_instance_offset(device));
+
 	// Torque, RPM, Encoder Feedback,
 	fvt_can_register_receive_id(
         device,
@@ -420,6 +452,32 @@ init_skai2_inverter_vissim(
     device_data_ptr->inverter_power_pin = inverter_power_pin;
 }
 
+
+/******************************************************************************
+ *
+ *        Name: skai2_vissim_get_device_data_ptr()
+ *
+ * Description: The record of a device instance, as resolved by
+ *              init_skai2_inverter_vissim(). NULL if the instance has not been
+ *              initialised or is out of range.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+device_data_t *
+skai2_vissim_get_device_data_ptr(
+    device_instances_t device)
+{
+    if ((device < ONE) || (device > FVT_MAX_DEVICE_INSTANCES))
+    {
+        return NULL;
+    }
+
+    return skai2_vissim_device_data_ptrs[device - ONE];
+}
+
 /******************************************************************************
  *
  *        Name: skai2_vissim_msg1_rx_timeout()
@@ -444,8 +502,8 @@ static void skai2_vissim_msg1_rx_timeout(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        skai2_vissim_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Mark this message as having timed out.
@@ -485,8 +543,8 @@ static void skai2_vissim_msg2_rx_timeout(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        skai2_vissim_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Mark this message as having timed out.
@@ -526,8 +584,8 @@ static void skai2_vissim_msg3_rx_timeout(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        skai2_vissim_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Mark this message as having timed out.
@@ -567,8 +625,8 @@ static void skai2_vissim_msg4_rx_timeout(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        skai2_vissim_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Mark this message as having timed out.
@@ -607,8 +665,8 @@ static void skai2_vissim_msg5_rx_timeout(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        skai2_vissim_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Mark this message as having timed out.
@@ -647,8 +705,8 @@ static void skai2_vissim_msg9_rx_timeout(
     // structure.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        skai2_vissim_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Mark this message as having timed out.
@@ -687,7 +745,7 @@ static void rx_skai2_vissim_msg1(device_instances_t device,
 							int16_t *receive_counter)
 {
     // Check can_data_ptr is not NULL.
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // This will be a pointer to the device's receive data structure
@@ -699,15 +757,15 @@ static void rx_skai2_vissim_msg1(device_instances_t device,
     // Get a pointer to this device's data record.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        skai2_vissim_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Have the pointer to this device's data record, not get a
     // pointer to the appropriate receive data structure.
     //
     dest_ptr = &(device_data_ptr->rx_msg1_data);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     //
     // Copy the data from the received CAN message to the designated
@@ -750,7 +808,7 @@ static void rx_skai2_vissim_msg2(device_instances_t device,
 							int16_t *receive_counter)
 {
 	    // Check can_data_ptr is not NULL.
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // This will be a pointer to the device's receive data structure
@@ -762,15 +820,15 @@ static void rx_skai2_vissim_msg2(device_instances_t device,
     // Get a pointer to this device's data record.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        skai2_vissim_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Have the pointer to this device's data record, not get a
     // pointer to the appropriate receive data structure.
     //
     dest_ptr = &(device_data_ptr->rx_msg2_data);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     //
     // Copy the data from the received CAN message to the designated
@@ -811,7 +869,7 @@ static void rx_skai2_vissim_msg3(device_instances_t device,
 								 int16_t *receive_counter)
 {
 	    // Check can_data_ptr is not NULL.
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // This will be a pointer to the device's receive data structure
@@ -823,15 +881,15 @@ static void rx_skai2_vissim_msg3(device_instances_t device,
     // Get a pointer to this device's data record.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        skai2_vissim_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Have the pointer to this device's data record, not get a
     // pointer to the appropriate receive data structure.
     //
     dest_ptr = &(device_data_ptr->rx_msg3_data);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     //
     // Copy the data from the received CAN message to the designated
@@ -873,7 +931,7 @@ static void rx_skai2_vissim_msg4(device_instances_t device,
 							int16_t *receive_counter)
 {
 	    // Check can_data_ptr is not NULL.
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // This will be a pointer to the device's receive data structure
@@ -885,15 +943,15 @@ static void rx_skai2_vissim_msg4(device_instances_t device,
     // Get a pointer to this device's data record.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        skai2_vissim_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Have the pointer to this device's data record, not get a
     // pointer to the appropriate receive data structure.
     //
     dest_ptr = &(device_data_ptr->rx_msg4_data);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     //
     // Copy the data from the received CAN message to the designated
@@ -934,7 +992,7 @@ static void rx_skai2_vissim_msg5(device_instances_t device,
 							int16_t *receive_counter)
 {
 	    // Check can_data_ptr is not NULL.
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // This will be a pointer to the device's receive data structure
@@ -946,15 +1004,15 @@ static void rx_skai2_vissim_msg5(device_instances_t device,
     // Get a pointer to this device's data record.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        skai2_vissim_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Have the pointer to this device's data record, not get a
     // pointer to the appropriate receive data structure.
     //
     dest_ptr = &(device_data_ptr->rx_msg5_data);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     //
     // Copy the data from the received CAN message to the designated
@@ -997,7 +1055,7 @@ static void rx_skai2_vissim_msg9(device_instances_t device,
 							int16_t *receive_counter)
 {
 	    // Check can_data_ptr is not NULL.
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // This will be a pointer to the device's receive data structure
@@ -1009,15 +1067,15 @@ static void rx_skai2_vissim_msg9(device_instances_t device,
     // Get a pointer to this device's data record.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        skai2_vissim_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Have the pointer to this device's data record, not get a
     // pointer to the appropriate receive data structure.
     //
     dest_ptr = &(device_data_ptr->rx_msg9_data);
-    if (dest_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(dest_ptr);
 
     //
     // Copy the data from the received CAN message to the designated
@@ -1138,8 +1196,8 @@ void tx_skai2_vissim_d_gains(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        skai2_vissim_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -1148,7 +1206,7 @@ void tx_skai2_vissim_d_gains(
 	can_tx_registration_t *tx_ptr =
         device_data_ptr->send_inverter_d_gains_ptr;
 
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -1163,21 +1221,19 @@ void tx_skai2_vissim_d_gains(
     skai2_inverter_tx_msg1_t *can_data_ptr =
         (skai2_inverter_tx_msg1_t *)tx_ptr->tx_message.data;
     
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // Send the CAN message if time to do so.
     //
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get
         // a pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->tx_msg1_data_d_gains);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit
@@ -1231,8 +1287,8 @@ void tx_skai2_vissim_q_gains(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        skai2_vissim_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -1241,7 +1297,7 @@ void tx_skai2_vissim_q_gains(
 	can_tx_registration_t *tx_ptr =
         device_data_ptr->send_inverter_q_gains_ptr;
 
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -1255,21 +1311,19 @@ void tx_skai2_vissim_q_gains(
     //
     skai2_inverter_tx_msg2_t *can_data_ptr =
         (skai2_inverter_tx_msg2_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // Send the CAN message if time to do so.
     //
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get
         // a pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->tx_msg2_data_q_gains);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit
@@ -1325,8 +1379,8 @@ void tx_skai2_vissim_speed_gains(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        skai2_vissim_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -1335,7 +1389,7 @@ void tx_skai2_vissim_speed_gains(
 	can_tx_registration_t *tx_ptr =
         device_data_ptr->send_inverter_spd_gains_ptr;
 
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -1349,21 +1403,19 @@ void tx_skai2_vissim_speed_gains(
     //
     skai2_inverter_tx_msg3_t *can_data_ptr =
         (skai2_inverter_tx_msg3_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // Send the CAN message if time to do so.
     //
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get
         // a pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->tx_msg3_data_speed_gains);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit
@@ -1416,8 +1468,8 @@ void tx_skai2_vissim_electrical_angle(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        skai2_vissim_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -1426,7 +1478,7 @@ void tx_skai2_vissim_electrical_angle(
 	can_tx_registration_t *tx_ptr =
         device_data_ptr->send_inverter_electrical_angle_ptr;
 
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -1440,21 +1492,19 @@ void tx_skai2_vissim_electrical_angle(
     //
     skai2_inverter_tx_msg4_t *can_data_ptr =
         (skai2_inverter_tx_msg4_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // Send the CAN message if time to do so.
     //
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get
         // a pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->tx_msg4_data_electrical_angle);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit
@@ -1511,8 +1561,8 @@ void tx_skai2_enable_maxcurrent_soc_highcell(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        skai2_vissim_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -1521,7 +1571,7 @@ void tx_skai2_enable_maxcurrent_soc_highcell(
 	can_tx_registration_t *tx_ptr =
         device_data_ptr->send_inverter_enable_maxCurrent_soc_highCell_ptr;
 
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -1535,21 +1585,19 @@ void tx_skai2_enable_maxcurrent_soc_highcell(
     //
     skai2_inverter_tx_msg5_t *can_data_ptr =
         (skai2_inverter_tx_msg5_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // Send the CAN message if time to do so.
     //
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get
         // a pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->tx_msg5_enable_max_current_soc_high_cell);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit
@@ -1606,8 +1654,8 @@ void tx_skai2_vissim_motor_scale(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        skai2_vissim_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -1616,7 +1664,7 @@ void tx_skai2_vissim_motor_scale(
 	can_tx_registration_t *tx_ptr =
         device_data_ptr->send_inverter_motor_scale_ptr;
 
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -1630,21 +1678,19 @@ void tx_skai2_vissim_motor_scale(
     //
     skai2_inverter_tx_msg6_t *can_data_ptr =
         (skai2_inverter_tx_msg6_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // Send the CAN message if time to do so.
     //
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get
         // a pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->tx_msg6_motor_scale);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit
@@ -1699,8 +1745,8 @@ void tx_skai2_vissim_regen_scale(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        skai2_vissim_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -1709,7 +1755,7 @@ void tx_skai2_vissim_regen_scale(
 	can_tx_registration_t *tx_ptr =
         device_data_ptr->send_inverter_regen_scale_ptr;
 
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -1723,21 +1769,19 @@ void tx_skai2_vissim_regen_scale(
     //
     skai2_inverter_tx_msg7_t *can_data_ptr =
         (skai2_inverter_tx_msg7_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // Send the CAN message if time to do so.
     //
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get
         // a pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->tx_msg7_regen_scale);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit
@@ -1795,8 +1839,8 @@ void tx_skai2_vissim_throttle_filter_dq_df_gains(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        skai2_vissim_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -1805,7 +1849,7 @@ void tx_skai2_vissim_throttle_filter_dq_df_gains(
 	can_tx_registration_t *tx_ptr =
         device_data_ptr->send_inverter_throttle_filter_dq_df_gains_ptr;
 
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -1819,21 +1863,19 @@ void tx_skai2_vissim_throttle_filter_dq_df_gains(
     //
     skai2_inverter_tx_msg8_t *can_data_ptr =
         (skai2_inverter_tx_msg8_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // Send the CAN message if time to do so.
     //
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get
         // a pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->tx_msg8_throttle_filter_dqf_gains);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit
@@ -1890,8 +1932,8 @@ void tx_skai2_vissim_battery_current_mode_direction_hyd_throttle(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        skai2_vissim_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -1900,7 +1942,7 @@ void tx_skai2_vissim_battery_current_mode_direction_hyd_throttle(
 	can_tx_registration_t *tx_ptr =
         device_data_ptr->send_inverter_battery_current_mode_direction_hyd_throttle_ptr;
 
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -1914,21 +1956,19 @@ void tx_skai2_vissim_battery_current_mode_direction_hyd_throttle(
     //
     skai2_inverter_tx_msg9_t *can_data_ptr =
         (skai2_inverter_tx_msg9_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // Send the CAN message if time to do so.
     //
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get
         // a pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->tx_msg9_battery_current_mode_direction_hyd_throttle);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit
@@ -1986,8 +2026,8 @@ void tx_skai2_vissim_pedal_calibration_battery_gain(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        skai2_vissim_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -1996,7 +2036,7 @@ void tx_skai2_vissim_pedal_calibration_battery_gain(
 	can_tx_registration_t *tx_ptr =
         device_data_ptr->send_inverter_pedal_calibration_battery_gain_ptr;
 
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -2010,21 +2050,19 @@ void tx_skai2_vissim_pedal_calibration_battery_gain(
     //
     skai2_inverter_tx_msg10_t *can_data_ptr =
         (skai2_inverter_tx_msg10_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // Send the CAN message if time to do so.
     //
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get
         // a pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->tx_msg10_pedal_calibration_motor_scale);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit
@@ -2080,8 +2118,8 @@ void tx_skai2_vissim_throttle_override(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        skai2_vissim_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -2090,7 +2128,7 @@ void tx_skai2_vissim_throttle_override(
 	can_tx_registration_t *tx_ptr =
         device_data_ptr->send_inverter_throttle_override_ptr;
 
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -2104,21 +2142,19 @@ void tx_skai2_vissim_throttle_override(
     //
     skai2_inverter_tx_msg11_t *can_data_ptr =
         (skai2_inverter_tx_msg11_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // Send the CAN message if time to do so.
     //
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get
         // a pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->tx_msg11_throttle_override);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit
@@ -2174,8 +2210,8 @@ void tx_skai2_vissim_rpm_settings_outgain_pgainramptime(
     // function.
     //
     device_data_t *device_data_ptr =
-        get_device_linked_data_record_instance_ptr(device, first_skai2_vissim_device_data_ptr);
-    if (device_data_ptr == NULL) {DEBUG("NULL Pointer");}
+        skai2_vissim_get_device_data_ptr(device);
+    NULL_CHECK_RETURN_VOID(device_data_ptr);
 
     //
     // Get a pointer to the can tx registration record that contains
@@ -2184,7 +2220,7 @@ void tx_skai2_vissim_rpm_settings_outgain_pgainramptime(
 	can_tx_registration_t *tx_ptr =
         device_data_ptr->send_inverter_rpm_outgain_ramptime_ptr;
 
-    if (tx_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK_RETURN_VOID(tx_ptr);
 
     //
     // Update the limit that the transmit counter is compared to.
@@ -2198,21 +2234,19 @@ void tx_skai2_vissim_rpm_settings_outgain_pgainramptime(
     //
     skai2_inverter_tx_msg12_t *can_data_ptr =
         (skai2_inverter_tx_msg12_t *)tx_ptr->tx_message.data;
-    if (can_data_ptr == NULL) {DEBUG("NULL Pointer");}
+    NULL_CHECK(can_data_ptr);
 
     //
     // Send the CAN message if time to do so.
     //
-    if (++(tx_ptr->transmit_counter) >= tx_ptr->transmit_counter_limit)
+    if (fvt_can_transmit_due(tx_ptr))
     {
-        tx_ptr->transmit_counter = 0;
-
         //
         // Have the pointer to this device's data record, not get
         // a pointer to the appropriate receive data structure.
         //
         source_ptr = &(device_data_ptr->tx_msg12_rpm_outgain_ramptime);
-        if (source_ptr == NULL) {DEBUG("NULL Pointer");}
+        NULL_CHECK(source_ptr);
 
         //
         // Copy data from our local structure to the CAN transmit
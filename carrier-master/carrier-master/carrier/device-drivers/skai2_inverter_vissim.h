@@ -330,6 +330,22 @@ uint16_t skai_get_vissim_auxilary_input_voltage(device_instances_t device);
  */
 uint16_t skai_get_vissim_version_number(device_instances_t device);
 
+/******************************************************************************
+ * Description: The ms since msg1 was last received, or since the
+ *              inverter was initialised if it has not been received.
+ *              FVT_CAN_RX_AGE_UNKNOWN if the inverter is not fitted.
+ ******************************************************************************
+ */
+uint32_t skai_get_vissim_rx_age_ms(device_instances_t device);
+
+/******************************************************************************
+ * Description: Goes up each time msg1 (errors, motor temperature, DC
+ *              link voltage) or msg3 (torque, rpm) is received or
+ *              times out. 0 if the inverter is not fitted.
+ ******************************************************************************
+ */
+uint32_t skai_get_vissim_rx_change_count(device_instances_t device);
+
 /******************************************************************************
  * Description: Displays the throttle (a value between 0-100) after
  *              the throttle conditioning block in vissim.
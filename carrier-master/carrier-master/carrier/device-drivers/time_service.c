@@ -0,0 +1,193 @@
+/******************************************************************************
+ *
+ *        Name: time_service.c
+ *
+ * Description: A monotonic millisecond time source. The clock is
+ *              sampled once per loop so every module sees the same
+ *              time and the same elapsed time within a loop.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+
+#include <stdlib.h>
+#include "Prototypes.h"
+#include "Constants.h"
+#include "typedefs.h"
+#include "Prototypes_Time.h"
+#include "can_service.h"
+#include "time_service.h"
+
+//
+// Used if Orchestra reports a loop period that cannot be converted.
+//
+#define DEFAULT_LOOP_PERIOD_MS 10
+
+//
+// The elapsed time of a single loop is clamped to this value, so a
+// stalled loop can not make the 16 bit CAN counters wrap around. A
+// receive timeout counter is a signed 16 bit value below its limit,
+// at most EVERY_10S, when the elapsed time is added to it.
+//
+#define MAX_ELAPSED_MS (32767 - EVERY_10S)
+
+//=============================================================================
+//
+// Static Variables
+//
+//=============================================================================
+//
+static p_clock_f_t clock_source_p = NULL;
+
+static uint32_t current_ms = 0;
+static uint32_t previous_clock_ms = 0;
+static uint16_t elapsed_ms = 0;
+static uint16_t loop_period_ms = 0;
+static bool_t clock_sampled = FALSE;
+
+
+//=============================================================================
+//
+// time_service_set_clock_source()
+//
+//=============================================================================
+//
+void time_service_set_clock_source(
+    p_clock_f_t clock_function)
+{
+    clock_source_p = clock_function;
+
+    //
+    // Re-sample on the next update, so switching clocks does not
+    // show up as a jump in time.
+    //
+    clock_sampled = FALSE;
+}
+
+
+/******************************************************************************
+ *
+ *        Name: time_service_update()
+ *
+ * Description: Samples the clock and latches the time of this loop
+ *              and the time elapsed since the previous loop. The very
+ *              first sample of a clock counts as one nominal loop
+ *              period.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+void time_service_update()
+{
+    uint32_t delta_ms;
+
+    if (clock_source_p == NULL)
+    {
+        //
+        // No clock registered. Advance by the nominal loop period.
+        //
+        delta_ms = time_service_get_loop_period_ms();
+    }
+    else
+    {
+        uint32_t clock_ms = clock_source_p();
+
+        if (clock_sampled == FALSE)
+        {
+            delta_ms = time_service_get_loop_period_ms();
+            clock_sampled = TRUE;
+        }
+        else
+        {
+            delta_ms = clock_ms - previous_clock_ms;
+        }
+
+        previous_clock_ms = clock_ms;
+    }
+
+    if (delta_ms > MAX_ELAPSED_MS)
+    {
+        delta_ms = MAX_ELAPSED_MS;
+    }
+
+    elapsed_ms = (uint16_t)delta_ms;
+    current_ms += delta_ms;
+}
+
+
+//=============================================================================
+//
+// time_service_get_ms()
+//
+//=============================================================================
+//
+uint32_t time_service_get_ms()
+{
+    return current_ms;
+}
+
+
+//=============================================================================
+//
+// time_service_get_elapsed_ms()
+//
+//=============================================================================
+//
+uint16_t time_service_get_elapsed_ms()
+{
+    return elapsed_ms;
+}
+
+
+//=============================================================================
+//
+// time_service_ms_since()
+//
+//=============================================================================
+//
+uint32_t time_service_ms_since(
+    uint32_t timestamp_ms)
+{
+    return (current_ms - timestamp_ms);
+}
+
+
+/******************************************************************************
+ *
+ *        Name: time_service_get_loop_period_ms()
+ *
+ * Description: The nominal loop period, worked out once from the
+ *              number of loops Orchestra runs in ten seconds.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+uint16_t time_service_get_loop_period_ms()
+{
+    if (loop_period_ms == 0)
+    {
+        uint32_t loops = ConvertMsecToLoops(10000);
+
+        if (loops == 0)
+        {
+            loop_period_ms = DEFAULT_LOOP_PERIOD_MS;
+        }
+        else
+        {
+            loop_period_ms = (uint16_t)((10000 + (loops / 2)) / loops);
+        }
+
+        if (loop_period_ms == 0)
+        {
+            loop_period_ms = 1;
+        }
+    }
+
+    return loop_period_ms;
+}
@@ -0,0 +1,74 @@
+/******************************************************************************
+ *
+ *        Name: time_service.h
+ *
+ * Description: A monotonic millisecond time source for the vehicle
+ *              control code. Timers, CAN receive timeouts and CAN
+ *              transmit rates are accounted for in milliseconds of
+ *              elapsed time instead of User_App() loop counts. A
+ *              change to the Orchestra loop period, or jitter in the
+ *              loop, no longer rescales them.
+ *
+ *              By default the clock advances by the nominal loop
+ *              period (from ConvertMsecToLoops()) on every call to
+ *              time_service_update(). A target with a free running
+ *              hardware timer, or a host test harness, registers its
+ *              own millisecond clock with
+ *              time_service_set_clock_source() in User_Init().
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+
+#ifndef TIME_SERVICE_H_
+#define TIME_SERVICE_H_
+
+//
+// A function returning a free running millisecond count. It is
+// allowed to wrap around at 2^32.
+//
+typedef uint32_t (*p_clock_f_t)(void);
+
+//
+// Register the clock that time_service_update() reads. Passing NULL
+// returns to the nominal loop period clock.
+//
+void time_service_set_clock_source(p_clock_f_t clock_function);
+
+/******************************************************************************
+ *
+ *        Name: time_service_update()
+ *
+ * Description: Samples the clock and latches the time of this loop
+ *              and the time elapsed since the previous loop. Must be
+ *              called exactly once, at the very top of User_App(),
+ *              before anything that uses the time service.
+ *
+ ******************************************************************************
+ */
+void time_service_update();
+
+//
+// Time of the current loop, in milliseconds since start up.
+//
+uint32_t time_service_get_ms();
+
+//
+// Milliseconds elapsed between the previous loop and this one.
+//
+uint16_t time_service_get_elapsed_ms();
+
+//
+// Milliseconds elapsed since a time previously returned by
+// time_service_get_ms(). Safe across the wrap around.
+//
+uint32_t time_service_ms_since(uint32_t timestamp_ms);
+
+//
+// The nominal User_App() loop period set in Orchestra.
+//
+uint16_t time_service_get_loop_period_ms();
+
+#endif // TIME_SERVICE_H_
@@ -17,6 +17,9 @@
 #include "User_Can_Receive.h"
 #include "timer_service.h"
 #include "Prototypes_Time.h"
+#include "time_service.h"
+
+static void timer_count_down(timer_t *timer);
 
 /******************************************************************************
  *
@@ -38,6 +41,7 @@ timer_t timer_setup (uint32_t period, timer_type_t timer_type)
 
     tp.period = period;
     tp.type   = timer_type;
+    tp.units  = TIMER_LOOPS;
 
     // tp.preVal = FALSE;
     if (timer_type == PULSE)
@@ -62,6 +66,28 @@ timer_t timer_setup (uint32_t period, timer_type_t timer_type)
     return tp;
 }
 
+/******************************************************************************
+ *
+ *        Name: timer_setup_ms()
+ *
+ * Description: Initializes a timer whose period is in milliseconds.
+ *              Each call to timer_operate() counts down by the time
+ *              elapsed since the previous loop instead of by one.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+timer_t timer_setup_ms (uint32_t period_ms, timer_type_t timer_type)
+{
+    timer_t tp = timer_setup(period_ms, timer_type);
+
+    tp.units = TIMER_MSECS;
+
+    return tp;
+}
+
 /******************************************************************************
  *
  *        Name: timer_operate()
@@ -115,7 +141,7 @@ bool_t timer_operate(timer_t *	timer,
 			// if timer hasn't run out yet, decrement
 			if (timer->counter != 0)
 			{
-				timer->counter--;
+				timer_count_down(timer);
 			}
 		}
 		else											// input is false, reset timer
@@ -132,7 +158,7 @@ bool_t timer_operate(timer_t *	timer,
 			// if timer hasn't run out yet, decrement
 			if (timer->counter != 0)
 			{
-				timer->counter--;
+				timer_count_down(timer);
 			}
 		}
 
@@ -148,11 +174,11 @@ bool_t timer_operate(timer_t *	timer,
 	{
 		if (input && (timer->counter == timer->period))
 		{												// if input is true and the timer is set
-			timer->counter--;							// decrease the value by one to signal that the timer should run
+			timer_count_down(timer);					// decrease the value to signal that the timer should run
 		}
 		else if ((timer->counter != timer->period) && (timer->counter != 0))
 		{												// if the timer is running
-			timer->counter--;							// continue to run it
+			timer_count_down(timer);					// continue to run it
 		}
 		else if ((timer->counter == 0) && !input)		// if the timer is done and the input is false
 		{
@@ -175,3 +201,30 @@ bool_t timer_operate(timer_t *	timer,
 			((timer->type == PULSE) && (timer->counter != 0) && (timer->counter != timer->period)));
 	                // pulse types are true if the timer is between extremes (running)
 }
+
+//=============================================================================
+//
+// timer_count_down(): Loop timers count down by one. Millisecond
+// timers count down by the elapsed time of the loop, stopping at
+// zero.
+//
+//=============================================================================
+//
+static void timer_count_down(timer_t *timer)
+{
+    uint32_t step = 1;
+
+    if (timer->units == TIMER_MSECS)
+    {
+        step = time_service_get_elapsed_ms();
+    }
+
+    if (timer->counter > step)
+    {
+        timer->counter -= step;
+    }
+    else
+    {
+        timer->counter = 0;
+    }
+}
@@ -10,6 +10,9 @@
  ******************************************************************************
  */
 
+#ifndef TIMER_SERVICE_H_
+#define TIMER_SERVICE_H_
+
 #include <stdlib.h>
 
 typedef enum
@@ -20,18 +23,31 @@ typedef enum
 } timer_type_t;
 
 //
-// Period = number of cycles timer runs for.
+// The unit the period and counter of a timer are kept in.
+//
+typedef enum
+{
+    TIMER_LOOPS = 0,
+    TIMER_MSECS = 1
+} timer_units_t;
+
+//
+// Period = number of cycles (or milliseconds) timer runs for.
 //
 // Counter = value to keep track of how long the timer has been
 // running for.
 //
 // Type = how the timer behaves: RISING, FALLING, PULSE.
 //
+// Units = TIMER_LOOPS counts one per call, TIMER_MSECS counts the
+// milliseconds elapsed since the previous loop (time_service.h).
+//
 typedef struct
 {
-    uint32_t     period;
-    uint32_t     counter;
-    timer_type_t type;
+    uint32_t      period;
+    uint32_t      counter;
+    timer_type_t  type;
+    timer_units_t units;
 } timer_t;
 
 //
@@ -56,8 +72,32 @@ typedef struct
 //
 timer_t timer_setup(uint32_t period, timer_type_t timer_type);
 
+//
+// Same as timer_setup(), with the period given in milliseconds. The
+// timer runs on elapsed time and is not affected by the User_App()
+// loop period.
+//
+timer_t timer_setup_ms(uint32_t period_ms, timer_type_t timer_type);
+
+//
+// Initialiser of a static timer_t, the same timer as
+// timer_setup_ms() returns. A timer declared with it needs no first
+// pass block to set it up:
+//
+//     static timer_t plugged_in_timer = TIMER_INIT_MS(3000, RISING);
+//
+#define TIMER_INIT_MS(period_ms, timer_type)                        \
+    {                                                               \
+        ((timer_type) == PULSE) ? ((period_ms) + 1) : (period_ms),  \
+        ((timer_type) == RISING) ? (period_ms) : 0,                 \
+        (timer_type),                                               \
+        TIMER_MSECS                                                 \
+    }
+
 //
 // Timer_Operate should be called each loop. Will return true or
 // false, based on inBit and the type of the timer passed.
 //
 bool_t timer_operate(timer_t *timer, bool_t inBit);
+
+#endif // TIMER_SERVICE_H_
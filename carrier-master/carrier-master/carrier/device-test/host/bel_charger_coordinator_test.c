@@ -0,0 +1,590 @@
+/******************************************************************************
+ *
+ *        Name: bel_charger_coordinator_test.c
+ *
+ * Description: Host test of the Bel charger coordinator. Runs the real
+ *              bel_charger_coordinator.c against stand-in chargers: a
+ *              plant model of each Bel that ramps its output towards
+ *              its command, up to what it can really deliver, and
+ *              reports its status the way bel_charger_device.c does.
+ *              Checks:
+ *
+ *              - the total is the lowest of the pack CCL, the charge
+ *                profile command and the sum of the charger limits,
+ *                and is split in proportion to the limits.
+ *              - the limit of a charger follows its reported maximum
+ *                current, its AC input, its temperature and its
+ *                faults.
+ *              - a charger that derates on its own is caught after
+ *                BEL_COORDINATOR_SHORTFALL_MS, the other takes up the
+ *                difference, and the derated one is given its share
+ *                back once it keeps up again.
+ *              - a charge with one charger derated finishes sooner
+ *                than with the old even split of the total command.
+ *              - nothing is commanded when not charging, or to a
+ *                charger that is not installed.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+
+#ifdef FVT_HOST_TEST
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "Prototypes.h"
+#include "Constants.h"
+#include "typedefs.h"
+#include "can_service.h"
+#include "time_service.h"
+#include "orion_control.h"
+#include "bel_charger_device.h"
+#include "state_machine.h"
+#include "charge_profile.h"
+#include "bel_charger_coordinator.h"
+#include "host_stubs.h"
+
+#define LOOP_MS                 10
+
+#define NUM_PACKS               3
+#define PACK_VOLTAGE_V10        6500
+
+//
+// The coordinator's rated current and shortfall timing, in 0.05A and
+// ms, as the plant sees them.
+//
+#define RATED_A20               800
+#define SHORTFALL_A20           40
+#define SHORTFALL_MS            10000
+#define RECOVERY_A20            20
+#define RECOVERY_MS             1000
+
+//
+// A Bel ramps its output up at about 10A a second, and drops it at
+// once.
+//
+#define RAMP_A20_PER_LOOP       2
+
+//
+// Charge delivered in the charge time test, in 0.05A ms.
+//
+#define CHARGE_AH               10
+#define CHARGE_A20_MS           ((uint32_t)CHARGE_AH * 20 * 3600 * 1000)
+
+//
+// A stand-in Bel. capability is what the charger can really deliver,
+// which the coordinator does not see.
+//
+typedef struct
+{
+    bool_t input_voltage_ok;
+    bool_t overtemperature;
+    bool_t latched_off;
+    uint16_t max_charging_current_a;
+    uint8_t pilot_duty_cycle;
+    uint16_t line_voltage_v;
+    uint16_t output_voltage_v20;
+    int8_t chassis_temperature_c;
+
+    uint16_t capability;
+    uint16_t output;
+} plant_charger_t;
+
+static plant_charger_t plant[BEL_COORDINATOR_MAX_CHARGERS];
+
+static battery_pack_aggregate_t aggregate;
+static bool_t hv_enabled = TRUE;
+static state_t sm_state = CHARGING;
+static uint16_t profile_command = 0;
+
+static uint16_t failures = 0;
+
+
+//=============================================================================
+//
+// Stand-ins for the state machine, the packs and the charge profile.
+//
+//=============================================================================
+//
+bool_t get_sm_status_enable_hv_systems() { return hv_enabled; }
+state_t get_sm_current_state() { return sm_state; }
+uint16_t charge_profile_get_current_command() { return profile_command; }
+const battery_pack_aggregate_t *get_battery_pack_aggregate() { return &aggregate; }
+uint8_t get_number_of_bms() { return NUM_PACKS; }
+uint16_t get_battery_pack_voltage() { return PACK_VOLTAGE_V10; }
+
+
+//=============================================================================
+//
+// Stand-ins for bel_charger_device.c.
+//
+//=============================================================================
+//
+bool_t bel_get_input_voltage_ok(device_instances_t device)
+{
+    return plant[device - ONE].input_voltage_ok;
+}
+
+bool_t bel_get_unit_overtemperature(device_instances_t device)
+{
+    return plant[device - ONE].overtemperature;
+}
+
+bool_t bel_get_converter_latched_off_due_to_fault(device_instances_t device)
+{
+    return plant[device - ONE].latched_off;
+}
+
+uint16_t bel_get_max_charging_current_ava(device_instances_t device)
+{
+    return plant[device - ONE].max_charging_current_a;
+}
+
+uint8_t bel_get_pilot_duty_cycle_percent(device_instances_t device)
+{
+    return plant[device - ONE].pilot_duty_cycle;
+}
+
+uint16_t bel_get_input_voltage_rms_phase_1_2_v(device_instances_t device)
+{
+    return plant[device - ONE].line_voltage_v;
+}
+
+uint16_t bel_get_input_voltage_rms_phase_2_3_v(device_instances_t device)
+{
+    return plant[device - ONE].line_voltage_v;
+}
+
+uint16_t bel_get_input_voltage_rms_phase_3_1_v(device_instances_t device)
+{
+    return plant[device - ONE].line_voltage_v;
+}
+
+uint16_t bel_get_output_voltage_v_20(device_instances_t device)
+{
+    return plant[device - ONE].output_voltage_v20;
+}
+
+uint16_t bel_get_output_current_a_20(device_instances_t device)
+{
+    return plant[device - ONE].output;
+}
+
+int8_t bel_get_chassis_temperature_c(device_instances_t device)
+{
+    return plant[device - ONE].chassis_temperature_c;
+}
+
+
+//=============================================================================
+//
+// fail()
+//
+//=============================================================================
+//
+static void fail(const char *test, const char *what)
+{
+    printf("FAIL %-22s %s\n", test, what);
+    failures++;
+}
+
+
+//=============================================================================
+//
+// check_value()
+//
+//=============================================================================
+//
+static void check_value(const char *test,
+                        const char *what,
+                        uint32_t value,
+                        uint32_t expected)
+{
+    if (value != expected)
+    {
+        printf("     %s %lu, expected %lu\n",
+               what, (unsigned long)value, (unsigned long)expected);
+        fail(test, what);
+    }
+}
+
+
+//=============================================================================
+//
+// reset_plant(): Two healthy chargers on a 400V line with no pilot
+// limit, two packs able to take 100A, and a charge profile asking for
+// 60A. Any learned limit is cleared by a loop out of CHARGING.
+//
+//=============================================================================
+//
+static void reset_plant(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < BEL_COORDINATOR_MAX_CHARGERS; i++)
+    {
+        plant[i].input_voltage_ok = TRUE;
+        plant[i].overtemperature = FALSE;
+        plant[i].latched_off = FALSE;
+        plant[i].max_charging_current_a = 0;
+        plant[i].pilot_duty_cycle = 0;
+        plant[i].line_voltage_v = 400;
+        plant[i].output_voltage_v20 = 0;
+        plant[i].chassis_temperature_c = 40;
+        plant[i].capability = RATED_A20;
+        plant[i].output = 0;
+    }
+
+    aggregate.signal[PACK_SIGNAL_CHARGE_CURRENT_LIMIT].min = 100;
+    profile_command = 60 * 20;
+    IOMap[IOMapIndex_EEVAR_CHARGER_no_of_chargers] = 2;
+
+    hv_enabled = TRUE;
+    sm_state = STARTUP;
+    host_clock_ms += LOOP_MS;
+    time_service_update();
+    bel_charger_coordinator_update();
+    sm_state = CHARGING;
+}
+
+
+//=============================================================================
+//
+// run_loop(): One loop of the coordinator, then the chargers move
+// towards their new commands. Returns the total delivered.
+//
+//=============================================================================
+//
+static uint32_t run_loop(void)
+{
+    uint32_t delivered = 0;
+    uint8_t i;
+
+    host_clock_ms += LOOP_MS;
+    time_service_update();
+    bel_charger_coordinator_update();
+
+    for (i = 0; i < BEL_COORDINATOR_MAX_CHARGERS; i++)
+    {
+        uint16_t target =
+            bel_charger_coordinator_get_current_command(ONE + i);
+
+        if (target > plant[i].capability)
+        {
+            target = plant[i].capability;
+        }
+
+        if (plant[i].output + RAMP_A20_PER_LOOP < target)
+        {
+            plant[i].output += RAMP_A20_PER_LOOP;
+        }
+        else
+        {
+            plant[i].output = target;
+        }
+
+        delivered += plant[i].output;
+    }
+
+    return delivered;
+}
+
+
+//=============================================================================
+//
+// run_ms()
+//
+//=============================================================================
+//
+static void run_ms(uint32_t ms)
+{
+    uint32_t elapsed;
+
+    for (elapsed = 0; elapsed < ms; elapsed += LOOP_MS)
+    {
+        run_loop();
+    }
+}
+
+
+//=============================================================================
+//
+// check_split(): The commands and limits of both chargers after a
+// loop.
+//
+//=============================================================================
+//
+static void check_split(const char *test,
+                        uint16_t limit_one,
+                        uint16_t limit_two,
+                        uint16_t command_one,
+                        uint16_t command_two)
+{
+    run_loop();
+
+    check_value(test, "limit ONE", bel_charger_coordinator_get_limit(ONE), limit_one);
+    check_value(test, "limit TWO", bel_charger_coordinator_get_limit(TWO), limit_two);
+    check_value(test, "command ONE", bel_charger_coordinator_get_current_command(ONE), command_one);
+    check_value(test, "command TWO", bel_charger_coordinator_get_current_command(TWO), command_two);
+}
+
+
+//=============================================================================
+//
+// test_total(): Each of the three limits on the total in turn.
+//
+//=============================================================================
+//
+static void test_total(void)
+{
+    reset_plant();
+    check_split("profile limits", RATED_A20, RATED_A20, 600, 600);
+
+    //
+    // 10A from each of three packs.
+    //
+    reset_plant();
+    aggregate.signal[PACK_SIGNAL_CHARGE_CURRENT_LIMIT].min = 10;
+    check_split("pack CCL limits", RATED_A20, RATED_A20, 300, 300);
+
+    reset_plant();
+    profile_command = 100 * 20;
+    check_split("chargers limit", RATED_A20, RATED_A20, RATED_A20, RATED_A20);
+
+    //
+    // Proportional: 30A and 10A limits share 20A as 15A and 5A.
+    //
+    reset_plant();
+    profile_command = 20 * 20;
+    plant[0].max_charging_current_a = 30;
+    plant[1].max_charging_current_a = 10;
+    check_split("proportional", 600, 200, 300, 100);
+}
+
+
+//=============================================================================
+//
+// test_limits()
+//
+//=============================================================================
+//
+static void test_limits(void)
+{
+    //
+    // sqrt(3) x 400V x 30A x 0.93 / 700V is 27.6A.
+    //
+    reset_plant();
+    plant[0].pilot_duty_cycle = 50;
+    plant[0].output_voltage_v20 = 700 * 20;
+    check_split("AC input", 552, RATED_A20, 489, 710);
+
+    //
+    // Before the charger reports its output voltage, the pack voltage
+    // is used. Out of range duty cycles are no limit.
+    //
+    reset_plant();
+    plant[0].pilot_duty_cycle = 50;
+    plant[1].pilot_duty_cycle = 90;
+    check_split("AC input, pack voltage", 594, RATED_A20, 511, 688);
+
+    reset_plant();
+    plant[0].chassis_temperature_c = 92;
+    plant[1].chassis_temperature_c = 100;
+    check_split("temperature", 426, 0, 426, 0);
+
+    reset_plant();
+    plant[0].input_voltage_ok = FALSE;
+    check_split("input voltage", 0, RATED_A20, 0, RATED_A20);
+
+    reset_plant();
+    plant[0].overtemperature = TRUE;
+    plant[1].latched_off = TRUE;
+    check_split("faults", 0, 0, 0, 0);
+}
+
+
+//=============================================================================
+//
+// test_rebalance(): Charger TWO derates itself to 15A without telling
+// anyone. The other charger has to take up the difference.
+//
+//=============================================================================
+//
+static void test_rebalance(void)
+{
+    const char *test = "rebalance";
+    uint32_t delivered;
+
+    reset_plant();
+    run_ms(SHORTFALL_MS);
+
+    //
+    // A healthy ramp up is not a shortfall.
+    //
+    check_value(test, "ramped limit ONE", bel_charger_coordinator_get_limit(ONE), RATED_A20);
+    check_value(test, "ramped limit TWO", bel_charger_coordinator_get_limit(TWO), RATED_A20);
+
+    plant[1].capability = 15 * 20;
+    run_ms(SHORTFALL_MS - 2 * LOOP_MS);
+
+    if (bel_charger_coordinator_get_limit(TWO) != RATED_A20)
+    {
+        fail(test, "shortfall caught early");
+    }
+
+    run_ms(4 * LOOP_MS);
+
+    check_value(test, "learned limit TWO",
+                bel_charger_coordinator_get_limit(TWO), 15 * 20 + SHORTFALL_A20);
+
+    //
+    // 60A asked for, ONE at its 40A limit and TWO delivering 15A.
+    //
+    run_ms(5000);
+    delivered = run_loop();
+
+    check_value(test, "command ONE",
+                bel_charger_coordinator_get_current_command(ONE), RATED_A20);
+    check_value(test, "delivered", delivered, RATED_A20 + 15 * 20);
+
+    //
+    // TWO keeps up again: its limit rises by RECOVERY_A20 a second
+    // until it is no longer used.
+    //
+    plant[1].capability = RATED_A20;
+    run_ms(((RATED_A20 - 15 * 20) / RECOVERY_A20 + 2) * RECOVERY_MS);
+
+    check_value(test, "recovered limit TWO",
+                bel_charger_coordinator_get_limit(TWO), RATED_A20);
+    check_value(test, "recovered command TWO",
+                bel_charger_coordinator_get_current_command(TWO), 600);
+}
+
+
+//=============================================================================
+//
+// charge_time_ms(): The time to deliver CHARGE_AH from the start of
+// charging. With even_split, each charger is commanded half of the
+// charge profile command, as bel_charger_control() did before the
+// coordinator.
+//
+//=============================================================================
+//
+static uint32_t charge_time_ms(bool_t even_split)
+{
+    uint32_t charge = 0;
+    uint32_t elapsed = 0;
+    uint8_t i;
+
+    reset_plant();
+    plant[1].capability = 15 * 20;
+
+    while (charge < CHARGE_A20_MS)
+    {
+        if (even_split)
+        {
+            host_clock_ms += LOOP_MS;
+
+            for (i = 0; i < BEL_COORDINATOR_MAX_CHARGERS; i++)
+            {
+                uint16_t target = profile_command / 2;
+
+                if (target > plant[i].capability)
+                {
+                    target = plant[i].capability;
+                }
+
+                plant[i].output = target;
+                charge += (uint32_t)plant[i].output * LOOP_MS;
+            }
+        }
+        else
+        {
+            charge += (uint32_t)run_loop() * LOOP_MS;
+        }
+
+        elapsed += LOOP_MS;
+    }
+
+    return elapsed;
+}
+
+
+//=============================================================================
+//
+// test_charge_time(): The even split is given chargers that reach
+// their command at once, so it is the best the old split could do.
+// 30A + 15A against 40A + 15A is about 18% sooner.
+//
+//=============================================================================
+//
+static void test_charge_time(void)
+{
+    uint32_t even_split_ms = charge_time_ms(TRUE);
+    uint32_t coordinated_ms = charge_time_ms(FALSE);
+
+    if ((coordinated_ms * 100) > (even_split_ms * 85))
+    {
+        printf("     coordinated %lu s, even split %lu s\n",
+               (unsigned long)(coordinated_ms / 1000),
+               (unsigned long)(even_split_ms / 1000));
+        fail("charge time", "not sooner than the even split");
+    }
+}
+
+
+//=============================================================================
+//
+// test_not_charging()
+//
+//=============================================================================
+//
+static void test_not_charging(void)
+{
+    reset_plant();
+    run_ms(1000);
+
+    hv_enabled = FALSE;
+    check_split("HV off", 0, 0, 0, 0);
+
+    reset_plant();
+    run_ms(1000);
+
+    sm_state = READY_TO_DRIVE;
+    check_split("not CHARGING", 0, 0, 0, 0);
+
+    reset_plant();
+    IOMap[IOMapIndex_EEVAR_CHARGER_no_of_chargers] = 1;
+    check_split("one installed", RATED_A20, 0, RATED_A20, 0);
+}
+
+
+//=============================================================================
+//
+// main()
+//
+//=============================================================================
+//
+int main(void)
+{
+    host_clock_start();
+
+    test_total();
+    test_limits();
+    test_rebalance();
+    test_charge_time();
+    test_not_charging();
+
+    if (failures != 0)
+    {
+        printf("bel_charger_coordinator_test: %u failures\n", failures);
+        return EXIT_FAILURE;
+    }
+
+    printf("bel_charger_coordinator_test: passed\n");
+    return EXIT_SUCCESS;
+}
+
+#endif // FVT_HOST_TEST
@@ -0,0 +1,596 @@
+/******************************************************************************
+ *
+ *        Name: can_tp_test.c
+ *
+ * Description: Host test of the J1939 transport protocol reassembly
+ *              in can_service.c, with the DM1 of the PDM as the
+ *              consumer. Runs the real can_service.c and pdm_device.c
+ *              with the frames a PDM sends. Checks:
+ *
+ *              - a DM1 in a single frame, and with no DTC.
+ *              - a DM1 sent as a BAM is reassembled, and the PDM
+ *                driver keeps its DTCs. Nothing is sent back.
+ *              - a DM1 sent with RTS/CTS to the CVC is cleared a few
+ *                packets at a time, as the RTS asks, acknowledged at
+ *                the end, and reassembled.
+ *              - a BAM that stops for longer than T1 is dropped, and
+ *                an RTS/CTS transfer that stops for longer than T2 is
+ *                aborted with a timeout.
+ *              - a packet out of sequence drops a BAM, and aborts an
+ *                RTS/CTS transfer with a bad sequence.
+ *              - a transfer of an unregistered PGN, or from another
+ *                source address, is ignored.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+
+#ifdef FVT_HOST_TEST
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "Prototypes.h"
+#include "Constants.h"
+#include "typedefs.h"
+#include "Prototypes_CAN.h"
+#include "can_service.h"
+#include "can_service_devices.h"
+#include "time_service.h"
+#include "pdm_device.h"
+#include "host_stubs.h"
+
+#define LOOP_MS                     10
+
+//
+// The source address of PDM ONE, and the CAN line it is on.
+//
+#define PDM_SOURCE_ADDRESS          0x1E
+#define PDM_CAN_LINE                CAN2
+
+#define PGN_DM2                     0xFECB
+
+#define DM1_PRIORITY                6
+#define TP_PRIORITY                 7
+
+#define TP_CM_RTS                   16
+#define TP_CM_CTS                   17
+#define TP_CM_END_OF_MSG_ACK        19
+#define TP_CM_ABORT                 255
+
+#define TP_ABORT_TIMEOUT            3
+#define TP_ABORT_BAD_SEQUENCE       7
+
+//
+// Longer than T1 of a BAM and T2 of an RTS/CTS transfer.
+//
+#define BAM_TIMEOUT_MS              800
+#define CTS_TIMEOUT_MS              1300
+
+#define MAX_DM1_BYTES               64
+
+static uint16_t failures = 0;
+
+
+//=============================================================================
+//
+// fail()
+//
+//=============================================================================
+//
+static void fail(const char *test, const char *what)
+{
+    printf("FAIL %-24s %s\n", test, what);
+    failures++;
+}
+
+
+//=============================================================================
+//
+// run_loops(): The time passing, with the receive timeouts checked
+// each loop, as User_App() does.
+//
+//=============================================================================
+//
+static void run_loops(uint32_t ms)
+{
+    uint32_t elapsed;
+
+    for (elapsed = 0; elapsed < ms; elapsed += LOOP_MS)
+    {
+        host_clock_ms += LOOP_MS;
+        time_service_update();
+        can_rx_check_message_timeouts();
+    }
+}
+
+
+//=============================================================================
+//
+// receive(): A frame from a source address, as User_Can_Receive()
+// passes it on.
+//
+//=============================================================================
+//
+static void receive(uint8_t priority,
+                    uint32_t pgn_and_ps,
+                    uint8_t source_address,
+                    const uint8_t *data)
+{
+    Can_Message_ message;
+
+    memset(&message, 0, sizeof(message));
+
+    message.identifier = ((uint32_t)priority << 26) | (pgn_and_ps << 8) | source_address;
+    message.type = EXTENDED;
+    message.length = 8;
+    memcpy(message.data, data, 8);
+
+    fvt_can_process_rx_message(message, 0, PDM_CAN_LINE);
+}
+
+
+//=============================================================================
+//
+// receive_cm(): A TP.CM with a control byte and the next four bytes,
+// followed by the PGN.
+//
+//=============================================================================
+//
+static void receive_cm(uint8_t source_address,
+                       uint8_t destination_address,
+                       uint8_t control,
+                       uint16_t size,
+                       uint8_t packets,
+                       uint8_t byte_4,
+                       uint32_t pgn)
+{
+    uint8_t data[8];
+
+    data[0] = control;
+    data[1] = (uint8_t)(size & 0xFF);
+    data[2] = (uint8_t)(size >> 8);
+    data[3] = packets;
+    data[4] = byte_4;
+    data[5] = (uint8_t)(pgn & 0xFF);
+    data[6] = (uint8_t)((pgn >> 8) & 0xFF);
+    data[7] = (uint8_t)((pgn >> 16) & 0xFF);
+
+    receive(TP_PRIORITY, J1939_PGN_TP_CM | destination_address, source_address, data);
+}
+
+
+//=============================================================================
+//
+// receive_dt(): A TP.DT with its sequence number, and the seven
+// bytes of the payload it carries, padded with 0xFF.
+//
+//=============================================================================
+//
+static void receive_dt(uint8_t source_address,
+                       uint8_t destination_address,
+                       uint8_t sequence,
+                       const uint8_t *payload,
+                       uint16_t size)
+{
+    uint8_t data[8];
+    uint16_t offset = (uint16_t)(sequence - 1) * 7;
+    uint8_t i;
+
+    data[0] = sequence;
+
+    for (i = 0; i < 7; i++)
+    {
+        data[i + 1] = ((offset + i) < size) ? payload[offset + i] : 0xFF;
+    }
+
+    receive(TP_PRIORITY, J1939_PGN_TP_DT | destination_address, source_address, data);
+}
+
+
+//=============================================================================
+//
+// make_dm1(): A DM1 with a DTC for each SPN, with the FMI the low
+// five bits of the SPN. Returns its size.
+//
+//=============================================================================
+//
+static uint16_t make_dm1(uint8_t *dm1, const uint32_t *spns, uint8_t dtc_count)
+{
+    uint16_t size = 0;
+    uint8_t i;
+
+    dm1[size++] = 0x04;
+    dm1[size++] = 0xFF;
+
+    for (i = 0; i < dtc_count; i++)
+    {
+        dm1[size++] = (uint8_t)(spns[i] & 0xFF);
+        dm1[size++] = (uint8_t)((spns[i] >> 8) & 0xFF);
+        dm1[size++] = (uint8_t)(((spns[i] >> 11) & 0xE0) | (spns[i] & 0x1F));
+        dm1[size++] = 1;
+    }
+
+    return size;
+}
+
+
+//=============================================================================
+//
+// check_dtcs(): The PDM driver has the DTCs of make_dm1().
+//
+//=============================================================================
+//
+static void check_dtcs(const char *test, const uint32_t *spns, uint8_t dtc_count)
+{
+    uint8_t i;
+
+    if (pdm_get_dm1_dtc_count(ONE) != dtc_count)
+    {
+        printf("     %u DTCs, expected %u\n", pdm_get_dm1_dtc_count(ONE), dtc_count);
+        fail(test, "wrong number of DTCs");
+        return;
+    }
+
+    for (i = 0; i < dtc_count; i++)
+    {
+        if ((pdm_get_dm1_spn(ONE, i) != spns[i]) ||
+            (pdm_get_dm1_fmi(ONE, i) != (spns[i] & 0x1F)))
+        {
+            fail(test, "wrong SPN or FMI");
+        }
+    }
+}
+
+
+//=============================================================================
+//
+// check_cm_sent(): The CVC sent one TP.CM to the PDM, with the
+// control byte and the next two bytes given.
+//
+//=============================================================================
+//
+static void check_cm_sent(const char *test,
+                          uint8_t control,
+                          uint8_t byte_1,
+                          uint8_t byte_2)
+{
+    const Can_Message_ *frame = &host_sent_frames[0];
+
+    if (host_sent_frame_count != 1)
+    {
+        printf("     %u frames sent, expected a TP.CM %u\n", host_sent_frame_count, control);
+        fail(test, "not one TP.CM sent");
+        host_sent_frame_count = 0;
+        return;
+    }
+
+    if ((frame->identifier & 0x00FFFFFF) !=
+        (((uint32_t)J1939_PGN_TP_CM << 8) |
+         ((uint32_t)PDM_SOURCE_ADDRESS << 8) |
+         J1939_CVC_SOURCE_ADDRESS))
+    {
+        fail(test, "TP.CM not sent from the CVC to the PDM");
+    }
+
+    if ((frame->data[0] != control) ||
+        (frame->data[1] != byte_1) ||
+        (frame->data[2] != byte_2))
+    {
+        printf("     sent %u %u %u, expected %u %u %u\n",
+               frame->data[0], frame->data[1], frame->data[2],
+               control, byte_1, byte_2);
+        fail(test, "wrong TP.CM sent");
+    }
+
+    if ((frame->data[5] != (J1939_PGN_DM1 & 0xFF)) ||
+        (frame->data[6] != ((J1939_PGN_DM1 >> 8) & 0xFF)))
+    {
+        fail(test, "TP.CM not for the DM1");
+    }
+
+    host_sent_frame_count = 0;
+}
+
+
+//=============================================================================
+//
+// set_single_frame_dm1(): Leaves the PDM with one known DTC, sent in
+// a single frame, so a transfer that fails can be seen to have
+// changed nothing.
+//
+//=============================================================================
+//
+static const uint32_t single_spn[] = { 0x1234 };
+
+static void set_single_frame_dm1(void)
+{
+    uint8_t dm1[8];
+
+    make_dm1(dm1, single_spn, 1);
+    receive(DM1_PRIORITY, J1939_PGN_DM1, PDM_SOURCE_ADDRESS, dm1);
+}
+
+
+//=============================================================================
+//
+// test_single_frame()
+//
+//=============================================================================
+//
+static void test_single_frame(void)
+{
+    const char *test = "single frame";
+    const uint32_t no_dtc[] = { 0 };
+    uint8_t dm1[8];
+
+    set_single_frame_dm1();
+    check_dtcs(test, single_spn, 1);
+
+    make_dm1(dm1, no_dtc, 1);
+    receive(DM1_PRIORITY, J1939_PGN_DM1, PDM_SOURCE_ADDRESS, dm1);
+    check_dtcs(test, no_dtc, 0);
+}
+
+
+//=============================================================================
+//
+// test_bam()
+//
+//=============================================================================
+//
+static void test_bam(void)
+{
+    const char *test = "BAM";
+    const uint32_t spns[] = { 0x7FFFF, 100, 0x40001 };
+    uint8_t dm1[MAX_DM1_BYTES];
+    uint16_t size = make_dm1(dm1, spns, 3);
+
+    set_single_frame_dm1();
+    host_sent_frame_count = 0;
+
+    receive_cm(PDM_SOURCE_ADDRESS, J1939_GLOBAL_ADDRESS,
+               J1939_TP_CM_BAM, size, 2, 0xFF, J1939_PGN_DM1);
+    run_loops(50);
+    receive_dt(PDM_SOURCE_ADDRESS, J1939_GLOBAL_ADDRESS, 1, dm1, size);
+
+    check_dtcs(test, single_spn, 1);
+
+    run_loops(50);
+    receive_dt(PDM_SOURCE_ADDRESS, J1939_GLOBAL_ADDRESS, 2, dm1, size);
+
+    check_dtcs(test, spns, 3);
+
+    if (host_sent_frame_count != 0)
+    {
+        fail(test, "frames sent in answer to a BAM");
+        host_sent_frame_count = 0;
+    }
+}
+
+
+//=============================================================================
+//
+// test_rts_cts(): Five DTCs in four packets, two packets a CTS.
+//
+//=============================================================================
+//
+static void test_rts_cts(void)
+{
+    const char *test = "RTS/CTS";
+    const uint32_t spns[] = { 1, 2, 3, 4, 5 };
+    uint8_t dm1[MAX_DM1_BYTES];
+    uint16_t size = make_dm1(dm1, spns, 5);
+
+    set_single_frame_dm1();
+    host_sent_frame_count = 0;
+
+    receive_cm(PDM_SOURCE_ADDRESS, J1939_CVC_SOURCE_ADDRESS,
+               TP_CM_RTS, size, 4, 2, J1939_PGN_DM1);
+    check_cm_sent(test, TP_CM_CTS, 2, 1);
+
+    receive_dt(PDM_SOURCE_ADDRESS, J1939_CVC_SOURCE_ADDRESS, 1, dm1, size);
+
+    if (host_sent_frame_count != 0)
+    {
+        fail(test, "CTS sent before the packets cleared were received");
+        host_sent_frame_count = 0;
+    }
+
+    receive_dt(PDM_SOURCE_ADDRESS, J1939_CVC_SOURCE_ADDRESS, 2, dm1, size);
+    check_cm_sent(test, TP_CM_CTS, 2, 3);
+
+    receive_dt(PDM_SOURCE_ADDRESS, J1939_CVC_SOURCE_ADDRESS, 3, dm1, size);
+    check_dtcs(test, single_spn, 1);
+
+    receive_dt(PDM_SOURCE_ADDRESS, J1939_CVC_SOURCE_ADDRESS, 4, dm1, size);
+    check_cm_sent(test, TP_CM_END_OF_MSG_ACK, (uint8_t)size, 0);
+
+    check_dtcs(test, spns, 5);
+}
+
+
+//=============================================================================
+//
+// test_timeouts()
+//
+//=============================================================================
+//
+static void test_timeouts(void)
+{
+    const char *test = "timeout";
+    const uint32_t spns[] = { 10, 20, 30 };
+    uint8_t dm1[MAX_DM1_BYTES];
+    uint16_t size = make_dm1(dm1, spns, 3);
+
+    //
+    // A BAM that stops is dropped, and its last packet is ignored.
+    //
+    set_single_frame_dm1();
+    host_sent_frame_count = 0;
+
+    receive_cm(PDM_SOURCE_ADDRESS, J1939_GLOBAL_ADDRESS,
+               J1939_TP_CM_BAM, size, 2, 0xFF, J1939_PGN_DM1);
+    receive_dt(PDM_SOURCE_ADDRESS, J1939_GLOBAL_ADDRESS, 1, dm1, size);
+    run_loops(BAM_TIMEOUT_MS);
+    receive_dt(PDM_SOURCE_ADDRESS, J1939_GLOBAL_ADDRESS, 2, dm1, size);
+
+    check_dtcs(test, single_spn, 1);
+
+    if (host_sent_frame_count != 0)
+    {
+        fail(test, "frames sent when a BAM timed out");
+        host_sent_frame_count = 0;
+    }
+
+    //
+    // An RTS/CTS transfer that stops is aborted.
+    //
+    receive_cm(PDM_SOURCE_ADDRESS, J1939_CVC_SOURCE_ADDRESS,
+               TP_CM_RTS, size, 2, 0xFF, J1939_PGN_DM1);
+    check_cm_sent(test, TP_CM_CTS, 2, 1);
+
+    receive_dt(PDM_SOURCE_ADDRESS, J1939_CVC_SOURCE_ADDRESS, 1, dm1, size);
+    run_loops(CTS_TIMEOUT_MS);
+    check_cm_sent(test, TP_CM_ABORT, TP_ABORT_TIMEOUT, 0xFF);
+
+    receive_dt(PDM_SOURCE_ADDRESS, J1939_CVC_SOURCE_ADDRESS, 2, dm1, size);
+    check_dtcs(test, single_spn, 1);
+
+    //
+    // The sessions are free again.
+    //
+    receive_cm(PDM_SOURCE_ADDRESS, J1939_GLOBAL_ADDRESS,
+               J1939_TP_CM_BAM, size, 2, 0xFF, J1939_PGN_DM1);
+    receive_dt(PDM_SOURCE_ADDRESS, J1939_GLOBAL_ADDRESS, 1, dm1, size);
+    receive_dt(PDM_SOURCE_ADDRESS, J1939_GLOBAL_ADDRESS, 2, dm1, size);
+
+    check_dtcs(test, spns, 3);
+}
+
+
+//=============================================================================
+//
+// test_bad_sequence()
+//
+//=============================================================================
+//
+static void test_bad_sequence(void)
+{
+    const char *test = "bad sequence";
+    const uint32_t spns[] = { 7, 8, 9 };
+    uint8_t dm1[MAX_DM1_BYTES];
+    uint16_t size = make_dm1(dm1, spns, 3);
+
+    set_single_frame_dm1();
+    host_sent_frame_count = 0;
+
+    //
+    // A BAM with a packet missing.
+    //
+    receive_cm(PDM_SOURCE_ADDRESS, J1939_GLOBAL_ADDRESS,
+               J1939_TP_CM_BAM, size, 2, 0xFF, J1939_PGN_DM1);
+    receive_dt(PDM_SOURCE_ADDRESS, J1939_GLOBAL_ADDRESS, 2, dm1, size);
+    receive_dt(PDM_SOURCE_ADDRESS, J1939_GLOBAL_ADDRESS, 1, dm1, size);
+
+    check_dtcs(test, single_spn, 1);
+
+    if (host_sent_frame_count != 0)
+    {
+        fail(test, "frames sent for a BAM out of sequence");
+        host_sent_frame_count = 0;
+    }
+
+    //
+    // An RTS/CTS transfer with a packet repeated.
+    //
+    receive_cm(PDM_SOURCE_ADDRESS, J1939_CVC_SOURCE_ADDRESS,
+               TP_CM_RTS, size, 2, 0xFF, J1939_PGN_DM1);
+    check_cm_sent(test, TP_CM_CTS, 2, 1);
+
+    receive_dt(PDM_SOURCE_ADDRESS, J1939_CVC_SOURCE_ADDRESS, 1, dm1, size);
+    receive_dt(PDM_SOURCE_ADDRESS, J1939_CVC_SOURCE_ADDRESS, 1, dm1, size);
+    check_cm_sent(test, TP_CM_ABORT, TP_ABORT_BAD_SEQUENCE, 0xFF);
+
+    receive_dt(PDM_SOURCE_ADDRESS, J1939_CVC_SOURCE_ADDRESS, 2, dm1, size);
+
+    check_dtcs(test, single_spn, 1);
+
+    if (host_sent_frame_count != 0)
+    {
+        fail(test, "frames sent after the abort");
+        host_sent_frame_count = 0;
+    }
+}
+
+
+//=============================================================================
+//
+// test_not_registered(): A DM2 from the PDM, and a DM1 from another
+// source address.
+//
+//=============================================================================
+//
+static void test_not_registered(void)
+{
+    const char *test = "not registered";
+    const uint32_t spns[] = { 11, 12, 13 };
+    uint8_t dm1[MAX_DM1_BYTES];
+    uint16_t size = make_dm1(dm1, spns, 3);
+
+    set_single_frame_dm1();
+    host_sent_frame_count = 0;
+
+    receive_cm(PDM_SOURCE_ADDRESS, J1939_GLOBAL_ADDRESS,
+               J1939_TP_CM_BAM, size, 2, 0xFF, PGN_DM2);
+    receive_dt(PDM_SOURCE_ADDRESS, J1939_GLOBAL_ADDRESS, 1, dm1, size);
+    receive_dt(PDM_SOURCE_ADDRESS, J1939_GLOBAL_ADDRESS, 2, dm1, size);
+
+    receive_cm(PDM_SOURCE_ADDRESS + 8, J1939_GLOBAL_ADDRESS,
+               J1939_TP_CM_BAM, size, 2, 0xFF, J1939_PGN_DM1);
+    receive_dt(PDM_SOURCE_ADDRESS + 8, J1939_GLOBAL_ADDRESS, 1, dm1, size);
+    receive_dt(PDM_SOURCE_ADDRESS + 8, J1939_GLOBAL_ADDRESS, 2, dm1, size);
+
+    check_dtcs(test, single_spn, 1);
+
+    if (host_sent_frame_count != 0)
+    {
+        fail(test, "frames sent for an unregistered transfer");
+        host_sent_frame_count = 0;
+    }
+}
+
+
+//=============================================================================
+//
+// main()
+//
+//=============================================================================
+//
+int main(void)
+{
+    host_clock_start();
+    time_service_update();
+
+    pdm_init(ONE, 0, PDM_CAN_LINE);
+
+    test_single_frame();
+    test_bam();
+    test_rts_cts();
+    test_timeouts();
+    test_bad_sequence();
+    test_not_registered();
+
+    if (failures != 0)
+    {
+        printf("can_tp_test: %u failures\n", failures);
+        return EXIT_FAILURE;
+    }
+
+    printf("can_tp_test: passed\n");
+    return EXIT_SUCCESS;
+}
+
+#endif // FVT_HOST_TEST
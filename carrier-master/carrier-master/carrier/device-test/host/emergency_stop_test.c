@@ -0,0 +1,463 @@
+/******************************************************************************
+ *
+ *        Name: emergency_stop_test.c
+ *
+ * Description: Host test of the E-stop and master switch fast path.
+ *              Runs the real emergency_stop.c and contactor_control.c
+ *              in the order User_App() calls them, with the state
+ *              machine still asking for the contactors to be closed,
+ *              as it does for the rest of the loop an E-stop is
+ *              pressed in. Checks:
+ *
+ *              - an E-stop writes every contactor output off in
+ *                emergency_stop_update(), and they stay off for as
+ *                long as it is pressed.
+ *              - an E-stop or the master switch opening sends a
+ *                disable frame to both SKAI2 inverters in the same
+ *                loop, only once the CAN registrations are valid.
+ *              - the master switch opening leaves the contactors to
+ *                the state machine.
+ *              - after the release, the contactors follow the state
+ *                machine again.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+
+#ifdef FVT_HOST_TEST
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "Prototypes.h"
+#include "Constants.h"
+#include "typedefs.h"
+#include "can_service.h"
+#include "skai2_inverter_vissim.h"
+#include "cvc_input_control.h"
+#include "contactor_control.h"
+#include "state_machine.h"
+#include "orion_control.h"
+#include "time_service.h"
+#include "emergency_stop.h"
+#include "host_stubs.h"
+
+#define LOOP_MS                 10
+
+//
+// Long enough for every pack to finish its staggered connect.
+//
+#define CONNECT_LOOPS           50
+
+#define MAX_MODULES             8
+#define MAX_OUTPUTS             64
+#define NUM_INVERTERS           2
+
+typedef struct
+{
+    uint8_t module_id;
+    uint8_t number;
+} output_t;
+
+static const output_t contactor_outputs[] =
+{
+    { OUT_D01_battery_1_positive_contactor },
+    { OUT_D02_battery_1_negative_contactor },
+    { OUT_D03_battery_1_precharge_contactor },
+    { OUT_D04_battery_2_positive_contactor },
+    { OUT_D07_battery_2_negative_contactor },
+    { OUT_D09_battery_2_precharge_contactor },
+    { OUT_D10_battery_3_positive_contactor },
+    { OUT_D13_battery_3_negative_contactor },
+    { OUT_C14_battery_3_precharge_contactor },
+};
+
+#define NUM_CONTACTOR_OUTPUTS \
+    (sizeof(contactor_outputs) / sizeof(contactor_outputs[0]))
+
+//
+// Connected, each pack has its positive and negative contactor on and
+// its precharge contactor off.
+//
+#define NUM_CONNECTED_OUTPUTS   6
+
+//
+// What the stand-ins below saw.
+//
+static uint16_t output_value[MAX_MODULES][MAX_OUTPUTS];
+static Input_State_t digital_inputs[NUM_CVC_DIGITAL_INPUTS];
+static bool_t registrations_valid = TRUE;
+static bool_t sm_contactors_closed = FALSE;
+static uint16_t inverter_enable[NUM_INVERTERS];
+static uint16_t disable_frames_sent[NUM_INVERTERS];
+
+static uint16_t failures = 0;
+
+
+//=============================================================================
+//
+// HED library stand-in.
+//
+//=============================================================================
+//
+void Update_Output(uint8_t module_id, uint8_t number, uint16_t value, bool_t flash)
+{
+    (void)flash;
+
+    if ((module_id < MAX_MODULES) && (number < MAX_OUTPUTS))
+    {
+        output_value[module_id][number] = value;
+    }
+}
+
+
+//=============================================================================
+//
+// Stand-ins for the CVC inputs, the CAN devices and the state
+// machine.
+//
+//=============================================================================
+//
+Input_State_t cvc_input_get_digital(cvc_digital_input_t input)
+{
+    return digital_inputs[input];
+}
+
+bool_t fvt_can_get_device_registrations_valid()
+{
+    return registrations_valid;
+}
+
+void skai2_set_vissim_tx_msg5_enable_max_current_soc_high_cell(
+    device_instances_t device,
+    uint16_t enable,
+    uint16_t max_battery_current,
+    uint16_t pack_state_of_charge,
+    uint16_t high_cell_voltage)
+{
+    (void)max_battery_current;
+    (void)pack_state_of_charge;
+    (void)high_cell_voltage;
+
+    inverter_enable[device - ONE] = enable;
+}
+
+void tx_skai2_enable_maxcurrent_soc_highcell(device_instances_t device,
+                                             can_rate_t transmit_counter_limit)
+{
+    if ((transmit_counter_limit == TX_SEND_EACH_CALL) &&
+        (inverter_enable[device - ONE] == FALSE))
+    {
+        disable_frames_sent[device - ONE]++;
+    }
+}
+
+bool_t battery_pack_voltages_matched(device_instances_t pack,
+                                     device_instances_t reference_pack)
+{
+    (void)pack;
+    (void)reference_pack;
+
+    return TRUE;
+}
+
+bool_t get_sm_neg_contactor_status() { return sm_contactors_closed; }
+bool_t get_sm_pre_contactor_status() { return FALSE; }
+bool_t get_sm_pos_contactor_status() { return sm_contactors_closed; }
+
+
+//=============================================================================
+//
+// fail()
+//
+//=============================================================================
+//
+static void fail(const char *test, const char *what)
+{
+    printf("FAIL %-24s %s\n", test, what);
+    failures++;
+}
+
+
+//=============================================================================
+//
+// contactor_outputs_on(): The number of contactor outputs last
+// written on.
+//
+//=============================================================================
+//
+static uint8_t contactor_outputs_on(void)
+{
+    uint8_t on = 0;
+    uint8_t i;
+
+    for (i = 0; i < NUM_CONTACTOR_OUTPUTS; i++)
+    {
+        if (output_value[contactor_outputs[i].module_id][contactor_outputs[i].number] != 0)
+        {
+            on++;
+        }
+    }
+
+    return on;
+}
+
+
+//=============================================================================
+//
+// set_inputs(): The E-stops are normally closed, so released is ON.
+// The master switch is ON when closed.
+//
+//=============================================================================
+//
+static void set_inputs(bool_t dash_e_stop,
+                       bool_t charge_box_e_stop,
+                       bool_t master_open)
+{
+    digital_inputs[CVC_DIN_A16_DASH_E_STOP] =
+        dash_e_stop ? INPUT_OFF : INPUT_ON;
+
+    digital_inputs[CVC_DIN_A17_CHARGE_BOX_E_STOP] =
+        charge_box_e_stop ? INPUT_OFF : INPUT_ON;
+
+    digital_inputs[CVC_DIN_E11_MASTER_SWITCH] =
+        master_open ? INPUT_OFF : INPUT_ON;
+}
+
+
+//=============================================================================
+//
+// start_loop(): The top of User_App(), up to and including the fast
+// path. The disable frame counts are of this loop only.
+//
+//=============================================================================
+//
+static void start_loop(void)
+{
+    host_clock_ms += LOOP_MS;
+    time_service_update();
+
+    disable_frames_sent[0] = 0;
+    disable_frames_sent[1] = 0;
+
+    emergency_stop_update();
+}
+
+
+//=============================================================================
+//
+// run_loops(): Whole loops, with the contactors updated from the
+// state machine later in the loop.
+//
+//=============================================================================
+//
+static void run_loops(uint16_t loops)
+{
+    uint16_t i;
+
+    for (i = 0; i < loops; i++)
+    {
+        start_loop();
+        update_contactor_control_output(TRUE);
+    }
+}
+
+
+//=============================================================================
+//
+// connect(): Released inputs and the state machine asking for the
+// contactors, until every pack is connected.
+//
+//=============================================================================
+//
+static void connect(const char *test)
+{
+    set_inputs(FALSE, FALSE, FALSE);
+    sm_contactors_closed = TRUE;
+    run_loops(CONNECT_LOOPS);
+
+    if (contactor_outputs_on() != NUM_CONNECTED_OUTPUTS)
+    {
+        fail(test, "contactors did not close before the test");
+    }
+}
+
+
+//=============================================================================
+//
+// test_e_stop()
+//
+//=============================================================================
+//
+static void test_e_stop(const char *test,
+                        bool_t dash_e_stop,
+                        bool_t charge_box_e_stop)
+{
+    uint16_t i;
+
+    registrations_valid = TRUE;
+    connect(test);
+
+    set_inputs(dash_e_stop, charge_box_e_stop, FALSE);
+    start_loop();
+
+    if (contactor_outputs_on() != 0)
+    {
+        fail(test, "contactors not opened by the fast path");
+    }
+
+    if ((disable_frames_sent[0] == 0) || (disable_frames_sent[1] == 0))
+    {
+        fail(test, "inverters not disabled in the same loop");
+    }
+
+    if (!emergency_stop_get_e_stop() ||
+        !emergency_stop_get_inverters_disabled() ||
+        emergency_stop_get_master_open())
+    {
+        fail(test, "getters do not show the E-stop");
+    }
+
+    //
+    // The state machine only moves to E_STOP at the end of the loop,
+    // so it still asks for the contactors.
+    //
+    update_contactor_control_output(TRUE);
+
+    for (i = 0; i < CONNECT_LOOPS; i++)
+    {
+        if (contactor_outputs_on() != 0)
+        {
+            fail(test, "contactors closed again with the E-stop pressed");
+            break;
+        }
+
+        run_loops(1);
+    }
+
+    //
+    // Released, the contactors follow the state machine again.
+    //
+    set_inputs(FALSE, FALSE, FALSE);
+    run_loops(CONNECT_LOOPS);
+
+    if (emergency_stop_get_e_stop() ||
+        emergency_stop_get_inverters_disabled())
+    {
+        fail(test, "E-stop still active after the release");
+    }
+
+    if (contactor_outputs_on() != NUM_CONNECTED_OUTPUTS)
+    {
+        fail(test, "contactors did not close again after the release");
+    }
+
+    sm_contactors_closed = FALSE;
+    run_loops(1);
+}
+
+
+//=============================================================================
+//
+// test_master_open()
+//
+//=============================================================================
+//
+static void test_master_open(void)
+{
+    const char *test = "master open";
+    uint8_t closed;
+
+    registrations_valid = TRUE;
+    connect(test);
+    closed = contactor_outputs_on();
+
+    set_inputs(FALSE, FALSE, TRUE);
+    start_loop();
+
+    if ((disable_frames_sent[0] == 0) || (disable_frames_sent[1] == 0))
+    {
+        fail(test, "inverters not disabled in the same loop");
+    }
+
+    if (contactor_outputs_on() != closed)
+    {
+        fail(test, "contactors opened, they are left to SHUTDOWN");
+    }
+
+    if (emergency_stop_get_e_stop() ||
+        !emergency_stop_get_master_open() ||
+        !emergency_stop_get_inverters_disabled())
+    {
+        fail(test, "getters do not show the master open");
+    }
+
+    update_contactor_control_output(TRUE);
+    sm_contactors_closed = FALSE;
+    set_inputs(FALSE, FALSE, FALSE);
+    run_loops(1);
+}
+
+
+//=============================================================================
+//
+// test_registrations_invalid(): No SKAI2 frames before the device
+// records can be used, but the contactors are still opened.
+//
+//=============================================================================
+//
+static void test_registrations_invalid(void)
+{
+    const char *test = "registrations invalid";
+
+    registrations_valid = FALSE;
+    connect(test);
+
+    set_inputs(TRUE, FALSE, FALSE);
+    start_loop();
+
+    if ((disable_frames_sent[0] != 0) || (disable_frames_sent[1] != 0))
+    {
+        fail(test, "SKAI2 frames sent before registration");
+    }
+
+    if (contactor_outputs_on() != 0)
+    {
+        fail(test, "contactors not opened by the fast path");
+    }
+
+    update_contactor_control_output(TRUE);
+    sm_contactors_closed = FALSE;
+    set_inputs(FALSE, FALSE, FALSE);
+    run_loops(1);
+}
+
+
+//=============================================================================
+//
+// main()
+//
+//=============================================================================
+//
+int main(void)
+{
+    host_clock_start();
+
+    test_e_stop("dash E-stop", TRUE, FALSE);
+    test_e_stop("charge box E-stop", FALSE, TRUE);
+    test_e_stop("both E-stops", TRUE, TRUE);
+    test_master_open();
+    test_registrations_invalid();
+
+    if (failures != 0)
+    {
+        printf("emergency_stop_test: %u failures\n", failures);
+        return EXIT_FAILURE;
+    }
+
+    printf("emergency_stop_test: passed\n");
+    return EXIT_SUCCESS;
+}
+
+#endif // FVT_HOST_TEST
@@ -0,0 +1,82 @@
+/******************************************************************************
+ *
+ *        Name: host_stubs.c
+ *
+ * Description: Stand-ins for the HED library shared by the host
+ *              tests, see host_stubs.h.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+
+#ifdef FVT_HOST_TEST
+
+#include "Prototypes.h"
+#include "Constants.h"
+#include "typedefs.h"
+#include "Prototypes_CAN.h"
+#include "time_service.h"
+#include "host_stubs.h"
+
+uint16_t IOMap[IO_MAP_SIZE];
+
+Can_Message_ host_sent_frames[HOST_MAX_SENT_FRAMES];
+uint8_t host_sent_frame_count = 0;
+
+uint32_t host_clock_ms = 0;
+
+
+//=============================================================================
+//
+// HED library stand-ins.
+//
+//=============================================================================
+//
+uint32_t ConvertMsecToLoops(uint32_t msec)
+{
+    return msec / HOST_LOOP_MS;
+}
+
+CAN_WRITE_STATUS Send_CAN_Message(uint8_t module_id,
+                                  CANLINE_ canline,
+                                  Can_Message_ canmessage)
+{
+    (void)module_id;
+    (void)canline;
+
+    if (host_sent_frame_count < HOST_MAX_SENT_FRAMES)
+    {
+        host_sent_frames[host_sent_frame_count++] = canmessage;
+    }
+
+    return CAN_WRITE_OK;
+}
+
+
+//=============================================================================
+//
+// host_clock()
+//
+//=============================================================================
+//
+static uint32_t host_clock(void)
+{
+    return host_clock_ms;
+}
+
+
+//=============================================================================
+//
+// host_clock_start(): Has the time service read host_clock_ms from
+// the next time_service_update() on.
+//
+//=============================================================================
+//
+void host_clock_start(void)
+{
+    time_service_set_clock_source(host_clock);
+}
+
+#endif // FVT_HOST_TEST
@@ -0,0 +1,41 @@
+/******************************************************************************
+ *
+ *        Name: host_stubs.h
+ *
+ * Description: Stand-ins for the HED library shared by the host tests:
+ *              the IOMap, the nominal loop period, a Send_CAN_Message()
+ *              that records the frames sent, and a host clock for the
+ *              time service that the test steps itself.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+
+#ifndef HOST_STUBS_H_
+#define HOST_STUBS_H_
+
+//
+// The nominal loop period ConvertMsecToLoops() divides by.
+//
+#define HOST_LOOP_MS                10
+
+#define HOST_MAX_SENT_FRAMES        16
+
+//
+// The frames Send_CAN_Message() was given, up to
+// HOST_MAX_SENT_FRAMES. A test clears host_sent_frame_count itself.
+//
+extern Can_Message_ host_sent_frames[HOST_MAX_SENT_FRAMES];
+extern uint8_t host_sent_frame_count;
+
+//
+// The time host_clock_start() has the time service read, in
+// milliseconds. A test steps it before each time_service_update().
+//
+extern uint32_t host_clock_ms;
+
+void host_clock_start(void);
+
+#endif // HOST_STUBS_H_
@@ -0,0 +1,419 @@
+/******************************************************************************
+ *
+ *        Name: precharge_estimator_test.c
+ *
+ * Description: Host test of the precharge estimator. Runs the real
+ *              precharge_estimator.c against a plant model of the DC
+ *              link charging through the precharge resistor:
+ *
+ *                  V(t) = Vbat - (Vbat - V0) * exp(-t / tau)
+ *
+ *              The DC link voltage reaches the estimator as the
+ *              inverter reports it, in whole volts, with a little
+ *              noise and only refreshed at the rate of its CAN
+ *              message. Checks, at a 10 and a 20 ms loop:
+ *
+ *              - a healthy precharge is never called a failure, the
+ *                fitted tau is close to the plant's and COMPLETE is
+ *                not reported before the DC link is nearly there.
+ *              - an open precharge resistor is NO_RISE just after
+ *                PRECHARGE_NO_RISE_MS.
+ *              - a precharge too slow to finish in time is TOO_SLOW
+ *                long before the precharge timer runs out.
+ *              - the fit starts again with every precharge.
+ *              - with no battery voltage, or one below
+ *                PRECHARGE_MIN_BATTERY_V, COMPLETE is never reported,
+ *                even with the battery voltage lost part way through.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+
+#ifdef FVT_HOST_TEST
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "Prototypes.h"
+#include "Constants.h"
+#include "typedefs.h"
+#include "time_service.h"
+#include "precharge_estimator.h"
+#include "host_stubs.h"
+
+#define PLANT_BATTERY_V         650
+#define PLANT_REPORT_MS         50
+#define PLANT_NOISE_V           1
+
+//
+// Longest precharge run, past the 15 s precharge timer.
+//
+#define RUN_MS                  20000
+
+//
+// The fitted tau must be within this many percent of the plant's.
+//
+#define TAU_TOLERANCE_PERCENT   10
+
+//
+// COMPLETE may be reported once the DC link will be within the
+// threshold this soon (30 ms to close the positive contactor, plus a
+// CAN report and a loop of slack).
+//
+#define EARLY_COMPLETE_MS       (30 + PLANT_REPORT_MS + 20)
+
+//
+// A precharge that can not finish in time must be caught by now.
+//
+#define TOO_SLOW_DETECT_MS      3000
+
+typedef struct
+{
+    const char *name;
+    float tau_ms;
+    uint16_t start_v;
+    bool_t resistor_open;
+} precharge_case_t;
+
+//
+// How a run ended.
+//
+typedef struct
+{
+    precharge_estimate_t first_failure;
+    uint32_t failure_ms;
+    uint32_t complete_ms;
+    uint32_t tau_ms;
+} precharge_result_t;
+
+static const precharge_case_t healthy_cases[] =
+{
+    { "tau 300 ms",          300.0f, 0,   FALSE },
+    { "tau 1 s",            1000.0f, 0,   FALSE },
+    { "tau 1 s from 200V",  1000.0f, 200, FALSE },
+    { "tau 3.5 s",          3500.0f, 0,   FALSE }
+};
+
+static const uint16_t loop_periods_ms[] = { 10, 20 };
+
+static uint32_t noise_state = 0x1234567UL;
+static uint16_t failures = 0;
+
+
+//=============================================================================
+//
+// noise(): -PLANT_NOISE_V to +PLANT_NOISE_V, repeatable.
+//
+//=============================================================================
+//
+static int16_t noise(void)
+{
+    noise_state = noise_state * 1103515245UL + 12345UL;
+    return (int16_t)((noise_state >> 16) % (2 * PLANT_NOISE_V + 1)) - PLANT_NOISE_V;
+}
+
+
+//=============================================================================
+//
+// fail()
+//
+//=============================================================================
+//
+static void fail(uint16_t loop_ms, const char *name, const char *what)
+{
+    printf("FAIL %2u ms loop, %-18s %s\n", loop_ms, name, what);
+    failures++;
+}
+
+
+/******************************************************************************
+ *
+ *        Name: run_precharge()
+ *
+ * Description: Closes the precharge contactor on the plant and runs
+ *              the estimator until it reports a failure or the run
+ *              ends. The DC link is reported every PLANT_REPORT_MS.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+static precharge_result_t run_precharge(const precharge_case_t *test,
+                                        uint16_t loop_ms)
+{
+    precharge_result_t result = { PRECHARGE_ESTIMATE_NONE, 0, 0, 0 };
+    uint32_t elapsed_ms = 0;
+    uint32_t since_report_ms = PLANT_REPORT_MS;
+    uint16_t reported_v = test->start_v;
+
+    //
+    // A loop with the contactor open, so the estimator starts again.
+    //
+    host_clock_ms += loop_ms;
+    time_service_update();
+    precharge_estimator_update(FALSE, reported_v, PLANT_BATTERY_V);
+
+    while (elapsed_ms <= RUN_MS)
+    {
+        precharge_estimate_t estimate;
+        float plant_v = test->start_v;
+
+        if (!test->resistor_open)
+        {
+            plant_v = PLANT_BATTERY_V -
+                      (PLANT_BATTERY_V - test->start_v) *
+                      expf(-(float)elapsed_ms / test->tau_ms);
+        }
+
+        if (since_report_ms >= PLANT_REPORT_MS)
+        {
+            int32_t v = (int32_t)plant_v + noise();
+
+            reported_v = (uint16_t)((v < 0) ? 0 : v);
+            since_report_ms = 0;
+        }
+
+        estimate = precharge_estimator_update(TRUE, reported_v, PLANT_BATTERY_V);
+
+        if ((result.complete_ms == 0) &&
+            (estimate == PRECHARGE_ESTIMATE_COMPLETE))
+        {
+            result.complete_ms = elapsed_ms;
+        }
+
+        if (precharge_estimator_get_tau_ms() != 0)
+        {
+            result.tau_ms = precharge_estimator_get_tau_ms();
+        }
+
+        if (precharge_estimator_is_failure(estimate))
+        {
+            result.first_failure = estimate;
+            result.failure_ms = elapsed_ms;
+            break;
+        }
+
+        if (result.complete_ms != 0)
+        {
+            break;
+        }
+
+        host_clock_ms += loop_ms;
+        time_service_update();
+        elapsed_ms += loop_ms;
+        since_report_ms += loop_ms;
+    }
+
+    return result;
+}
+
+
+//=============================================================================
+//
+// test_healthy()
+//
+//=============================================================================
+//
+static void test_healthy(const precharge_case_t *test, uint16_t loop_ms)
+{
+    precharge_result_t result = run_precharge(test, loop_ms);
+    uint32_t tau_error;
+
+    //
+    // When the plant comes within the completion threshold.
+    //
+    uint32_t plant_complete_ms =
+        (uint32_t)(test->tau_ms *
+                   logf((float)(PLANT_BATTERY_V - test->start_v) /
+                        PRECHARGE_COMPLETE_THRESHOLD_V));
+
+    if (result.first_failure != PRECHARGE_ESTIMATE_NONE)
+    {
+        fail(loop_ms, test->name, "healthy precharge called a failure");
+        return;
+    }
+
+    if (result.complete_ms == 0)
+    {
+        fail(loop_ms, test->name, "never COMPLETE");
+        return;
+    }
+
+    //
+    // A fast precharge can be inside the threshold before there are
+    // enough samples for a fit.
+    //
+    if (result.tau_ms != 0)
+    {
+        tau_error = (uint32_t)abs((int32_t)result.tau_ms - (int32_t)test->tau_ms);
+
+        if (tau_error * 100 > (uint32_t)test->tau_ms * TAU_TOLERANCE_PERCENT)
+        {
+            printf("     fitted tau %lu ms\n", (unsigned long)result.tau_ms);
+            fail(loop_ms, test->name, "fitted tau is off");
+        }
+    }
+    else if (test->tau_ms > 1000.0f)
+    {
+        fail(loop_ms, test->name, "no fit");
+    }
+
+    if (result.complete_ms + EARLY_COMPLETE_MS < plant_complete_ms)
+    {
+        printf("     COMPLETE at %lu ms, plant at %lu ms\n",
+               (unsigned long)result.complete_ms,
+               (unsigned long)plant_complete_ms);
+        fail(loop_ms, test->name, "COMPLETE too early");
+    }
+}
+
+
+//=============================================================================
+//
+// test_open_resistor()
+//
+//=============================================================================
+//
+static void test_open_resistor(uint16_t loop_ms)
+{
+    const precharge_case_t test = { "open resistor", 1000.0f, 0, TRUE };
+    precharge_result_t result = run_precharge(&test, loop_ms);
+
+    if (result.first_failure != PRECHARGE_ESTIMATE_NO_RISE)
+    {
+        fail(loop_ms, test.name, "not NO_RISE");
+        return;
+    }
+
+    if ((result.failure_ms < 300) || (result.failure_ms > 300U + loop_ms))
+    {
+        printf("     NO_RISE at %lu ms\n", (unsigned long)result.failure_ms);
+        fail(loop_ms, test.name, "NO_RISE at the wrong time");
+    }
+}
+
+
+//=============================================================================
+//
+// test_too_slow(): A tau of 6 s takes about 20 s to come within the
+// threshold, past the 15 s precharge timer.
+//
+//=============================================================================
+//
+static void test_too_slow(uint16_t loop_ms)
+{
+    const precharge_case_t test = { "tau 6 s", 6000.0f, 0, FALSE };
+    precharge_result_t result = run_precharge(&test, loop_ms);
+
+    if (result.first_failure != PRECHARGE_ESTIMATE_TOO_SLOW)
+    {
+        fail(loop_ms, test.name, "not TOO_SLOW");
+        return;
+    }
+
+    if (result.failure_ms > TOO_SLOW_DETECT_MS)
+    {
+        printf("     TOO_SLOW at %lu ms\n", (unsigned long)result.failure_ms);
+        fail(loop_ms, test.name, "TOO_SLOW caught late");
+    }
+}
+
+
+//=============================================================================
+//
+// test_no_battery_voltage(): The DC link charges as normal, but the
+// battery voltage is below PRECHARGE_MIN_BATTERY_V, from the start or
+// from lost_ms on, as when the BMSs have not reported or have gone
+// stale.
+//
+//=============================================================================
+//
+static void test_no_battery_voltage(const char *name,
+                                    uint16_t battery_v,
+                                    uint32_t lost_ms,
+                                    uint16_t loop_ms)
+{
+    uint32_t elapsed_ms = 0;
+
+    host_clock_ms += loop_ms;
+    time_service_update();
+    precharge_estimator_update(FALSE, 0, PLANT_BATTERY_V);
+
+    while (elapsed_ms <= RUN_MS)
+    {
+        uint16_t reported_battery_v =
+            (elapsed_ms >= lost_ms) ? battery_v : PLANT_BATTERY_V;
+
+        uint16_t dc_link_v =
+            (uint16_t)(PLANT_BATTERY_V *
+                       (1.0f - expf(-(float)elapsed_ms / 1000.0f)));
+
+        precharge_estimate_t estimate =
+            precharge_estimator_update(TRUE, dc_link_v, reported_battery_v);
+
+        if ((elapsed_ms >= lost_ms) &&
+            (estimate != PRECHARGE_ESTIMATE_NONE))
+        {
+            printf("     estimate %u at %lu ms\n",
+                   estimate, (unsigned long)elapsed_ms);
+            fail(loop_ms, name, "not NONE without a battery voltage");
+            return;
+        }
+
+        host_clock_ms += loop_ms;
+        time_service_update();
+        elapsed_ms += loop_ms;
+    }
+}
+
+
+//=============================================================================
+//
+// main()
+//
+//=============================================================================
+//
+int main(void)
+{
+    uint8_t i;
+    uint8_t j;
+
+    host_clock_start();
+
+    for (i = 0; i < (sizeof(loop_periods_ms) / sizeof(loop_periods_ms[0])); i++)
+    {
+        uint16_t loop_ms = loop_periods_ms[i];
+
+        //
+        // The open resistor and slow runs come between the healthy
+        // ones, so a fit left over from one run would show up in the
+        // next.
+        //
+        for (j = 0; j < (sizeof(healthy_cases) / sizeof(healthy_cases[0])); j++)
+        {
+            test_healthy(&healthy_cases[j], loop_ms);
+            test_open_resistor(loop_ms);
+            test_too_slow(loop_ms);
+        }
+
+        test_no_battery_voltage("no battery voltage", 0, 0, loop_ms);
+        test_no_battery_voltage("battery voltage 20V", 20, 0, loop_ms);
+        test_no_battery_voltage("battery voltage low",
+                                PRECHARGE_MIN_BATTERY_V - 1, 0, loop_ms);
+        test_no_battery_voltage("battery voltage lost", 0, 500, loop_ms);
+    }
+
+    if (failures != 0)
+    {
+        printf("precharge_estimator_test: %u failures\n", failures);
+        return EXIT_FAILURE;
+    }
+
+    printf("precharge_estimator_test: passed\n");
+    return EXIT_SUCCESS;
+}
+
+#endif // FVT_HOST_TEST
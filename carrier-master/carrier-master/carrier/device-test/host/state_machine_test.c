@@ -0,0 +1,1411 @@
+/******************************************************************************
+ *
+ *        Name: state_machine_test.c
+ *
+ * Description: Host test of the state machine. Includes the real
+ *              state_machine.c, so the real run_state_machine(), its
+ *              during, entry and guard functions, the state and
+ *              transition tables and contactor_control() are run,
+ *              with the real timer, time and precharge estimator
+ *              services.
+ *
+ *              Explores the state machine exhaustively over a
+ *              discretized input space. An input vector is one bit
+ *              for each of the NUM_INPUT_BITS inputs below, so there
+ *              are NUM_VECTORS of them. The DC link follows a plant
+ *              model of the contactors and the precharge resistor,
+ *              and the resistor being open is one of the bits.
+ *
+ *              A configuration is where the state machine settles
+ *              with a vector held: the state, the contactor and other
+ *              outputs, the latches of state_machine.c and whether the
+ *              DC link is discharged or precharged (config_key()). It
+ *              has settled once nothing in it has changed and no
+ *              timer has been counting for QUIET_LOOPS loops, or once
+ *              the timers have taken it round a cycle of states.
+ *              Timers longer than MAX_SETTLE_MS, the one hour top off
+ *              cooldown, are taken as steady, so its expiry is not
+ *              explored.
+ *
+ *              From every configuration reached, starting from
+ *              everything off, it runs:
+ *
+ *              - every vector, held until it settles.
+ *              - every single input changed for one loop, then back.
+ *              - the vector that first reached the configuration,
+ *                interrupted after each of interrupt_loops[] by every
+ *                single input changing, then held until it settles.
+ *                This changes the inputs part way through a
+ *                precharge, the startup timer or a shutdown.
+ *
+ *              The state machine's memory is saved with each
+ *              configuration reached and restored before each run
+ *              from it (snapshot_save()). The runs are shared out
+ *              between worker processes forked from main(), through
+ *              shared memory: one per core, or as many as the first
+ *              argument asks for.
+ *
+ *              Every loop it checks:
+ *
+ *              - the positive and precharge contactors are never
+ *                closed without the negative contactor.
+ *              - HV systems are only enabled with the main
+ *                contactors closed.
+ *              - the positive and precharge contactors are not both
+ *                closed for longer than the precharge opening delay.
+ *              - the contactors open within the HV turning off delay
+ *                of a state that does not want HV, and of an E-stop.
+ *              - the negative contactor opens after a precharge
+ *                failure, and the positive contactor only closes on
+ *                a precharged DC link.
+ *              - every change of state is a transition of the table,
+ *                and a state without a during action takes the first
+ *                transition whose guard is true (the guard skip in
+ *                run_state_machine() never misses one).
+ *              - livelock: with the inputs held, the state does not
+ *                keep changing on every loop, and it settles or
+ *                cycles within MAX_SETTLE_MS.
+ *
+ *              At the end, every transition out of a state that was
+ *              reached must have been taken, and the contactors must
+ *              have closed and failed a precharge. The states never
+ *              reached, the changes of the contactor commands seen and
+ *              the cycles of states are reported. A failure prints the
+ *              runs that lead to it from everything off.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+
+#ifdef FVT_HOST_TEST
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+
+//
+// Every timer_operate() of state_machine.c goes through
+// host_timer_operate(), so a run can tell when a timer is counting.
+// The during, entry and guard functions all take the input data,
+// not all of them read it.
+//
+#define timer_operate host_timer_operate
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#include "../../vehicle-control/state_machine.c"
+#pragma GCC diagnostic pop
+#undef timer_operate
+
+#include "time_service.h"
+
+bool_t timer_operate(timer_t *timer, bool_t inBit);
+
+#define LOOP_MS                     10
+
+//
+// The plant: a 650V pack, the DC link charged through the precharge
+// resistor, and bled down by the inverter to PLANT_RESIDUAL_V when
+// disconnected. The negative contactor only closes on a DC link
+// reading of at least MINIMUM_DC_LINK_V.
+//
+#define PLANT_BATTERY_V             650
+#define PLANT_PRECHARGE_TAU_MS      300.0f
+#define PLANT_DISCHARGE_TAU_MS      2000.0f
+#define PLANT_RESIDUAL_V            20
+
+//
+// The DC link may still be up to this far short of the completion
+// threshold when the estimator predicts it (precharge_estimator.c).
+//
+#define POS_CLOSE_MARGIN_V          10
+
+//
+// The input vector. The max cell voltage is either well below the
+// slow charging band or at the maximum, and the traction drive is
+// either stopped or turning.
+//
+#define IN_MASTER_CLOSED            0
+#define IN_E_STOP                   1
+#define IN_IGNITION_ON              2
+#define IN_PLUGGED_IN               3
+#define IN_IN_NEUTRAL               4
+#define IN_STOP_CHARGING_BUTTON     5
+#define IN_BRAKE_TEST_MODE          6
+#define IN_DIAGNOSTIC_MODE          7
+#define IN_EXIT_POST_CHARGE_IDLE    8
+#define IN_CRITICAL_FAULT_HV_OFF    9
+#define IN_CRITICAL_FAULT_HV_ON     10
+#define IN_MAX_CELL_AT_MAXIMUM      11
+#define IN_TRACTION_TURNING         12
+#define IN_PRECHARGE_RESISTOR_OPEN  13
+#define NUM_INPUT_BITS              14
+
+#define NUM_VECTORS                 (1UL << NUM_INPUT_BITS)
+
+#define INPUT(vector, bit)          ((bool_t)(((vector) >> (bit)) & 1))
+
+#define MAX_CELL_LOW_UV             39000
+#define TRACTION_TURNING_RPM        300
+
+//
+// Settling. MAX_SETTLE_MS is longer than every timer of the state
+// machine but the top off cooldown.
+//
+#define QUIET_LOOPS                 5
+#define MAX_SETTLE_MS               60000UL
+#define MAX_SETTLE_LOOPS            (MAX_SETTLE_MS / LOOP_MS + QUIET_LOOPS)
+
+//
+// How the runs from a configuration are shared out. Each block of
+// VECTORS_PER_ITEM vectors is one item, and the single input changes
+// and interrupts are one more.
+//
+#define VECTORS_PER_ITEM            1024
+#define ITEMS_PER_CONFIG            (NUM_VECTORS / VECTORS_PER_ITEM + 1)
+
+#define MAX_CONFIGS                 4096
+#define CONFIG_TABLE_SIZE           8192
+#define MAX_SNAPSHOT_BYTES          8192
+#define MAX_PRINTED_FAILURES        10
+#define MAX_CYCLES                  16
+#define MAX_CYCLE_CHANGES           32
+
+static const uint16_t interrupt_loops[] = { 1, 5, 25, 100, 500 };
+
+#define NUM_INTERRUPT_LOOPS \
+    (sizeof(interrupt_loops) / sizeof(interrupt_loops[0]))
+
+typedef enum
+{
+    RUN_HOLD = 0,
+    RUN_GLITCH,
+    RUN_INTERRUPT
+} run_kind_t;
+
+//
+// A run from a configuration. For RUN_HOLD, vector is held. For
+// RUN_GLITCH, the held vector with input bit changed for one loop.
+// For RUN_INTERRUPT, vector for loops, then with input bit changed.
+//
+typedef struct
+{
+    run_kind_t kind;
+    uint16_t   vector;
+    uint8_t    bit;
+    uint16_t   loops;
+} run_t;
+
+//
+// A cycle of states with the inputs held. The states are a bit each,
+// and run from config is the first run seen to go round it.
+//
+typedef struct
+{
+    uint16_t states;
+    uint16_t vector;
+    int32_t  config;
+    run_t    run;
+} cycle_t;
+
+typedef struct
+{
+    uint32_t key;
+    int32_t  parent;
+    run_t    run;
+    uint16_t held_vector;
+    uint8_t  snapshot[MAX_SNAPSHOT_BYTES];
+} config_t;
+
+//
+// Shared between main() and the workers.
+//
+typedef struct
+{
+    volatile uint8_t lock;
+
+    uint32_t num_configs;
+    uint32_t next_item;
+    uint32_t busy_workers;
+
+    int32_t  config_table[CONFIG_TABLE_SIZE];
+
+    uint32_t runs;
+    unsigned long long loops;
+    uint32_t failures;
+    uint32_t pos_contactor_closes;
+    uint32_t precharge_failures;
+
+    bool_t   state_reached[NUM_STATES];
+    bool_t   transition_taken[NUM_STATES][NUM_STATES];
+    bool_t   command_change_seen[8][8];
+
+    uint8_t  num_cycles;
+    cycle_t  cycles[MAX_CYCLES];
+
+    config_t configs[MAX_CONFIGS];
+} shared_t;
+
+//
+// The memory of the program, .data and .bss, that snapshot_save()
+// saves. Defined by the linker.
+//
+extern char __data_start[];
+extern char _end[];
+
+static shared_t *shared = NULL;
+
+//
+// The run in progress, for fail().
+//
+static int32_t current_config = -1;
+static const run_t *current_run = NULL;
+
+static uint16_t held_vector = 0;
+static float dc_link_v = PLANT_RESIDUAL_V;
+static bool_t timer_running = FALSE;
+
+static state_t tracked_state = ZERO_ENERGY;
+static bool_t state_changed = FALSE;
+
+
+//=============================================================================
+//
+// Stand-ins for the modules populate_state_machine_member_elements()
+// reads. The test fills sm_input_data itself, so they are not used.
+//
+//=============================================================================
+//
+bool_t low_power_mode = FALSE;
+
+bool_t emergency_stop_get_e_stop() { return FALSE; }
+bool_t emergency_stop_get_master_open() { return FALSE; }
+uint16_t cvc_input_get_analog(cvc_analog_input_t input) { (void)input; return 0; }
+Input_State_t cvc_input_get_digital(cvc_digital_input_t input) { (void)input; return 0; }
+bool_t detect_charge_handle() { return FALSE; }
+shifter_position_t get_shifter_direction() { return SHIFTER_NEUTRAL; }
+uint32_t fault_manager_get_reasons(uint8_t reaction, bool_t active_only) { (void)reaction; (void)active_only; return 0; }
+uint32_t get_battery_pack_data_change_count() { return 0; }
+uint16_t get_pack_high_cell_voltage() { return 0; }
+uint16_t get_pack_low_cell_voltage() { return 0; }
+uint8_t get_battery_pack_SOC() { return 0; }
+uint16_t get_battery_pack_voltage() { return 0; }
+uint32_t skai_get_vissim_rx_change_count(device_instances_t device) { (void)device; return 0; }
+uint16_t skai_get_vissim_DCLink_Voltage(device_instances_t device) { (void)device; return 0; }
+uint16_t skai_get_vissim_motor_rpm(device_instances_t device) { (void)device; return 0; }
+uint32_t get_critical_fault_hv_off() { return 0; }
+uint32_t get_critical_fault_hv_on() { return 0; }
+bool_t bms_fresh_data_1() { return TRUE; }
+bool_t bms_fresh_data_2() { return TRUE; }
+bool_t bms_fresh_data_3() { return TRUE; }
+
+
+//=============================================================================
+//
+// lock() and unlock(): A spinlock on the shared memory.
+//
+//=============================================================================
+//
+static void lock(void)
+{
+    while (__atomic_test_and_set(&shared->lock, __ATOMIC_ACQUIRE))
+    {
+        // spin
+    }
+}
+
+static void unlock(void)
+{
+    __atomic_clear(&shared->lock, __ATOMIC_RELEASE);
+}
+
+
+//=============================================================================
+//
+// print_run()
+//
+//=============================================================================
+//
+static void print_run(const run_t *run)
+{
+    switch (run->kind)
+    {
+    case RUN_HOLD:
+        printf("     hold 0x%04x\n", run->vector);
+        break;
+
+    case RUN_GLITCH:
+        printf("     glitch input %u of 0x%04x for a loop\n",
+               run->bit, run->vector);
+        break;
+
+    case RUN_INTERRUPT:
+        printf("     0x%04x for %u loops, then input %u changed\n",
+               run->vector, run->loops, run->bit);
+        break;
+    }
+}
+
+
+//=============================================================================
+//
+// print_path(): The runs from everything off to a configuration.
+//
+//=============================================================================
+//
+static void print_path(int32_t config)
+{
+    if (config <= 0)
+    {
+        return;
+    }
+
+    print_path(shared->configs[config].parent);
+    print_run(&shared->configs[config].run);
+}
+
+
+//=============================================================================
+//
+// fail()
+//
+//=============================================================================
+//
+static void fail(const char *what)
+{
+    uint32_t failures = __atomic_fetch_add(&shared->failures, 1, __ATOMIC_RELAXED);
+
+    //
+    // Only the first few, one broken invariant fails over and over.
+    //
+    if (failures < MAX_PRINTED_FAILURES)
+    {
+        lock();
+        printf("FAIL state %d: %s, after\n", (int)tracked_state, what);
+        print_path(current_config);
+
+        if (current_run != NULL)
+        {
+            print_run(current_run);
+        }
+
+        fflush(stdout);
+        unlock();
+    }
+}
+
+
+//=============================================================================
+//
+// host_timer_operate(): timer_operate(), noting a timer that is part
+// way through counting.
+//
+//=============================================================================
+//
+bool_t host_timer_operate(timer_t *timer, bool_t input)
+{
+    bool_t output = timer_operate(timer, input);
+    uint32_t period_ms = timer->period;
+
+    if (timer->units == TIMER_LOOPS)
+    {
+        period_ms *= LOOP_MS;
+    }
+
+    if ((period_ms <= MAX_SETTLE_MS) &&
+        (timer->counter != 0) &&
+        (timer->counter != timer->period))
+    {
+        timer_running = TRUE;
+    }
+
+    return output;
+}
+
+
+/******************************************************************************
+ *
+ *        Name: flight_recorder_record()
+ *
+ * Description: Called by run_state_machine() on every change of
+ *              state. Checks the change is a transition of the table
+ *              and follows the state the test expects to be current.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+void flight_recorder_record(state_t from_state,
+                            state_t to_state,
+                            uint16_t inputs,
+                            uint32_t critical_fault_hv_off,
+                            uint32_t critical_fault_hv_on)
+{
+    uint8_t i;
+    bool_t in_table = FALSE;
+
+    (void)inputs;
+    (void)critical_fault_hv_off;
+    (void)critical_fault_hv_on;
+
+    if (from_state != tracked_state)
+    {
+        fail("change of state recorded from the wrong state");
+    }
+
+    for (i = sm_transition_first[from_state];
+         i < sm_transition_first[from_state + 1];
+         i++)
+    {
+        if (sm_transition_table[i].to == to_state)
+        {
+            in_table = TRUE;
+        }
+    }
+
+    if (!in_table)
+    {
+        fail("change of state that is not in the transition table");
+    }
+
+    shared->transition_taken[from_state][to_state] = TRUE;
+    tracked_state = to_state;
+    state_changed = TRUE;
+}
+
+
+//=============================================================================
+//
+// snapshot_save() and snapshot_restore(): The whole memory of the
+// state machine, the services and this test, as the linker lays it
+// out. The shared memory is mapped, so only the pointer to it is
+// saved.
+//
+//=============================================================================
+//
+static size_t snapshot_size(void)
+{
+    return (size_t)(_end - __data_start);
+}
+
+static void snapshot_save(uint8_t *snapshot)
+{
+    memcpy(snapshot, __data_start, snapshot_size());
+}
+
+static void snapshot_restore(const uint8_t *snapshot)
+{
+    memcpy(__data_start, snapshot, snapshot_size());
+}
+
+
+//=============================================================================
+//
+// apply_inputs()
+//
+//=============================================================================
+//
+static void apply_inputs(uint16_t vector)
+{
+    sm_input_data.master_closed         = INPUT(vector, IN_MASTER_CLOSED);
+    sm_input_data.e_stop                = INPUT(vector, IN_E_STOP);
+    sm_input_data.ignition_on           = INPUT(vector, IN_IGNITION_ON);
+    sm_input_data.plugged_in            = INPUT(vector, IN_PLUGGED_IN);
+    sm_input_data.in_neutral            = INPUT(vector, IN_IN_NEUTRAL);
+    sm_input_data.stop_charging_button  = INPUT(vector, IN_STOP_CHARGING_BUTTON);
+    sm_input_data.brake_test_mode       = INPUT(vector, IN_BRAKE_TEST_MODE);
+    sm_input_data.diagnostic_mode       = INPUT(vector, IN_DIAGNOSTIC_MODE);
+    sm_input_data.exit_post_charge_idle = INPUT(vector, IN_EXIT_POST_CHARGE_IDLE);
+    sm_input_data.critical_fault_hv_off = INPUT(vector, IN_CRITICAL_FAULT_HV_OFF) ? 1 : 0;
+    sm_input_data.critical_fault_hv_on  = INPUT(vector, IN_CRITICAL_FAULT_HV_ON) ? 2 : 0;
+    sm_input_data.max_cell_voltage_uv   =
+        INPUT(vector, IN_MAX_CELL_AT_MAXIMUM) ? MAX_CHARGING_CELL_VOLTAGE
+                                              : MAX_CELL_LOW_UV;
+    sm_input_data.min_cell_voltage_uv   = sm_input_data.max_cell_voltage_uv - 200;
+    sm_input_data.battery_soc           = 80;
+    sm_input_data.traction_rpm          =
+        INPUT(vector, IN_TRACTION_TURNING) ? TRACTION_TURNING_RPM : 0;
+    sm_input_data.dc_bus_voltage_v      = (uint16_t)dc_link_v;
+    sm_input_data.battery_voltage_v     = PLANT_BATTERY_V;
+
+    sm_input_data.setting_max_charging_cell_voltage_uv =
+        MAX_CHARGING_CELL_VOLTAGE;
+}
+
+
+//=============================================================================
+//
+// expected_next_state(): The guards of a state without a during
+// action only read the inputs, so the next state is known before
+// run_state_machine() is called. NUM_STATES for the other states.
+//
+//=============================================================================
+//
+static state_t expected_next_state(state_t state)
+{
+    uint8_t i;
+
+    if (sm_state_table[state].during != NULL)
+    {
+        return NUM_STATES;
+    }
+
+    for (i = sm_transition_first[state];
+         i < sm_transition_first[state + 1];
+         i++)
+    {
+        if (sm_transition_table[i].guard(&sm_input_data))
+        {
+            return sm_transition_table[i].to;
+        }
+    }
+
+    return state;
+}
+
+
+//=============================================================================
+//
+// plant_update()
+//
+//=============================================================================
+//
+static void plant_update(const state_machine_contactor_status_t *contactors,
+                         bool_t precharge_resistor_open)
+{
+    if (contactors->neg_contactor && contactors->pos_contactor)
+    {
+        dc_link_v = PLANT_BATTERY_V;
+    }
+    else if (contactors->neg_contactor &&
+             contactors->pre_contactor &&
+             !precharge_resistor_open)
+    {
+        dc_link_v += (PLANT_BATTERY_V - dc_link_v) * LOOP_MS / PLANT_PRECHARGE_TAU_MS;
+    }
+    else if (dc_link_v > PLANT_RESIDUAL_V)
+    {
+        dc_link_v -= (dc_link_v - PLANT_RESIDUAL_V) * LOOP_MS / PLANT_DISCHARGE_TAU_MS;
+    }
+    else
+    {
+        dc_link_v = PLANT_RESIDUAL_V;
+    }
+}
+
+
+//=============================================================================
+//
+// contactor_command(): neg, pos and pre as bits 2, 1 and 0.
+//
+//=============================================================================
+//
+static uint8_t contactor_command(const state_machine_contactor_status_t *contactors)
+{
+    return (uint8_t)((contactors->neg_contactor ? 4 : 0) |
+                     (contactors->pos_contactor ? 2 : 0) |
+                     (contactors->pre_contactor ? 1 : 0));
+}
+
+
+/******************************************************************************
+ *
+ *        Name: check_contactors()
+ *
+ * Description: The contactor invariants, on the output data of this
+ *              loop. The times are how long each condition has held,
+ *              counted from the first loop it held in.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+static void check_contactors(const state_machine_output_data_t *output,
+                             uint16_t dc_link_voltage)
+{
+    static uint32_t hv_not_desired_ms = 0;
+    static uint32_t e_stop_ms = 0;
+    static uint32_t pos_and_pre_ms = 0;
+    static bool_t previous_precharge_failure = FALSE;
+    static bool_t previous_pos_contactor = FALSE;
+    static uint8_t previous_command = 0;
+
+    const state_machine_contactor_status_t *contactors = &output->contactors;
+    uint8_t command = contactor_command(contactors);
+    bool_t any_closed = (command != 0);
+
+    if ((contactors->pos_contactor || contactors->pre_contactor) &&
+        !contactors->neg_contactor)
+    {
+        fail("positive or precharge contactor closed without the negative");
+    }
+
+    if (output->enable_hv_systems &&
+        !(contactors->pos_contactor && contactors->neg_contactor))
+    {
+        fail("HV systems enabled with the main contactors open");
+    }
+
+    pos_and_pre_ms = (contactors->pos_contactor && contactors->pre_contactor)
+                     ? pos_and_pre_ms + LOOP_MS : 0;
+
+    if (pos_and_pre_ms > (DELAY_OPEN_PRECHARGE_MS + LOOP_MS))
+    {
+        fail("precharge contactor left closed with the positive");
+    }
+
+    hv_not_desired_ms = !sm_state_table[output->current_state].hv_desired
+                        ? hv_not_desired_ms + LOOP_MS : 0;
+
+    if (any_closed && (hv_not_desired_ms > HV_TURNING_OFF_DELAY_MS))
+    {
+        fail("contactors closed in a state that does not want HV");
+    }
+
+    //
+    // The state changes on the loop after the E-stop is seen.
+    //
+    e_stop_ms = sm_input_data.e_stop ? e_stop_ms + LOOP_MS : 0;
+
+    if (any_closed && (e_stop_ms > (HV_TURNING_OFF_DELAY_MS + LOOP_MS)))
+    {
+        fail("contactors closed with the E-stop pressed");
+    }
+
+    if (previous_precharge_failure && contactors->neg_contactor)
+    {
+        fail("negative contactor closed after a precharge failure");
+    }
+
+    if (contactors->pos_contactor && !previous_pos_contactor)
+    {
+        __atomic_fetch_add(&shared->pos_contactor_closes, 1, __ATOMIC_RELAXED);
+    }
+
+    if (contactors->precharge_failure && !previous_precharge_failure)
+    {
+        __atomic_fetch_add(&shared->precharge_failures, 1, __ATOMIC_RELAXED);
+    }
+
+    if (contactors->pos_contactor && !previous_pos_contactor &&
+        (dc_link_voltage + PRECHARGE_COMPLETE_THRESHOLD_V + POS_CLOSE_MARGIN_V
+         < PLANT_BATTERY_V))
+    {
+        fail("positive contactor closed on a DC link that is not precharged");
+    }
+
+    if (command != previous_command)
+    {
+        shared->command_change_seen[previous_command][command] = TRUE;
+    }
+
+    previous_precharge_failure = contactors->precharge_failure;
+    previous_pos_contactor = contactors->pos_contactor;
+    previous_command = command;
+}
+
+
+//=============================================================================
+//
+// run_loop(): One loop of User_App(), as far as the state machine is
+// concerned, with the inputs of vector.
+//
+//=============================================================================
+//
+static void run_loop(uint16_t vector)
+{
+    state_t expected;
+
+    time_service_update();
+    apply_inputs(vector);
+
+    expected = expected_next_state(tracked_state);
+    state_changed = FALSE;
+
+    run_state_machine();
+
+    shared->state_reached[sm_output_data.current_state] = TRUE;
+
+    if (sm_output_data.current_state != tracked_state &&
+        !state_changed)
+    {
+        fail("output state is not the state that was run");
+    }
+
+    if ((expected != NUM_STATES) && (tracked_state != expected))
+    {
+        fail("a state without a during action missed a transition");
+    }
+
+    check_contactors(&sm_output_data, sm_input_data.dc_bus_voltage_v);
+    plant_update(&sm_output_data.contactors,
+                 INPUT(vector, IN_PRECHARGE_RESISTOR_OPEN));
+}
+
+
+/******************************************************************************
+ *
+ *        Name: config_key()
+ *
+ * Description: What tells the configurations apart: the state, the
+ *              contactor and other outputs, the latches of
+ *              state_machine.c and the DC link.
+ *
+ *              Each latch is only read in one state, and is set
+ *              again by the entry action of every transition to it,
+ *              so it only counts in that state. safe_startup in
+ *              contactor_control() is not counted. It is worked out
+ *              again from the inputs of each loop unless both main
+ *              contactors are closed, and then it is set.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+typedef struct
+{
+    const bool_t *latch;
+    state_t state;
+} latch_t;
+
+static const latch_t latches[] =
+{
+    { &master_closed_ignition_off_before_on, MASTER_CLOSED_NO_HV },
+    { &startup_complete,                     STARTUP },
+    { &top_off_cooldown,                     CHARGING },
+    { &post_charge_ignition_off_before_on,   POST_CHARGE_IDLE },
+    { &failure_shutdown_complete,            CRITICAL_FAILURE_HV_OFF },
+    { &shutdown_complete,                    SHUTDOWN },
+};
+
+#define NUM_LATCHES (sizeof(latches) / sizeof(latches[0]))
+
+static uint32_t config_key(void)
+{
+    const state_machine_output_data_t *output = &sm_output_data;
+    uint32_t key = (uint32_t)tracked_state;
+    uint8_t i;
+
+    key = (key << 8) |
+          ((uint32_t)contactor_command(&output->contactors) << 5) |
+          (output->contactors.precharge_failure ? 0x10 : 0) |
+          (output->contactors.precharge_success ? 0x08 : 0) |
+          (output->enable_hv_systems ? 0x04 : 0) |
+          (output->charging_desired ? 0x02 : 0) |
+          (output->brakes_desired ? 0x01 : 0);
+
+    for (i = 0; i < NUM_LATCHES; i++)
+    {
+        key = (key << 1) |
+              ((*latches[i].latch && (tracked_state == latches[i].state)) ? 1 : 0);
+    }
+
+    //
+    // Discharged, precharged, or part way.
+    //
+    key <<= 2;
+
+    if (dc_link_v + PRECHARGE_COMPLETE_THRESHOLD_V >= PLANT_BATTERY_V)
+    {
+        key |= 2;
+    }
+    else if (dc_link_v > PLANT_RESIDUAL_V + 1)
+    {
+        key |= 1;
+    }
+
+    return key;
+}
+
+
+//=============================================================================
+//
+// run_loops(): Holds a vector for a number of loops.
+//
+//=============================================================================
+//
+static void run_loops(uint16_t vector, uint16_t loops)
+{
+    uint16_t i;
+
+    held_vector = vector;
+
+    for (i = 0; i < loops; i++)
+    {
+        run_loop(vector);
+    }
+
+    __atomic_fetch_add(&shared->loops, loops, __ATOMIC_RELAXED);
+}
+
+
+//=============================================================================
+//
+// add_cycle(): Notes the states of a cycle, the first time it is
+// seen.
+//
+//=============================================================================
+//
+static void add_cycle(uint16_t states, uint16_t vector)
+{
+    uint8_t i;
+
+    lock();
+
+    for (i = 0; i < shared->num_cycles; i++)
+    {
+        if (shared->cycles[i].states == states)
+        {
+            unlock();
+            return;
+        }
+    }
+
+    if (shared->num_cycles < MAX_CYCLES)
+    {
+        cycle_t *cycle = &shared->cycles[shared->num_cycles++];
+
+        cycle->states = states;
+        cycle->config = current_config;
+        cycle->run = *current_run;
+        cycle->vector = vector;
+    }
+
+    unlock();
+}
+
+
+/******************************************************************************
+ *
+ *        Name: settle()
+ *
+ * Description: Holds a vector until the configuration has settled,
+ *              or has come back round to where it was at an earlier
+ *              change of state. Timers can take the state machine
+ *              round a cycle of states with the inputs held, such as
+ *              a retry after a critical failure. The cycles are
+ *              reported, and where it came back round to is a
+ *              configuration like any other.
+ *
+ *              FALSE if the state changes on every loop, which is a
+ *              livelock, or if it neither settles nor cycles within
+ *              MAX_SETTLE_MS.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+static bool_t settle(uint16_t vector)
+{
+    uint32_t loops;
+    uint16_t quiet = 0;
+    uint8_t changes_in_a_row = 0;
+    uint32_t change_keys[MAX_CYCLE_CHANGES];
+    uint16_t states_since[MAX_CYCLE_CHANGES];
+    uint8_t changes = 0;
+    uint8_t i;
+
+    held_vector = vector;
+
+    for (loops = 1; loops <= MAX_SETTLE_LOOPS; loops++)
+    {
+        uint32_t key = config_key();
+
+        timer_running = FALSE;
+        run_loop(vector);
+
+        changes_in_a_row = state_changed ? changes_in_a_row + 1 : 0;
+
+        if (changes_in_a_row > NUM_STATES)
+        {
+            fail("livelock, the state changes every loop with the inputs held");
+            break;
+        }
+
+        //
+        // The keys are compared at the first change of state of a run
+        // of them, as the states in between can take a loop each.
+        //
+        if (state_changed)
+        {
+            for (i = 0; i < changes; i++)
+            {
+                states_since[i] |= (uint16_t)(1U << tracked_state);
+            }
+        }
+
+        if (state_changed && (changes_in_a_row == 1))
+        {
+            uint32_t change_key = config_key();
+
+            for (i = 0; i < changes; i++)
+            {
+                if (change_keys[i] == change_key)
+                {
+                    add_cycle(states_since[i], vector);
+                    __atomic_fetch_add(&shared->loops, loops, __ATOMIC_RELAXED);
+                    return TRUE;
+                }
+            }
+
+            if (changes < MAX_CYCLE_CHANGES)
+            {
+                change_keys[changes] = change_key;
+                states_since[changes] = (uint16_t)(1U << tracked_state);
+                changes++;
+            }
+        }
+
+        quiet = ((config_key() == key) && !timer_running) ? quiet + 1 : 0;
+
+        if (quiet >= QUIET_LOOPS)
+        {
+            __atomic_fetch_add(&shared->loops, loops, __ATOMIC_RELAXED);
+            return TRUE;
+        }
+    }
+
+    if (loops > MAX_SETTLE_LOOPS)
+    {
+        fail("never settles with the inputs held");
+    }
+
+    __atomic_fetch_add(&shared->loops, loops, __ATOMIC_RELAXED);
+    return FALSE;
+}
+
+
+//=============================================================================
+//
+// add_config(): Adds the configuration the state machine has settled
+// in, if it is new.
+//
+//=============================================================================
+//
+static void add_config(int32_t parent, const run_t *run)
+{
+    uint32_t key = config_key();
+    uint32_t slot = (key * 2654435761UL) % CONFIG_TABLE_SIZE;
+    int32_t index;
+
+    lock();
+
+    while ((index = shared->config_table[slot]) >= 0)
+    {
+        if (shared->configs[index].key == key)
+        {
+            unlock();
+            return;
+        }
+
+        slot = (slot + 1) % CONFIG_TABLE_SIZE;
+    }
+
+    if (shared->num_configs >= MAX_CONFIGS)
+    {
+        unlock();
+        fail("more configurations than MAX_CONFIGS");
+        return;
+    }
+
+    index = (int32_t)shared->num_configs;
+
+    config_t *config = &shared->configs[index];
+
+    config->key = key;
+    config->parent = parent;
+    config->held_vector = held_vector;
+
+    if (run != NULL)
+    {
+        config->run = *run;
+    }
+
+    snapshot_save(config->snapshot);
+
+    shared->config_table[slot] = index;
+    shared->num_configs++;
+
+    unlock();
+}
+
+
+//=============================================================================
+//
+// do_run(): From a configuration, one run, then adds where it
+// settles.
+//
+//=============================================================================
+//
+static void do_run(int32_t config_index, const run_t *run)
+{
+    const config_t *config = &shared->configs[config_index];
+    uint16_t changed;
+
+    snapshot_restore(config->snapshot);
+
+    current_config = config_index;
+    current_run = run;
+
+    switch (run->kind)
+    {
+    case RUN_HOLD:
+        if (!settle(run->vector))
+        {
+            return;
+        }
+        break;
+
+    case RUN_GLITCH:
+        changed = (uint16_t)(run->vector ^ (1U << run->bit));
+        run_loops(changed, 1);
+
+        if (!settle(run->vector))
+        {
+            return;
+        }
+        break;
+
+    case RUN_INTERRUPT:
+        changed = (uint16_t)(run->vector ^ (1U << run->bit));
+        run_loops(run->vector, run->loops);
+
+        if (!settle(changed))
+        {
+            return;
+        }
+        break;
+    }
+
+    __atomic_fetch_add(&shared->runs, 1, __ATOMIC_RELAXED);
+    add_config(config_index, run);
+}
+
+
+//=============================================================================
+//
+// do_item(): One block of the runs from a configuration. The
+// interrupts restore the parent of the configuration, and rerun the
+// vector that reached it.
+//
+//=============================================================================
+//
+static void do_item(uint32_t item)
+{
+    int32_t config_index = (int32_t)(item / ITEMS_PER_CONFIG);
+    uint32_t block = item % ITEMS_PER_CONFIG;
+    const config_t *config = &shared->configs[config_index];
+    run_t run;
+    uint32_t vector;
+    uint8_t bit;
+    uint8_t i;
+
+    if (block < ITEMS_PER_CONFIG - 1)
+    {
+        run.kind = RUN_HOLD;
+        run.bit = 0;
+        run.loops = 0;
+
+        for (vector = block * VECTORS_PER_ITEM;
+             vector < (block + 1) * VECTORS_PER_ITEM;
+             vector++)
+        {
+            run.vector = (uint16_t)vector;
+            do_run(config_index, &run);
+        }
+
+        return;
+    }
+
+    run.kind = RUN_GLITCH;
+    run.vector = config->held_vector;
+    run.loops = 1;
+
+    for (bit = 0; bit < NUM_INPUT_BITS; bit++)
+    {
+        run.bit = bit;
+        do_run(config_index, &run);
+    }
+
+    if (config->parent < 0)
+    {
+        return;
+    }
+
+    run.kind = RUN_INTERRUPT;
+    run.vector = config->held_vector;
+
+    for (i = 0; i < NUM_INTERRUPT_LOOPS; i++)
+    {
+        run.loops = interrupt_loops[i];
+
+        for (bit = 0; bit < NUM_INPUT_BITS; bit++)
+        {
+            run.bit = bit;
+            do_run(config->parent, &run);
+        }
+    }
+}
+
+
+//=============================================================================
+//
+// worker(): Takes items until every configuration has been run from
+// and no other worker can add more.
+//
+//=============================================================================
+//
+static void worker(void)
+{
+    for (;;)
+    {
+        uint32_t item;
+
+        lock();
+
+        if (shared->next_item < shared->num_configs * ITEMS_PER_CONFIG)
+        {
+            item = shared->next_item++;
+            shared->busy_workers++;
+            unlock();
+
+            do_item(item);
+
+            lock();
+            shared->busy_workers--;
+            unlock();
+        }
+        else if (shared->busy_workers == 0)
+        {
+            unlock();
+            return;
+        }
+        else
+        {
+            unlock();
+            usleep(100);
+        }
+    }
+}
+
+
+//=============================================================================
+//
+// check_coverage(): Every transition to another state, out of a
+// state that was reached, must have been taken.
+//
+//=============================================================================
+//
+static void check_coverage(void)
+{
+    uint8_t i;
+    uint8_t j;
+    uint8_t state;
+    uint8_t taken = 0;
+    uint8_t possible = 0;
+
+    for (i = 0; i < SM_NUM_TRANSITIONS; i++)
+    {
+        const state_transition_t *transition = &sm_transition_table[i];
+
+        if ((transition->from == transition->to) ||
+            !shared->state_reached[transition->from])
+        {
+            continue;
+        }
+
+        possible++;
+
+        if (shared->transition_taken[transition->from][transition->to])
+        {
+            taken++;
+        }
+        else
+        {
+            printf("FAIL transition %d -> %d never taken\n",
+                   (int)transition->from, (int)transition->to);
+            shared->failures++;
+        }
+    }
+
+    printf("state_machine_test: %lu configurations, %lu runs, %llu loops\n",
+           (unsigned long)shared->num_configs,
+           (unsigned long)shared->runs,
+           (unsigned long long)shared->loops);
+
+    printf("state_machine_test: %u of %u transitions taken\n", taken, possible);
+
+    printf("state_machine_test: positive contactor closed %lu times, "
+           "%lu precharge failures\n",
+           (unsigned long)shared->pos_contactor_closes,
+           (unsigned long)shared->precharge_failures);
+
+    if ((shared->pos_contactor_closes == 0) || (shared->precharge_failures == 0))
+    {
+        printf("FAIL the contactors were not exercised\n");
+        shared->failures++;
+    }
+
+    printf("state_machine_test: contactor commands (neg pos pre) seen:");
+
+    for (i = 0; i < 8; i++)
+    {
+        for (j = 0; j < 8; j++)
+        {
+            if (shared->command_change_seen[i][j])
+            {
+                printf(" %u%u%u->%u%u%u",
+                       (i >> 2) & 1, (i >> 1) & 1, i & 1,
+                       (j >> 2) & 1, (j >> 1) & 1, j & 1);
+            }
+        }
+    }
+
+    printf("\n");
+
+    for (state = 0; state < NUM_STATES; state++)
+    {
+        if (!shared->state_reached[state])
+        {
+            printf("state_machine_test: state %u never reached, "
+                   "no transition leads to it\n", state);
+        }
+    }
+
+    for (i = 0; i < shared->num_cycles; i++)
+    {
+        const cycle_t *cycle = &shared->cycles[i];
+
+        printf("state_machine_test: cycle of states");
+
+        for (state = 0; state < NUM_STATES; state++)
+        {
+            if (cycle->states & (1U << state))
+            {
+                printf(" %u", state);
+            }
+        }
+
+        printf(" with 0x%04x held, after\n", cycle->vector);
+        print_path(cycle->config);
+        print_run(&cycle->run);
+    }
+}
+
+
+//=============================================================================
+//
+// main()
+//
+//=============================================================================
+//
+int main(int argc, char *argv[])
+{
+    long workers = sysconf(_SC_NPROCESSORS_ONLN);
+    long i;
+    bool_t worker_failed = FALSE;
+
+    if (argc > 1)
+    {
+        workers = atol(argv[1]);
+    }
+
+    if (workers < 1)
+    {
+        workers = 1;
+    }
+
+    shared = mmap(NULL, sizeof(shared_t), PROT_READ | PROT_WRITE,
+                  MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+
+    if (shared == MAP_FAILED)
+    {
+        printf("state_machine_test: no shared memory\n");
+        return EXIT_FAILURE;
+    }
+
+    if (snapshot_size() > MAX_SNAPSHOT_BYTES)
+    {
+        printf("state_machine_test: %lu bytes of memory, MAX_SNAPSHOT_BYTES "
+               "is too small\n", (unsigned long)snapshot_size());
+        return EXIT_FAILURE;
+    }
+
+    memset(shared->config_table, 0xFF, sizeof(shared->config_table));
+
+    time_service_set_clock_source(NULL);
+
+    //
+    // Everything off.
+    //
+    if (!settle(0))
+    {
+        return EXIT_FAILURE;
+    }
+
+    add_config(-1, NULL);
+
+    fflush(stdout);
+
+    for (i = 0; i < workers; i++)
+    {
+        pid_t pid = fork();
+
+        if (pid == 0)
+        {
+            worker();
+            fflush(stdout);
+            _exit(0);
+        }
+
+        if (pid < 0)
+        {
+            printf("state_machine_test: fork failed\n");
+            worker_failed = TRUE;
+            break;
+        }
+    }
+
+    for (;;)
+    {
+        int status;
+
+        if (wait(&status) < 0)
+        {
+            break;
+        }
+
+        if (!WIFEXITED(status) || (WEXITSTATUS(status) != 0))
+        {
+            worker_failed = TRUE;
+        }
+    }
+
+    if (worker_failed)
+    {
+        printf("FAIL a worker did not finish\n");
+        shared->failures++;
+    }
+
+    printf("state_machine_test: %ld workers\n", workers);
+    check_coverage();
+
+    if (shared->failures != 0)
+    {
+        printf("state_machine_test: %lu failures\n",
+               (unsigned long)shared->failures);
+        return EXIT_FAILURE;
+    }
+
+    printf("state_machine_test: passed\n");
+    return EXIT_SUCCESS;
+}
+
+#endif // FVT_HOST_TEST
@@ -0,0 +1,394 @@
+/******************************************************************************
+ *
+ *        Name: throttle_pipeline_test.c
+ *
+ * Description: Host test of the fixed point throttle pipeline against
+ *              the floating point lines it replaced. Runs the real
+ *              throttle_pipeline.c over every 12 bit reading of the
+ *              pedal. Checks:
+ *
+ *              - uncalibrated, the steady state demand is the percent
+ *                of the old inverter_throttle_control() line,
+ *                0.03278x - 22.95. It may only be one percent lower,
+ *                where the float line is within
+ *                BOUNDARY_TOLERANCE_PERCENT of a whole percent.
+ *              - calibrated from EEVAR_THROTTLE_RELEASED/DEPRESSED,
+ *                including a pedal that reads lower when depressed,
+ *                the position is within one Q15 LSB of the float
+ *                calibration, and is 0 and full travel at the ends.
+ *              - a step of the pedal settles on the position exactly,
+ *                and reaches 98% within STEP_LOOPS loops.
+ *
+ *              It also times the float line and the pipeline on the
+ *              host. The host has a hardware FPU, so the times are
+ *              reported but not checked.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+
+#ifdef FVT_HOST_TEST
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "Prototypes.h"
+#include "Constants.h"
+#include "typedefs.h"
+#include "cvc_input_control.h"
+#include "throttle_pipeline.h"
+
+#define NUM_READINGS                4096
+
+//
+// A reading the pipeline rounds down to the percent below the float
+// line must have the float line this close above a whole percent.
+//
+#define BOUNDARY_TOLERANCE_PERCENT  0.01
+
+#define SETTLE_LOOPS                40
+#define STEP_LOOPS                  6
+
+#define TIMING_CALLS                2000000
+
+typedef struct
+{
+    const char *name;
+    uint16_t released;
+    uint16_t depressed;
+} calibration_t;
+
+static const calibration_t calibrations[] =
+{
+    { "625 - 3846",   625,  3846 },
+    { "3846 - 625",   3846, 625  },
+    { "400 - 3000",   400,  3000 },
+    { "1000 - 1300",  1000, 1300 },
+    { "4000 - 100",   4000, 100  }
+};
+
+static uint16_t pedal_reading = 0;
+static uint16_t failures = 0;
+
+
+//=============================================================================
+//
+// Stand-in for the CVC input snapshot.
+//
+//=============================================================================
+//
+uint16_t cvc_input_get_analog(cvc_analog_input_t input)
+{
+    (void)input;
+
+    return pedal_reading;
+}
+
+
+//=============================================================================
+//
+// float_line_percent(): inverter_throttle_control() before the
+// pipeline. A negative result is 0, as the clamp below it intended.
+//
+//=============================================================================
+//
+static double float_line(uint16_t analog_reading)
+{
+    return (analog_reading * 0.03278) - 22.95;
+}
+
+static uint16_t float_line_percent(uint16_t analog_reading)
+{
+    double line = float_line(analog_reading);
+
+    if (line <= 0)
+    {
+        return 0;
+    }
+
+    uint16_t throttle_percent = (uint16_t)line;
+
+    if (throttle_percent > 100)
+    {
+        throttle_percent = 100;
+    }
+
+    return throttle_percent;
+}
+
+
+//=============================================================================
+//
+// fail()
+//
+//=============================================================================
+//
+static void fail(const char *test, uint16_t reading, const char *what)
+{
+    printf("FAIL %-14s reading %4u: %s\n", test, reading, what);
+    failures++;
+}
+
+
+//=============================================================================
+//
+// settle(): Holds the pedal at a reading until the filter has
+// settled.
+//
+//=============================================================================
+//
+static void settle(uint16_t reading)
+{
+    uint16_t i;
+
+    pedal_reading = reading;
+
+    for (i = 0; i < SETTLE_LOOPS; i++)
+    {
+        throttle_pipeline_update();
+    }
+}
+
+
+//=============================================================================
+//
+// set_calibration()
+//
+//=============================================================================
+//
+static void set_calibration(uint16_t released, uint16_t depressed)
+{
+    EEVAR_THROTTLE_RELEASED = released;
+    EEVAR_THROTTLE_DEPRESSED = depressed;
+}
+
+
+//=============================================================================
+//
+// test_uncalibrated()
+//
+//=============================================================================
+//
+static void test_uncalibrated(void)
+{
+    const char *test = "uncalibrated";
+    uint16_t reading;
+
+    set_calibration(0, 0);
+
+    for (reading = 0; reading < NUM_READINGS; reading++)
+    {
+        uint16_t expected = float_line_percent(reading);
+        uint16_t percent;
+
+        settle(reading);
+        percent = throttle_pipeline_get_percent();
+
+        if (percent == expected)
+        {
+            continue;
+        }
+
+        double above = float_line(reading) - expected;
+
+        if ((percent + 1 != expected) || (above > BOUNDARY_TOLERANCE_PERCENT))
+        {
+            printf("     %u%%, float line %.4f%%\n", percent, float_line(reading));
+            fail(test, reading, "not the percent of the float line");
+        }
+    }
+}
+
+
+//=============================================================================
+//
+// test_calibrated()
+//
+//=============================================================================
+//
+static void test_calibrated(const calibration_t *calibration)
+{
+    int32_t reading;
+
+    set_calibration(calibration->released, calibration->depressed);
+
+    for (reading = 0; reading < NUM_READINGS; reading++)
+    {
+        double position = ((double)reading - calibration->released) /
+                          ((double)calibration->depressed - calibration->released);
+        double expected;
+        double error;
+
+        if (position < 0)
+        {
+            position = 0;
+        }
+
+        if (position > 1)
+        {
+            position = 1;
+        }
+
+        expected = position * THROTTLE_Q15_ONE;
+        error = throttle_pipeline_get_position_q15((uint16_t)reading) - expected;
+
+        if ((error > 1.0) || (error < -1.0))
+        {
+            printf("     Q15 %u, float %.2f\n",
+                   throttle_pipeline_get_position_q15((uint16_t)reading),
+                   expected);
+            fail(calibration->name, (uint16_t)reading, "position off the float calibration");
+        }
+    }
+
+    if (throttle_pipeline_get_position_q15(calibration->released) != 0)
+    {
+        fail(calibration->name, calibration->released, "released is not 0");
+    }
+
+    if (throttle_pipeline_get_position_q15(calibration->depressed) != THROTTLE_Q15_ONE)
+    {
+        fail(calibration->name, calibration->depressed, "depressed is not full travel");
+    }
+}
+
+
+//=============================================================================
+//
+// test_step(): Released to fully depressed and back.
+//
+//=============================================================================
+//
+static void test_step(void)
+{
+    const char *test = "step";
+    uint16_t i;
+
+    set_calibration(625, 3846);
+    settle(625);
+
+    if (throttle_pipeline_get_demand_q15() != 0)
+    {
+        fail(test, 625, "released did not settle on 0");
+    }
+
+    pedal_reading = 3846;
+
+    for (i = 0; i < STEP_LOOPS; i++)
+    {
+        throttle_pipeline_update();
+    }
+
+    if (throttle_pipeline_get_percent() < 98)
+    {
+        fail(test, 3846, "slower than STEP_LOOPS to 98%");
+    }
+
+    settle(3846);
+
+    if (throttle_pipeline_get_demand_q15() != THROTTLE_Q15_ONE)
+    {
+        fail(test, 3846, "did not settle on full travel");
+    }
+
+    settle(625);
+
+    if (throttle_pipeline_get_demand_q15() != 0)
+    {
+        fail(test, 625, "did not settle back on 0");
+    }
+}
+
+
+//=============================================================================
+//
+// elapsed_ns()
+//
+//=============================================================================
+//
+static double elapsed_ns(const struct timespec *start, const struct timespec *end)
+{
+    return (end->tv_sec - start->tv_sec) * 1e9 + (end->tv_nsec - start->tv_nsec);
+}
+
+
+//=============================================================================
+//
+// report_timing(): A loop of the float line against a loop of the
+// pipeline, over the readings in turn.
+//
+//=============================================================================
+//
+static void report_timing(void)
+{
+    struct timespec start;
+    struct timespec end;
+    volatile uint16_t sink = 0;
+    uint32_t i;
+    double float_ns;
+    double pipeline_ns;
+
+    set_calibration(0, 0);
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    for (i = 0; i < TIMING_CALLS; i++)
+    {
+        sink = float_line_percent((uint16_t)(i & (NUM_READINGS - 1)));
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    float_ns = elapsed_ns(&start, &end) / TIMING_CALLS;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    for (i = 0; i < TIMING_CALLS; i++)
+    {
+        pedal_reading = (uint16_t)(i & (NUM_READINGS - 1));
+        throttle_pipeline_update();
+        sink = throttle_pipeline_get_percent();
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    pipeline_ns = elapsed_ns(&start, &end) / TIMING_CALLS;
+
+    (void)sink;
+
+    printf("     host: float line %.1f ns, Q15 pipeline %.1f ns a loop\n",
+           float_ns, pipeline_ns);
+}
+
+
+//=============================================================================
+//
+// main()
+//
+//=============================================================================
+//
+int main(void)
+{
+    uint8_t i;
+
+    test_uncalibrated();
+
+    for (i = 0; i < (sizeof(calibrations) / sizeof(calibrations[0])); i++)
+    {
+        test_calibrated(&calibrations[i]);
+    }
+
+    test_step();
+    report_timing();
+
+    if (failures != 0)
+    {
+        printf("throttle_pipeline_test: %u failures\n", failures);
+        return EXIT_FAILURE;
+    }
+
+    printf("throttle_pipeline_test: passed\n");
+    return EXIT_SUCCESS;
+}
+
+#endif // FVT_HOST_TEST
@@ -0,0 +1,299 @@
+/******************************************************************************
+ *
+ *        Name: timer_service_test.c
+ *
+ * Description: Host test of the millisecond timers. Runs the real
+ *              time_service.c and timer_service.c on a host clock
+ *              stepping at a 5, 10 and 20 ms loop period, and on a
+ *              jittery 5/15 ms loop, and checks the timers expire
+ *              after the same elapsed time at each. Also checks
+ *              TIMER_INIT_MS() gives the timer timer_setup_ms() does.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+
+#ifdef FVT_HOST_TEST
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include "Prototypes.h"
+#include "Constants.h"
+#include "typedefs.h"
+#include "can_service.h"
+#include "time_service.h"
+#include "timer_service.h"
+#include "host_stubs.h"
+
+#define RISING_PERIOD_MS    5000
+#define FALLING_PERIOD_MS   1500
+#define PULSE_PERIOD_MS     10000
+
+//
+// Loop steps of a run, repeated until the run ends.
+//
+typedef struct
+{
+    const char *name;
+    const uint16_t *steps;
+    uint8_t step_count;
+    uint16_t max_step;
+} loop_profile_t;
+
+static const uint16_t steps_5[] = { 5 };
+static const uint16_t steps_10[] = { 10 };
+static const uint16_t steps_20[] = { 20 };
+static const uint16_t steps_jitter[] = { 5, 15 };
+
+static const loop_profile_t profiles[] =
+{
+    { "5 ms",     steps_5,      1, 5  },
+    { "10 ms",    steps_10,     1, 10 },
+    { "20 ms",    steps_20,     1, 20 },
+    { "5/15 ms",  steps_jitter, 2, 15 }
+};
+
+static uint8_t step_index = 0;
+static uint16_t failures = 0;
+
+//
+// Static timers, to be compared with timer_setup_ms().
+//
+static timer_t init_rising = TIMER_INIT_MS(RISING_PERIOD_MS, RISING);
+static timer_t init_falling = TIMER_INIT_MS(FALLING_PERIOD_MS, FALLING);
+static timer_t init_pulse = TIMER_INIT_MS(PULSE_PERIOD_MS, PULSE);
+
+
+//=============================================================================
+//
+// HED library stand-in. Diagnostics go to stdout instead of CAN.
+//
+//=============================================================================
+//
+int canPrintf(
+    uint8_t module_id,
+    CANLINE_ can_line,
+    uint32_t can_id,
+    char *format, ...)
+{
+    va_list args;
+    int length;
+
+    (void)module_id;
+    (void)can_line;
+    (void)can_id;
+
+    va_start(args, format);
+    length = vprintf(format, args);
+    va_end(args);
+
+    return length;
+}
+
+
+//=============================================================================
+//
+// run_loop(): Advances the host clock by the next step of the
+// profile and runs the top of User_App().
+//
+//=============================================================================
+//
+static void run_loop(const loop_profile_t *profile)
+{
+    host_clock_ms += profile->steps[step_index];
+    step_index = (step_index + 1) % profile->step_count;
+
+    time_service_update();
+}
+
+
+//=============================================================================
+//
+// start_run(): Switches to the host clock. The first sample counts as
+// one nominal loop, HOST_LOOP_MS, so it is taken before anything is
+// measured.
+//
+//=============================================================================
+//
+static void start_run(const loop_profile_t *profile)
+{
+    step_index = 0;
+    host_clock_start();
+    run_loop(profile);
+}
+
+
+//=============================================================================
+//
+// check_delay(): An input is seen one loop after it changes, so a
+// delay measured from the last loop before the change is the period,
+// plus up to one loop when the steps do not divide the period.
+//
+//=============================================================================
+//
+static void check_delay(const loop_profile_t *profile,
+                        const char *what,
+                        uint32_t delay_ms,
+                        uint32_t period_ms)
+{
+    if ((delay_ms < period_ms) || (delay_ms >= (period_ms + profile->max_step)))
+    {
+        printf("FAIL %-8s %-20s %lu ms, expected %lu ms\n",
+               profile->name,
+               what,
+               (unsigned long)delay_ms,
+               (unsigned long)period_ms);
+        failures++;
+    }
+}
+
+
+//=============================================================================
+//
+// test_rising()
+//
+//=============================================================================
+//
+static void test_rising(const loop_profile_t *profile)
+{
+    timer_t timer = timer_setup_ms(RISING_PERIOD_MS, RISING);
+    uint32_t input_low_ms;
+
+    start_run(profile);
+    timer_operate(&timer, FALSE);
+    input_low_ms = time_service_get_ms();
+
+    do
+    {
+        run_loop(profile);
+    }
+    while (timer_operate(&timer, TRUE) == FALSE);
+
+    check_delay(profile, "RISING",
+                time_service_ms_since(input_low_ms), RISING_PERIOD_MS);
+}
+
+
+//=============================================================================
+//
+// test_falling()
+//
+//=============================================================================
+//
+static void test_falling(const loop_profile_t *profile)
+{
+    timer_t timer = timer_setup_ms(FALLING_PERIOD_MS, FALLING);
+    uint32_t input_high_ms;
+
+    start_run(profile);
+    timer_operate(&timer, TRUE);
+    input_high_ms = time_service_get_ms();
+
+    do
+    {
+        run_loop(profile);
+    }
+    while (timer_operate(&timer, FALSE) == TRUE);
+
+    check_delay(profile, "FALLING",
+                time_service_ms_since(input_high_ms), FALLING_PERIOD_MS);
+}
+
+
+//=============================================================================
+//
+// test_pulse(): The width of the pulse, from the first loop it is
+// high to the first loop it is low again.
+//
+//=============================================================================
+//
+static void test_pulse(const loop_profile_t *profile)
+{
+    timer_t timer = timer_setup_ms(PULSE_PERIOD_MS, PULSE);
+    uint32_t high_ms;
+
+    start_run(profile);
+    timer_operate(&timer, FALSE);
+    run_loop(profile);
+
+    if (timer_operate(&timer, TRUE) == FALSE)
+    {
+        printf("FAIL %-8s %-20s did not start\n", profile->name, "PULSE");
+        failures++;
+        return;
+    }
+
+    high_ms = time_service_get_ms();
+
+    do
+    {
+        run_loop(profile);
+    }
+    while (timer_operate(&timer, TRUE) == TRUE);
+
+    check_delay(profile, "PULSE",
+                time_service_ms_since(high_ms), PULSE_PERIOD_MS);
+}
+
+
+//=============================================================================
+//
+// check_init(): A static timer against the one timer_setup_ms()
+// returns.
+//
+//=============================================================================
+//
+static void check_init(const char *what,
+                       const timer_t *timer,
+                       uint32_t period_ms,
+                       timer_type_t timer_type)
+{
+    timer_t expected = timer_setup_ms(period_ms, timer_type);
+
+    if ((timer->period != expected.period) ||
+        (timer->counter != expected.counter) ||
+        (timer->type != expected.type) ||
+        (timer->units != expected.units))
+    {
+        printf("FAIL %-8s %-20s not the timer_setup_ms() timer\n",
+               "static", what);
+        failures++;
+    }
+}
+
+
+//=============================================================================
+//
+// main()
+//
+//=============================================================================
+//
+int main(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < (sizeof(profiles) / sizeof(profiles[0])); i++)
+    {
+        test_rising(&profiles[i]);
+        test_falling(&profiles[i]);
+        test_pulse(&profiles[i]);
+    }
+
+    check_init("TIMER_INIT_MS RISING", &init_rising, RISING_PERIOD_MS, RISING);
+    check_init("TIMER_INIT_MS FALLING", &init_falling, FALLING_PERIOD_MS, FALLING);
+    check_init("TIMER_INIT_MS PULSE", &init_pulse, PULSE_PERIOD_MS, PULSE);
+
+    if (failures != 0)
+    {
+        printf("timer_service_test: %u failures\n", failures);
+        return EXIT_FAILURE;
+    }
+
+    printf("timer_service_test: passed\n");
+    return EXIT_SUCCESS;
+}
+
+#endif // FVT_HOST_TEST
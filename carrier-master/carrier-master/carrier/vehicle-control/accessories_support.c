@@ -29,6 +29,7 @@
 #include "accessories_support.h"
 #include "hydraulic_system.h"
 #include "timer_service.h"
+#include "time_service.h"
 #include "orion_control.h"
 #include "gears_and_transmission.h"
 #include "fvt_library.h"
@@ -38,6 +39,8 @@
 #include "pku2400_device.h"
 
 #define ENABLE_BALANCING_CURRENT_LIMIT 30
+#define SHUTTLE_SHIFT_TIME_MS 5000
+#define ODOMETER_TALLY_MS 250
 
 static OUTPUT_STATUS_ turn_on_balancing_signal_control();
 static OUTPUT_STATUS_ low_accum_light_control();
@@ -94,7 +97,7 @@ void accessories_support()
 
     static bool_t keyswitch_firstpass = FALSE;
 
-    if(IN_A11_keyswitch < 4000)
+    if(cvc_input_get_analog(CVC_AIN_A11_KEYSWITCH) < 4000)
     {
 
         disable_outputs();
@@ -200,8 +203,9 @@ void estop_led_control()
     //
     state_t sm_state = get_sm_current_state();
 
-    if(sm_state == E_STOP || !(IN_A16_dash_e_stop_signal == INPUT_ON)
-       || !(IN_A17_charge_box_e_stop_signal == INPUT_ON))
+    if(sm_state == E_STOP
+       || !(cvc_input_get_digital(CVC_DIN_A16_DASH_E_STOP) == INPUT_ON)
+       || !(cvc_input_get_digital(CVC_DIN_A17_CHARGE_BOX_E_STOP) == INPUT_ON))
     {
         //
         // If Estop is pressed, Blink the LEDs
@@ -366,7 +370,7 @@ void status_led_signal_control()
     // Enable the Green Led in the Low Voltage Cab if there are
     //
 
-    if(check_critical_fault_high_voltage_off() && sm_state == CRITICAL_FAILURE_HV_OFF)
+    if((get_critical_fault_hv_off() != 0) && sm_state == CRITICAL_FAILURE_HV_OFF)
     {
         //
         // If a critical error has occured. Enable the red led and
@@ -386,7 +390,7 @@ void status_led_signal_control()
         //
         Update_Output(OUT_B02_status_bicolor_green_led, OUTPUT_ON);
 
-        if(IN_A11_keyswitch < 12000)
+        if(cvc_input_get_analog(CVC_AIN_A11_KEYSWITCH) < 12000)
         {
             //
             // Will turn the led yellow, indicating the 12V battery is
@@ -566,24 +570,12 @@ static OUTPUT_STATUS_ seat_belt_buzzer_pwr_control()
 static OUTPUT_STATUS_ aba_brake_button_led_pwr_control()
 {
 
-    static timer_t shuttle_shift_timer;
-    static bool_t first_pass = TRUE;
+    static timer_t shuttle_shift_timer =
+        TIMER_INIT_MS(SHUTTLE_SHIFT_TIME_MS, FALLING);
     static bool_t shuttle_shift = FALSE;
     static bool_t set_bit = FALSE;
     static bool_t reset_bit = FALSE;
 
-    if(first_pass)
-    {
-        //
-        // Initialize Timer
-        //
-        shuttle_shift_timer =
-            timer_setup(get_FIVE_SECONDS(), FALLING);
-
-        first_pass = FALSE;
-
-    }
-
     //
     // Check to see if the state machine is in brakes desired state.
     //
@@ -617,9 +609,11 @@ static OUTPUT_STATUS_ aba_brake_button_led_pwr_control()
         (direction == SHIFTER_FORWARD)
         || (direction == SHIFTER_REVERSE));
 
-    set_bit = (sm_brakes_desired || (IN_C15_aba_brake_button_signal == INPUT_OFF) || !shuttle_shift);
+    set_bit = (sm_brakes_desired
+               || (cvc_input_get_digital(CVC_DIN_C15_ABA_BRAKE_BUTTON) == INPUT_OFF)
+               || !shuttle_shift);
 
-    reset_bit = (IN_C16_aba_brake_momentary_signal == INPUT_ON
+    reset_bit = (cvc_input_get_digital(CVC_DIN_C16_ABA_BRAKE_MOMENTARY) == INPUT_ON
                  && (front_accum_pressure > 1150)
                  && (rear_accum_pressure > 1150)
                  && (transmission_pressure > 175));
@@ -772,9 +766,9 @@ void odometer_calculate()
     static uint16_t running_cm_counter          = 0;
 
     //
-    // A counter to keep track of how long it's been.
+    // The time the distance was last tallied, ms.
     //
-    static uint16_t time_interval_counter       = 1;
+    static uint32_t last_tally_ms               = 0;
 
     //
     // status of HV on the system
@@ -827,17 +821,26 @@ void odometer_calculate()
     }
 
     //
-    // Decrement the counter, and if it's zero, tally the cm travelled
+    // Every 250 msecs of elapsed time, tally the cm travelled. The
+    // tally time steps by 250 msecs, so the loop period does not
+    // stretch the interval. After a stall it restarts from now.
     //
-    if (--time_interval_counter == 0)
+    if (time_service_ms_since(last_tally_ms) >= ODOMETER_TALLY_MS)
     {
 
         //
         // The number of cm travelled in the last 250 msecs.
         //
         uint16_t cm_travelled_in_250_msecs   = 0;
-        time_interval_counter =
-            get_TWO_HUNDRED_FIFTY_MSECS();
+
+        if (time_service_ms_since(last_tally_ms) >= (2 * ODOMETER_TALLY_MS))
+        {
+            last_tally_ms = time_service_get_ms();
+        }
+        else
+        {
+            last_tally_ms += ODOMETER_TALLY_MS;
+        }
 
         // Calculate the distance travelled in the last 250msecs based
         // on current speed
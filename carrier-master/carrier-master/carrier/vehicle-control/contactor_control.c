@@ -8,6 +8,21 @@
  *              machine. The state machine getters determine the
  *              opening and closing of contactors on the carrier.
  *
+ *              The battery packs and their contactor outputs are
+ *              listed in battery_pack_contactors[]. The number of
+ *              packs is the number of rows in the table.
+ *
+ *              The contactors of every pack follow the state
+ *              machine, but each pack runs its connect sequence
+ *              (negative, precharge, positive) PACK_CONNECT_STAGGER_MS
+ *              after the pack before it in the table, so the inrush of
+ *              each step is taken one pack at a time. Contactors
+ *              always open at once. A pack after the first only
+ *              starts its sequence if its voltage matches the voltage
+ *              of the first pack. A pack that does not match stays
+ *              disconnected until the state machine has opened every
+ *              contactor.
+ *
  *      Author: Deepak
  *        Date: Tuesday, 10 September 2019
  *
@@ -19,259 +34,296 @@
 #include "Prototypes.h"
 #include "contactor_control.h"
 #include "state_machine.h"
+#include "orion_control.h"
+#include "time_service.h"
+#include "emergency_stop.h"
 
-#define MAX_BATTERY_PACKS 3
+//
+// Time between two packs closing the same contactor.
+//
+#define PACK_CONNECT_STAGGER_MS 50
 
-static void positive_contactor_control(bool_t startup_timer);
-static void negative_contactor_control(bool_t startup_timer);
-static void precharge_contactor_control(bool_t startup_timer);
+//
+// Every contactor output is written this many times per loop, as a
+// potential fix for an unknown, possibly electrical, issue on the
+// carrier.
+//
+#define CONTACTOR_OUTPUT_WRITES 4
 
-/******************************************************************************
- *
- *        Name: contactor_control()
- *
- * Description: The contactor_control function controls the working of
- *              the contactors on the carrier. The input to the
- *              contactor control is obtained from the state
- *              machine. The state machine getters determine the
- *              opening and closing of contactors on the carrier.
- *
- *        Date: Tuesday, 10 September 2019
- *
- ******************************************************************************
- */
-void update_contactor_control_output(bool_t startup_timer)
+//
+// A CVC output. The OUT_ names in Constants.h expand to the module id
+// and the output number, so they can be used to initialise this.
+//
+typedef struct
 {
+    uint8_t module_id;
+    uint8_t number;
+} cvc_output_t;
 
-    //
-    // Positive Contactor Control
-    //
-    positive_contactor_control(startup_timer);
-
-    //
-    // Negative Contactor Control
-    //
-    negative_contactor_control(startup_timer);
-
-    //
-    // Precharge Contactor Control
-    //
-    precharge_contactor_control(startup_timer);
-
-}
-
-
-/******************************************************************************
- *
- *        Name: positive_contactor_control()
- *
- * Description: Enables/disables the contactor based on input from
- *              state machine
- *
- * The positive and precharge connectors are swapped on this battery
- * pack.
- *
- *        Date: Tuesday, 10 September 2019
- *
- ******************************************************************************
- */
-static void positive_contactor_control(bool_t startup_timer)
+typedef struct
 {
+    device_instances_t bms;
+    cvc_output_t positive_contactor;
+    cvc_output_t negative_contactor;
+    cvc_output_t precharge_contactor;
+} battery_pack_contactors_t;
 
-    //
-    // Check the status of the pos_contactor variable in the state
-    // machine. Use the status bit to control the working of the
-    // contactor based on the result from the function call.
-    //
-    bool_t sm_positive_contactor_state =
-         get_sm_pos_contactor_status();
-
-    if ((sm_positive_contactor_state == TRUE) && startup_timer)
+//
+// The positive and precharge connectors are swapped on this battery
+// pack.
+//
+static const battery_pack_contactors_t battery_pack_contactors[] =
+{
     {
-
-        Update_Output(OUT_D01_battery_1_positive_contactor, OUTPUT_ON);
-        Update_Output(OUT_D04_battery_2_positive_contactor, OUTPUT_ON);
-        Update_Output(OUT_D10_battery_3_positive_contactor, OUTPUT_ON);
-
-        Update_Output(OUT_D01_battery_1_positive_contactor, OUTPUT_ON);
-        Update_Output(OUT_D04_battery_2_positive_contactor, OUTPUT_ON);
-        Update_Output(OUT_D10_battery_3_positive_contactor, OUTPUT_ON);
-
-        Update_Output(OUT_D01_battery_1_positive_contactor, OUTPUT_ON);
-        Update_Output(OUT_D04_battery_2_positive_contactor, OUTPUT_ON);
-        Update_Output(OUT_D10_battery_3_positive_contactor, OUTPUT_ON);
-
-        Update_Output(OUT_D01_battery_1_positive_contactor, OUTPUT_ON);
-        Update_Output(OUT_D04_battery_2_positive_contactor, OUTPUT_ON);
-        Update_Output(OUT_D10_battery_3_positive_contactor, OUTPUT_ON);
-
-    }
-    else
+        ONE,
+        { OUT_D01_battery_1_positive_contactor },
+        { OUT_D02_battery_1_negative_contactor },
+        { OUT_D03_battery_1_precharge_contactor },
+    },
     {
+        TWO,
+        { OUT_D04_battery_2_positive_contactor },
+        { OUT_D07_battery_2_negative_contactor },
+        { OUT_D09_battery_2_precharge_contactor },
+    },
+    {
+        THREE,
+        { OUT_D10_battery_3_positive_contactor },
+        { OUT_D13_battery_3_negative_contactor },
+        { OUT_C14_battery_3_precharge_contactor },
+    },
+};
 
-        Update_Output(OUT_D01_battery_1_positive_contactor, OUTPUT_OFF);
-        Update_Output(OUT_D04_battery_2_positive_contactor, OUTPUT_OFF);
-        Update_Output(OUT_D10_battery_3_positive_contactor, OUTPUT_OFF);
-
-        Update_Output(OUT_D01_battery_1_positive_contactor, OUTPUT_OFF);
-        Update_Output(OUT_D04_battery_2_positive_contactor, OUTPUT_OFF);
-        Update_Output(OUT_D10_battery_3_positive_contactor, OUTPUT_OFF);
+#define NUM_BATTERY_PACKS \
+    (sizeof(battery_pack_contactors) / sizeof(battery_pack_contactors[0]))
 
-        Update_Output(OUT_D01_battery_1_positive_contactor, OUTPUT_OFF);
-        Update_Output(OUT_D04_battery_2_positive_contactor, OUTPUT_OFF);
-        Update_Output(OUT_D10_battery_3_positive_contactor, OUTPUT_OFF);
+typedef enum
+{
+    PACK_CONTACTOR_NEGATIVE = 0,
+    PACK_CONTACTOR_PRECHARGE,
+    PACK_CONTACTOR_POSITIVE,
+    NUM_PACK_CONTACTORS
+} pack_contactor_t;
 
-        Update_Output(OUT_D01_battery_1_positive_contactor, OUTPUT_OFF);
-        Update_Output(OUT_D04_battery_2_positive_contactor, OUTPUT_OFF);
-        Update_Output(OUT_D10_battery_3_positive_contactor, OUTPUT_OFF);
+//=============================================================================
+//
+// Static Variables
+//
+//=============================================================================
+//
 
-    }
+//
+// The state machine command for each contactor at the last update,
+// and when it last closed.
+//
+static bool_t command_closed[NUM_PACK_CONTACTORS];
+static uint32_t command_closed_ms[NUM_PACK_CONTACTORS];
 
+//
+// The contactors of each pack, and the packs that are kept out until
+// every contactor has been opened.
+//
+static bool_t pack_contactor_closed[NUM_BATTERY_PACKS][NUM_PACK_CONTACTORS];
+static bool_t pack_excluded[NUM_BATTERY_PACKS];
 
-}
+static void sequence_battery_packs(const bool_t command[NUM_PACK_CONTACTORS]);
+static void write_contactor_outputs();
 
 
 /******************************************************************************
  *
- *        Name: negative_contactor_control()
+ *        Name: update_contactor_control_output()
  *
- * Description: Enables/disables the contactor based on input from
- *              state machine
+ * Description: The contactor_control function controls the working of
+ *              the contactors on the carrier. The input to the
+ *              contactor control is obtained from the state
+ *              machine. The state machine getters determine the
+ *              opening and closing of contactors on the carrier.
  *
  *        Date: Tuesday, 10 September 2019
  *
  ******************************************************************************
  */
-static void negative_contactor_control(bool_t startup_timer)
+void update_contactor_control_output(bool_t startup_timer)
 {
-
     //
-    // Check the status of the pos_contactor variable in the state
-    // machine. Use the status bit to control the working of the
-    // contactor based on the result from the function call.
+    // Check the status of the contactor variables in the state
+    // machine. Use the status bits to control the working of the
+    // contactors. The state machine only moves to E_STOP at the end
+    // of the loop an E-stop is pressed in, so keep the contactors
+    // opened by the fast path open until then.
     //
-    bool_t sm_negative_contactor_state =
-         get_sm_neg_contactor_status();
+    bool_t contactors_allowed =
+        startup_timer && !emergency_stop_get_e_stop();
 
-    if ((sm_negative_contactor_state == TRUE) && startup_timer)
-    {
+    bool_t command[NUM_PACK_CONTACTORS];
 
-        //
-        // Enable Contactors
-        //
-        Update_Output(OUT_D02_battery_1_negative_contactor, OUTPUT_ON);
-        Update_Output(OUT_D07_battery_2_negative_contactor, OUTPUT_ON);
-        Update_Output(OUT_D13_battery_3_negative_contactor, OUTPUT_ON);
-
-        Update_Output(OUT_D02_battery_1_negative_contactor, OUTPUT_ON);
-        Update_Output(OUT_D07_battery_2_negative_contactor, OUTPUT_ON);
-        Update_Output(OUT_D13_battery_3_negative_contactor, OUTPUT_ON);
-
-        Update_Output(OUT_D02_battery_1_negative_contactor, OUTPUT_ON);
-        Update_Output(OUT_D07_battery_2_negative_contactor, OUTPUT_ON);
-        Update_Output(OUT_D13_battery_3_negative_contactor, OUTPUT_ON);
-
-        Update_Output(OUT_D02_battery_1_negative_contactor, OUTPUT_ON);
-        Update_Output(OUT_D07_battery_2_negative_contactor, OUTPUT_ON);
-        Update_Output(OUT_D13_battery_3_negative_contactor, OUTPUT_ON);
+    command[PACK_CONTACTOR_NEGATIVE] =
+        get_sm_neg_contactor_status() && contactors_allowed;
 
-    }
-    else
-    {
+    command[PACK_CONTACTOR_PRECHARGE] =
+        get_sm_pre_contactor_status() && contactors_allowed;
 
-        //
-        // Keeps Contactors Turned OFF
-        //
-        Update_Output(OUT_D02_battery_1_negative_contactor, OUTPUT_OFF);
-        Update_Output(OUT_D07_battery_2_negative_contactor, OUTPUT_OFF);
-        Update_Output(OUT_D13_battery_3_negative_contactor, OUTPUT_OFF);
+    command[PACK_CONTACTOR_POSITIVE] =
+        get_sm_pos_contactor_status() && contactors_allowed;
 
-        Update_Output(OUT_D02_battery_1_negative_contactor, OUTPUT_OFF);
-        Update_Output(OUT_D07_battery_2_negative_contactor, OUTPUT_OFF);
-        Update_Output(OUT_D13_battery_3_negative_contactor, OUTPUT_OFF);
-
-        Update_Output(OUT_D02_battery_1_negative_contactor, OUTPUT_OFF);
-        Update_Output(OUT_D07_battery_2_negative_contactor, OUTPUT_OFF);
-        Update_Output(OUT_D13_battery_3_negative_contactor, OUTPUT_OFF);
-
-        Update_Output(OUT_D02_battery_1_negative_contactor, OUTPUT_OFF);
-        Update_Output(OUT_D07_battery_2_negative_contactor, OUTPUT_OFF);
-        Update_Output(OUT_D13_battery_3_negative_contactor, OUTPUT_OFF);
-
-    }
+    sequence_battery_packs(command);
 
+    write_contactor_outputs();
 }
 
 
 /******************************************************************************
  *
- *        Name: precharge_contactor_control()
+ *        Name: sequence_battery_packs()
  *
- * Description: Enables/disables the contactor based on input from
- *              state machine
+ * Description: Decides which contactors of each pack are closed. A
+ *              pack closes a contactor once the state machine has
+ *              held it closed for PACK_CONNECT_STAGGER_MS times the
+ *              position of the pack in the table, so the first pack
+ *              follows the state machine and every step of the
+ *              sequence of each pack after it is delayed by one more
+ *              stagger. A contactor the state machine opens is opened
+ *              on every pack at once, except the precharge of a pack
+ *              still waiting to close its positive.
  *
- *        Date: Tuesday, 10 September 2019
+ *              A pack after the first is checked against the voltage
+ *              of the first pack before its first contactor closes,
+ *              and is kept out if they do not match.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
  *
  ******************************************************************************
  */
-static void precharge_contactor_control(bool_t startup_timer)
+static void sequence_battery_packs(const bool_t command[NUM_PACK_CONTACTORS])
 {
+    uint32_t now_ms = time_service_get_ms();
+    bool_t any_command = FALSE;
+    uint8_t contactor;
+    uint8_t i;
 
-    //
-    // Check the status of the pos_contactor variable in the state
-    // machine. Use the status bit to control the working of the
-    // contactor based on the result from the function call.
-    //
-    bool_t sm_precharge_contactor_state =
-         get_sm_pre_contactor_status();
-
-    if ((sm_precharge_contactor_state == TRUE) && startup_timer)
+    for (contactor = 0; contactor < NUM_PACK_CONTACTORS; contactor++)
     {
-        //
-        // Writing multiple times as a potential fix for an unknown,
-        // possibly and electrical issue on the carrier.
-        //
-        Update_Output(OUT_D03_battery_1_precharge_contactor, OUTPUT_ON);
-        Update_Output(OUT_D09_battery_2_precharge_contactor, OUTPUT_ON);
-        Update_Output(OUT_C14_battery_3_precharge_contactor, OUTPUT_ON);
-
-        Update_Output(OUT_D03_battery_1_precharge_contactor, OUTPUT_ON);
-        Update_Output(OUT_D09_battery_2_precharge_contactor, OUTPUT_ON);
-        Update_Output(OUT_C14_battery_3_precharge_contactor, OUTPUT_ON);
-
-        Update_Output(OUT_D03_battery_1_precharge_contactor, OUTPUT_ON);
-        Update_Output(OUT_D09_battery_2_precharge_contactor, OUTPUT_ON);
-        Update_Output(OUT_C14_battery_3_precharge_contactor, OUTPUT_ON);
-
-        Update_Output(OUT_D03_battery_1_precharge_contactor, OUTPUT_ON);
-        Update_Output(OUT_D09_battery_2_precharge_contactor, OUTPUT_ON);
-        Update_Output(OUT_C14_battery_3_precharge_contactor, OUTPUT_ON);
+        if (command[contactor] && !command_closed[contactor])
+        {
+            command_closed_ms[contactor] = now_ms;
+        }
 
+        command_closed[contactor] = command[contactor];
+        any_command = any_command || command[contactor];
     }
-    else
+
+    for (i = 0; i < NUM_BATTERY_PACKS; i++)
     {
+        uint32_t stagger_ms = (uint32_t)i * PACK_CONNECT_STAGGER_MS;
+        bool_t sequence_started = FALSE;
+        bool_t precharge_was_closed =
+            pack_contactor_closed[i][PACK_CONTACTOR_PRECHARGE];
+
+        if (!any_command)
+        {
+            pack_excluded[i] = FALSE;
+        }
+
+        for (contactor = 0; contactor < NUM_PACK_CONTACTORS; contactor++)
+        {
+            sequence_started = sequence_started
+                               || pack_contactor_closed[i][contactor];
+        }
+
+        for (contactor = 0; contactor < NUM_PACK_CONTACTORS; contactor++)
+        {
+            bool_t close =
+                command[contactor] &&
+                (time_service_ms_since(command_closed_ms[contactor]) >= stagger_ms);
+
+            if (close && !sequence_started && (i > 0) && !pack_excluded[i])
+            {
+                pack_excluded[i] =
+                    !battery_pack_voltages_matched(battery_pack_contactors[i].bms,
+                                                   battery_pack_contactors[0].bms);
+                sequence_started = TRUE;
+            }
+
+            pack_contactor_closed[i][contactor] = close && !pack_excluded[i];
+        }
+
         //
-        // Writing multiple times as a potential fix for an unknown,
-        // possibly and electrical issue on the carrier.
+        // The state machine opens the precharge as it closes the
+        // positive. A pack whose positive is still waiting for its
+        // stagger keeps its precharge closed until then, so it is not
+        // left off the bus in between.
         //
-        Update_Output(OUT_D03_battery_1_precharge_contactor, OUTPUT_OFF);
-        Update_Output(OUT_D09_battery_2_precharge_contactor, OUTPUT_OFF);
-        Update_Output(OUT_C14_battery_3_precharge_contactor, OUTPUT_OFF);
-
-        Update_Output(OUT_D03_battery_1_precharge_contactor, OUTPUT_OFF);
-        Update_Output(OUT_D09_battery_2_precharge_contactor, OUTPUT_OFF);
-        Update_Output(OUT_C14_battery_3_precharge_contactor, OUTPUT_OFF);
+        if (precharge_was_closed &&
+            command[PACK_CONTACTOR_POSITIVE] &&
+            !pack_contactor_closed[i][PACK_CONTACTOR_POSITIVE] &&
+            !pack_excluded[i])
+        {
+            pack_contactor_closed[i][PACK_CONTACTOR_PRECHARGE] = TRUE;
+        }
+    }
+}
 
-        Update_Output(OUT_D03_battery_1_precharge_contactor, OUTPUT_OFF);
-        Update_Output(OUT_D09_battery_2_precharge_contactor, OUTPUT_OFF);
-        Update_Output(OUT_C14_battery_3_precharge_contactor, OUTPUT_OFF);
 
-        Update_Output(OUT_D03_battery_1_precharge_contactor, OUTPUT_OFF);
-        Update_Output(OUT_D09_battery_2_precharge_contactor, OUTPUT_OFF);
-        Update_Output(OUT_C14_battery_3_precharge_contactor, OUTPUT_OFF);
+//=============================================================================
+//
+// write_contactor_outputs()
+//
+//=============================================================================
+//
+static void write_contactor_outputs()
+{
+    uint8_t write;
+    uint8_t i;
 
+    for (write = 0; write < CONTACTOR_OUTPUT_WRITES; write++)
+    {
+        for (i = 0; i < NUM_BATTERY_PACKS; i++)
+        {
+            const battery_pack_contactors_t *pack =
+                &battery_pack_contactors[i];
+
+            if (pack_contactor_closed[i][PACK_CONTACTOR_POSITIVE])
+            {
+                Update_Output(pack->positive_contactor.module_id,
+                              pack->positive_contactor.number,
+                              OUTPUT_ON);
+            }
+            else
+            {
+                Update_Output(pack->positive_contactor.module_id,
+                              pack->positive_contactor.number,
+                              OUTPUT_OFF);
+            }
+
+            if (pack_contactor_closed[i][PACK_CONTACTOR_NEGATIVE])
+            {
+                Update_Output(pack->negative_contactor.module_id,
+                              pack->negative_contactor.number,
+                              OUTPUT_ON);
+            }
+            else
+            {
+                Update_Output(pack->negative_contactor.module_id,
+                              pack->negative_contactor.number,
+                              OUTPUT_OFF);
+            }
+
+            if (pack_contactor_closed[i][PACK_CONTACTOR_PRECHARGE])
+            {
+                Update_Output(pack->precharge_contactor.module_id,
+                              pack->precharge_contactor.number,
+                              OUTPUT_ON);
+            }
+            else
+            {
+                Update_Output(pack->precharge_contactor.module_id,
+                              pack->precharge_contactor.number,
+                              OUTPUT_OFF);
+            }
+        }
     }
-
 }
 
 
@@ -283,52 +335,9 @@ static void precharge_contactor_control(bool_t startup_timer)
 //
 void disable_contactors()
 {
-    Update_Output(OUT_D01_battery_1_positive_contactor, OUTPUT_OFF);
-    Update_Output(OUT_D04_battery_2_positive_contactor, OUTPUT_OFF);
-    Update_Output(OUT_D10_battery_3_positive_contactor, OUTPUT_OFF);
-
-    Update_Output(OUT_D02_battery_1_negative_contactor, OUTPUT_OFF);
-    Update_Output(OUT_D07_battery_2_negative_contactor, OUTPUT_OFF);
-    Update_Output(OUT_D13_battery_3_negative_contactor, OUTPUT_OFF);
-
-    Update_Output(OUT_D03_battery_1_precharge_contactor, OUTPUT_OFF);
-    Update_Output(OUT_D09_battery_2_precharge_contactor, OUTPUT_OFF);
-    Update_Output(OUT_C14_battery_3_precharge_contactor, OUTPUT_OFF);
-
-    Update_Output(OUT_D01_battery_1_positive_contactor, OUTPUT_OFF);
-    Update_Output(OUT_D04_battery_2_positive_contactor, OUTPUT_OFF);
-    Update_Output(OUT_D10_battery_3_positive_contactor, OUTPUT_OFF);
-
-    Update_Output(OUT_D02_battery_1_negative_contactor, OUTPUT_OFF);
-    Update_Output(OUT_D07_battery_2_negative_contactor, OUTPUT_OFF);
-    Update_Output(OUT_D13_battery_3_negative_contactor, OUTPUT_OFF);
-
-    Update_Output(OUT_D03_battery_1_precharge_contactor, OUTPUT_OFF);
-    Update_Output(OUT_D09_battery_2_precharge_contactor, OUTPUT_OFF);
-    Update_Output(OUT_C14_battery_3_precharge_contactor, OUTPUT_OFF);
-
-    Update_Output(OUT_D01_battery_1_positive_contactor, OUTPUT_OFF);
-    Update_Output(OUT_D04_battery_2_positive_contactor, OUTPUT_OFF);
-    Update_Output(OUT_D10_battery_3_positive_contactor, OUTPUT_OFF);
-
-    Update_Output(OUT_D02_battery_1_negative_contactor, OUTPUT_OFF);
-    Update_Output(OUT_D07_battery_2_negative_contactor, OUTPUT_OFF);
-    Update_Output(OUT_D13_battery_3_negative_contactor, OUTPUT_OFF);
-
-    Update_Output(OUT_D03_battery_1_precharge_contactor, OUTPUT_OFF);
-    Update_Output(OUT_D09_battery_2_precharge_contactor, OUTPUT_OFF);
-    Update_Output(OUT_C14_battery_3_precharge_contactor, OUTPUT_OFF);
-
-    Update_Output(OUT_D01_battery_1_positive_contactor, OUTPUT_OFF);
-    Update_Output(OUT_D04_battery_2_positive_contactor, OUTPUT_OFF);
-    Update_Output(OUT_D10_battery_3_positive_contactor, OUTPUT_OFF);
-
-    Update_Output(OUT_D02_battery_1_negative_contactor, OUTPUT_OFF);
-    Update_Output(OUT_D07_battery_2_negative_contactor, OUTPUT_OFF);
-    Update_Output(OUT_D13_battery_3_negative_contactor, OUTPUT_OFF);
+    const bool_t command[NUM_PACK_CONTACTORS] = { FALSE, FALSE, FALSE };
 
-    Update_Output(OUT_D03_battery_1_precharge_contactor, OUTPUT_OFF);
-    Update_Output(OUT_D09_battery_2_precharge_contactor, OUTPUT_OFF);
-    Update_Output(OUT_C14_battery_3_precharge_contactor, OUTPUT_OFF);
+    sequence_battery_packs(command);
 
+    write_contactor_outputs();
 }
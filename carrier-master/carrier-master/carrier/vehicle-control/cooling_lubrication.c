@@ -34,6 +34,8 @@
 #include "hydraulic_inverter_control.h"
 #include "cvc_debug_msgs.h"
 
+#define PRE_OIL_TIME_MS 10000
+
 //=============================================================================
 //
 // Function Prototypes()
@@ -104,7 +106,7 @@ static bool_t get_preoil_timer_state(bool_t timer_enable)
         // pumps and radiator fans.
         //
         pre_oil_timer  =
-            timer_setup( get_TEN_SECONDS(), PULSE);
+            timer_setup_ms(PRE_OIL_TIME_MS, PULSE);
 
         pre_oil_state = timer_operate(
             &pre_oil_timer,
@@ -60,6 +60,11 @@
 #include "contactor_control.h"
 #include "timer_service.h"
 #include "state_machine.h"
+#include "cvc_input_control.h"
+#include "flight_recorder.h"
+#include "energy_estimator.h"
+
+#define SHUTDOWN_DELAY_MS 3000
 
 bool_t low_power_mode = FALSE;
 
@@ -109,31 +114,24 @@ bool_t cvc_power_sequencing_low_power_control()
     uint16_t keyswitch_mv;
     uint16_t screen_ma = 0;
     uint16_t telematics_ma = 0;
-    static bool_t first_pass = TRUE;
-    static timer_t shutdown_timer;
+
+    //
+    // A three second timer.
+    //
+    static timer_t shutdown_timer = TIMER_INIT_MS(SHUTDOWN_DELAY_MS, RISING);
 
     //
     // Read the keyswitch voltage input CVC pin A11. Read the source
     // current into the HED screen and the telematics units.
     //
-    keyswitch_mv = IN_A11_keyswitch;
+    keyswitch_mv = cvc_input_get_analog(CVC_AIN_A11_KEYSWITCH);
     screen_ma = OUT_A02_screen_constant_12v_pwr_CURRENT;
     telematics_ma = OUT_A01_telematics_constant_12v_pwr_CURRENT;
 
-    if(first_pass)
-    {
-
-        //
-        // Initialise a three second timer.
-        //
-        shutdown_timer = timer_setup(get_THREE_SECONDS(), RISING);
-        first_pass = FALSE;
-    }
-
     bool_t shutdown_timer_state =
         timer_operate(&shutdown_timer,
                       ((keyswitch_mv < KEYSWITCH_ON_TRHESHOLD_MV)
-                      || (IN_E11_master_switch_signal == INPUT_OFF)));
+                      || (cvc_input_get_digital(CVC_DIN_E11_MASTER_SWITCH) == INPUT_OFF)));
 
     //
     // Check if the key switch is ON.
@@ -210,6 +208,18 @@ bool_t cvc_power_sequencing_low_power_control()
                     //
                     ret_val = TRUE;
 
+                    //
+                    // Save the state machine flight recorder before
+                    // the CVC powers down. Only written once.
+                    //
+                    flight_recorder_flush();
+
+                    //
+                    // Save the consumption rates learned by the
+                    // range estimator.
+                    //
+                    energy_estimator_flush();
+
                     for(i = 0; i <= 3; i++)
                     {
 
@@ -0,0 +1,147 @@
+/******************************************************************************
+ *
+ *        Name: emergency_stop.c
+ *
+ * Description: The fast path for the E-stops and the master switch.
+ *              See emergency_stop.h.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+
+#include "Prototypes.h"
+#include "Constants.h"
+#include "typedefs.h"
+#include "can_service.h"
+#include "skai2_inverter_vissim.h"
+#include "cvc_input_control.h"
+#include "contactor_control.h"
+#include "emergency_stop.h"
+
+//
+// The SKAI2 inverters, as passed to traction_inverter_control() and
+// hydraulic_system_control() in User_App().
+//
+#define TRACTION_INVERTER_DEVICE  ONE
+#define HYDRAULIC_INVERTER_DEVICE TWO
+
+//=============================================================================
+//
+// Static Variables
+//
+//=============================================================================
+//
+static bool_t e_stop = FALSE;
+static bool_t master_open = FALSE;
+
+static void disable_inverter(device_instances_t device);
+
+
+/******************************************************************************
+ *
+ *        Name: emergency_stop_update()
+ *
+ * Description: Called once a loop from User_App(), straight after
+ *              cvc_input_snapshot_update(). If an E-stop is pressed,
+ *              writes every contactor output off. If an E-stop is
+ *              pressed or the master switch is open, sends a disable
+ *              frame to both SKAI2 inverters.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+void emergency_stop_update()
+{
+    //
+    // The E-stops are normally closed. Either one open is an E-stop.
+    //
+    e_stop =
+        !(cvc_input_get_digital(CVC_DIN_A16_DASH_E_STOP) == INPUT_ON) ||
+        !(cvc_input_get_digital(CVC_DIN_A17_CHARGE_BOX_E_STOP) == INPUT_ON);
+
+    master_open =
+        !(cvc_input_get_digital(CVC_DIN_E11_MASTER_SWITCH) == INPUT_ON);
+
+    if (e_stop)
+    {
+        disable_contactors();
+    }
+
+    //
+    // The SKAI2 device records are only used once the CAN
+    // registrations have been validated, as in the rest of
+    // User_App().
+    //
+    if ((e_stop || master_open) &&
+        fvt_can_get_device_registrations_valid())
+    {
+        disable_inverter(TRACTION_INVERTER_DEVICE);
+        disable_inverter(HYDRAULIC_INVERTER_DEVICE);
+    }
+}
+
+
+//=============================================================================
+//
+// disable_inverter()
+//
+//=============================================================================
+//
+static void disable_inverter(device_instances_t device)
+{
+    //
+    // Zero the enable and the current limit, and send the frame now
+    // rather than at the rate of the inverter control function. The
+    // control function sends the frame again later in the loop, with
+    // the enable still held off by
+    // emergency_stop_get_inverters_disabled().
+    //
+    skai2_set_vissim_tx_msg5_enable_max_current_soc_high_cell(
+        device,
+        FALSE,
+        0,
+        0,
+        0);
+
+    tx_skai2_enable_maxcurrent_soc_highcell(device, TX_SEND_EACH_CALL);
+}
+
+
+//=============================================================================
+//
+// emergency_stop_get_e_stop()
+//
+//=============================================================================
+//
+bool_t emergency_stop_get_e_stop()
+{
+    return e_stop;
+}
+
+
+//=============================================================================
+//
+// emergency_stop_get_master_open()
+//
+//=============================================================================
+//
+bool_t emergency_stop_get_master_open()
+{
+    return master_open;
+}
+
+
+//=============================================================================
+//
+// emergency_stop_get_inverters_disabled()
+//
+//=============================================================================
+//
+bool_t emergency_stop_get_inverters_disabled()
+{
+    return e_stop || master_open;
+}
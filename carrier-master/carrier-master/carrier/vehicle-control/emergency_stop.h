@@ -0,0 +1,69 @@
+/******************************************************************************
+ *
+ *        Name: emergency_stop.h
+ *
+ * Description: The fast path for the E-stops and the master switch.
+ *
+ *              The state machine only sees the E-stops and the master
+ *              switch through populate_state_machine_member_elements()
+ *              near the end of User_App(), and the contactor and
+ *              inverter outputs only follow its new state on the next
+ *              loop. emergency_stop_update() is called at the top of
+ *              User_App(), straight after the inputs are latched, and
+ *              acts on them in the same loop:
+ *
+ *              E-STOP     : every contactor output is written off and
+ *                           a disable frame is sent to both SKAI2
+ *                           inverters.
+ *              MASTER OPEN: a disable frame is sent to both SKAI2
+ *                           inverters. The contactors are left to the
+ *                           SHUTDOWN state, which keeps the high
+ *                           voltage on for its shutdown time.
+ *
+ *              The rest of the loop still runs, so the state machine
+ *              moves to E_STOP or SHUTDOWN as before. While an input
+ *              is active, the contactor and inverter control functions
+ *              read the getters below and keep their outputs off, so
+ *              nothing later in the loop can turn them back on.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+
+#ifndef EMERGENCY_STOP_H_
+#define EMERGENCY_STOP_H_
+
+/******************************************************************************
+ *
+ *        Name: emergency_stop_update()
+ *
+ * Description: Called once a loop from User_App(), straight after
+ *              cvc_input_snapshot_update(). Reads the E-stops and the
+ *              master switch from the snapshot and, if either is
+ *              active, opens the contactors and disables the
+ *              inverters as above.
+ *
+ ******************************************************************************
+ */
+void emergency_stop_update();
+
+//
+// An E-stop is pressed in this loop's snapshot. The contactors are
+// held open.
+//
+bool_t emergency_stop_get_e_stop();
+
+//
+// The master switch is open in this loop's snapshot.
+//
+bool_t emergency_stop_get_master_open();
+
+//
+// An E-stop is pressed or the master switch is open. The inverters
+// are held disabled.
+//
+bool_t emergency_stop_get_inverters_disabled();
+
+#endif // EMERGENCY_STOP_H_
@@ -0,0 +1,613 @@
+/******************************************************************************
+ *
+ *        Name: energy_estimator.c
+ *
+ * Description: Charge and energy integrator and range estimator. See
+ *              energy_estimator.h.
+ *
+ *              All the arithmetic is in 32 bit integers. The bounds
+ *              that keep each product in range are given where the
+ *              product is formed. The part of an increment below the
+ *              unit of a total is carried in a remainder, so nothing
+ *              is lost to truncation however short the loop.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "reserved.h"
+#include "Prototypes.h"
+#include "Constants.h"
+#include "typedefs.h"
+#include "can_service.h"
+#include "time_service.h"
+#include "state_machine.h"
+#include "orion_control.h"
+#include "gears_and_transmission.h"
+#include "energy_estimator.h"
+
+//
+// The BMS SOC shown as 0% on the screen (see get_screen_SOC()). The
+// range is to this SOC, not to empty.
+//
+#define RANGE_SOC_FLOOR_PERCENT            20
+
+//
+// Learned rates used until the first window has been learned and
+// saved.
+//
+#define RANGE_DEFAULT_POWER_W              15000
+#define RANGE_DEFAULT_J_PER_M              5000
+
+//
+// Each complete bucket moves the learned rates 1/8 of the way to the
+// window rates. With 10 second buckets, the learned rates settle in
+// a few minutes of a new duty.
+//
+#define RANGE_LEARNING_DIVISOR             8
+
+//
+// A window rate is only learned once the window holds a minute of
+// working time, and the energy per metre once it holds 100 m.
+//
+#define RANGE_MIN_WINDOW_BUCKETS           6
+#define RANGE_MIN_WINDOW_DISTANCE_MM       100000
+
+//
+// Bounds of the learned rates. A downhill window can return more
+// energy than it used, which would otherwise predict an infinite
+// range.
+//
+#define RANGE_MIN_POWER_W                  500
+#define RANGE_MAX_POWER_W                  500000
+#define RANGE_MIN_J_PER_M                  50
+#define RANGE_MAX_J_PER_M                  100000
+
+//
+// Longest step integrated in one loop, and the largest power
+// integrated. A stalled loop is integrated as this step. Together
+// they bound every sum below 2^31, even over a full window.
+//
+#define ENERGY_MAX_STEP_MS                 100
+#define ENERGY_MAX_POWER_W                 2000000
+
+//
+// The learned rates are saved in the sector of the external serial
+// flash after the flight recorder sectors (flight_recorder.c).
+//
+#define ENERGY_ESTIMATOR_FLASH_SECTOR      4
+
+#define ENERGY_ESTIMATOR_FLASH_START \
+    ((FLASH_POINTER_TYPE)(EXTERNAL_MEMORY_BASE_ADDRESS + \
+                          ENERGY_ESTIMATOR_FLASH_SECTOR * EXTERNAL_MEMORY_SECTOR_SIZE))
+#define ENERGY_ESTIMATOR_FLASH_END \
+    ((FLASH_POINTER_TYPE)(EXTERNAL_MEMORY_BASE_ADDRESS + \
+                          (ENERGY_ESTIMATOR_FLASH_SECTOR + 1) * EXTERNAL_MEMORY_SECTOR_SIZE - 1))
+
+//
+// Marks a saved image. Changed whenever the image changes.
+//
+#define ENERGY_ESTIMATOR_MAGIC             0x45450001
+
+typedef struct
+{
+    uint32_t magic;
+    uint32_t learned_power_w;
+    uint32_t learned_j_per_m;
+    uint32_t spare;
+} energy_estimator_image_t;
+
+//
+// The flash is written 8 bytes at a time, so the image is padded to
+// a multiple of 8 bytes.
+//
+typedef union
+{
+    energy_estimator_image_t image;
+    uint32_t words[((sizeof(energy_estimator_image_t) + 7) / 8) * 2];
+} energy_estimator_flash_t;
+
+typedef char energy_estimator_flash_size_check[
+    (sizeof(energy_estimator_flash_t) <= EXTERNAL_MEMORY_SECTOR_SIZE) ? 1 : -1];
+
+//
+// The net energy and distance of one bucket of working time.
+//
+typedef struct
+{
+    int32_t  energy_j;
+    uint32_t distance_mm;
+} consumption_bucket_t;
+
+//=============================================================================
+//
+// Static Variables
+//
+//=============================================================================
+//
+static energy_estimator_flash_t learned;
+static bool_t learned_dirty = FALSE;
+
+//
+// Totals since start up, and the parts of an increment below their
+// units: 0.1A.ms (1/10000 A.s), mJ and um.
+//
+static uint32_t charge_out_as = 0;
+static uint32_t charge_in_as = 0;
+static uint32_t energy_out_j = 0;
+static uint32_t energy_in_j = 0;
+static int32_t charge_remainder = 0;
+static int32_t energy_remainder_mj = 0;
+static uint32_t distance_remainder_um = 0;
+
+//
+// The bucket being filled, and the rolling window of complete
+// buckets with its running sums.
+//
+static consumption_bucket_t bucket;
+static uint32_t bucket_ms = 0;
+static consumption_bucket_t window[RANGE_WINDOW_BUCKETS];
+static uint8_t window_next = 0;
+static uint8_t window_count = 0;
+static int32_t window_energy_j = 0;
+static uint32_t window_distance_mm = 0;
+
+static void complete_bucket();
+static void learn_window_rates();
+static uint32_t learn(uint32_t learned_value, uint32_t window_value);
+static uint32_t get_usable_energy_wh();
+
+
+//=============================================================================
+//
+// saturating_add()
+//
+//=============================================================================
+//
+static inline uint32_t saturating_add(uint32_t total, uint32_t increment)
+{
+    return (total > (0xFFFFFFFF - increment)) ? 0xFFFFFFFF : (total + increment);
+}
+
+
+/******************************************************************************
+ *
+ *        Name: energy_estimator_init()
+ *
+ * Description: Reads the image saved by the last flush. If there is
+ *              no valid image, for example on the first start up, the
+ *              learned rates start at their defaults.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+void energy_estimator_init()
+{
+    FLASH_COMMAND_STATUS_ status =
+        Flash_Read_Block(ENERGY_ESTIMATOR_FLASH_START,
+                         (uint8_t *)learned.words,
+                         sizeof(learned.words));
+
+    if ((status != FLASH_COMMAND_SUCCESSFUL) ||
+        (learned.image.magic != ENERGY_ESTIMATOR_MAGIC) ||
+        (learned.image.learned_power_w < RANGE_MIN_POWER_W) ||
+        (learned.image.learned_power_w > RANGE_MAX_POWER_W) ||
+        (learned.image.learned_j_per_m < RANGE_MIN_J_PER_M) ||
+        (learned.image.learned_j_per_m > RANGE_MAX_J_PER_M))
+    {
+        memset(&learned, 0, sizeof(learned));
+        learned.image.magic = ENERGY_ESTIMATOR_MAGIC;
+        learned.image.learned_power_w = RANGE_DEFAULT_POWER_W;
+        learned.image.learned_j_per_m = RANGE_DEFAULT_J_PER_M;
+    }
+
+    learned_dirty = FALSE;
+}
+
+
+/******************************************************************************
+ *
+ *        Name: energy_estimator_update()
+ *
+ * Description: Integrates the pack current and power over the time
+ *              elapsed since the previous loop. While the vehicle is
+ *              being worked, the net energy and the distance driven
+ *              are added to the current bucket of the window.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+void energy_estimator_update()
+{
+    const battery_pack_aggregate_t *aggregate = get_battery_pack_aggregate();
+
+    uint32_t step_ms = time_service_get_elapsed_ms();
+
+    if (step_ms > ENERGY_MAX_STEP_MS)
+    {
+        step_ms = ENERGY_MAX_STEP_MS;
+    }
+
+    //
+    // The packs are in parallel: the total current at the mean
+    // voltage. Positive is out of the packs. Currents are in 0.1A
+    // and voltages in 0.1V.
+    //
+    int32_t current = aggregate->signal[PACK_SIGNAL_CURRENT].sum;
+    int32_t voltage = aggregate->signal[PACK_SIGNAL_VOLTAGE].mean;
+
+    //
+    // Power in W. The voltage is taken in V first: three packs of at
+    // most 3276.7A at 6553V is under 2^31.
+    //
+    int32_t power_w = (current * (voltage / 10)) / 10;
+
+    if (power_w > ENERGY_MAX_POWER_W)
+    {
+        power_w = ENERGY_MAX_POWER_W;
+    }
+    else if (power_w < -ENERGY_MAX_POWER_W)
+    {
+        power_w = -ENERGY_MAX_POWER_W;
+    }
+
+    //
+    // Charge, in 0.1A.ms. At most 98301 x 100 per step.
+    //
+    charge_remainder += current * (int32_t)step_ms;
+
+    int32_t whole_as = charge_remainder / 10000;
+    charge_remainder -= whole_as * 10000;
+
+    if (whole_as > 0)
+    {
+        charge_out_as = saturating_add(charge_out_as, (uint32_t)whole_as);
+    }
+    else if (whole_as < 0)
+    {
+        charge_in_as = saturating_add(charge_in_as, (uint32_t)(-whole_as));
+    }
+
+    //
+    // Energy, in mJ. At most 2000000 x 100 per step.
+    //
+    energy_remainder_mj += power_w * (int32_t)step_ms;
+
+    int32_t whole_j = energy_remainder_mj / 1000;
+    energy_remainder_mj -= whole_j * 1000;
+
+    if (whole_j > 0)
+    {
+        energy_out_j = saturating_add(energy_out_j, (uint32_t)whole_j);
+    }
+    else if (whole_j < 0)
+    {
+        energy_in_j = saturating_add(energy_in_j, (uint32_t)(-whole_j));
+    }
+
+    //
+    // Only the time the vehicle is being worked goes into the
+    // consumption window. Charging and sitting with high voltage off
+    // would otherwise be learned as consumption.
+    //
+    if (!get_sm_status_enable_hv_systems() ||
+        get_sm_status_charging_desired())
+    {
+        return;
+    }
+
+    //
+    // Distance, in um. At most 65535 mm/s x 100 ms per step.
+    //
+    distance_remainder_um += (uint32_t)get_ground_speed_mmps() * step_ms;
+
+    uint32_t whole_mm = distance_remainder_um / 1000;
+    distance_remainder_um -= whole_mm * 1000;
+
+    bucket.energy_j += whole_j;
+    bucket.distance_mm += whole_mm;
+    bucket_ms += step_ms;
+
+    if (bucket_ms >= RANGE_BUCKET_MS)
+    {
+        complete_bucket();
+    }
+}
+
+
+//=============================================================================
+//
+// complete_bucket()
+//
+// Moves the current bucket into the window, dropping the oldest
+// bucket once the window is full, and learns from the window.
+//
+//=============================================================================
+//
+static void complete_bucket()
+{
+    if (window_count == RANGE_WINDOW_BUCKETS)
+    {
+        window_energy_j -= window[window_next].energy_j;
+        window_distance_mm -= window[window_next].distance_mm;
+    }
+    else
+    {
+        window_count++;
+    }
+
+    window[window_next] = bucket;
+    window_energy_j += bucket.energy_j;
+    window_distance_mm += bucket.distance_mm;
+
+    window_next = (window_next + 1) % RANGE_WINDOW_BUCKETS;
+
+    //
+    // Working time past the end of the bucket starts the next one.
+    //
+    bucket_ms -= RANGE_BUCKET_MS;
+    bucket.energy_j = 0;
+    bucket.distance_mm = 0;
+
+    learn_window_rates();
+}
+
+
+//=============================================================================
+//
+// learn_window_rates()
+//
+//=============================================================================
+//
+static void learn_window_rates()
+{
+    if (window_count < RANGE_MIN_WINDOW_BUCKETS)
+    {
+        return;
+    }
+
+    //
+    // A window returning more energy than it used counts as using
+    // none, and is held up by the minimum rates below.
+    //
+    uint32_t energy_j = (window_energy_j > 0) ? (uint32_t)window_energy_j : 0;
+
+    uint32_t window_s = (uint32_t)window_count * (RANGE_BUCKET_MS / 1000);
+
+    uint32_t power_w = energy_j / window_s;
+
+    if (power_w < RANGE_MIN_POWER_W)
+    {
+        power_w = RANGE_MIN_POWER_W;
+    }
+    else if (power_w > RANGE_MAX_POWER_W)
+    {
+        power_w = RANGE_MAX_POWER_W;
+    }
+
+    learned.image.learned_power_w =
+        learn(learned.image.learned_power_w, power_w);
+
+    if (window_distance_mm >= RANGE_MIN_WINDOW_DISTANCE_MM)
+    {
+        uint32_t j_per_m = energy_j / (window_distance_mm / 1000);
+
+        if (j_per_m < RANGE_MIN_J_PER_M)
+        {
+            j_per_m = RANGE_MIN_J_PER_M;
+        }
+        else if (j_per_m > RANGE_MAX_J_PER_M)
+        {
+            j_per_m = RANGE_MAX_J_PER_M;
+        }
+
+        learned.image.learned_j_per_m =
+            learn(learned.image.learned_j_per_m, j_per_m);
+    }
+
+    learned_dirty = TRUE;
+}
+
+
+//=============================================================================
+//
+// learn()
+//
+// Moves a learned value 1/RANGE_LEARNING_DIVISOR of the way to the
+// window value, and at least 1 unit so it always arrives.
+//
+//=============================================================================
+//
+static uint32_t learn(uint32_t learned_value, uint32_t window_value)
+{
+    uint32_t step;
+
+    if (window_value > learned_value)
+    {
+        step = (window_value - learned_value) / RANGE_LEARNING_DIVISOR;
+        return learned_value + ((step > 0) ? step : 1);
+    }
+
+    if (window_value < learned_value)
+    {
+        step = (learned_value - window_value) / RANGE_LEARNING_DIVISOR;
+        return learned_value - ((step > 0) ? step : 1);
+    }
+
+    return learned_value;
+}
+
+
+//=============================================================================
+//
+// get_usable_energy_wh()
+//
+// The energy left in the packs above RANGE_SOC_FLOOR_PERCENT,
+// in Wh, from the amp hours remaining and the pack voltage.
+//
+//=============================================================================
+//
+static uint32_t get_usable_energy_wh()
+{
+    const battery_pack_aggregate_t *aggregate = get_battery_pack_aggregate();
+
+    //
+    // Amp hours in 0.1Ah, summed over the parallel packs, so at most
+    // 3 x 65535. SOC is in %, voltage in 0.1V.
+    //
+    uint32_t amp_hours = (uint32_t)aggregate->signal[PACK_SIGNAL_AMP_HOURS].sum;
+    uint32_t soc = (uint32_t)aggregate->signal[PACK_SIGNAL_SOC].mean;
+    uint32_t voltage = (uint32_t)aggregate->signal[PACK_SIGNAL_VOLTAGE].mean;
+
+    if ((soc <= RANGE_SOC_FLOOR_PERCENT) || (soc > 100))
+    {
+        return 0;
+    }
+
+    //
+    // The amp hours above the floor. At most 196605 x 100.
+    //
+    uint32_t usable_amp_hours =
+        (amp_hours * (soc - RANGE_SOC_FLOOR_PERCENT)) / soc;
+
+    //
+    // 0.1Ah x 0.1V = 0.01Wh. Divide first when the product would not
+    // fit.
+    //
+    if ((voltage != 0) && (usable_amp_hours > (0xFFFFFFFF / voltage)))
+    {
+        return (usable_amp_hours / 10) * (voltage / 10);
+    }
+
+    return (usable_amp_hours * voltage) / 100;
+}
+
+
+//=============================================================================
+//
+// energy_estimator_get_range_minutes()
+//
+//=============================================================================
+//
+uint16_t energy_estimator_get_range_minutes()
+{
+    //
+    // Wh x 60 / W, split so neither product can overflow.
+    //
+    uint32_t usable_wh = get_usable_energy_wh();
+    uint32_t power_w = learned.image.learned_power_w;
+
+    uint32_t minutes = (usable_wh / power_w) * 60 +
+                       ((usable_wh % power_w) * 60) / power_w;
+
+    return (minutes > 0xFFFF) ? 0xFFFF : (uint16_t)minutes;
+}
+
+
+//=============================================================================
+//
+// energy_estimator_get_range_metres()
+//
+//=============================================================================
+//
+uint32_t energy_estimator_get_range_metres()
+{
+    //
+    // Wh x 3600 / (J/m). The remainder is below RANGE_MAX_J_PER_M, so
+    // the remainder product is below 2^32.
+    //
+    uint32_t usable_wh = get_usable_energy_wh();
+    uint32_t j_per_m = learned.image.learned_j_per_m;
+
+    uint32_t whole = usable_wh / j_per_m;
+
+    if (whole >= (0xFFFFFFFF / 3600))
+    {
+        return 0xFFFFFFFF;
+    }
+
+    return whole * 3600 + ((usable_wh % j_per_m) * 3600) / j_per_m;
+}
+
+
+/******************************************************************************
+ *
+ *        Name: energy_estimator_flush()
+ *
+ * Description: Writes the learned rates to the external serial flash
+ *              if they have been learned since start up.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+void energy_estimator_flush()
+{
+    if (!learned_dirty)
+    {
+        return;
+    }
+
+    if (Flash_Erase_Block(ENERGY_ESTIMATOR_FLASH_START,
+                          ENERGY_ESTIMATOR_FLASH_END) != FLASH_COMMAND_SUCCESSFUL)
+    {
+        DEBUG("Energy estimator flash erase failed");
+        return;
+    }
+
+    if (Flash_Write_Block((FLASH_POINTER_TYPE)learned.words,
+                          ENERGY_ESTIMATOR_FLASH_START,
+                          sizeof(learned.words)) != FLASH_COMMAND_SUCCESSFUL)
+    {
+        DEBUG("Energy estimator flash write failed");
+        return;
+    }
+
+    learned_dirty = FALSE;
+}
+
+
+//=============================================================================
+//
+// Getters
+//
+//=============================================================================
+//
+uint32_t energy_estimator_get_charge_out_as()
+{
+    return charge_out_as;
+}
+
+uint32_t energy_estimator_get_charge_in_as()
+{
+    return charge_in_as;
+}
+
+uint32_t energy_estimator_get_energy_out_j()
+{
+    return energy_out_j;
+}
+
+uint32_t energy_estimator_get_energy_in_j()
+{
+    return energy_in_j;
+}
+
+uint32_t energy_estimator_get_learned_power_w()
+{
+    return learned.image.learned_power_w;
+}
+
+uint32_t energy_estimator_get_learned_energy_per_metre_j()
+{
+    return learned.image.learned_j_per_m;
+}
@@ -0,0 +1,99 @@
+/******************************************************************************
+ *
+ *        Name: energy_estimator.h
+ *
+ * Description: Counts the charge and energy in and out of the battery
+ *              packs, and predicts the remaining range from how the
+ *              vehicle has actually been worked.
+ *
+ *              Every loop, the pack current and voltage from the BMS
+ *              aggregate (orion_control.h) are integrated, in fixed
+ *              point, into the charge (A.s) and energy (J) sourced
+ *              and sunk by the packs since start up.
+ *
+ *              While high voltage is on and the vehicle is not
+ *              charging, the net energy and the distance driven are
+ *              also collected into a rolling window of the last
+ *              RANGE_WINDOW_BUCKETS buckets of RANGE_BUCKET_MS each.
+ *              Every time a bucket is complete, the average power and
+ *              the energy per metre over the window are blended into
+ *              the learned consumption rates.
+ *
+ *              The range is the usable energy left in the packs, down
+ *              to the SOC shown as 0% on the screen, divided by the
+ *              learned rates. The learned rates are written to the
+ *              external serial flash when the CVC shuts down and read
+ *              back at start up, so the range is right from the first
+ *              loop of the next key cycle.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+
+#ifndef ENERGY_ESTIMATOR_H_
+#define ENERGY_ESTIMATOR_H_
+
+//
+// The rolling consumption window: 60 buckets of 10 seconds of
+// working time.
+//
+#define RANGE_BUCKET_MS        10000
+#define RANGE_WINDOW_BUCKETS   60
+
+/******************************************************************************
+ *
+ *        Name: energy_estimator_init()
+ *
+ * Description: Restores the learned consumption rates saved by the
+ *              last shutdown from the external serial flash. Called
+ *              once from User_Init().
+ *
+ ******************************************************************************
+ */
+void energy_estimator_init();
+
+/******************************************************************************
+ *
+ *        Name: energy_estimator_update()
+ *
+ * Description: Integrates the pack current and voltage over the time
+ *              elapsed since the previous loop, and updates the
+ *              consumption window and the learned rates. Called once
+ *              a loop from User_App(), after the state machine.
+ *
+ ******************************************************************************
+ */
+void energy_estimator_update();
+
+//
+// Write the learned consumption rates to the external serial flash,
+// if they have changed since start up. Called on shutdown.
+//
+void energy_estimator_flush();
+
+//
+// Charge (A.s) and energy (J) sourced by the packs (out) and sunk
+// into them (in, regen and charging) since start up. Saturate at
+// 2^32 - 1.
+//
+uint32_t energy_estimator_get_charge_out_as();
+uint32_t energy_estimator_get_charge_in_as();
+uint32_t energy_estimator_get_energy_out_j();
+uint32_t energy_estimator_get_energy_in_j();
+
+//
+// The learned consumption rates: average power (W) and energy per
+// metre driven (J/m).
+//
+uint32_t energy_estimator_get_learned_power_w();
+uint32_t energy_estimator_get_learned_energy_per_metre_j();
+
+//
+// The predicted range at the learned rates.
+//
+uint16_t energy_estimator_get_range_minutes();
+uint32_t energy_estimator_get_range_metres();
+
+#endif // ENERGY_ESTIMATOR_H_
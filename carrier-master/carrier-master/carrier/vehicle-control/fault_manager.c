@@ -0,0 +1,575 @@
+/******************************************************************************
+ *
+ *        Name: fault_manager.c
+ *
+ * Description: The fault table and the single pass fault detection
+ *              and debounce. See fault_manager.h.
+ *
+ *              Each fault is debounced by its RISING channel of the
+ *              debounce bank (debounce_bank.c). The bank debounces at
+ *              the top of the loop, so a fault becomes active a loop
+ *              after it has been detected for its debounce time. It
+ *              stops being active in the loop it is no longer
+ *              detected.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+
+#include <stdlib.h>
+#include "Prototypes.h"
+#include "Constants.h"
+#include "typedefs.h"
+#include "can_service.h"
+#include "time_service.h"
+#include "skai2_inverter_vissim.h"
+#include "orion_device.h"
+#include "orion_control.h"
+#include "state_machine.h"
+#include "fvt_library.h"
+#include "cvc_input_control.h"
+#include "pack_divergence.h"
+#include "fault_manager.h"
+#include "debounce_bank.h"
+
+//
+// The fault bitsets are 32 bits wide.
+//
+typedef char fault_manager_fault_count_check[
+    (NUM_FAULTS <= 32) ? 1 : -1];
+
+#define BATTERY_CRITICAL_FAULT_THRESHOLD_MV            8000
+#define AUX_BATTERY_DYING_THRESHOLD_MV                 11000
+#define MOTOR_CRITICAL_FAULT_TEMPERATURE_THRESHOLD     150
+#define INVERTER_CRITICAL_FAULT_TEMPERATURE_THRESHOLD  125
+#define MOTOR_WARNING_TEMPERATURE_THRESHOLD            125
+#define INVERTER_WARNING_TEMPERATURE_THRESHOLD         100
+#define BATTERY_WARNING_TEMPERATURE_THRESHOLD          50
+#define CELL_DELTA_WARNING_THRESHOLD                   1750
+#define LOW_SOC_WARNING_THRESHOLD                      30
+
+//
+// The HED system status has no change notification. It is read at
+// this period and the HED faults are detected from the copy.
+//
+#define SYSTEM_STATUS_POLL_PERIOD_MS                   100
+
+//
+// J1939 SPNs. Faults without a standard SPN use the proprietary SPN
+// range, from FAULT_SPN_PROPRIETARY_BASE (fault_manager.h).
+//
+#define FAULT_SPN_BATTERY_POTENTIAL                    168
+#define FAULT_SPN_J1939_NETWORK_1                      639
+#define FAULT_SPN_J1939_NETWORK_2                      1231
+#define FAULT_SPN_J1939_NETWORK_3                      1235
+
+//
+// J1939 FMIs.
+//
+#define FMI_ABOVE_NORMAL_MOST_SEVERE                   0
+#define FMI_BELOW_NORMAL_MOST_SEVERE                   1
+#define FMI_ROOT_CAUSE_NOT_KNOWN                       11
+#define FMI_BAD_INTELLIGENT_DEVICE                     12
+#define FMI_NETWORK_FAULT                              14
+#define FMI_ABOVE_NORMAL_MODERATELY_SEVERE             16
+#define FMI_BELOW_NORMAL_MODERATELY_SEVERE             18
+#define FMI_CONDITION_EXISTS                           31
+
+//=============================================================================
+//
+// Detectors
+//
+//=============================================================================
+//
+static hed_system_status_t system_status = {.in_safe_mode = FALSE};
+
+static uint16_t max_inverter_temperature(device_instances_t device);
+
+static bool_t detect_aux_battery_dying(void);
+static bool_t detect_aux_battery_under_voltage(void);
+static bool_t detect_battery_pack(void);
+static bool_t detect_traction_inverter(void);
+static bool_t detect_hydraulic_inverter(void);
+static bool_t detect_can1(void);
+static bool_t detect_can2(void);
+static bool_t detect_can3(void);
+static bool_t detect_master_module_not_running(void);
+static bool_t detect_system_errors(void);
+static bool_t detect_precharge(void);
+static bool_t detect_traction_motor_over_temperature(void);
+static bool_t detect_hydraulic_motor_over_temperature(void);
+static bool_t detect_traction_inverter_over_temperature(void);
+static bool_t detect_hydraulic_inverter_over_temperature(void);
+static bool_t detect_battery_warm(void);
+static bool_t detect_cell_delta(void);
+static bool_t detect_traction_motor_warm(void);
+static bool_t detect_hydraulic_motor_warm(void);
+static bool_t detect_traction_inverter_warm(void);
+static bool_t detect_hydraulic_inverter_warm(void);
+static bool_t detect_hv_isolation(void);
+static bool_t detect_low_soc(void);
+static bool_t detect_pack_divergence(void);
+
+//=============================================================================
+//
+// Fault table. The reason_bit of each fault is its bit in the reason
+// masks the screen decodes, and must not be changed.
+//
+//=============================================================================
+//
+static const fault_definition_t fault_table[NUM_FAULTS] =
+{
+    //                                           detect                                       debounce  severity                 reaction                 flags                    bit  spn                               fmi
+    [FAULT_AUX_BATTERY_DYING]                  = { detect_aux_battery_dying,                   7500,    FAULT_SEVERITY_CRITICAL, FAULT_REACTION_HV_OFF,   FAULT_DETECT_EVERY_LOOP,  0,  FAULT_SPN_BATTERY_POTENTIAL,      FMI_BELOW_NORMAL_MODERATELY_SEVERE },
+    [FAULT_AUX_BATTERY_UNDER_VOLTAGE]          = { detect_aux_battery_under_voltage,           5000,    FAULT_SEVERITY_CRITICAL, FAULT_REACTION_HV_OFF,   FAULT_DETECT_EVERY_LOOP,  1,  FAULT_SPN_BATTERY_POTENTIAL,      FMI_BELOW_NORMAL_MOST_SEVERE },
+    [FAULT_BATTERY_PACK]                       = { detect_battery_pack,                        5000,    FAULT_SEVERITY_CRITICAL, FAULT_REACTION_HV_OFF,   FAULT_DETECT_EVERY_LOOP,  2,  FAULT_SPN_PROPRIETARY_BASE + 0,   FMI_CONDITION_EXISTS },
+    [FAULT_TRACTION_INVERTER]                  = { detect_traction_inverter,                   5000,    FAULT_SEVERITY_CRITICAL, FAULT_REACTION_HV_OFF,   FAULT_DETECT_ON_CAN_RX,   3,  FAULT_SPN_PROPRIETARY_BASE + 1,   FMI_BAD_INTELLIGENT_DEVICE },
+    [FAULT_HYDRAULIC_INVERTER]                 = { detect_hydraulic_inverter,                  5000,    FAULT_SEVERITY_CRITICAL, FAULT_REACTION_HV_OFF,   FAULT_DETECT_ON_CAN_RX,   4,  FAULT_SPN_PROPRIETARY_BASE + 2,   FMI_BAD_INTELLIGENT_DEVICE },
+    [FAULT_CAN1]                               = { detect_can1,                                5000,    FAULT_SEVERITY_CRITICAL, FAULT_REACTION_HV_OFF,   FAULT_DETECT_EVERY_LOOP,  5,  FAULT_SPN_J1939_NETWORK_1,        FMI_NETWORK_FAULT },
+    [FAULT_CAN2]                               = { detect_can2,                                5000,    FAULT_SEVERITY_CRITICAL, FAULT_REACTION_HV_OFF,   FAULT_DETECT_EVERY_LOOP,  6,  FAULT_SPN_J1939_NETWORK_2,        FMI_NETWORK_FAULT },
+    [FAULT_CAN3]                               = { detect_can3,                                5000,    FAULT_SEVERITY_CRITICAL, FAULT_REACTION_HV_OFF,   FAULT_DETECT_EVERY_LOOP,  7,  FAULT_SPN_J1939_NETWORK_3,        FMI_NETWORK_FAULT },
+    [FAULT_MASTER_MODULE_NOT_RUNNING]          = { detect_master_module_not_running,           5000,    FAULT_SEVERITY_CRITICAL, FAULT_REACTION_HV_OFF,   FAULT_DETECT_EVERY_LOOP,  8,  FAULT_SPN_PROPRIETARY_BASE + 3,   FMI_BAD_INTELLIGENT_DEVICE },
+    [FAULT_SYSTEM_ERRORS]                      = { detect_system_errors,                       5000,    FAULT_SEVERITY_CRITICAL, FAULT_REACTION_HV_OFF,   FAULT_DETECT_EVERY_LOOP,  9,  FAULT_SPN_PROPRIETARY_BASE + 4,   FMI_ROOT_CAUSE_NOT_KNOWN },
+    [FAULT_PRECHARGE]                          = { detect_precharge,                           5000,    FAULT_SEVERITY_CRITICAL, FAULT_REACTION_HV_OFF,   FAULT_DETECT_EVERY_LOOP, 10,  FAULT_SPN_PROPRIETARY_BASE + 5,   FMI_CONDITION_EXISTS },
+
+    [FAULT_TRACTION_MOTOR_OVER_TEMPERATURE]    = { detect_traction_motor_over_temperature,     5000,    FAULT_SEVERITY_CRITICAL, FAULT_REACTION_HV_ON,    FAULT_DETECT_ON_CAN_RX,   0,  FAULT_SPN_PROPRIETARY_BASE + 6,   FMI_ABOVE_NORMAL_MOST_SEVERE },
+    [FAULT_HYDRAULIC_MOTOR_OVER_TEMPERATURE]   = { detect_hydraulic_motor_over_temperature,    5000,    FAULT_SEVERITY_CRITICAL, FAULT_REACTION_HV_ON,    FAULT_DETECT_ON_CAN_RX,   1,  FAULT_SPN_PROPRIETARY_BASE + 7,   FMI_ABOVE_NORMAL_MOST_SEVERE },
+    [FAULT_TRACTION_INVERTER_OVER_TEMPERATURE] = { detect_traction_inverter_over_temperature,  5000,    FAULT_SEVERITY_CRITICAL, FAULT_REACTION_HV_ON,    FAULT_DETECT_ON_CAN_RX,   2,  FAULT_SPN_PROPRIETARY_BASE + 8,   FMI_ABOVE_NORMAL_MOST_SEVERE },
+    [FAULT_HYDRAULIC_INVERTER_OVER_TEMPERATURE]= { detect_hydraulic_inverter_over_temperature, 5000,    FAULT_SEVERITY_CRITICAL, FAULT_REACTION_HV_ON,    FAULT_DETECT_ON_CAN_RX,   3,  FAULT_SPN_PROPRIETARY_BASE + 9,   FMI_ABOVE_NORMAL_MOST_SEVERE },
+
+    [FAULT_BATTERY_WARM]                       = { detect_battery_warm,                           0,    FAULT_SEVERITY_WARNING,  FAULT_REACTION_WARNING,  FAULT_DETECT_ON_CAN_RX,   0,  FAULT_SPN_PROPRIETARY_BASE + 10,  FMI_ABOVE_NORMAL_MODERATELY_SEVERE },
+    [FAULT_CELL_DELTA]                         = { detect_cell_delta,                             0,    FAULT_SEVERITY_WARNING,  FAULT_REACTION_WARNING,  FAULT_DETECT_ON_CAN_RX,   1,  FAULT_SPN_PROPRIETARY_BASE + 11,  FMI_ABOVE_NORMAL_MODERATELY_SEVERE },
+    [FAULT_TRACTION_MOTOR_WARM]                = { detect_traction_motor_warm,                    0,    FAULT_SEVERITY_WARNING,  FAULT_REACTION_WARNING,  FAULT_DETECT_ON_CAN_RX,   2,  FAULT_SPN_PROPRIETARY_BASE + 6,   FMI_ABOVE_NORMAL_MODERATELY_SEVERE },
+    [FAULT_HYDRAULIC_MOTOR_WARM]               = { detect_hydraulic_motor_warm,                   0,    FAULT_SEVERITY_WARNING,  FAULT_REACTION_WARNING,  FAULT_DETECT_ON_CAN_RX,   3,  FAULT_SPN_PROPRIETARY_BASE + 7,   FMI_ABOVE_NORMAL_MODERATELY_SEVERE },
+    [FAULT_TRACTION_INVERTER_WARM]             = { detect_traction_inverter_warm,                 0,    FAULT_SEVERITY_WARNING,  FAULT_REACTION_WARNING,  FAULT_DETECT_ON_CAN_RX,   4,  FAULT_SPN_PROPRIETARY_BASE + 8,   FMI_ABOVE_NORMAL_MODERATELY_SEVERE },
+    [FAULT_HYDRAULIC_INVERTER_WARM]            = { detect_hydraulic_inverter_warm,                0,    FAULT_SEVERITY_WARNING,  FAULT_REACTION_WARNING,  FAULT_DETECT_ON_CAN_RX,   5,  FAULT_SPN_PROPRIETARY_BASE + 9,   FMI_ABOVE_NORMAL_MODERATELY_SEVERE },
+    [FAULT_HV_ISOLATION]                       = { detect_hv_isolation,                           0,    FAULT_SEVERITY_WARNING,  FAULT_REACTION_WARNING,  FAULT_DETECT_ON_CAN_RX,   6,  FAULT_SPN_PROPRIETARY_BASE + 12,  FMI_CONDITION_EXISTS },
+    [FAULT_LOW_SOC]                            = { detect_low_soc,                                0,    FAULT_SEVERITY_WARNING,  FAULT_REACTION_WARNING,  FAULT_DETECT_ON_CAN_RX,   7,  FAULT_SPN_PROPRIETARY_BASE + 13,  FMI_BELOW_NORMAL_MODERATELY_SEVERE },
+    [FAULT_PACK_DIVERGENCE]                    = { detect_pack_divergence,                        0,    FAULT_SEVERITY_WARNING,  FAULT_REACTION_WARNING,  FAULT_DETECT_ON_CAN_RX,   8,  FAULT_SPN_PROPRIETARY_BASE + 14,  FMI_CONDITION_EXISTS },
+};
+
+//=============================================================================
+//
+// Static Variables
+//
+//=============================================================================
+//
+static uint8_t fault_occurrences[NUM_FAULTS];
+
+static uint32_t faults_detected = 0;
+static uint32_t faults_active = 0;
+static uint32_t faults_history = 0;
+static uint8_t fault_reactions = FAULT_REACTION_NONE;
+
+
+/******************************************************************************
+ *
+ *        Name: fault_manager_update()
+ *
+ * Description: Polls the HED system status when it is due, runs the
+ *              detectors that need to run this loop, and latches
+ *              every fault into its debounce bank channel. The
+ *              reactions of the active faults are ORed into
+ *              fault_reactions.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+void fault_manager_update()
+{
+    static bool_t first_pass = TRUE;
+    static uint32_t last_rx_change_count = 0;
+    static uint32_t system_status_poll_ms = 0;
+
+    uint32_t rx_change_count = fvt_can_get_rx_change_count();
+    bool_t can_rx_changed =
+        (first_pass || (rx_change_count != last_rx_change_count));
+    uint32_t active = 0;
+    uint8_t reactions = FAULT_REACTION_NONE;
+    uint8_t i;
+
+    if (first_pass ||
+        (time_service_ms_since(system_status_poll_ms) >=
+         SYSTEM_STATUS_POLL_PERIOD_MS))
+    {
+        system_status = get_system_status();
+        system_status_poll_ms = time_service_get_ms();
+    }
+
+    last_rx_change_count = rx_change_count;
+    first_pass = FALSE;
+
+    for (i = 0; i < NUM_FAULTS; i++)
+    {
+        const fault_definition_t *fault = &fault_table[i];
+        debounce_channel_t channel = (debounce_channel_t)(DEBOUNCE_FAULT_FIRST + i);
+        uint32_t bit = ((uint32_t)1 << i);
+
+        //
+        // Detect. A detector that is not run this loop keeps its
+        // previous result.
+        //
+        if (!(fault->flags & FAULT_DETECT_ON_CAN_RX) || can_rx_changed)
+        {
+            if (fault->detect())
+            {
+                faults_detected |= bit;
+            }
+            else
+            {
+                faults_detected &= ~bit;
+            }
+        }
+
+        //
+        // Debounce. The bank output is from the top of this loop, so
+        // it is ANDed with the detection of this loop.
+        //
+        debounce_bank_set_input(channel, (faults_detected & bit) != 0);
+
+        if ((faults_detected & bit) && debounce_bank_get_output(channel))
+        {
+            //
+            // Count each time the fault becomes active.
+            //
+            if (!(faults_active & bit) && (fault_occurrences[i] < 255))
+            {
+                fault_occurrences[i]++;
+            }
+
+            active |= bit;
+            reactions |= fault->reaction;
+        }
+    }
+
+    faults_active = active;
+    faults_history |= active;
+    fault_reactions = reactions;
+}
+
+
+//=============================================================================
+//
+// Getters
+//
+//=============================================================================
+//
+uint8_t fault_manager_get_reactions()
+{
+    return fault_reactions;
+}
+
+uint32_t fault_manager_get_detected()
+{
+    return faults_detected;
+}
+
+uint32_t fault_manager_get_pending()
+{
+    return faults_detected & ~faults_active;
+}
+
+uint32_t fault_manager_get_active()
+{
+    return faults_active;
+}
+
+uint32_t fault_manager_get_history()
+{
+    return faults_history;
+}
+
+
+//=============================================================================
+//
+// fault_manager_get_reasons()
+//
+//=============================================================================
+//
+uint32_t fault_manager_get_reasons(
+    uint8_t reaction,
+    bool_t active_only)
+{
+    uint32_t faults = active_only ? faults_active : faults_detected;
+    uint32_t reasons = 0;
+    uint8_t i;
+
+    for (i = 0; i < NUM_FAULTS; i++)
+    {
+        if ((faults & ((uint32_t)1 << i)) &&
+            (fault_table[i].reaction & reaction))
+        {
+            reasons |= ((uint32_t)1 << fault_table[i].reason_bit);
+        }
+    }
+
+    return reasons;
+}
+
+
+//=============================================================================
+//
+// fault_manager_get_definition()
+//
+//=============================================================================
+//
+const fault_definition_t *fault_manager_get_definition(
+    fault_id_t fault)
+{
+    if (fault >= NUM_FAULTS)
+    {
+        DEBUG("Invalid fault");
+        return NULL;
+    }
+
+    return &fault_table[fault];
+}
+
+
+//=============================================================================
+//
+// fault_manager_get_occurrences()
+//
+//=============================================================================
+//
+uint8_t fault_manager_get_occurrences(
+    fault_id_t fault)
+{
+    if (fault >= NUM_FAULTS)
+    {
+        DEBUG("Invalid fault");
+        return 0;
+    }
+
+    return fault_occurrences[fault];
+}
+
+
+//=============================================================================
+//
+// fault_manager_clear_history()
+//
+//=============================================================================
+//
+void fault_manager_clear_history()
+{
+    uint8_t i;
+
+    for (i = 0; i < NUM_FAULTS; i++)
+    {
+        fault_occurrences[i] = 0;
+    }
+
+    faults_history = faults_active;
+}
+
+
+//=============================================================================
+//
+// max_inverter_temperature(): Hottest phase of an inverter, in degree
+// Celcius.
+//
+//=============================================================================
+//
+static uint16_t max_inverter_temperature(device_instances_t device)
+{
+    uint16_t temperature =
+        max_of_three_uint16_t_values(skai_get_vissim_dcb_phase1_temperature(device),
+                                     skai_get_vissim_dcb_phase2_temperature(device),
+                                     skai_get_vissim_dcb_phase3_temperature(device));
+
+    return temperature / 10;
+}
+
+
+//=============================================================================
+//
+// Critical, high voltage off.
+//
+//=============================================================================
+//
+//
+// Check to see if battery power supply voltage is less than 11V
+// while the high voltage is on, so the DC-DC should be charging it.
+//
+static bool_t detect_aux_battery_dying(void)
+{
+    return (cvc_input_get_analog(CVC_AIN_A11_KEYSWITCH) <= AUX_BATTERY_DYING_THRESHOLD_MV)
+        && get_sm_status_enable_hv_systems()
+        && get_sm_pos_contactor_status();
+}
+
+//
+// Check to see if the 12V battery is above 8V.
+//
+static bool_t detect_aux_battery_under_voltage(void)
+{
+    return (cvc_input_get_analog(CVC_AIN_A11_KEYSWITCH) <
+            BATTERY_CRITICAL_FAULT_THRESHOLD_MV);
+}
+
+//
+// Must run every loop, not on CAN receive, as the BMS data going
+// stale is the absence of a receive.
+//
+static bool_t detect_battery_pack(void)
+{
+    return battery_pack_failure_status();
+}
+
+static bool_t detect_traction_inverter(void)
+{
+    return skai_get_vissim_error_status(ONE);
+}
+
+static bool_t detect_hydraulic_inverter(void)
+{
+    return skai_get_vissim_error_status(TWO);
+}
+
+static bool_t detect_can1(void)
+{
+    return (system_status.can1_status == CAN_ERROR_STATUS) ||
+           (system_status.can1_status == CAN_BUSOFF_STATUS);
+}
+
+static bool_t detect_can2(void)
+{
+    return (system_status.can2_status == CAN_ERROR_STATUS) ||
+           (system_status.can2_status == CAN_BUSOFF_STATUS);
+}
+
+static bool_t detect_can3(void)
+{
+    return (system_status.can3_status == CAN_ERROR_STATUS) ||
+           (system_status.can3_status == CAN_BUSOFF_STATUS);
+}
+
+static bool_t detect_master_module_not_running(void)
+{
+    return (system_status.master_module_state != MODULE_RUNNING_STATE);
+}
+
+static bool_t detect_system_errors(void)
+{
+    return (system_status.number_of_system_errors != 0);
+}
+
+static bool_t detect_precharge(void)
+{
+    return get_sm_precharge_failure_status();
+}
+
+
+//=============================================================================
+//
+// Critical, high voltage kept on.
+//
+//=============================================================================
+//
+static bool_t detect_traction_motor_over_temperature(void)
+{
+    return (skai_get_vissim_motor_temp_C(ONE) >
+            MOTOR_CRITICAL_FAULT_TEMPERATURE_THRESHOLD);
+}
+
+static bool_t detect_hydraulic_motor_over_temperature(void)
+{
+    return (skai_get_vissim_motor_temp_C(TWO) >
+            MOTOR_CRITICAL_FAULT_TEMPERATURE_THRESHOLD);
+}
+
+static bool_t detect_traction_inverter_over_temperature(void)
+{
+    return (max_inverter_temperature(ONE) >
+            INVERTER_CRITICAL_FAULT_TEMPERATURE_THRESHOLD);
+}
+
+static bool_t detect_hydraulic_inverter_over_temperature(void)
+{
+    return (max_inverter_temperature(TWO) >
+            INVERTER_CRITICAL_FAULT_TEMPERATURE_THRESHOLD);
+}
+
+
+//=============================================================================
+//
+// Warnings.
+//
+//=============================================================================
+//
+static bool_t detect_battery_warm(void)
+{
+    return (get_battery_pack_high_cell_max_temperature() >=
+            BATTERY_WARNING_TEMPERATURE_THRESHOLD);
+}
+
+//
+// The spread from the highest to the lowest cell of all the packs.
+// A pack that has not reported reads 0, so nothing is checked until
+// every BMS has fresh data.
+//
+static bool_t detect_cell_delta(void)
+{
+    if (!bms_fresh_data_1() || !bms_fresh_data_2() || !bms_fresh_data_3())
+    {
+        return FALSE;
+    }
+
+    const battery_pack_aggregate_t *aggregate = get_battery_pack_aggregate();
+
+    int32_t high_cell = aggregate->signal[PACK_SIGNAL_HIGH_CELL_VOLTAGE].max;
+    int32_t low_cell = aggregate->signal[PACK_SIGNAL_LOW_CELL_VOLTAGE].min;
+
+    return (high_cell >= low_cell)
+        && ((high_cell - low_cell) > CELL_DELTA_WARNING_THRESHOLD);
+}
+
+static bool_t detect_traction_motor_warm(void)
+{
+    return (skai_get_vissim_motor_temp_C(ONE) >
+            MOTOR_WARNING_TEMPERATURE_THRESHOLD);
+}
+
+static bool_t detect_hydraulic_motor_warm(void)
+{
+    return (skai_get_vissim_motor_temp_C(TWO) >
+            MOTOR_WARNING_TEMPERATURE_THRESHOLD);
+}
+
+static bool_t detect_traction_inverter_warm(void)
+{
+    return (max_inverter_temperature(ONE) >
+            INVERTER_WARNING_TEMPERATURE_THRESHOLD);
+}
+
+static bool_t detect_hydraulic_inverter_warm(void)
+{
+    return (max_inverter_temperature(TWO) >
+            INVERTER_WARNING_TEMPERATURE_THRESHOLD);
+}
+
+static bool_t detect_hv_isolation(void)
+{
+    return orion_get_flag2_high_voltage_isolation_fault(ONE)
+        || orion_get_flag2_high_voltage_isolation_fault(TWO)
+        || orion_get_flag2_high_voltage_isolation_fault(THREE);
+}
+
+static bool_t detect_low_soc(void)
+{
+    return (get_battery_pack_SOC() < LOW_SOC_WARNING_THRESHOLD);
+}
+
+//
+// A pack trending apart from the others (pack_divergence.c). The
+// flags have their own hysteresis, so there is no debounce.
+//
+static bool_t detect_pack_divergence(void)
+{
+    return pack_divergence_get_any_flagged();
+}
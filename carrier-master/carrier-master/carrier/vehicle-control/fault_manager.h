@@ -0,0 +1,179 @@
+/******************************************************************************
+ *
+ *        Name: fault_manager.h
+ *
+ * Description: Every fault of the vehicle is defined in one const
+ *              table in fault_manager.c: its detector, debounce time,
+ *              severity, reaction, J1939 SPN and FMI, and its bit in
+ *              the fault reason masks sent to the screen. All the
+ *              faults are detected together, in one pass, by
+ *              fault_manager_update(), and debounced on the debounce
+ *              bank (debounce_bank.c).
+ *
+ *              Each fault is:
+ *
+ *              PENDING: detected, but not yet for its debounce time.
+ *              ACTIVE : detected for at least its debounce time. It
+ *                       stops being active as soon as it is no
+ *                       longer detected.
+ *              HISTORY: has been active since start up, or since the
+ *                       history was last cleared.
+ *
+ *              The state machine only reads the reactions of the
+ *              active faults, ORed into one mask.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+
+#ifndef FAULT_MANAGER_H_
+#define FAULT_MANAGER_H_
+
+//
+// One entry per fault. There can be no more than 32 faults, one per
+// bit of the fault bitsets.
+//
+typedef enum
+{
+    //
+    // Critical, high voltage off.
+    //
+    FAULT_AUX_BATTERY_DYING = 0,
+    FAULT_AUX_BATTERY_UNDER_VOLTAGE,
+    FAULT_BATTERY_PACK,
+    FAULT_TRACTION_INVERTER,
+    FAULT_HYDRAULIC_INVERTER,
+    FAULT_CAN1,
+    FAULT_CAN2,
+    FAULT_CAN3,
+    FAULT_MASTER_MODULE_NOT_RUNNING,
+    FAULT_SYSTEM_ERRORS,
+    FAULT_PRECHARGE,
+
+    //
+    // Critical, high voltage kept on.
+    //
+    FAULT_TRACTION_MOTOR_OVER_TEMPERATURE,
+    FAULT_HYDRAULIC_MOTOR_OVER_TEMPERATURE,
+    FAULT_TRACTION_INVERTER_OVER_TEMPERATURE,
+    FAULT_HYDRAULIC_INVERTER_OVER_TEMPERATURE,
+
+    //
+    // Warnings, yellow warning light on the screen.
+    //
+    FAULT_BATTERY_WARM,
+    FAULT_CELL_DELTA,
+    FAULT_TRACTION_MOTOR_WARM,
+    FAULT_HYDRAULIC_MOTOR_WARM,
+    FAULT_TRACTION_INVERTER_WARM,
+    FAULT_HYDRAULIC_INVERTER_WARM,
+    FAULT_HV_ISOLATION,
+    FAULT_LOW_SOC,
+    FAULT_PACK_DIVERGENCE,
+
+    NUM_FAULTS
+} fault_id_t;
+
+typedef enum
+{
+    FAULT_SEVERITY_WARNING = 0,
+    FAULT_SEVERITY_CRITICAL
+} fault_severity_t;
+
+//
+// Reactions, one bit each, so the reactions of all the active faults
+// can be ORed into one mask.
+//
+#define FAULT_REACTION_NONE     0x00
+#define FAULT_REACTION_HV_OFF   0x01    // CRITICAL_FAILURE_HV_OFF
+#define FAULT_REACTION_HV_ON    0x02    // CRITICAL_FAILURE_HV_ON
+#define FAULT_REACTION_WARNING  0x04    // Yellow warning light
+
+//
+// Detection flags.
+//
+#define FAULT_DETECT_EVERY_LOOP 0x00
+
+//
+// The detector only reads received CAN data. It is only run again
+// when a CAN message has been received or has timed out.
+//
+#define FAULT_DETECT_ON_CAN_RX  0x01
+
+//
+// Start of the J1939 proprietary SPN range. The faults without a
+// standard SPN are numbered from here; proprietary SPNs from
+// FAULT_SPN_PROPRIETARY_BASE + 0x100 are used by the DM1 broadcast
+// (j1939_dm1.c).
+//
+#define FAULT_SPN_PROPRIETARY_BASE 520192
+
+typedef bool_t (*fault_detector_t)(void);
+
+typedef struct
+{
+    fault_detector_t detect;
+    uint32_t         debounce_ms;
+    fault_severity_t severity;
+    uint8_t          reaction;
+    uint8_t          flags;
+
+    //
+    // Bit of the fault in the reason mask of its reaction, see
+    // fault_manager_get_reasons().
+    //
+    uint8_t          reason_bit;
+
+    uint32_t         spn;
+    uint8_t          fmi;
+} fault_definition_t;
+
+/******************************************************************************
+ *
+ *        Name: fault_manager_update()
+ *
+ * Description: Detects every fault in one pass, and latches it into
+ *              its debounce bank channel. Called once a loop from
+ *              User_App(), before the state machine inputs are
+ *              populated.
+ *
+ ******************************************************************************
+ */
+void fault_manager_update();
+
+//
+// The reactions of all the active faults, ORed together.
+//
+uint8_t fault_manager_get_reactions();
+
+//
+// Bitsets of the faults. Bit n is fault_id_t n.
+//
+uint32_t fault_manager_get_detected();
+uint32_t fault_manager_get_pending();
+uint32_t fault_manager_get_active();
+uint32_t fault_manager_get_history();
+
+//
+// The detected, or only the active, faults with a reaction, as a
+// mask of their reason_bit. These are the fault reason masks sent to
+// the screen and in the critical failure message.
+//
+uint32_t fault_manager_get_reasons(uint8_t reaction, bool_t active_only);
+
+//
+// The definition of a fault, and the number of times it has become
+// active since start up (saturates at 255). NULL and 0 for an
+// invalid fault.
+//
+const fault_definition_t *fault_manager_get_definition(fault_id_t fault);
+uint8_t fault_manager_get_occurrences(fault_id_t fault);
+
+//
+// Clear the history and occurrence counts of every fault.
+//
+void fault_manager_clear_history();
+
+#endif // FAULT_MANAGER_H_
@@ -0,0 +1,331 @@
+/******************************************************************************
+ *
+ *        Name: flight_recorder.c
+ *
+ * Description: State machine transition recorder. See
+ *              flight_recorder.h.
+ *
+ *              The ring is kept in the same image that is written to
+ *              the external serial flash, so a flush is a single
+ *              erase and a single write of that image.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "reserved.h"
+#include "Prototypes.h"
+#include "Prototypes_CAN.h"
+#include "Prototypes_RTCC.h"
+#include "Constants.h"
+#include "typedefs.h"
+#include "can_service.h"
+#include "can_service_devices.h"
+#include "time_service.h"
+#include "state_machine.h"
+#include "flight_recorder.h"
+
+//
+// The ring is saved in the first sectors of the external serial
+// flash.
+//
+#define FLIGHT_RECORDER_FLASH_SECTORS  4
+#define FLIGHT_RECORDER_FLASH_SIZE \
+    (FLIGHT_RECORDER_FLASH_SECTORS * EXTERNAL_MEMORY_SECTOR_SIZE)
+
+#define FLIGHT_RECORDER_FLASH_START \
+    ((FLASH_POINTER_TYPE)EXTERNAL_MEMORY_BASE_ADDRESS)
+#define FLIGHT_RECORDER_FLASH_END \
+    ((FLASH_POINTER_TYPE)(EXTERNAL_MEMORY_BASE_ADDRESS + \
+                          FLIGHT_RECORDER_FLASH_SIZE - 1))
+
+//
+// Marks a saved image. Changed whenever flight_record_t changes, so
+// an image of an older layout is not restored.
+//
+#define FLIGHT_RECORDER_MAGIC          0x46520001
+
+typedef struct
+{
+    uint32_t magic;
+    uint16_t count;
+    uint16_t next;
+    uint16_t sequence;
+    uint16_t spare;
+    flight_record_t records[FLIGHT_RECORDER_NUM_RECORDS];
+} flight_recorder_image_t;
+
+//
+// The flash is written 8 bytes at a time, so the image is padded to
+// a multiple of 8 bytes.
+//
+typedef union
+{
+    flight_recorder_image_t image;
+    uint32_t words[((sizeof(flight_recorder_image_t) + 7) / 8) * 2];
+} flight_recorder_flash_t;
+
+typedef char flight_recorder_flash_size_check[
+    (sizeof(flight_recorder_flash_t) <= FLIGHT_RECORDER_FLASH_SIZE) ? 1 : -1];
+
+//=============================================================================
+//
+// Static Variables
+//
+//=============================================================================
+//
+static flight_recorder_flash_t recorder;
+
+//
+// TRUE if there are records that have not been written to flash.
+//
+static bool_t recorder_dirty = FALSE;
+
+//
+// Age of the next record to send in a dump. Not dumping when it is
+// equal to dump_count.
+//
+static uint8_t dump_index = 0;
+static uint8_t dump_count = 0;
+
+
+/******************************************************************************
+ *
+ *        Name: flight_recorder_init()
+ *
+ * Description: Reads the image saved by the last flush. If there is
+ *              no valid image, for example on the first start up or
+ *              after the record layout changed, the ring starts
+ *              empty.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+void flight_recorder_init()
+{
+    FLASH_COMMAND_STATUS_ status =
+        Flash_Read_Block(FLIGHT_RECORDER_FLASH_START,
+                         (uint8_t *)recorder.words,
+                         sizeof(recorder.words));
+
+    if ((status != FLASH_COMMAND_SUCCESSFUL) ||
+        (recorder.image.magic != FLIGHT_RECORDER_MAGIC) ||
+        (recorder.image.count > FLIGHT_RECORDER_NUM_RECORDS) ||
+        (recorder.image.next >= FLIGHT_RECORDER_NUM_RECORDS))
+    {
+        memset(&recorder, 0, sizeof(recorder));
+        recorder.image.magic = FLIGHT_RECORDER_MAGIC;
+    }
+
+    recorder_dirty = FALSE;
+    dump_index = 0;
+    dump_count = 0;
+}
+
+
+/******************************************************************************
+ *
+ *        Name: flight_recorder_record()
+ *
+ * Description: Fills in the next record of the ring, overwriting the
+ *              oldest record once the ring is full.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+void flight_recorder_record(
+    state_t from_state,
+    state_t to_state,
+    uint16_t inputs,
+    uint32_t critical_fault_hv_off,
+    uint32_t critical_fault_hv_on)
+{
+    flight_record_t *record =
+        &recorder.image.records[recorder.image.next];
+
+    struct tm now = Get_DateTime();
+
+    record->stamp_ms = time_service_get_ms();
+    record->critical_fault_hv_off = critical_fault_hv_off;
+    record->critical_fault_hv_on = critical_fault_hv_on;
+    record->inputs = inputs;
+    record->sequence = recorder.image.sequence++;
+    record->from_state = (uint8_t)from_state;
+    record->to_state = (uint8_t)to_state;
+    record->year = (uint8_t)now.tm_year;
+    record->month = (uint8_t)(now.tm_mon + 1);
+    record->day = (uint8_t)now.tm_mday;
+    record->hour = (uint8_t)now.tm_hour;
+    record->minute = (uint8_t)now.tm_min;
+    record->second = (uint8_t)now.tm_sec;
+
+    recorder.image.next =
+        (recorder.image.next + 1) % FLIGHT_RECORDER_NUM_RECORDS;
+
+    if (recorder.image.count < FLIGHT_RECORDER_NUM_RECORDS)
+    {
+        recorder.image.count++;
+    }
+
+    recorder_dirty = TRUE;
+}
+
+
+//=============================================================================
+//
+// flight_recorder_request_dump()
+//
+//=============================================================================
+//
+void flight_recorder_request_dump()
+{
+    dump_index = 0;
+    dump_count = (uint8_t)recorder.image.count;
+}
+
+
+/******************************************************************************
+ *
+ *        Name: flight_recorder_update()
+ *
+ * Description: Sends one record of a dump in progress. The records
+ *              are sent oldest first. A record made during the dump
+ *              shifts the ages by one, so it may repeat a record, but
+ *              each message carries the sequence number of its
+ *              record.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+void flight_recorder_update()
+{
+    Can_Message_ tx_message;
+    can_data_t *data_ptr = (can_data_t *)tx_message.data;
+
+    if (dump_index >= dump_count)
+    {
+        return;
+    }
+
+    const flight_record_t *record =
+        flight_recorder_get_record(dump_index);
+
+    dump_index++;
+
+    if (record == NULL)
+    {
+        return;
+    }
+
+    tx_message.length = 8;
+    tx_message.type = EXTENDED;
+
+    tx_message.identifier = FLIGHT_RECORDER_DUMP_ID_1;
+    data_ptr->MDL.bit16.HALF0 = BYTE_SWAP16(record->sequence);
+    data_ptr->MDL.bit8.BYTE2 = record->from_state;
+    data_ptr->MDL.bit8.BYTE3 = record->to_state;
+    data_ptr->MDH.bit32 = BYTE_SWAP32(record->stamp_ms);
+    Send_CAN_Message(0, CAN3, tx_message);
+
+    tx_message.identifier = FLIGHT_RECORDER_DUMP_ID_2;
+    data_ptr->MDL.bit32 = BYTE_SWAP32(record->critical_fault_hv_off);
+    data_ptr->MDH.bit32 = BYTE_SWAP32(record->critical_fault_hv_on);
+    Send_CAN_Message(0, CAN3, tx_message);
+
+    tx_message.identifier = FLIGHT_RECORDER_DUMP_ID_3;
+    data_ptr->MDL.bit16.HALF0 = BYTE_SWAP16(record->inputs);
+    data_ptr->MDL.bit8.BYTE2 = record->year;
+    data_ptr->MDL.bit8.BYTE3 = record->month;
+    data_ptr->MDH.bit8.BYTE0 = record->day;
+    data_ptr->MDH.bit8.BYTE1 = record->hour;
+    data_ptr->MDH.bit8.BYTE2 = record->minute;
+    data_ptr->MDH.bit8.BYTE3 = record->second;
+    Send_CAN_Message(0, CAN3, tx_message);
+}
+
+
+/******************************************************************************
+ *
+ *        Name: flight_recorder_flush()
+ *
+ * Description: Erases the flight recorder sectors of the external
+ *              serial flash and writes the image. Nothing is done if
+ *              nothing was recorded since the last flush, so calling
+ *              this on every loop of the shutdown sequence costs one
+ *              erase and write per power cycle at most.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+void flight_recorder_flush()
+{
+    if (!recorder_dirty)
+    {
+        return;
+    }
+
+    if (Flash_Erase_Block(FLIGHT_RECORDER_FLASH_START,
+                          FLIGHT_RECORDER_FLASH_END) != FLASH_COMMAND_SUCCESSFUL)
+    {
+        DEBUG("Flight recorder flash erase failed");
+        return;
+    }
+
+    if (Flash_Write_Block((FLASH_POINTER_TYPE)recorder.words,
+                          FLIGHT_RECORDER_FLASH_START,
+                          sizeof(recorder.words)) != FLASH_COMMAND_SUCCESSFUL)
+    {
+        DEBUG("Flight recorder flash write failed");
+        return;
+    }
+
+    recorder_dirty = FALSE;
+}
+
+
+//=============================================================================
+//
+// flight_recorder_get_count()
+//
+//=============================================================================
+//
+uint8_t flight_recorder_get_count()
+{
+    return (uint8_t)recorder.image.count;
+}
+
+
+//=============================================================================
+//
+// flight_recorder_get_record()
+//
+//=============================================================================
+//
+const flight_record_t *flight_recorder_get_record(uint8_t index)
+{
+    uint16_t oldest;
+
+    if (index >= recorder.image.count)
+    {
+        return NULL;
+    }
+
+    oldest = (recorder.image.next + FLIGHT_RECORDER_NUM_RECORDS
+              - recorder.image.count) % FLIGHT_RECORDER_NUM_RECORDS;
+
+    return &recorder.image.records[
+        (oldest + index) % FLIGHT_RECORDER_NUM_RECORDS];
+}
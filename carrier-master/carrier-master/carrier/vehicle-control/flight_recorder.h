@@ -0,0 +1,117 @@
+/******************************************************************************
+ *
+ *        Name: flight_recorder.h
+ *
+ * Description: Records every state machine transition in a fixed
+ *              size ring in RAM, so a drop into CRITICAL_FAILURE_HV_OFF
+ *              or E_STOP in the field can be explained afterwards.
+ *
+ *              Recording a transition is a copy of one record into
+ *              the ring. The ring is written to the external serial
+ *              flash when the CVC shuts down and is read back at
+ *              start up, so the records survive a power cycle.
+ *
+ *              The ring is read over CAN3. A message with the id
+ *              FLIGHT_RECORDER_DUMP_REQUEST_ID starts a dump of every
+ *              record, oldest first, one record per loop. Each record
+ *              is sent as three messages:
+ *
+ *              0xF00B: sequence (16 bits), from state, to state,
+ *                      time_service ms stamp (32 bits)
+ *              0xF00C: critical_fault_hv_off, critical_fault_hv_on
+ *              0xF00D: inputs (16 bits), RTCC year (since 1900),
+ *                      month, day, hour, minute, second
+ *
+ *              Include state_machine.h before this file.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+
+#ifndef FLIGHT_RECORDER_H_
+#define FLIGHT_RECORDER_H_
+
+#define FLIGHT_RECORDER_NUM_RECORDS       32
+
+#define FLIGHT_RECORDER_DUMP_REQUEST_ID   0xF00E
+#define FLIGHT_RECORDER_DUMP_ID_1         0xF00B
+#define FLIGHT_RECORDER_DUMP_ID_2         0xF00C
+#define FLIGHT_RECORDER_DUMP_ID_3         0xF00D
+
+//
+// Bits of the inputs member of a record. Bits 0 to 8 are the guard
+// inputs of run_state_machine().
+//
+#define FLIGHT_RECORDER_INPUT_IN_NEUTRAL            (1 << 9)
+#define FLIGHT_RECORDER_INPUT_STOP_CHARGING_BUTTON  (1 << 10)
+
+//
+// One transition. 24 bytes, a multiple of the 8 byte minimum flash
+// write.
+//
+typedef struct
+{
+    uint32_t stamp_ms;
+    uint32_t critical_fault_hv_off;
+    uint32_t critical_fault_hv_on;
+    uint16_t inputs;
+    uint16_t sequence;
+    uint8_t  from_state;
+    uint8_t  to_state;
+    uint8_t  year;
+    uint8_t  month;
+    uint8_t  day;
+    uint8_t  hour;
+    uint8_t  minute;
+    uint8_t  second;
+} flight_record_t;
+
+/******************************************************************************
+ *
+ *        Name: flight_recorder_init()
+ *
+ * Description: Restores the ring saved by the last shutdown from the
+ *              external serial flash. Called once from User_Init().
+ *
+ ******************************************************************************
+ */
+void flight_recorder_init();
+
+//
+// Record a transition. Called by run_state_machine() when the state
+// changes. The fault masks are the raw, not debounced, masks.
+//
+void flight_recorder_record(state_t from_state,
+                            state_t to_state,
+                            uint16_t inputs,
+                            uint32_t critical_fault_hv_off,
+                            uint32_t critical_fault_hv_on);
+
+//
+// Start a dump of the ring over CAN3. Called when the dump request
+// message is received.
+//
+void flight_recorder_request_dump();
+
+//
+// Sends the next record of a dump in progress. Called once a loop
+// from User_App().
+//
+void flight_recorder_update();
+
+//
+// Write the ring to the external serial flash, if anything was
+// recorded since it was last written. Called on shutdown.
+//
+void flight_recorder_flush();
+
+//
+// Number of records in the ring, and a record by age, 0 being the
+// oldest. NULL if there is no such record.
+//
+uint8_t flight_recorder_get_count();
+const flight_record_t *flight_recorder_get_record(uint8_t index);
+
+#endif // FLIGHT_RECORDER_H_
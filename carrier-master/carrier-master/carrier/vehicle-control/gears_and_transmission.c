@@ -30,6 +30,7 @@
 #include "state_machine.h"
 #include "timer_service.h"
 #include "hydraulic_system.h"
+#include "skai2_inverter_vissim.h"
 
 //
 // main_system_pressure_sensor minimum threshold
@@ -37,6 +38,14 @@
 #define TRANSMISSION_SYSTEM_PRESSURE_SENSOR_MIN_THRESHOLD   200
 #define EEVAR_MAXIMUM_ALLOWABLE_GEARS               2
 
+//
+// Ground speed per traction motor rpm in each gear, in 1/65536 mm/s.
+// 0.0019043539, 0.0039677741 and 0.0069031280 km/h per rpm.
+//
+#define GROUND_SPEED_1ST_GEAR_MMPS_PER_RPM_Q16      34668
+#define GROUND_SPEED_2ND_GEAR_MMPS_PER_RPM_Q16      72231
+#define GROUND_SPEED_3RD_GEAR_MMPS_PER_RPM_Q16      125669
+
 //
 // Function Prototypes
 //
@@ -295,3 +304,45 @@ shifter_position_t get_shifter_gear_position()
     return gear_position;
 
 }
+
+/******************************************************************************
+ *
+ *        Name: get_ground_speed_mmps()
+ *
+ * Description: The ground speed of the vehicle in mm/s, from the
+ *              traction motor rpm and the gear selected. Zero in
+ *              neutral.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+uint16_t get_ground_speed_mmps()
+{
+    uint32_t mmps_per_rpm_q16 = 0;
+
+    //
+    // The rpm is signed, negative in reverse.
+    //
+    uint32_t abs_motor_rpm =
+        (uint32_t)abs((int16_t)skai_get_vissim_motor_rpm(ONE));
+
+    if (gear_position == SHIFTER_1st_GEAR)
+    {
+        mmps_per_rpm_q16 = GROUND_SPEED_1ST_GEAR_MMPS_PER_RPM_Q16;
+    }
+    else if (gear_position == SHIFTER_2nd_GEAR)
+    {
+        mmps_per_rpm_q16 = GROUND_SPEED_2ND_GEAR_MMPS_PER_RPM_Q16;
+    }
+    else if (gear_position == SHIFTER_3rd_GEAR)
+    {
+        mmps_per_rpm_q16 = GROUND_SPEED_3RD_GEAR_MMPS_PER_RPM_Q16;
+    }
+
+    //
+    // 32768 rpm at the highest ratio is still below 2^32.
+    //
+    return (uint16_t)((abs_motor_rpm * mmps_per_rpm_q16) >> 16);
+}
@@ -42,6 +42,12 @@ void gears_and_transmission_control();
 shifter_position_t get_shifter_direction();
 shifter_position_t get_shifter_gear_position();
 
+//
+// Ground speed of the vehicle in mm/s, from the traction motor rpm
+// and the gear selected.
+//
+uint16_t get_ground_speed_mmps();
+
 
 
 #endif
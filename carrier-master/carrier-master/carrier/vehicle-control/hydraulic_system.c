@@ -41,6 +41,7 @@
 #include "state_machine.h"
 #include "cvc_debug_msgs.h"
 #include "pdm_device.h"
+#include "emergency_stop.h"
 
 //
 // The thresholds for hydraulic system pressure on the carrier.
@@ -50,6 +51,7 @@
 #define MIN_TRANSMISSION_OIL_PRESSURE_THRESHOLD    175
 #define SOFT_START_SOLENOID_UPPER_RPM_LIMIT        1000
 #define SOFT_START_SOLENOID_LOWER_RPM_LIMIT        100
+#define SHUTTLE_SHIFT_TIME_MS                      3000
 
 
 //=============================================================================
@@ -85,29 +87,15 @@ void hydraulic_system_control(device_instances_t device_hydraulic_inverter,
                               device_instances_t device_transmission_inverter)
 {
     //
-    // shuttle shifter timer
+    // shuttle shifter timer, would change from a 1 to 0, after the
+    // specified time.
     //
-    static timer_t shuttle_shift_timer;
+    static timer_t shuttle_shift_timer =
+        TIMER_INIT_MS(SHUTTLE_SHIFT_TIME_MS, FALLING);
     bool_t shuttle_shift = FALSE;
     bool_t transmission_inverter_enable = FALSE;
     uint16_t hydraulic_inverter_enable = FALSE;
 
-    static bool_t first_pass = TRUE;
-
-    if (first_pass)
-    {
-
-        //
-        // Setup the shuttle_shift_timer, would change from a 1 to 0,
-        // after the specified time.
-        //
-        shuttle_shift_timer =
-            timer_setup(get_THREE_SECONDS(), FALLING);
-
-        first_pass = FALSE;
-
-    }
-
     //
     // Get the direction of the shifter. Forward, reverse or neutral.
     //
@@ -200,6 +188,9 @@ void hydraulic_system_control(device_instances_t device_hydraulic_inverter,
     // 4) The vehilce is not in post_charge_idle.
     //
     // 5) The vehilce is has no critical_failure_hv_on failure.
+    //
+    // 6) No E-stop is pressed and the master switch is closed (see
+    //    emergency_stop.c).
 
     //
     // get the current state of the state machine
@@ -211,6 +202,7 @@ void hydraulic_system_control(device_instances_t device_hydraulic_inverter,
     //
     hydraulic_inverter_enable =
         (uint16_t)(sm_enable_hv_system
+                  && !emergency_stop_get_inverters_disabled()
                   && shuttle_shift
                   && (sm_state != POST_CHARGE_IDLE)
                   && (sm_state != CRITICAL_FAILURE_HV_ON)
@@ -241,6 +233,7 @@ void hydraulic_system_control(device_instances_t device_hydraulic_inverter,
 
     transmission_inverter_enable =
         (bool_t)(sm_enable_hv_system
+                 && !emergency_stop_get_inverters_disabled()
                  && shuttle_shift
                  && (sm_state != POST_CHARGE_IDLE)
                  && (sm_state != CRITICAL_FAILURE_HV_ON)
@@ -403,7 +396,9 @@ uint16_t main_sys_pressure()
 {
 
     uint16_t main_system_pressure =
-        (uint16_t)(1.25 * IN_E10_main_sys_pressure_sensor_signal - 624.99);
+        (uint16_t)(1.25 *
+                   cvc_input_get_analog(CVC_AIN_E10_MAIN_SYS_PRESSURE_SENSOR) -
+                   624.99);
 
     return main_system_pressure;
 
@@ -0,0 +1,397 @@
+/******************************************************************************
+ *
+ *        Name: j1939_dm1.c
+ *
+ * Description: J1939 DM1 broadcast of the CVC active faults. See
+ *              j1939_dm1.h.
+ *
+ *              The DM1 data is built into dm1_data, and copied into
+ *              bam_data when a BAM is started, so the DTCs can change
+ *              while a BAM is being sent.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "Prototypes.h"
+#include "Prototypes_CAN.h"
+#include "Constants.h"
+#include "typedefs.h"
+#include "can_service.h"
+#include "can_service_devices.h"
+#include "time_service.h"
+#include "fault_manager.h"
+#include "j1939_dm1.h"
+
+#define J1939_DM1_CAN_LINE          CAN3
+
+//
+// 29 bit identifiers: priority 6 for the DM1, priority 7 for the
+// transport protocol.
+//
+#define J1939_DM1_ID \
+    (((uint32_t)6 << 26) | ((uint32_t)J1939_PGN_DM1 << 8) | J1939_CVC_SOURCE_ADDRESS)
+#define J1939_DM1_TP_CM_ID \
+    (((uint32_t)7 << 26) | ((uint32_t)(J1939_PGN_TP_CM | J1939_GLOBAL_ADDRESS) << 8) | J1939_CVC_SOURCE_ADDRESS)
+#define J1939_DM1_TP_DT_ID \
+    (((uint32_t)7 << 26) | ((uint32_t)(J1939_PGN_TP_DT | J1939_GLOBAL_ADDRESS) << 8) | J1939_CVC_SOURCE_ADDRESS)
+
+#define J1939_DM1_PERIOD_MS         1000
+#define J1939_DM1_BAM_PACKET_MS     50
+
+//
+// Lamp status byte: two bits each for the malfunction indicator,
+// red stop, amber warning and protect lamps. 01 is on.
+//
+#define J1939_DM1_LAMP_RED_STOP     0x10
+#define J1939_DM1_LAMP_AMBER        0x04
+
+//
+// Flash byte: 11 for every lamp, unavailable / do not flash.
+//
+#define J1939_DM1_LAMP_NO_FLASH     0xFF
+
+//
+// A timed out receive message is reported against the source address
+// of the message, as FMI 9, abnormal update rate.
+//
+#define J1939_DM1_SPN_RX_TIMEOUT    (FAULT_SPN_PROPRIETARY_BASE + 0x100)
+#define J1939_DM1_FMI_RX_TIMEOUT    9
+
+#define J1939_DM1_OC_NOT_AVAILABLE  0x7F
+#define J1939_DM1_OC_MAX            0x7E
+
+//
+// Two lamp bytes and four bytes per DTC.
+//
+#define J1939_DM1_DATA_SIZE         (2 + (4 * J1939_DM1_MAX_DTCS))
+
+//
+// The largest number of timed out receive messages looked at.
+//
+#define J1939_DM1_MAX_RX_TIMEOUTS   16
+
+//=============================================================================
+//
+// Static Variables
+//
+//=============================================================================
+//
+static uint8_t dm1_data[J1939_DM1_DATA_SIZE];
+static uint16_t dm1_size = 0;
+static uint8_t dtc_count = 0;
+static bool_t dm1_changed = FALSE;
+
+static bool_t dm1_sent = FALSE;
+static uint32_t last_send_ms = 0;
+static uint32_t last_change_send_ms = 0;
+
+static uint8_t bam_data[J1939_DM1_DATA_SIZE];
+static uint16_t bam_size = 0;
+static uint8_t bam_packets = 0;
+static uint8_t bam_next_packet = 0;
+static uint32_t bam_packet_ms = 0;
+
+static void j1939_dm1_build();
+static void j1939_dm1_add_dtc(uint32_t spn, uint8_t fmi, uint8_t occurrences);
+static void j1939_dm1_send();
+static void j1939_dm1_send_bam_packet();
+
+
+/******************************************************************************
+ *
+ *        Name: j1939_dm1_update()
+ *
+ * Description: See j1939_dm1.h.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+void j1939_dm1_update()
+{
+    static bool_t first_pass = TRUE;
+    static uint32_t last_active_faults = 0;
+    static uint32_t last_rx_change_count = 0;
+
+    uint32_t active_faults = fault_manager_get_active();
+    uint32_t rx_change_count = fvt_can_get_rx_change_count();
+
+    //
+    // The DTCs only change when the active faults change, or when a
+    // receive message times out or is received again.
+    //
+    if (first_pass ||
+        (active_faults != last_active_faults) ||
+        (rx_change_count != last_rx_change_count))
+    {
+        j1939_dm1_build();
+
+        last_active_faults = active_faults;
+        last_rx_change_count = rx_change_count;
+        first_pass = FALSE;
+    }
+
+    //
+    // Finish sending a BAM before starting another DM1.
+    //
+    if (bam_next_packet < bam_packets)
+    {
+        if (time_service_ms_since(bam_packet_ms) >= J1939_DM1_BAM_PACKET_MS)
+        {
+            j1939_dm1_send_bam_packet();
+        }
+
+        return;
+    }
+
+    if (!dm1_sent ||
+        (time_service_ms_since(last_send_ms) >= J1939_DM1_PERIOD_MS))
+    {
+        j1939_dm1_send();
+    }
+    else if (dm1_changed &&
+             (time_service_ms_since(last_change_send_ms) >= J1939_DM1_PERIOD_MS))
+    {
+        j1939_dm1_send();
+        last_change_send_ms = last_send_ms;
+    }
+}
+
+
+//=============================================================================
+//
+// j1939_dm1_get_dtc_count()
+//
+//=============================================================================
+//
+uint8_t j1939_dm1_get_dtc_count()
+{
+    return dtc_count;
+}
+
+
+/******************************************************************************
+ *
+ *        Name: j1939_dm1_build()
+ *
+ * Description: Builds the DM1 data from the active faults and the
+ *              timed out receive messages. dm1_changed is set if the
+ *              data differs from the data last sent.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+static void j1939_dm1_build()
+{
+    static uint8_t previous_data[J1939_DM1_DATA_SIZE];
+    static uint16_t previous_size = 0;
+
+    can_rx_timeout_status_t timeouts[J1939_DM1_MAX_RX_TIMEOUTS];
+    uint32_t active_faults = fault_manager_get_active();
+    uint8_t lamps = 0;
+    uint8_t timeout_count;
+    uint8_t i;
+
+    memcpy(previous_data, dm1_data, dm1_size);
+    previous_size = dm1_size;
+
+    dtc_count = 0;
+    dm1_size = 2;
+
+    for (i = 0; i < NUM_FAULTS; i++)
+    {
+        if (active_faults & ((uint32_t)1 << i))
+        {
+            const fault_definition_t *fault =
+                fault_manager_get_definition((fault_id_t)i);
+            uint8_t occurrences = fault_manager_get_occurrences((fault_id_t)i);
+
+            if (occurrences > J1939_DM1_OC_MAX)
+            {
+                occurrences = J1939_DM1_OC_MAX;
+            }
+
+            lamps |= (fault->severity == FAULT_SEVERITY_CRITICAL) ?
+                J1939_DM1_LAMP_RED_STOP : J1939_DM1_LAMP_AMBER;
+
+            j1939_dm1_add_dtc(fault->spn, fault->fmi, occurrences);
+        }
+    }
+
+    timeout_count =
+        fvt_can_get_timed_out_receive_ids(timeouts, J1939_DM1_MAX_RX_TIMEOUTS);
+
+    for (i = 0; i < timeout_count; i++)
+    {
+        uint8_t source_address = (uint8_t)(timeouts[i].can_id & 0xFF);
+        uint8_t j;
+
+        //
+        // One DTC per source address, however many of its messages
+        // have timed out.
+        //
+        for (j = 0; j < i; j++)
+        {
+            if ((uint8_t)(timeouts[j].can_id & 0xFF) == source_address)
+            {
+                break;
+            }
+        }
+
+        if (j == i)
+        {
+            lamps |= J1939_DM1_LAMP_AMBER;
+
+            j1939_dm1_add_dtc(J1939_DM1_SPN_RX_TIMEOUT + source_address,
+                              J1939_DM1_FMI_RX_TIMEOUT,
+                              J1939_DM1_OC_NOT_AVAILABLE);
+        }
+    }
+
+    dm1_data[0] = lamps;
+    dm1_data[1] = J1939_DM1_LAMP_NO_FLASH;
+
+    //
+    // No DTC: an all zero DTC, padded to a single frame.
+    //
+    if (dtc_count == 0)
+    {
+        dm1_data[2] = 0;
+        dm1_data[3] = 0;
+        dm1_data[4] = 0;
+        dm1_data[5] = 0;
+        dm1_size = 6;
+    }
+
+    if ((dm1_size != previous_size) ||
+        (memcmp(dm1_data, previous_data, dm1_size) != 0))
+    {
+        dm1_changed = TRUE;
+    }
+}
+
+
+//=============================================================================
+//
+// j1939_dm1_add_dtc(): SPN, FMI, conversion method 0 and occurrence
+// count, in four bytes.
+//
+//=============================================================================
+//
+static void j1939_dm1_add_dtc(
+    uint32_t spn,
+    uint8_t fmi,
+    uint8_t occurrences)
+{
+    if (dtc_count >= J1939_DM1_MAX_DTCS)
+    {
+        return;
+    }
+
+    dm1_data[dm1_size++] = (uint8_t)(spn & 0xFF);
+    dm1_data[dm1_size++] = (uint8_t)((spn >> 8) & 0xFF);
+    dm1_data[dm1_size++] = (uint8_t)(((spn >> 11) & 0xE0) | (fmi & 0x1F));
+    dm1_data[dm1_size++] = (uint8_t)(occurrences & 0x7F);
+
+    dtc_count++;
+}
+
+
+/******************************************************************************
+ *
+ *        Name: j1939_dm1_send()
+ *
+ * Description: Sends the DM1 in a single frame if it fits, otherwise
+ *              sends the BAM announce and starts sending the data
+ *              packets.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+static void j1939_dm1_send()
+{
+    Can_Message_ tx_message;
+    uint8_t i;
+
+    tx_message.length = 8;
+    tx_message.type = EXTENDED;
+
+    if (dm1_size <= 8)
+    {
+        tx_message.identifier = J1939_DM1_ID;
+
+        for (i = 0; i < 8; i++)
+        {
+            tx_message.data[i] = (i < dm1_size) ? dm1_data[i] : 0xFF;
+        }
+
+        Send_CAN_Message(0, J1939_DM1_CAN_LINE, tx_message);
+    }
+    else
+    {
+        memcpy(bam_data, dm1_data, dm1_size);
+        bam_size = dm1_size;
+        bam_packets = (uint8_t)((bam_size + 6) / 7);
+        bam_next_packet = 0;
+
+        tx_message.identifier = J1939_DM1_TP_CM_ID;
+        tx_message.data[0] = J1939_TP_CM_BAM;
+        tx_message.data[1] = (uint8_t)(bam_size & 0xFF);
+        tx_message.data[2] = (uint8_t)(bam_size >> 8);
+        tx_message.data[3] = bam_packets;
+        tx_message.data[4] = 0xFF;
+        tx_message.data[5] = (uint8_t)(J1939_PGN_DM1 & 0xFF);
+        tx_message.data[6] = (uint8_t)((J1939_PGN_DM1 >> 8) & 0xFF);
+        tx_message.data[7] = (uint8_t)((J1939_PGN_DM1 >> 16) & 0xFF);
+
+        Send_CAN_Message(0, J1939_DM1_CAN_LINE, tx_message);
+
+        bam_packet_ms = time_service_get_ms();
+    }
+
+    dm1_sent = TRUE;
+    dm1_changed = FALSE;
+    last_send_ms = time_service_get_ms();
+}
+
+
+//=============================================================================
+//
+// j1939_dm1_send_bam_packet(): the next data packet of the BAM in
+// progress. Sequence numbers start at 1; the last packet is padded
+// with 0xFF.
+//
+//=============================================================================
+//
+static void j1939_dm1_send_bam_packet()
+{
+    Can_Message_ tx_message;
+    uint16_t offset = (uint16_t)bam_next_packet * 7;
+    uint8_t i;
+
+    tx_message.identifier = J1939_DM1_TP_DT_ID;
+    tx_message.length = 8;
+    tx_message.type = EXTENDED;
+    tx_message.data[0] = (uint8_t)(bam_next_packet + 1);
+
+    for (i = 0; i < 7; i++)
+    {
+        tx_message.data[i + 1] =
+            ((offset + i) < bam_size) ? bam_data[offset + i] : 0xFF;
+    }
+
+    Send_CAN_Message(0, J1939_DM1_CAN_LINE, tx_message);
+
+    bam_next_packet++;
+    bam_packet_ms = time_service_get_ms();
+}
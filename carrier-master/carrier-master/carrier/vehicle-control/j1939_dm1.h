@@ -0,0 +1,53 @@
+/******************************************************************************
+ *
+ *        Name: j1939_dm1.h
+ *
+ * Description: Broadcasts the active faults of the CVC as a J1939
+ *              DM1 (active diagnostic trouble codes) on CAN3, so the
+ *              fleet tools can read them without the decoders of the
+ *              custom debug messages.
+ *
+ *              The DTCs are the active faults of the fault manager,
+ *              with the SPN and FMI from its fault table, and one DTC
+ *              for each source address with a timed out receive
+ *              message.
+ *
+ *              The DM1 is sent every second, and as soon as the DTCs
+ *              change, but no more than one extra DM1 a second. With
+ *              no DTC or one DTC, it fits in a single frame. With
+ *              more, it is sent with the BAM transport protocol, with
+ *              the data packets 50 ms apart.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+
+#ifndef J1939_DM1_H_
+#define J1939_DM1_H_
+
+//
+// The DTCs that fit in one DM1. Any more are not sent.
+//
+#define J1939_DM1_MAX_DTCS 32
+
+/******************************************************************************
+ *
+ *        Name: j1939_dm1_update()
+ *
+ * Description: Called once a loop from User_App(), after
+ *              fault_manager_update(). Rebuilds the DTCs when the
+ *              active faults or the received CAN data have changed,
+ *              and sends the DM1, or the next BAM packet, when due.
+ *
+ ******************************************************************************
+ */
+void j1939_dm1_update();
+
+//
+// The number of DTCs in the DM1.
+//
+uint8_t j1939_dm1_get_dtc_count();
+
+#endif // J1939_DM1_H_
@@ -0,0 +1,285 @@
+/******************************************************************************
+ *
+ *        Name: precharge_estimator.c
+ *
+ * Description: Precharge completion estimator. See
+ *              precharge_estimator.h.
+ *
+ *              A sample is taken every time the DC link voltage
+ *              changes. The voltage arrives over CAN and is repeated
+ *              on the loops in between, so taking a sample every loop
+ *              would weight the fit towards the flat steps.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include "Prototypes.h"
+#include "Constants.h"
+#include "typedefs.h"
+#include "time_service.h"
+#include "precharge_estimator.h"
+
+//
+// The precharge time allowed by contactor_control(). A fit that
+// predicts completion later than this is a failure.
+//
+#define PRECHARGE_TIMEOUT_MS             15000
+
+//
+// Time for the positive contactor to close. The precharge is
+// complete once the DC link will be within the threshold by the time
+// the positive contactor has closed.
+//
+#define PRECHARGE_POS_CONTACTOR_CLOSE_MS 30
+
+//
+// The DC link must have risen by PRECHARGE_NO_RISE_V within
+// PRECHARGE_NO_RISE_MS of the precharge contactor closing.
+//
+#define PRECHARGE_NO_RISE_MS             300
+#define PRECHARGE_NO_RISE_V              10
+
+//
+// A fit needs this many samples, spread over this much time, before
+// it is used.
+//
+#define PRECHARGE_MIN_FIT_SAMPLES        4
+#define PRECHARGE_MIN_FIT_MS             100
+
+//=============================================================================
+//
+// Static Variables
+//
+//=============================================================================
+//
+static bool_t was_precharging = FALSE;
+static uint32_t start_ms = 0;
+static uint16_t start_voltage = 0;
+static uint16_t last_sample_voltage = 0;
+
+//
+// Running sums of the least squares fit of y = ln(Vbat - V) against t
+// in seconds since the start of the precharge.
+//
+static uint16_t fit_n = 0;
+static float fit_sum_t = 0;
+static float fit_sum_y = 0;
+static float fit_sum_tt = 0;
+static float fit_sum_ty = 0;
+static float fit_last_t = 0;
+
+static precharge_estimate_t estimate = PRECHARGE_ESTIMATE_NONE;
+static uint32_t tau_ms = 0;
+static uint32_t remaining_ms = 0;
+
+
+//=============================================================================
+//
+// precharge_estimator_start()
+//
+//=============================================================================
+//
+static void precharge_estimator_start(uint16_t dc_link_voltage)
+{
+    start_ms = time_service_get_ms();
+    start_voltage = dc_link_voltage;
+    last_sample_voltage = dc_link_voltage;
+
+    fit_n = 0;
+    fit_sum_t = 0;
+    fit_sum_y = 0;
+    fit_sum_tt = 0;
+    fit_sum_ty = 0;
+    fit_last_t = 0;
+}
+
+
+/******************************************************************************
+ *
+ *        Name: precharge_estimator_update()
+ *
+ * Description: See precharge_estimator.h.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+precharge_estimate_t precharge_estimator_update(
+    bool_t precharging,
+    uint16_t dc_link_voltage,
+    uint16_t battery_voltage)
+{
+    uint32_t elapsed_ms;
+    float t;
+
+    estimate = PRECHARGE_ESTIMATE_NONE;
+    tau_ms = 0;
+    remaining_ms = 0;
+
+    if (!precharging)
+    {
+        was_precharging = FALSE;
+        return estimate;
+    }
+
+    if (!was_precharging)
+    {
+        precharge_estimator_start(dc_link_voltage);
+        was_precharging = TRUE;
+    }
+
+    elapsed_ms = time_service_ms_since(start_ms);
+    t = (float)elapsed_ms / 1000.0f;
+
+    //
+    // No battery voltage to compare the DC link with. The precharge
+    // timer in contactor_control() still catches a precharge that
+    // never completes.
+    //
+    if (battery_voltage < PRECHARGE_MIN_BATTERY_V)
+    {
+        return estimate;
+    }
+
+    //
+    // Already within the threshold.
+    //
+    if (dc_link_voltage + PRECHARGE_COMPLETE_THRESHOLD_V > battery_voltage)
+    {
+        estimate = PRECHARGE_ESTIMATE_COMPLETE;
+        return estimate;
+    }
+
+    //
+    // No rise at all: open resistor or contactor, or a DC bus short.
+    //
+    if ((elapsed_ms >= PRECHARGE_NO_RISE_MS) &&
+        (dc_link_voltage < start_voltage + PRECHARGE_NO_RISE_V))
+    {
+        estimate = PRECHARGE_ESTIMATE_NO_RISE;
+        return estimate;
+    }
+
+    //
+    // Add a sample to the fit when the DC link voltage has changed,
+    // and always for the first sample.
+    //
+    if ((fit_n == 0) || (dc_link_voltage != last_sample_voltage))
+    {
+        float y = logf((float)(battery_voltage - dc_link_voltage));
+
+        fit_n++;
+        fit_sum_t += t;
+        fit_sum_y += y;
+        fit_sum_tt += t * t;
+        fit_sum_ty += t * y;
+        fit_last_t = t;
+
+        last_sample_voltage = dc_link_voltage;
+    }
+
+    //
+    // Until the DC link has clearly started to rise, the fit is of
+    // the noise on a flat voltage, so only the no rise check above
+    // can call it a failure.
+    //
+    if ((fit_n < PRECHARGE_MIN_FIT_SAMPLES) ||
+        (fit_last_t * 1000.0f < PRECHARGE_MIN_FIT_MS) ||
+        (dc_link_voltage < start_voltage + PRECHARGE_NO_RISE_V))
+    {
+        return estimate;
+    }
+
+    float n = (float)fit_n;
+    float denominator = n * fit_sum_tt - fit_sum_t * fit_sum_t;
+
+    if (denominator <= 0)
+    {
+        return estimate;
+    }
+
+    float slope = (n * fit_sum_ty - fit_sum_t * fit_sum_y) / denominator;
+    float intercept = (fit_sum_y - slope * fit_sum_t) / n;
+
+    //
+    // Not rising yet. The no rise check above decides whether that
+    // is a failure.
+    //
+    if (slope >= 0)
+    {
+        return estimate;
+    }
+
+    //
+    // Time left until ln(Vbat - V) reaches ln(threshold), from the
+    // fitted line at the current time.
+    //
+    float tau_s = -1.0f / slope;
+    float remaining_s =
+        ((intercept + slope * t) -
+         logf((float)PRECHARGE_COMPLETE_THRESHOLD_V)) * tau_s;
+
+    if (remaining_s < 0)
+    {
+        remaining_s = 0;
+    }
+
+    tau_ms = (uint32_t)(tau_s * 1000.0f);
+    remaining_ms = (uint32_t)(remaining_s * 1000.0f);
+
+    if (elapsed_ms + remaining_ms > PRECHARGE_TIMEOUT_MS)
+    {
+        estimate = PRECHARGE_ESTIMATE_TOO_SLOW;
+    }
+    else if (remaining_ms <= PRECHARGE_POS_CONTACTOR_CLOSE_MS)
+    {
+        estimate = PRECHARGE_ESTIMATE_COMPLETE;
+    }
+    else
+    {
+        estimate = PRECHARGE_ESTIMATE_CHARGING;
+    }
+
+    return estimate;
+}
+
+
+//=============================================================================
+//
+// precharge_estimator_is_failure()
+//
+//=============================================================================
+//
+bool_t precharge_estimator_is_failure(precharge_estimate_t result)
+{
+    return (result == PRECHARGE_ESTIMATE_NO_RISE) ||
+           (result == PRECHARGE_ESTIMATE_TOO_SLOW);
+}
+
+
+//=============================================================================
+//
+// Getters
+//
+//=============================================================================
+//
+precharge_estimate_t precharge_estimator_get_estimate()
+{
+    return estimate;
+}
+
+uint32_t precharge_estimator_get_tau_ms()
+{
+    return tau_ms;
+}
+
+uint32_t precharge_estimator_get_remaining_ms()
+{
+    return remaining_ms;
+}
@@ -0,0 +1,107 @@
+/******************************************************************************
+ *
+ *        Name: precharge_estimator.h
+ *
+ * Description: Fits the RC charging curve of the DC link while the
+ *              precharge contactor is closed, to predict when the
+ *              precharge will complete and to detect a precharge that
+ *              will never complete long before the precharge timer
+ *              runs out.
+ *
+ *              While precharging through the resistor, the DC link
+ *              voltage follows
+ *
+ *                  V(t) = Vbat - (Vbat - V0) * exp(-t / tau)
+ *
+ *              so ln(Vbat - V) is a straight line in t with a slope
+ *              of -1 / tau. The line is fitted by least squares over
+ *              every new DC link sample, using running sums, so each
+ *              sample costs the same whatever the number of samples.
+ *
+ *      Author: Deepak
+ *        Date: Monday, 19 October 2026
+ *
+ ******************************************************************************
+ */
+
+#ifndef PRECHARGE_ESTIMATOR_H_
+#define PRECHARGE_ESTIMATOR_H_
+
+//
+// Precharge is complete when the DC link voltage is within this many
+// volts of the battery voltage.
+//
+#define PRECHARGE_COMPLETE_THRESHOLD_V   25
+
+//
+// A battery voltage below this is not a reading: the BMSs have not
+// reported, or their data is stale and has been zeroed. The precharge
+// is never complete against it.
+//
+#define PRECHARGE_MIN_BATTERY_V          400
+
+typedef enum
+{
+    //
+    // Not precharging, or not enough samples for a fit yet.
+    //
+    PRECHARGE_ESTIMATE_NONE = 0,
+
+    //
+    // Precharging, and the fit predicts completion in time.
+    //
+    PRECHARGE_ESTIMATE_CHARGING,
+
+    //
+    // The DC link is within the completion threshold, or will be by
+    // the time the positive contactor has closed.
+    //
+    PRECHARGE_ESTIMATE_COMPLETE,
+
+    //
+    // The DC link voltage has not risen after the precharge
+    // contactor closed: an open precharge resistor or contactor, or
+    // a short on the DC bus.
+    //
+    PRECHARGE_ESTIMATE_NO_RISE,
+
+    //
+    // The DC link voltage is rising, but the fit predicts it will not
+    // complete within the precharge time: a load or partial short on
+    // the DC bus, or the wrong resistor.
+    //
+    PRECHARGE_ESTIMATE_TOO_SLOW
+} precharge_estimate_t;
+
+/******************************************************************************
+ *
+ *        Name: precharge_estimator_update()
+ *
+ * Description: Called once a loop with the state of the precharge
+ *              contactor and the latest DC link and battery voltages.
+ *              The estimate starts again every time precharging
+ *              starts. Returns the estimate for this loop, which is
+ *              NONE while the battery voltage is below
+ *              PRECHARGE_MIN_BATTERY_V.
+ *
+ ******************************************************************************
+ */
+precharge_estimate_t precharge_estimator_update(bool_t precharging,
+                                                uint16_t dc_link_voltage,
+                                                uint16_t battery_voltage);
+
+//
+// TRUE for the estimates that are a precharge failure.
+//
+bool_t precharge_estimator_is_failure(precharge_estimate_t estimate);
+
+//
+// The latest estimate, the fitted time constant and the predicted
+// time left until the DC link is within the completion threshold.
+// The times are 0 while there is no fit.
+//
+precharge_estimate_t precharge_estimator_get_estimate();
+uint32_t precharge_estimator_get_tau_ms();
+uint32_t precharge_estimator_get_remaining_ms();
+
+#endif // PRECHARGE_ESTIMATOR_H_
@@ -13,10 +13,11 @@
 #include "Prototypes.h"
 #include "Constants.h"
 #include "state_machine.h"
-#include "prototypes.h"
 #include "User_Low_Power.h"
 #include "fvt_library.h"
 #include "timer_service.h"
+#include "time_service.h"
+#include "debounce_bank.h"
 #include <math.h>
 #include <stdlib.h>
 #include "can_service.h"
@@ -28,6 +29,11 @@
 #include "gears_and_transmission.h"
 #include "can_switches.h"
 #include "bel_charger_control.h"
+#include "cvc_input_control.h"
+#include "flight_recorder.h"
+#include "precharge_estimator.h"
+#include "fault_manager.h"
+#include "emergency_stop.h"
 
 #define MAX_CHARGING_CELL_VOLTAGE 40400
 extern bool_t low_power_mode;
@@ -45,76 +51,6 @@ static state_machine_output_data_t sm_output_data;
 //
 // Private function prototypes
 //
-static state_t
-do_state_zero_energy(
-    const state_machine_input_data_t *input_data,
-    state_machine_output_data_t *output_data);
-
-static state_t
-do_state_master_closed_no_hv(
-    const state_machine_input_data_t *input_data,
-    state_machine_output_data_t *output_data);
-
-static state_t
-do_state_startup(
-    const state_machine_input_data_t *input_data,
-    state_machine_output_data_t *output_data);
-
-static state_t
-do_state_charging(
-    const state_machine_input_data_t *input_data,
-    state_machine_output_data_t *output_data);
-
-static state_t
-do_state_post_charge_idle(
-    const state_machine_input_data_t * input_data,
-    state_machine_output_data_t * output_data);
-
-static state_t
-do_state_brake_test_mode(
-    const state_machine_input_data_t *input_data,
-    state_machine_output_data_t *output_data);
-
-static state_t
-do_state_diagnostic_mode(
-    const state_machine_input_data_t *input_data,
-    state_machine_output_data_t *output_data);
-
-static state_t
-do_state_ready_to_drive(
-    const state_machine_input_data_t *input_data,
-    state_machine_output_data_t *output_data);
-
-static state_t
-do_state_tow_mode(
-    const state_machine_input_data_t *input_data,
-    state_machine_output_data_t *output_data);
-
-static state_t
-do_state_dead_battery(
-    const state_machine_input_data_t *input_data,
-    state_machine_output_data_t *output_data);
-
-static state_t
-do_state_critical_failure_hv_off(
-    const state_machine_input_data_t *input_data,
-    state_machine_output_data_t *output_data);
-
-static state_t
-do_state_critical_failure_hv_on(
-    const state_machine_input_data_t *input_data,
-    state_machine_output_data_t *output_data);
-
-static state_t
-do_state_e_stop(
-    const state_machine_input_data_t *input_data,
-    state_machine_output_data_t *output_data);
-
-static state_t
-do_state_shutdown(
-    const state_machine_input_data_t *input_data,
-    state_machine_output_data_t *output_data);
-
 static state_machine_contactor_status_t
 contactor_control(
     bool_t power_up,
@@ -144,303 +80,216 @@ update_output_data(
     const bool_t charging_desired,
     const float charge_current_factor);
 
+//
+// The state and transition tables, generated from the FVT State
+// Machine 4.0 spec.
+//
+#include "state_machine_table.h"
+
 
 //////////////////////////////////////////////////////////////////////////////
 //
 // DESCRIPTION OF GENERAL FUNCTION OF STATE MACHINE
 //
-// each state function shares several characteristics:
+// The states and transitions are not coded here. They are taken from
+// the tables in state_machine_table.h, which are generated from
+// ref/state machine/fvt_state_machine_4_0.txt, the machine readable
+// version of the FVT State Machine 4.0 diagram.
+//
+// Every loop, run_state_machine():
+//
+//  1) Runs the during action of the current state, if it has one.
+//     The during actions run the timers and flip flops the guards of
+//     the state depend on.
 //
-//  1) It assigns the result of update_output_data() to the pointer to
-//     output_data passed to it which ensures that the output_data is
-//     fully populated.
+//  2) Updates the output data with update_output_data(), using the
+//     hv_desired and brakes_desired of the current state.
 //
-//  2) It declares a destination_state, which is what the function
-//     will return.
+//  3) Evaluates the guards of the transitions out of the current
+//     state only, in priority order. The first guard that is true
+//     gives the next state, and the entry action of the transition
+//     is run. If no guard is true, the state does not change. In a
+//     state without a during action, the guards are skipped while
+//     the inputs they read are unchanged.
 //
-//  3) Several if / else statements determine what destination_state
-//     will be.
+//  4) Records every change of state in the flight recorder
+//     (flight_recorder.c).
 //
-//  4) The destination_state is returned..
+// To change the state machine, change the spec and the diagram, run
+// generate_state_machine_table.py, and add any new guard or action
+// below.
 //
 //////////////////////////////////////////////////////////////////////////////
 
+//=============================================================================
+//
+// State Variables: The timers and flip flops used by the during
+// actions, entry actions and guards below.
+//
+//=============================================================================
+//
+//
+// Set the slowdown voltage within 0.1V of the set maximum cell
+// voltage.
+//
+#define SLOW_CHARGING_VOLTAGE_PROX_UV 50000
 
+//
+// MASTER_CLOSED_NO_HV: If the vehicle is powered on with the key on,
+// require the key to be turned off first. key must transition from
+// off to on for the vehicle to precharge.
+//
+static bool_t master_closed_ignition_off_before_on = FALSE;
 
-/******************************************************************************
- *
- *        Name: do_state_zero_energy()
- *
- * Description: The zero energy state corresponds to the vehicle's
- *              rest state or state on startup. It is the initial
- *              state of the central vehicle controller before the
- *              master is closed, and before precharge update
- *              output_data structure with all parameters every time.
- *
- *
- *      Author: Tom
- *        Date: Friday, 16 August 2019
- *
- ******************************************************************************
- */
-static state_t
-do_state_zero_energy(
-    const state_machine_input_data_t *input_data,
-    state_machine_output_data_t *output_data)
-{
-    *output_data =
-        update_output_data(
-            input_data, FALSE,
-            ZERO_ENERGY, TRUE, FALSE, 0);
-
-    state_t destination_state;
-
-    if (input_data->master_closed)
-    {
-        destination_state = MASTER_CLOSED_NO_HV;
-    }
-    else
-    {
-        destination_state = ZERO_ENERGY;
-    }
+//
+// Periods of the state timers, ms.
+//
+#define STARTUP_TIMER_MS          5000
+#define TOP_OFF_TIMER_MS          3600000
+#define FAILURE_SHUTDOWN_TIMER_MS 10000
+#define SHUTDOWN_TIMER_MS         1500
 
+//
+// STARTUP: This state is only temporary, so we set a timer for when
+// we exit.
+//
+static timer_t startup_timer = TIMER_INIT_MS(STARTUP_TIMER_MS, RISING);
+static bool_t startup_complete = FALSE;
 
-    return destination_state;
-}
+//
+// CHARGING: Cooldown will remain true for one hour after the maximum
+// cell voltage has droped below the set cell max. The timer starts
+// expired, so cooldown is not initially true if the cell voltage is
+// below max.
+//
+static timer_t top_off_timer = TIMER_INIT_MS(TOP_OFF_TIMER_MS, FALLING);
+static bool_t top_off_cooldown = FALSE;
 
+//
+// POST_CHARGE_IDLE: The key must be turned off and on again to drive.
+//
+static bool_t post_charge_ignition_off_before_on = FALSE;
 
-/******************************************************************************
- *
- *        Name: do_state_master_closed_no_hv()
- *
- * Description: The master_closed_no_hv state corresponds to the state
- *              the vehicle is in right after the master disconnect is
- *              closed and before high voltage is requested. Update
- *              the output_data structure with all parameters every
- *              time.
- *
- *      Author: Tom
- *        Date: Friday, 16 August 2019
- *
- ******************************************************************************
- */
-static state_t
-do_state_master_closed_no_hv(
-    const state_machine_input_data_t *input_data,
-    state_machine_output_data_t *output_data)
-{
-    *output_data = update_output_data(
-        input_data, FALSE,
-        MASTER_CLOSED_NO_HV, TRUE, FALSE, 0);
+//
+// CRITICAL_FAILURE_HV_OFF and CRITICAL_FAILURE_HV_ON: The reasons for
+// the failure are captured on entry to the state and broadcast while
+// in the state, every CRITICAL_FAILURE_MESSAGE_PERIOD_MS.
+//
+#define CRITICAL_FAILURE_MESSAGE_PERIOD_MS 50
 
-    //
-    // If the vehicle is powered on with the key on, require the key
-    // to be turned off first.  key must transition from off to on for
-    // the vehicle to precharge.
-    //
-    static bool_t   ignition_off_before_on  = FALSE;
+static timer_t failure_shutdown_timer =
+    TIMER_INIT_MS(FAILURE_SHUTDOWN_TIMER_MS, RISING);
+static bool_t failure_shutdown_complete = FALSE;
+static uint32_t reasons_for_failure_hv_off = 0;
+static uint32_t reasons_for_failure_hv_on = 0;
 
-    //
-    // This flip flop ensures that the ignition is off before turning
-    // it on has an effect.
-    //
-    ignition_off_before_on =
-        set_reset(ignition_off_before_on,
-                  input_data->ignition_on, FALSE);
+//
+// SHUTDOWN
+//
+static timer_t shutdown_timer = TIMER_INIT_MS(SHUTDOWN_TIMER_MS, RISING);
+static bool_t shutdown_complete = FALSE;
 
-    state_t destination_state;
+//
+// Charging outputs requested by the during action of the CHARGING
+// state. Zero in every other state.
+//
+static bool_t charging_desired_request = FALSE;
+static float charge_current_factor_request = 0;
 
-    //
-    // If the master is open, go to the zero energy state.
-    //
-    if ( !input_data->master_closed)
-    {
-        destination_state = ZERO_ENERGY;
-    }
 
-    //
-    // If the diagnostic mode switch is closed, enter diagnostic mode.
-    //
-    else if (input_data->diagnostic_mode)
-    {
-        destination_state = DIAGNOSTIC_MODE;
-    }
+//=============================================================================
+//
+// send_critical_failure_message()
+//
+//=============================================================================
+//
+static void
+send_critical_failure_message(
+    uint32_t reasons_for_failure_hv_on,
+    uint32_t reasons_for_failure_hv_off)
+{
+    Can_Message_ crit_fail_message;
+
+    crit_fail_message.identifier = 0x11CC33FF;
+    crit_fail_message.length = 8;
+    crit_fail_message.type = EXTENDED;
+    crit_fail_message.data[0] = (uint8_t)((reasons_for_failure_hv_on >> 24) & 0xFF);
+    crit_fail_message.data[1] = (uint8_t)((reasons_for_failure_hv_on >> 16) & 0xFF);
+    crit_fail_message.data[2] = (uint8_t)((reasons_for_failure_hv_on >> 8) & 0xFF);
+    crit_fail_message.data[3] = (uint8_t)((reasons_for_failure_hv_on >> 0) & 0xFF);
+    crit_fail_message.data[4] = (uint8_t)((reasons_for_failure_hv_off >> 24) & 0xFF);
+    crit_fail_message.data[5] = (uint8_t)((reasons_for_failure_hv_off >> 16) & 0xFF);
+    crit_fail_message.data[6] = (uint8_t)((reasons_for_failure_hv_off >> 8) & 0xFF);
+    crit_fail_message.data[7] = (uint8_t)((reasons_for_failure_hv_off >> 0) & 0xFF);
+
+    Send_CAN_Message(0, CAN1, crit_fail_message);
+    Send_CAN_Message(0, CAN3, crit_fail_message);
+}
 
-    //
-    // If the vehicle is plugged in and the key has gone from off to
-    // on, go to startup.
-    //
-//    else if (input_data->plugged_in ||
-//             (input_data->ignition_on && ignition_off_before_on))
-//    else if (input_data->plugged_in || input_data->ignition_on)
 
-    else if (input_data->plugged_in ||
-             (input_data->ignition_on && ignition_off_before_on))
-    {
-        destination_state = STARTUP;
-    }
-    else
-    {
-        destination_state = MASTER_CLOSED_NO_HV;
-    }
+///////////////////////////////////////////////////////////////////////////
+//
+// DURING ACTIONS
+//
+///////////////////////////////////////////////////////////////////////////
+//
 
+//=============================================================================
+//
+// sm_during_master_closed_no_hv()
+//
+//=============================================================================
+//
+static void
+sm_during_master_closed_no_hv(
+    const state_machine_input_data_t *input_data)
+{
     //
-    // If we're leaving this state, reset the flip flop so that it
-    // works properly the next time we return.
+    // This flip flop ensures that the ignition is off before turning
+    // it on has an effect.
     //
-    if (destination_state != MASTER_CLOSED_NO_HV)
-    {
-        ignition_off_before_on = FALSE;
-    }
-
-    return destination_state;
+    master_closed_ignition_off_before_on =
+        set_reset(master_closed_ignition_off_before_on,
+                  input_data->ignition_on, FALSE);
 }
 
 
-/******************************************************************************
- *
- *        Name: do_state_startup()
- *
- * Description:
- *
- *      Author: Tom
- *        Date: Friday, 16 August 2019
- *
- ******************************************************************************
- */
-static state_t
-do_state_startup(
-    const state_machine_input_data_t *input_data,
-    state_machine_output_data_t *output_data)
+//=============================================================================
+//
+// sm_during_startup()
+//
+//=============================================================================
+//
+static void
+sm_during_startup(
+    const state_machine_input_data_t *input_data)
 {
-    *output_data =
-        update_output_data(
-            input_data, FALSE,
-            STARTUP, TRUE, FALSE, 0);
-
-    state_t destination_state;
-    // This state is only temporary, so we set a timer for when we exit
-    static timer_t startup_timer;
-    static bool_t timers_initialized  = FALSE;
-
-    if (!timers_initialized)
-    {
-        startup_timer = timer_setup(get_FIVE_SECONDS(), RISING);
-        timers_initialized = TRUE;
-    }
-
     //
     // Startup will be complete after the timer expires, or we leave
     // this state for another reason.
     //
-    bool_t  startup_complete = timer_operate(&startup_timer, TRUE);
-
-    //
-    // If the e-stop is pressed go to the e-stop state.
-    //
-    if (input_data->e_stop)
-    {
-        destination_state = E_STOP;
-    }
-
-    //
-    // If the master is open, go to the zero energy state, since
-    // precharge has yet to happen.
-    //
-    if (!input_data->master_closed)
-    {
-        destination_state = ZERO_ENERGY;
-    }
-
-    //
-    // If someone turns the key off and the vehicle is unplugged, go
-    // back.
-    //
-    else if (!input_data->ignition_on && !input_data->plugged_in)
-    {
-        destination_state = MASTER_CLOSED_NO_HV;
-    }
-    else if (input_data->diagnostic_mode)
-    {
-        destination_state = DIAGNOSTIC_MODE;
-    }
-
-    //
-    // Once the timer has expired, see where we're going.
-    //
-    else if (startup_complete || (input_data->critical_fault_hv_off == 0))
-    {
-        if (input_data->critical_fault_hv_off != 0)
-        {
-            destination_state   = CRITICAL_FAILURE_HV_OFF;
-        }
-        else if (input_data->critical_fault_hv_on != 0)
-        {
-            destination_state   = CRITICAL_FAILURE_HV_ON;
-        }
-        else if (input_data->plugged_in)
-        {
-            destination_state = CHARGING;
-        }
-        else //normal startup
-        {
-            destination_state   = READY_TO_DRIVE;
-        }
-    }
-    else
-    {
-        destination_state   = STARTUP;
-    }
-
-    if (destination_state != STARTUP)
-    {   // Reset the timer so that the next startup will be the same.
-        startup_complete    = timer_operate(&startup_timer, FALSE);
-    }
-
-    return destination_state;
+    startup_complete = timer_operate(&startup_timer, TRUE);
 }
 
 
 /******************************************************************************
  *
- *        Name: do_state_charging()
+ *        Name: sm_during_charging()
  *
- * Description:
+ * Description: Runs the top off timer and works out the charge
+ *              current factor. The charging outputs are based on the
+ *              output data of the previous loop.
  *
  *      Author: Tom
  *        Date: Friday, 16 August 2019
  *
  ******************************************************************************
  */
-static state_t
-do_state_charging(
-    const state_machine_input_data_t *input_data,
-    state_machine_output_data_t *output_data)
+static void
+sm_during_charging(
+    const state_machine_input_data_t *input_data)
 {
-    //
-    // Set the slowdown voltage within 0.1V of the set maximum cell
-    // voltage.
-    //
-#define SLOW_CHARGING_VOLTAGE_PROX_UV 50000
-
     float charge_current_factor = 0;
-    state_t destination_state;
-    static timer_t top_off_timer;
-    static bool_t timers_initialized = FALSE;
-    static bool_t top_off_cooldown = FALSE;
-
-    if (!timers_initialized)
-    {
-        top_off_timer =
-            timer_setup(6 * get_TEN_MINUTES(), FALLING);
-
-        //
-        // Stop timer from being initially true if cell voltage is
-        // below max.
-        //
-        top_off_timer.counter = 0;
-        timers_initialized = TRUE;
-    }
 
     //
     // Set the cooldown to true if the cell voltage is higher than the
@@ -460,7 +309,7 @@ do_state_charging(
     // function, only once the max cell voltage is within a
     // predetermined threshold.
     //
-    if (!output_data->charging_desired)
+    if (!sm_output_data.charging_desired)
     {
         charge_current_factor = 0;
     }
@@ -487,672 +336,388 @@ do_state_charging(
         charge_current_factor = 1;
     }
 
-    *output_data =
-        update_output_data(
-            input_data,
-            TRUE,
-            CHARGING,
-            TRUE,
-            (output_data->enable_hv_systems && !top_off_cooldown),
-            charge_current_factor);
-
-    if (input_data->e_stop)
-    {
-        destination_state   = E_STOP;
-    }
-    else if ( !input_data->master_closed)
-    {
-        destination_state   = SHUTDOWN;
-    }
-    else if (input_data->diagnostic_mode)
-    {
-        destination_state   = DIAGNOSTIC_MODE;
-    }
-    else if (input_data->critical_fault_hv_off != 0)
-    {
-        destination_state   = CRITICAL_FAILURE_HV_OFF;
-    }
-    else if (input_data->critical_fault_hv_on != 0)
-    {
-        destination_state   = CRITICAL_FAILURE_HV_ON;
-    }
-    else if (!input_data->plugged_in)
-    {
-        destination_state   = POST_CHARGE_IDLE;
-    }
-    else
-    {
-        destination_state   = CHARGING;
-    }
-
-    if (destination_state != CHARGING)
-    {
-        top_off_timer.counter   = 0;
-    }
+    charging_desired_request =
+        (sm_output_data.enable_hv_systems && !top_off_cooldown);
 
-    return destination_state;
+    charge_current_factor_request = charge_current_factor;
 }
 
 
-/******************************************************************************
- *
- *        Name: do_state_post_charge_idle()
- *
- * Description:
- *
- *      Author: Tom
- *        Date: Friday, 16 August 2019
- *
- ******************************************************************************
- */
-static state_t
-do_state_post_charge_idle(
-    const state_machine_input_data_t * input_data,
-    state_machine_output_data_t * output_data)
+//=============================================================================
+//
+// sm_during_post_charge_idle()
+//
+//=============================================================================
+//
+static void
+sm_during_post_charge_idle(
+    const state_machine_input_data_t *input_data)
 {
-    *output_data =
-        update_output_data(
-            input_data,
-            TRUE,
-            POST_CHARGE_IDLE,
-            TRUE,
-            FALSE,
-            0);
-
-    state_t destination_state;
-    static bool_t ignition_off_before_on;
-
-    ignition_off_before_on =
-        set_reset(ignition_off_before_on,
+    post_charge_ignition_off_before_on =
+        set_reset(post_charge_ignition_off_before_on,
                   !input_data->ignition_on, FALSE);
-
-    if (input_data->e_stop)
-    {
-        destination_state = E_STOP;
-    }
-    else if (!input_data->master_closed)
-    {
-        destination_state = SHUTDOWN;
-    }
-    else if (input_data->diagnostic_mode)
-    {
-        destination_state = DIAGNOSTIC_MODE;
-    }
-    else if (input_data->critical_fault_hv_off != 0)
-    {
-        destination_state = CRITICAL_FAILURE_HV_OFF;
-    }
-    else if (input_data->critical_fault_hv_on != 0)
-    {
-        destination_state = CRITICAL_FAILURE_HV_ON;
-    }
-    else if (input_data->plugged_in)
-    {
-        destination_state = CHARGING;
-    }
-    else if ((input_data->ignition_on && ignition_off_before_on) || input_data->exit_post_charge_idle)
-    {
-        destination_state = READY_TO_DRIVE;
-    }
-    else
-    {
-        destination_state = POST_CHARGE_IDLE;
-    }
-
-    if (destination_state != POST_CHARGE_IDLE)
-    {
-        ignition_off_before_on = FALSE;
-    }
-
-    return destination_state;
 }
 
 
-/******************************************************************************
- *
- *        Name: do_state_brake_test_mode()
- *
- * Description:
- *
- *      Author: Tom
- *        Date: Friday, 16 August 2019
- *
- ******************************************************************************
- */
-static state_t
-do_state_brake_test_mode(
-    const state_machine_input_data_t *input_data,
-    state_machine_output_data_t *output_data)
+//=============================================================================
+//
+// sm_during_critical_failure_hv_off()
+//
+//=============================================================================
+//
+static void
+sm_during_critical_failure_hv_off(
+    const state_machine_input_data_t *input_data)
 {
-    *output_data =
-        update_output_data(
-            input_data, TRUE,
-            BRAKE_TEST_MODE, TRUE, FALSE, 0);
+    static uint16_t can_slowdown_ms = CRITICAL_FAILURE_MESSAGE_PERIOD_MS;
 
-    state_t destination_state;
-
-    if (input_data->e_stop)
-    {
-        destination_state = E_STOP;
-    }
-    else if ( !input_data->master_closed || !input_data->ignition_on)
-    {
-        destination_state = SHUTDOWN;
-    }
-    else if (input_data->diagnostic_mode)
+    if (can_slowdown_ms >= CRITICAL_FAILURE_MESSAGE_PERIOD_MS)
     {
-        destination_state = DIAGNOSTIC_MODE;
-    }
-    else if (input_data->critical_fault_hv_off != 0)
-    {
-        destination_state = CRITICAL_FAILURE_HV_OFF;
-    }
-    else if (input_data->critical_fault_hv_on != 0)
-    {
-        destination_state = CRITICAL_FAILURE_HV_ON;
-    }
-    else if ( !input_data->brake_test_mode)
-    {
-        destination_state = READY_TO_DRIVE;
-    }
-    else
-    {
-        destination_state   = BRAKE_TEST_MODE;
+        send_critical_failure_message(0, reasons_for_failure_hv_off);
+        can_slowdown_ms = 0;
     }
+    can_slowdown_ms += time_service_get_elapsed_ms();
 
-    return destination_state;
+    failure_shutdown_complete =
+        timer_operate(&failure_shutdown_timer, TRUE);
 }
 
 
-/******************************************************************************
- *
- *        Name: do_state_diagnostic_mode()
- *
- * Description:
- *
- *      Author: Tom
- *        Date: Friday, 16 August 2019
- *
- ******************************************************************************
- */
-static state_t
-do_state_diagnostic_mode(
-    const state_machine_input_data_t *input_data,
-    state_machine_output_data_t *output_data)
+//=============================================================================
+//
+// sm_during_critical_failure_hv_on()
+//
+//=============================================================================
+//
+static void
+sm_during_critical_failure_hv_on(
+    const state_machine_input_data_t *input_data)
 {
-    *output_data =
-        update_output_data(
-            input_data, FALSE,
-            DIAGNOSTIC_MODE, TRUE, FALSE, 0);
-
-    state_t destination_state;
+    static uint16_t can_slowdown_ms = CRITICAL_FAILURE_MESSAGE_PERIOD_MS;
 
-    if (input_data->e_stop)
+    if (can_slowdown_ms >= CRITICAL_FAILURE_MESSAGE_PERIOD_MS)
     {
-        destination_state = E_STOP;
+        send_critical_failure_message(reasons_for_failure_hv_on, 0);
+        can_slowdown_ms = 0;
     }
-    else if ( !input_data->master_closed || !input_data->diagnostic_mode)
-    {
-        destination_state = ZERO_ENERGY;
-    }
-    else
-    {
-        destination_state = DIAGNOSTIC_MODE;
-    }
-
-    return destination_state;
+    can_slowdown_ms += time_service_get_elapsed_ms();
 }
 
 
-/******************************************************************************
- *
- *        Name: do_state_ready_to_drive()
- *
- * Description:
- *
- *      Author: Tom
- *        Date: Friday, 16 August 2019
- *
- ******************************************************************************
- */
-static state_t
-do_state_ready_to_drive(
-    const state_machine_input_data_t *input_data,
-    state_machine_output_data_t *output_data)
+//=============================================================================
+//
+// sm_during_shutdown()
+//
+//=============================================================================
+//
+static void
+sm_during_shutdown(
+    const state_machine_input_data_t *input_data)
 {
-    *output_data =
-        update_output_data(
-            input_data, TRUE,
-            READY_TO_DRIVE, FALSE, FALSE, 0);
-
-    state_t destination_state;
-
-    if (input_data->e_stop)
-    {
-        destination_state = E_STOP;
-    }
-    else if ( !input_data->master_closed || !input_data->ignition_on)
-    {
-        destination_state = SHUTDOWN;
-    }
-    else if (input_data->diagnostic_mode)
-    {
-        destination_state = DIAGNOSTIC_MODE;
-    }
-    else if (input_data->critical_fault_hv_off != 0)
-    {
-        destination_state = CRITICAL_FAILURE_HV_OFF;
-    }
-    else if (input_data->critical_fault_hv_on != 0)
-    {
-        destination_state = CRITICAL_FAILURE_HV_ON;
-    }
-    else if (input_data->plugged_in)
-    {
-        destination_state = CHARGING;
-    }
-    else if (input_data->brake_test_mode)
-    {
-        destination_state = BRAKE_TEST_MODE;
-    }
-    else
-    {
-        destination_state = READY_TO_DRIVE;
-    }
-
-    return destination_state;
+    shutdown_complete = timer_operate(&shutdown_timer, TRUE);
 }
 
 
-/******************************************************************************
- *
- *        Name: do_state_tow_mode()
- *
- * Description:
- *
- *      Author: Tom
- *        Date: Friday, 16 August 2019
- *
- ******************************************************************************
- */
-static state_t
-do_state_tow_mode(
-    const state_machine_input_data_t *input_data,
-    state_machine_output_data_t *output_data)
-{
-    *output_data =
-        update_output_data(
-            input_data, TRUE,
-            TOW_MODE, FALSE, FALSE, 0);
-
-    state_t destination_state;
-
-    if (input_data->e_stop)
-    {
-        destination_state = E_STOP;
-    }
-    else if (!input_data->master_closed ||
-             !input_data->ignition_on)
-    {
-        destination_state = SHUTDOWN;
-    }
-    else if (input_data->diagnostic_mode)
-    {
-        destination_state = DIAGNOSTIC_MODE;
-    }
-    else if (input_data->critical_fault_hv_off != 0)
-    {
-        destination_state = CRITICAL_FAILURE_HV_OFF;
-    }
-    else if (input_data->critical_fault_hv_on != 0)
-    {
-        destination_state = CRITICAL_FAILURE_HV_ON;
-    }
-    else if (input_data->plugged_in)
-    {
-        destination_state = CHARGING;
-    }
-    else
-    {
-        destination_state   = TOW_MODE;
-    }
+///////////////////////////////////////////////////////////////////////////
+//
+// ENTRY ACTIONS: Reset the timers and flip flops of a state, so every
+// visit to the state behaves the same.
+//
+///////////////////////////////////////////////////////////////////////////
+//
 
-    return destination_state;
+//=============================================================================
+//
+// sm_entry_master_closed_no_hv()
+//
+//=============================================================================
+//
+static void
+sm_entry_master_closed_no_hv(
+    const state_machine_input_data_t *input_data)
+{
+    master_closed_ignition_off_before_on = FALSE;
 }
 
 
-/******************************************************************************
- *
- *        Name: do_state_dead_battery()
- *
- * Description:
- *
- *      Author: Tom
- *        Date: Friday, 16 August 2019
- *
- ******************************************************************************
- */
-static state_t
-do_state_dead_battery(
-    const state_machine_input_data_t *input_data,
-    state_machine_output_data_t *output_data)
+//=============================================================================
+//
+// sm_entry_startup()
+//
+//=============================================================================
+//
+static void
+sm_entry_startup(
+    const state_machine_input_data_t *input_data)
 {
-    *output_data =
-        update_output_data(
-            input_data, TRUE,
-            DEAD_BATTERY, TRUE, FALSE, 0);
+    startup_complete = timer_operate(&startup_timer, FALSE);
+}
 
-    state_t destination_state;
 
-    if (input_data->e_stop)
-    {
-        destination_state = E_STOP;
-    }
-    else if ( !input_data->master_closed || !input_data->ignition_on)
-    {
-        destination_state = SHUTDOWN;
-    }
-    else if (input_data->diagnostic_mode)
-    {
-        destination_state = DIAGNOSTIC_MODE;
-    }
-    else if (input_data->critical_fault_hv_off != 0)
-    {
-        destination_state = CRITICAL_FAILURE_HV_OFF;
-    }
-    else if (input_data->critical_fault_hv_on != 0)
-    {
-        destination_state = CRITICAL_FAILURE_HV_ON;
-    }
-    else if (input_data->plugged_in)
-    {
-        destination_state = CHARGING;
-    }
-    else
-    {
-        destination_state = DEAD_BATTERY;
-    }
-
-    return destination_state;
+//=============================================================================
+//
+// sm_entry_charging()
+//
+//=============================================================================
+//
+static void
+sm_entry_charging(
+    const state_machine_input_data_t *input_data)
+{
+    top_off_timer.counter = 0;
 }
 
 
-/******************************************************************************
- *
- *        Name: do_state_critical_failure_hv_off()
- *
- * Description:
- *
- *      Author: Tom
- *        Date: Friday, 16 August 2019
- *
- ******************************************************************************
- */
-static state_t
-do_state_critical_failure_hv_off(
-    const state_machine_input_data_t *input_data,
-    state_machine_output_data_t *output_data)
+//=============================================================================
+//
+// sm_entry_post_charge_idle()
+//
+//=============================================================================
+//
+static void
+sm_entry_post_charge_idle(
+    const state_machine_input_data_t *input_data)
 {
-    *output_data =
-        update_output_data(
-            input_data, FALSE,
-            CRITICAL_FAILURE_HV_OFF, TRUE, FALSE, 0);
+    post_charge_ignition_off_before_on = FALSE;
+}
 
-    state_t destination_state;
-    static timer_t failure_shutdown_timer;
-    static bool_t timers_initialized = FALSE;
-    static bool_t capture_failure_reason = TRUE;
-    static uint32_t reasons_for_failure = 0;
-    static uint8_t can_slowdown = 5;
 
-    if ( !timers_initialized)
-    {
-        failure_shutdown_timer =
-            timer_setup(get_TEN_SECONDS(), RISING);
-        timers_initialized = TRUE;
-    }
+//=============================================================================
+//
+// sm_entry_critical_failure_hv_off()
+//
+//=============================================================================
+//
+static void
+sm_entry_critical_failure_hv_off(
+    const state_machine_input_data_t *input_data)
+{
+    failure_shutdown_complete =
+        timer_operate(&failure_shutdown_timer, FALSE);
 
-    if (capture_failure_reason)
-    {
-        reasons_for_failure =
-            input_data->critical_fault_hv_off;
-        capture_failure_reason = FALSE;
-    }
+    reasons_for_failure_hv_off = input_data->critical_fault_hv_off;
+}
 
-    if (can_slowdown >= 5)
-    {
-        Can_Message_ crit_fail_message;
-
-        crit_fail_message.identifier = 0x11CC33FF;
-        crit_fail_message.length = 8;
-        crit_fail_message.type = EXTENDED;
-        crit_fail_message.data[0] = 0;
-        crit_fail_message.data[1] = 0;
-        crit_fail_message.data[2] = 0;
-        crit_fail_message.data[3] = 0;
-        crit_fail_message.data[4] = (uint8_t)((reasons_for_failure >> 24) & 0xFF);
-        crit_fail_message.data[5] = (uint8_t)((reasons_for_failure >> 16) & 0xFF);
-        crit_fail_message.data[6] = (uint8_t)((reasons_for_failure >> 8) & 0xFF);
-        crit_fail_message.data[7] = (uint8_t)((reasons_for_failure >> 0) & 0xFF);
-
-        Send_CAN_Message(0, CAN1, crit_fail_message);
-        Send_CAN_Message(0, CAN3, crit_fail_message);
-        can_slowdown = 0;
-    }
-    can_slowdown++;
 
-    if (input_data->e_stop)
-    {
-        destination_state = E_STOP;
-    }
-    else if ( !input_data->master_closed || !input_data->ignition_on)
-    {
-        destination_state = ZERO_ENERGY;
-    }
-    else if (timer_operate(&failure_shutdown_timer, TRUE))
-    {
-        destination_state = ZERO_ENERGY;
-    }
-    else
-    {
-        destination_state = CRITICAL_FAILURE_HV_OFF;
-    }
+//=============================================================================
+//
+// sm_entry_critical_failure_hv_on()
+//
+//=============================================================================
+//
+static void
+sm_entry_critical_failure_hv_on(
+    const state_machine_input_data_t *input_data)
+{
+    reasons_for_failure_hv_on = input_data->critical_fault_hv_on;
+}
 
-    if (destination_state != CRITICAL_FAILURE_HV_OFF)
-    {
-        timer_operate(&failure_shutdown_timer, FALSE);
 
-        capture_failure_reason  = TRUE;
-    }
+//=============================================================================
+//
+// sm_entry_shutdown()
+//
+//=============================================================================
+//
+static void
+sm_entry_shutdown(
+    const state_machine_input_data_t *input_data)
+{
+    //
+    // Reset the timer to the full period, so the timer responds
+    // properly every time we enter shutdown.
+    //
+    shutdown_complete = timer_operate(&shutdown_timer, FALSE);
+}
+
 
-    return destination_state;
+///////////////////////////////////////////////////////////////////////////
+//
+// GUARDS
+//
+///////////////////////////////////////////////////////////////////////////
+//
+static bool_t
+sm_guard_always(
+    const state_machine_input_data_t *input_data)
+{
+    return TRUE;
 }
 
+static bool_t
+sm_guard_e_stop(
+    const state_machine_input_data_t *input_data)
+{
+    return input_data->e_stop;
+}
 
+static bool_t
+sm_guard_e_stop_released(
+    const state_machine_input_data_t *input_data)
+{
+    return !input_data->e_stop;
+}
 
-/******************************************************************************
- *
- *        Name: do_state_critical_failure_hv_on()
- *
- * Description:
- *
- *      Author: Tom
- *        Date: Friday, 16 August 2019
- *
- ******************************************************************************
- */
-static state_t
-do_state_critical_failure_hv_on(
-    const state_machine_input_data_t *input_data,
-    state_machine_output_data_t *output_data)
+static bool_t
+sm_guard_master_closed(
+    const state_machine_input_data_t *input_data)
 {
-    *output_data =
-        update_output_data(
-            input_data, TRUE,
-            CRITICAL_FAILURE_HV_ON, TRUE, FALSE, 0);
+    return input_data->master_closed;
+}
 
-    state_t destination_state;
-    static bool_t capture_failure_reason = TRUE;
-    static uint32_t reasons_for_failure = 0;
-    static uint8_t can_slowdown = 5;
+static bool_t
+sm_guard_master_open(
+    const state_machine_input_data_t *input_data)
+{
+    return !input_data->master_closed;
+}
 
-    if (capture_failure_reason)
-    {
-        reasons_for_failure = input_data->critical_fault_hv_on;
-        capture_failure_reason  = FALSE;
-    }
+static bool_t
+sm_guard_master_open_or_ignition_off(
+    const state_machine_input_data_t *input_data)
+{
+    return (!input_data->master_closed || !input_data->ignition_on);
+}
 
-    if (can_slowdown >= 5)
-    {
-        Can_Message_ crit_fail_message;
-
-        crit_fail_message.identifier = 0x11CC33FF;
-        crit_fail_message.length = 8;
-        crit_fail_message.type = EXTENDED;
-        crit_fail_message.data[0] = (uint8_t)((reasons_for_failure >> 24) & 0xFF);
-        crit_fail_message.data[1] = (uint8_t)((reasons_for_failure >> 16) & 0xFF);
-        crit_fail_message.data[2] = (uint8_t)((reasons_for_failure >> 8) & 0xFF);
-        crit_fail_message.data[3] = (uint8_t)((reasons_for_failure >> 0) & 0xFF);
-        crit_fail_message.data[4] = 0;
-        crit_fail_message.data[5] = 0;
-        crit_fail_message.data[6] = 0;
-        crit_fail_message.data[7] = 0;
-
-        Send_CAN_Message(0, CAN1, crit_fail_message);
-        Send_CAN_Message(0, CAN3, crit_fail_message);
-        can_slowdown = 0;
-    }
-    can_slowdown++;
+static bool_t
+sm_guard_master_open_or_diagnostic_mode_off(
+    const state_machine_input_data_t *input_data)
+{
+    return (!input_data->master_closed || !input_data->diagnostic_mode);
+}
 
-    if (input_data->e_stop)
-    {
-        destination_state = E_STOP;
-    }
-    else if ( !input_data->master_closed || !input_data->ignition_on)
-    {
-        destination_state = SHUTDOWN;
-    }
-    else if (input_data->diagnostic_mode)
-    {
-        destination_state = DIAGNOSTIC_MODE;
-    }
-    else if (input_data->critical_fault_hv_off != 0)
-    {
-        destination_state = CRITICAL_FAILURE_HV_OFF;
-    }
-    else if (input_data->critical_fault_hv_on == 0)
-    {
-        destination_state = READY_TO_DRIVE;
-    }
-    else
-    {
-        destination_state = CRITICAL_FAILURE_HV_ON;
-    }
+static bool_t
+sm_guard_diagnostic_mode(
+    const state_machine_input_data_t *input_data)
+{
+    return input_data->diagnostic_mode;
+}
 
-    return destination_state;
+static bool_t
+sm_guard_plugged_in(
+    const state_machine_input_data_t *input_data)
+{
+    return input_data->plugged_in;
 }
 
+static bool_t
+sm_guard_unplugged(
+    const state_machine_input_data_t *input_data)
+{
+    return !input_data->plugged_in;
+}
 
-/******************************************************************************
- *
- *        Name: do_state_e_stop()
- *
- * Description:
- *
- *      Author: Tom
- *        Date: Friday, 16 August 2019
- *
- ******************************************************************************
- */
-static state_t
-do_state_e_stop(
-    const state_machine_input_data_t *input_data,
-    state_machine_output_data_t *output_data)
+static bool_t
+sm_guard_ignition_off_and_unplugged(
+    const state_machine_input_data_t *input_data)
 {
-    *output_data =
-        update_output_data(
-            input_data, FALSE,
-            E_STOP, TRUE, FALSE, 0);
+    return (!input_data->ignition_on && !input_data->plugged_in);
+}
 
-    state_t destination_state;
+static bool_t
+sm_guard_plugged_in_or_ignition_turned_on(
+    const state_machine_input_data_t *input_data)
+{
+    //
+    // If the vehicle is plugged in and the key has gone from off to
+    // on, go to startup.
+    //
+    return (input_data->plugged_in ||
+            (input_data->ignition_on && master_closed_ignition_off_before_on));
+}
 
-    if (!input_data->e_stop)
-    {
-        destination_state = ZERO_ENERGY;
-    }
-    else if (!input_data->master_closed || !input_data->ignition_on)
-    {
-        destination_state = ZERO_ENERGY;
-    }
-    else
-    {
-        destination_state = E_STOP;
-    }
+static bool_t
+sm_guard_ignition_turned_on_or_exit_post_charge_idle(
+    const state_machine_input_data_t *input_data)
+{
+    return ((input_data->ignition_on && post_charge_ignition_off_before_on) ||
+            input_data->exit_post_charge_idle);
+}
 
-    return destination_state;
+static bool_t
+sm_guard_brake_test_mode(
+    const state_machine_input_data_t *input_data)
+{
+    return input_data->brake_test_mode;
 }
 
+static bool_t
+sm_guard_brake_test_mode_off(
+    const state_machine_input_data_t *input_data)
+{
+    return !input_data->brake_test_mode;
+}
 
-/******************************************************************************
- *
- *        Name: do_state_shutdown()
- *
- * Description:
- *
- *      Author: Tom
- *        Date: Friday, 16 August 2019
- *
- ******************************************************************************
- */
-static state_t
-do_state_shutdown(
-    const state_machine_input_data_t *input_data,
-    state_machine_output_data_t *output_data)
+static bool_t
+sm_guard_critical_fault_hv_off(
+    const state_machine_input_data_t *input_data)
 {
-    state_t destination_state;
-    static timer_t shutdown_timer;
-    static bool_t timers_initialized  = FALSE;
+    return (input_data->critical_fault_hv_off != 0);
+}
 
-    if ( !timers_initialized)
-    {
-        shutdown_timer =
-            timer_setup(get_ONE_AND_A_HALF_SECONDS(), RISING);
-        timers_initialized  = TRUE;
-    }
+static bool_t
+sm_guard_critical_fault_hv_off_after_startup_timer(
+    const state_machine_input_data_t *input_data)
+{
+    return ((input_data->critical_fault_hv_off != 0) && startup_complete);
+}
 
-    *output_data =
-        update_output_data(
-            input_data, TRUE,
-            SHUTDOWN, TRUE, FALSE, 0);
+static bool_t
+sm_guard_critical_fault_hv_on(
+    const state_machine_input_data_t *input_data)
+{
+    return (input_data->critical_fault_hv_on != 0);
+}
 
-    if (input_data->e_stop)
-    {
-        destination_state = ZERO_ENERGY;
-    }
-    else if (timer_operate(&shutdown_timer, TRUE))
-    {
-        destination_state = ZERO_ENERGY;
-    }
-    else
-    {
-        destination_state = SHUTDOWN;
-    }
+static bool_t
+sm_guard_no_critical_fault_hv_on(
+    const state_machine_input_data_t *input_data)
+{
+    return (input_data->critical_fault_hv_on == 0);
+}
 
-    //
-    // If we are exiting the shutdown state, reset the timer to the
-    // full period and reset shutdown_complete to false (we have
-    // already set the flag to leave, so next time we enter shutdown
-    // from another state, the timer responds properly.
-    //
-    if (destination_state != SHUTDOWN)
-    {
-        timer_operate(&shutdown_timer, FALSE);
-    }
+static bool_t
+sm_guard_failure_shutdown_timer_expired(
+    const state_machine_input_data_t *input_data)
+{
+    return failure_shutdown_complete;
+}
 
-    return destination_state;
+static bool_t
+sm_guard_shutdown_timer_expired(
+    const state_machine_input_data_t *input_data)
+{
+    return shutdown_complete;
 }
 
 
+//=============================================================================
+//
+// pack_guard_inputs()
+//
+// Every input_data member read by a guard, packed into a bitset. If
+// a guard is added that reads another member, it must be added here
+// too, or a change of that member could be missed by
+// run_state_machine().
+//
+//=============================================================================
+//
+static uint32_t
+pack_guard_inputs(
+    const state_machine_input_data_t *input_data)
+{
+    return (uint32_t)(
+        ((input_data->master_closed != FALSE)            << 0)
+        | ((input_data->e_stop != FALSE)                 << 1)
+        | ((input_data->ignition_on != FALSE)            << 2)
+        | ((input_data->plugged_in != FALSE)             << 3)
+        | ((input_data->diagnostic_mode != FALSE)        << 4)
+        | ((input_data->brake_test_mode != FALSE)        << 5)
+        | ((input_data->exit_post_charge_idle != FALSE)  << 6)
+        | ((input_data->critical_fault_hv_off != 0)      << 7)
+        | ((input_data->critical_fault_hv_on != 0)       << 8));
+}
+
 
 /******************************************************************************
  *
@@ -1162,6 +727,22 @@ do_state_shutdown(
  *              called by the external loop. It must receive a
  *              populated input_data structure.
  *
+ *              The guards of a state without a during action only
+ *              read input_data. If none of the members they read
+ *              has changed since the guards last found no transition,
+ *              they would find none again, so they are skipped.
+ *
+ *              Only the guards are skipped. The during action and
+ *              update_output_data() run every loop, as the state
+ *              timers, the contactor timers and the precharge
+ *              estimator count elapsed time and the contactor
+ *              control reads the DC link and battery voltages. The
+ *              saving is the guard calls of the states without a
+ *              during action, at most seven a loop (READY_TO_DRIVE,
+ *              where the vehicle spends most of its time), each a
+ *              few reads of input_data, for the nine compares of
+ *              pack_guard_inputs() every loop.
+ *
  *      Author: Tom
  *        Date: Friday, 16 August 2019
  *
@@ -1170,113 +751,85 @@ do_state_shutdown(
 void
 run_state_machine()
 {
-    //
-    // Declare all state functions as an array of functions, in the
-    // same order as the state_t enumeration must line up with state_t
-    // enumeration.
-    //
-    static const state_function_t state_table[NUM_STATES] =
-    {
-        do_state_zero_energy,
-        do_state_master_closed_no_hv,
-        do_state_startup,
-        do_state_charging,
-        do_state_post_charge_idle,
-        do_state_brake_test_mode,
-        do_state_diagnostic_mode,
-        do_state_ready_to_drive,
-        do_state_tow_mode,
-        do_state_dead_battery,
-        do_state_critical_failure_hv_off,
-        do_state_critical_failure_hv_on,
-        do_state_e_stop,
-        do_state_shutdown
-    };
-
-//    static state_machine_output_data_t output_data;
     static state_t current_state = ZERO_ENERGY;
+    static state_t evaluated_state = NUM_STATES;
+    static uint32_t evaluated_guard_inputs = 0;
 
-    static bool_t first_run = TRUE;
-
-    static timer_t crit_fail_hv_off_timer;
-    static timer_t crit_fail_hv_on_timer;
-
-    static bool_t crit_fail_hv_off_debounce = FALSE;
-    static bool_t crit_fail_hv_on_debounce = FALSE;
+    const state_descriptor_t *state = &sm_state_table[current_state];
 
     //
-    // Initialize timers.
+    // 1) Run the during action of the current state.
     //
-    if (first_run)
-    {
-        first_run = FALSE;
+    charging_desired_request = FALSE;
+    charge_current_factor_request = 0;
 
-        crit_fail_hv_off_timer =
-            timer_setup(get_FIVE_SECONDS(), RISING);
-
-        crit_fail_hv_on_timer =
-            timer_setup(get_FIVE_SECONDS(), RISING);
+    if (state->during != NULL)
+    {
+        state->during(&sm_input_data);
     }
 
     //
-    // Some code to make sure that the incoming value has a fault for
-    // five seconds before a fault is triggered.
+    // 2) Update the output data, so the rest of the vehicle can
+    // respond to the state that was just run.
     //
-    crit_fail_hv_off_debounce =
-        timer_operate(&crit_fail_hv_off_timer,
-                      sm_input_data.critical_fault_hv_off != 0);
-
-    crit_fail_hv_on_debounce =
-        timer_operate(&crit_fail_hv_on_timer,
-                      sm_input_data.critical_fault_hv_on != 0);
+    sm_output_data =
+        update_output_data(
+            &sm_input_data,
+            state->hv_desired,
+            current_state,
+            state->brakes_desired,
+            charging_desired_request,
+            charge_current_factor_request);
 
     //
-    // If the timer hasn't gone true yet, set the values to 0 to
-    // ignore the fault. Otherwise, the timer has run and the value
-    // shall remain.
+    // 3) Evaluate the transitions out of the current state, in
+    // priority order. The new state is used on the next iteration of
+    // this function.
     //
-    if (!crit_fail_hv_off_debounce)
-    {
-        sm_input_data.critical_fault_hv_off = 0;
-    }
-    if (!crit_fail_hv_on_debounce)
+    uint32_t guard_inputs = pack_guard_inputs(&sm_input_data);
+    uint8_t i;
+
+    if ((state->during == NULL) &&
+        (current_state == evaluated_state) &&
+        (guard_inputs == evaluated_guard_inputs))
     {
-        sm_input_data.critical_fault_hv_on = 0;
+        return;
     }
 
-    //
-    // The desired order of operations for this state machine is:
-    //
-    // 1) Run the state function for the current state, and set
-    // sm_output_data accordingly.
-    //
-    // 2) Capture and store the next state, which will be used on the
-    // next state machine call.
-    //
-    // 3) Allow the rest of the vehicle to respond to the setting of
-    // sm_output_data.
-    //
-    // 4) Run the state machine again with the new state (step 1
-    // again).
-    //
-    // Decide here if high voltage is desired.
-    //
-    // Run the function for the current state and capture the result,
-    // which is the next state. The new state will give the state
-    // function called on the next iteration of this function.
-    //
-    state_t new_state =
-        state_table[current_state](&sm_input_data, &sm_output_data);
+    evaluated_state = current_state;
+    evaluated_guard_inputs = guard_inputs;
 
-    // Capture the new state for the next iteration of the state
-    // machine.
-    current_state = new_state;
+    for (i = sm_transition_first[current_state];
+         i < sm_transition_first[current_state + 1];
+         i++)
+    {
+        const state_transition_t *transition = &sm_transition_table[i];
 
-    //
-    // Allow vehicle to respond to the setting of sm_output_data
-    // (including the state that was just run).
-    //
-    // return sm_output_data;
+        if (transition->guard(&sm_input_data))
+        {
+            if (transition->entry != NULL)
+            {
+                transition->entry(&sm_input_data);
+            }
+
+            if (transition->to != current_state)
+            {
+                flight_recorder_record(
+                    current_state,
+                    transition->to,
+                    (uint16_t)(guard_inputs
+                               | (sm_input_data.in_neutral ?
+                                  FLIGHT_RECORDER_INPUT_IN_NEUTRAL : 0)
+                               | (sm_input_data.stop_charging_button ?
+                                  FLIGHT_RECORDER_INPUT_STOP_CHARGING_BUTTON : 0)),
+                    get_critical_fault_hv_off(),
+                    get_critical_fault_hv_on());
+            }
+
+            current_state = transition->to;
+            break;
+        }
+    }
 }
 
 
@@ -1310,21 +863,14 @@ update_output_data(
     const bool_t charging_desired,
     const float charge_current_factor)
 {
+#define HV_TURNING_OFF_DELAY_MS 500
     state_machine_output_data_t data;
 
     // Slight delay on turning off high voltage when shutting down.
-    static timer_t hv_turning_off_timer;
+    static timer_t hv_turning_off_timer =
+        TIMER_INIT_MS(HV_TURNING_OFF_DELAY_MS, FALLING);
     // Boolean to capture the delay on shutting down.
     static bool_t hv_desired_delay = FALSE;
-    // Boolean for initializing timers frst run.
-    static bool_t first_run_init = TRUE;
-
-    if (first_run_init)
-    {
-        hv_turning_off_timer =
-            timer_setup(get_FIVE_HUNDRED_MSECS(), FALLING);
-        first_run_init = FALSE;
-    }
 
     //
     // Get the result of the high voltage delay timer.
@@ -1377,34 +923,27 @@ static state_machine_contactor_status_t contactor_control(bool_t	power_up,
 		uint16_t													dc_link_voltage,
 		uint16_t													battery_voltage)
 {
-#define PRECHARGE_COMPLETE_THRESHOLD_V 25
 #define MINIMUM_DC_LINK_V 10
+#define DELAY_OPEN_PRECHARGE_MS  100
+#define DELAY_CLOSE_PRECHARGE_MS 250
+#define PRECHARGE_TIMER_MS       15000
+#define SYSTEM_WAKEUP_MS         250
 	static bool_t							safe_startup		=
 		FALSE;		// boolean to make sure vehicle is in neutral before closing contactors
 	static bool_t							prechargeComplete	=
 		FALSE;		// boolean that determines that the precharge has completed successfully
-	static timer_t						delay_open_precharge;
-	static timer_t						delay_close_precharge;
-	static timer_t						precharge_timer;
-	static timer_t						precharge_fail_timer;
-	static timer_t						system_wakeup;
-	static bool_t							timers_initialized	= FALSE;
+	static timer_t						delay_open_precharge	= TIMER_INIT_MS(DELAY_OPEN_PRECHARGE_MS, RISING);
+	static timer_t						delay_close_precharge	= TIMER_INIT_MS(DELAY_CLOSE_PRECHARGE_MS, RISING);
+	static timer_t						precharge_timer			= TIMER_INIT_MS(PRECHARGE_TIMER_MS, PULSE);
+	static timer_t						precharge_fail_timer	= TIMER_INIT_MS(PRECHARGE_TIMER_MS + 1, RISING);	// the period of the pulse timer
+	static timer_t						system_wakeup			= TIMER_INIT_MS(SYSTEM_WAKEUP_MS, RISING);
 	static state_machine_contactor_status_t	contactor_command;
 
 	// timer temp variables to force the execution of the timer_operate function inside a boolean evaluation
 	bool_t	timerTemp1;
 	bool_t	timerTemp2;
 	bool_t	timerTemp3;
-
-	if ( !timers_initialized)
-	{
-		delay_open_precharge	= timer_setup(get_ONE_HUNDRED_MSECS(), RISING);
-		delay_close_precharge	= timer_setup(get_TWO_HUNDRED_FIFTY_MSECS(), RISING);
-		precharge_timer			= timer_setup(get_FIFTEEN_SECONDS(), PULSE);
-		precharge_fail_timer	= timer_setup(precharge_timer.period, RISING);
-		system_wakeup			= timer_setup(get_TWO_HUNDRED_FIFTY_MSECS(), RISING);
-		timers_initialized		= TRUE;
-	}
+	precharge_estimate_t precharge_estimate;
 
 	// If vehicle is in neutral and the contactors are open, this will be true. It allows the vehicle to transition from off to on state with shifter in neutral
 	safe_startup	= set_reset(
@@ -1418,11 +957,22 @@ static state_machine_contactor_status_t contactor_control(bool_t	power_up,
 									  && !contactor_command.precharge_failure		// and the precharge hasn't failed
 									  && safe_startup;								// and the shifter is in neutral before precharge is initiated
 
-	// precharge is complete if the DC link voltage has made it to within 25V of the battery voltage
+	// fit the DC link charging curve while the precharge contactor is closed (see precharge_estimator.h)
+	precharge_estimate	= precharge_estimator_update(
+							  contactor_command.pre_contactor,
+							  dc_link_voltage,
+							  battery_voltage);
+
+	// precharge is complete if the DC link voltage has made it to within 25V of the battery voltage,
+	// or will have by the time the positive contactor has closed. It is forgotten whenever the
+	// negative contactor is open, as the DC link discharges, so closing it again precharges again.
+	// Never against a battery voltage the BMSs have not reported (see precharge_estimator.h)
 	prechargeComplete	= set_reset(
 							  prechargeComplete,
-							  (dc_link_voltage > (battery_voltage - PRECHARGE_COMPLETE_THRESHOLD_V)),
-							  !power_up);
+							  ((battery_voltage >= PRECHARGE_MIN_BATTERY_V)
+							   && (dc_link_voltage > (battery_voltage - PRECHARGE_COMPLETE_THRESHOLD_V)))
+							  || (precharge_estimate == PRECHARGE_ESTIMATE_COMPLETE),
+							  !power_up || !contactor_command.neg_contactor);
 	timerTemp1	= timer_operate(
 					  &delay_open_precharge,
 					  prechargeComplete);		// open precharge slightly after precharge is complete (to allow + contactor to have closed)
@@ -1449,8 +999,9 @@ static state_machine_contactor_status_t contactor_control(bool_t	power_up,
 	
 	contactor_command.precharge_failure	= set_reset(
 			contactor_command.precharge_failure,
-			timerTemp1 && !prechargeComplete,
-			!power_up);		// failure if timers expires and vehicle has not completed precharge
+			(timerTemp1 && !prechargeComplete)
+			|| precharge_estimator_is_failure(precharge_estimate),
+			!power_up);		// failure if timers expires and vehicle has not completed precharge, or the charging curve shows it never will
 
 	// logic for closing positive contactor
 	contactor_command.pos_contactor	= (!in_neutral
@@ -1488,6 +1039,24 @@ populate_state_machine_member_elements()
 {
 
     static bool_t first_run = TRUE;
+    static uint32_t last_rx_change_count = 0;
+
+    //
+    // The members below that come from received CAN data are only
+    // recomputed when a message they are read from has been received
+    // or has timed out since the previous loop: the pack data of the
+    // BMSs, and msg1 and msg3 of the traction inverter. Traffic from
+    // the other devices does not wake them.
+    //
+    uint32_t rx_change_count =
+        get_battery_pack_data_change_count()
+        + skai_get_vissim_rx_change_count(ONE);
+
+    bool_t rx_data_changed =
+        (first_run || (rx_change_count != last_rx_change_count));
+
+    last_rx_change_count = rx_change_count;
+    first_run = FALSE;
 
     //
     // All the member elements of the input data struct has to be
@@ -1495,23 +1064,24 @@ populate_state_machine_member_elements()
     //
     //
     // master_closed: the master on the vehilce is a red knife switch.
-    //                It is an input to the CVC
-    sm_input_data.master_closed = (IN_E11_master_switch_signal == INPUT_ON);
+    //                It is an input to the CVC. Read by the fast path
+    //                at the top of the loop (emergency_stop.c).
+    sm_input_data.master_closed = !emergency_stop_get_master_open();
 
     //
     // estop: estops are palced at various places on vehicle. If an
     //        Estop is presed, it signifies an emergency. The estop
     //        output signals are connected as inputs to the CVC.
     //
-    sm_input_data.e_stop =
-        !(IN_A16_dash_e_stop_signal == INPUT_ON) ||
-        !(IN_A17_charge_box_e_stop_signal == INPUT_ON);
+    sm_input_data.e_stop = emergency_stop_get_e_stop();
 
     //
     // Ignition_on: Set ignition, which is like they key switch being
     // on and signals the desire for high voltage to be active.
     //
-    sm_input_data.ignition_on = (IN_A11_keyswitch > 8000) || (low_power_mode != TRUE);
+    sm_input_data.ignition_on =
+        (cvc_input_get_analog(CVC_AIN_A11_KEYSWITCH) > 8000) ||
+        (low_power_mode != TRUE);
 
     //
     // plugged_in: identifies of the charger is plugged_in
@@ -1529,23 +1099,24 @@ populate_state_machine_member_elements()
 
     //
     // critical_fault_hv_off: shuts off the high voltage if a critical
-    // fault has occured.
+    // fault has occured. Only the faults that have been active for
+    // their debounce time (fault_manager.c).
     //
     sm_input_data.critical_fault_hv_off =
-    		check_critical_fault_high_voltage_off();
+        fault_manager_get_reasons(FAULT_REACTION_HV_OFF, TRUE);
 
     //
     // critical_fault_hv_on: a critical fault has occured. But leave
     // the high voltage ON.
     //
     sm_input_data.critical_fault_hv_on =
-    		check_critical_fault_high_voltage_on();
+        fault_manager_get_reasons(FAULT_REACTION_HV_ON, TRUE);
 
     //
     // stop_charging_button: An input to the CVC from the charging box.
     //
     sm_input_data.stop_charging_button =
-        (bool_t)IN_A15_stop_charging_button_signal;
+        (bool_t)cvc_input_get_digital(CVC_DIN_A15_STOP_CHARGING_BUTTON);
 
     //
     // brake_test_mode: does not exist in this machine, therfore kept
@@ -1557,7 +1128,7 @@ populate_state_machine_member_elements()
     // diagnostic_mode:
     //
     sm_input_data.diagnostic_mode =
-        (bool_t)IN_A18_diagnositic_switch_signal;
+        (bool_t)cvc_input_get_digital(CVC_DIN_A18_DIAGNOSTIC_SWITCH);
 
     //
     // exit_post_charge_idle:
@@ -1566,43 +1137,57 @@ populate_state_machine_member_elements()
     // switch is ON and the sifter is in neutral
     // When vehilce is in neutral and switch1 is ON
     sm_input_data.exit_post_charge_idle = 
-        ((shifter_pos == SHIFTER_NEUTRAL) && (IN_A11_keyswitch > 8000));
+        ((shifter_pos == SHIFTER_NEUTRAL) &&
+         (cvc_input_get_analog(CVC_AIN_A11_KEYSWITCH) > 8000));
 
-    //
-    // max_cell_voltage_in_micro_volts: Orion BMS
-    //
-    sm_input_data.max_cell_voltage_uv =
-        get_pack_high_cell_voltage();
+    if (rx_data_changed)
+    {
+        //
+        // max_cell_voltage_in_micro_volts: Orion BMS
+        //
+        sm_input_data.max_cell_voltage_uv =
+            get_pack_high_cell_voltage();
 
-    //
-    // min_cell_voltage_in_micro_volts: Orion BMS
-    //
-    sm_input_data.min_cell_voltage_uv =
-        get_pack_low_cell_voltage();
+        //
+        // min_cell_voltage_in_micro_volts: Orion BMS
+        //
+        sm_input_data.min_cell_voltage_uv =
+            get_pack_low_cell_voltage();
 
-    //
-    // battery_soc: Orion BMS
-    //
-    sm_input_data.battery_soc =
-        get_battery_pack_SOC();
+        //
+        // battery_soc: Orion BMS
+        //
+        sm_input_data.battery_soc =
+            get_battery_pack_SOC();
 
-    //
-    // dc_bus_voltage: Skai2 Traction Inverter
-    //
-    sm_input_data.dc_bus_voltage_v =
-    		skai_get_vissim_DCLink_Voltage(ONE);
+        //
+        // dc_bus_voltage: Skai2 Traction Inverter
+        //
+        sm_input_data.dc_bus_voltage_v =
+        		skai_get_vissim_DCLink_Voltage(ONE);
 
-    //
-    // battery_voltage: Orion BMS
-    //
-    sm_input_data.battery_voltage_v =
-        (uint16_t)(get_battery_pack_voltage() / 10);
+        //
+        // battery_voltage: Orion BMS
+        //
+        sm_input_data.battery_voltage_v =
+            (uint16_t)(get_battery_pack_voltage() / 10);
+
+        //
+        // traction_rpm: rpm from the traction drive.
+        //
+        sm_input_data.traction_rpm =
+            (int16_t)skai_get_vissim_motor_rpm(ONE);
+    }
 
     //
-    // traction_rpm: rpm from the traction drive.
+    // A battery voltage from a BMS that has not reported or has gone
+    // stale is not used. It reads as 0 until fresh data arrives, so
+    // the precharge is never complete against it.
     //
-    sm_input_data.traction_rpm =
-        (int16_t)skai_get_vissim_motor_rpm(ONE);
+    if (!bms_fresh_data_1() || !bms_fresh_data_2() || !bms_fresh_data_3())
+    {
+        sm_input_data.battery_voltage_v = 0;
+    }
 
     //
     // setting_max_charging_cell_voltage_uv: EEPROM VALUE
@@ -126,48 +126,54 @@ typedef struct
 } state_machine_output_data_t;
 
 //
-// Type definition: state_function_t can now be used as a type
-// (pointer to a function that takes data and returns a state)
+// Type definition: guard_function_t can now be used as a type
+// (pointer to a function that takes data and returns TRUE if a
+// transition is to be taken)
 //
-typedef state_t (*state_function_t)(const state_machine_input_data_t *input_data,
-	state_machine_output_data_t *output_data);
+typedef bool_t (*guard_function_t)(const state_machine_input_data_t *data);
 //
-// Type definition: transition_function: future
-// use. transition_function_t can now be used as a type (pointer to a
-// function that takes *data and returns void)
+// Type definition: transition_function_t can now be used as a type
+// (pointer to a function that takes *data and returns void). Used
+// for the action run every loop in a state and the action run on
+// entry to a state.
 //
 typedef void (*transition_function_t)(const state_machine_input_data_t *data);
 
 //
-// This function is exptected to be called by the controlling software
-// every loop all input data should be properly populated prior to
-// passing it to this function
+// An entry of the state table. The during action may be NULL.
 //
-void run_state_machine();
+typedef struct
+{
+	bool_t					hv_desired;
+	bool_t					brakes_desired;
+	transition_function_t	during;
+} state_descriptor_t;
 
-//=============================================================================
-//
-// check_critical_fault_high_voltage_off()
 //
-//=============================================================================
+// An entry of the transition table. The entry action may be NULL.
 //
-bool_t check_critical_fault_high_voltage_off();
+typedef struct
+{
+	state_t					from;
+	guard_function_t		guard;
+	state_t					to;
+	transition_function_t	entry;
+} state_transition_t;
 
-//=============================================================================
-//
-// battery_pack_failure_status()
 //
-//=============================================================================
+// This function is exptected to be called by the controlling software
+// every loop all input data should be properly populated prior to
+// passing it to this function
 //
-bool_t battery_pack_failure_status();
+void run_state_machine();
 
 //=============================================================================
 //
-// check_critical_fault_high_voltage_on()
+// battery_pack_failure_status()
 //
 //=============================================================================
 //
-bool_t check_critical_fault_high_voltage_on();
+bool_t battery_pack_failure_status();
 
 //=============================================================================
 //
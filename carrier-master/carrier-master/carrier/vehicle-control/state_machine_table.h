@@ -0,0 +1,184 @@
+/******************************************************************************
+ *
+ *        Name: state_machine_table.h
+ *
+ * Description: GENERATED FILE, DO NOT EDIT.
+ *
+ *              Generated from ref/state machine/fvt_state_machine_4_0.txt
+ *              by generate_state_machine_table.py. Change the spec and
+ *              run the generator again.
+ *
+ *              Included by state_machine.c only.
+ *
+ ******************************************************************************
+ */
+
+#ifndef STATE_MACHINE_TABLE_H_
+#define STATE_MACHINE_TABLE_H_
+
+//
+// Guards and actions named in the spec. Defined in state_machine.c
+//
+static bool_t sm_guard_always(const state_machine_input_data_t *input_data);
+static bool_t sm_guard_brake_test_mode(const state_machine_input_data_t *input_data);
+static bool_t sm_guard_brake_test_mode_off(const state_machine_input_data_t *input_data);
+static bool_t sm_guard_critical_fault_hv_off(const state_machine_input_data_t *input_data);
+static bool_t sm_guard_critical_fault_hv_off_after_startup_timer(const state_machine_input_data_t *input_data);
+static bool_t sm_guard_critical_fault_hv_on(const state_machine_input_data_t *input_data);
+static bool_t sm_guard_diagnostic_mode(const state_machine_input_data_t *input_data);
+static bool_t sm_guard_e_stop(const state_machine_input_data_t *input_data);
+static bool_t sm_guard_e_stop_released(const state_machine_input_data_t *input_data);
+static bool_t sm_guard_failure_shutdown_timer_expired(const state_machine_input_data_t *input_data);
+static bool_t sm_guard_ignition_off_and_unplugged(const state_machine_input_data_t *input_data);
+static bool_t sm_guard_ignition_turned_on_or_exit_post_charge_idle(const state_machine_input_data_t *input_data);
+static bool_t sm_guard_master_closed(const state_machine_input_data_t *input_data);
+static bool_t sm_guard_master_open(const state_machine_input_data_t *input_data);
+static bool_t sm_guard_master_open_or_diagnostic_mode_off(const state_machine_input_data_t *input_data);
+static bool_t sm_guard_master_open_or_ignition_off(const state_machine_input_data_t *input_data);
+static bool_t sm_guard_no_critical_fault_hv_on(const state_machine_input_data_t *input_data);
+static bool_t sm_guard_plugged_in(const state_machine_input_data_t *input_data);
+static bool_t sm_guard_plugged_in_or_ignition_turned_on(const state_machine_input_data_t *input_data);
+static bool_t sm_guard_shutdown_timer_expired(const state_machine_input_data_t *input_data);
+static bool_t sm_guard_unplugged(const state_machine_input_data_t *input_data);
+
+static void sm_during_charging(const state_machine_input_data_t *input_data);
+static void sm_during_critical_failure_hv_off(const state_machine_input_data_t *input_data);
+static void sm_during_critical_failure_hv_on(const state_machine_input_data_t *input_data);
+static void sm_during_master_closed_no_hv(const state_machine_input_data_t *input_data);
+static void sm_during_post_charge_idle(const state_machine_input_data_t *input_data);
+static void sm_during_shutdown(const state_machine_input_data_t *input_data);
+static void sm_during_startup(const state_machine_input_data_t *input_data);
+
+static void sm_entry_charging(const state_machine_input_data_t *input_data);
+static void sm_entry_critical_failure_hv_off(const state_machine_input_data_t *input_data);
+static void sm_entry_critical_failure_hv_on(const state_machine_input_data_t *input_data);
+static void sm_entry_master_closed_no_hv(const state_machine_input_data_t *input_data);
+static void sm_entry_post_charge_idle(const state_machine_input_data_t *input_data);
+static void sm_entry_shutdown(const state_machine_input_data_t *input_data);
+static void sm_entry_startup(const state_machine_input_data_t *input_data);
+
+//=============================================================================
+//
+// States, in the order of the state_t enumeration.
+//
+//=============================================================================
+//
+static const state_descriptor_t sm_state_table[NUM_STATES] =
+{
+    [ZERO_ENERGY]             = { FALSE, TRUE,  NULL },
+    [MASTER_CLOSED_NO_HV]     = { FALSE, TRUE,  sm_during_master_closed_no_hv },
+    [STARTUP]                 = { FALSE, TRUE,  sm_during_startup },
+    [CHARGING]                = { TRUE,  TRUE,  sm_during_charging },
+    [POST_CHARGE_IDLE]        = { TRUE,  TRUE,  sm_during_post_charge_idle },
+    [BRAKE_TEST_MODE]         = { TRUE,  TRUE,  NULL },
+    [DIAGNOSTIC_MODE]         = { FALSE, TRUE,  NULL },
+    [READY_TO_DRIVE]          = { TRUE,  FALSE, NULL },
+    [TOW_MODE]                = { TRUE,  FALSE, NULL },
+    [DEAD_BATTERY]            = { TRUE,  TRUE,  NULL },
+    [CRITICAL_FAILURE_HV_OFF] = { FALSE, TRUE,  sm_during_critical_failure_hv_off },
+    [CRITICAL_FAILURE_HV_ON]  = { TRUE,  TRUE,  sm_during_critical_failure_hv_on },
+    [E_STOP]                  = { FALSE, TRUE,  NULL },
+    [SHUTDOWN]                = { TRUE,  TRUE,  sm_during_shutdown },
+};
+
+//=============================================================================
+//
+// Transitions, grouped by from state and in priority order within
+// each state. The transitions out of state s are
+// sm_transition_table[sm_transition_first[s]] up to, but not
+// including, sm_transition_table[sm_transition_first[s + 1]].
+//
+//=============================================================================
+//
+#define SM_NUM_TRANSITIONS 65
+
+static const state_transition_t sm_transition_table[SM_NUM_TRANSITIONS] =
+{
+    // from                      guard                                                  to                        entry
+    { ZERO_ENERGY,              sm_guard_master_closed,                                MASTER_CLOSED_NO_HV,      sm_entry_master_closed_no_hv },
+    { MASTER_CLOSED_NO_HV,      sm_guard_master_open,                                  ZERO_ENERGY,              NULL },
+    { MASTER_CLOSED_NO_HV,      sm_guard_diagnostic_mode,                              DIAGNOSTIC_MODE,          NULL },
+    { MASTER_CLOSED_NO_HV,      sm_guard_plugged_in_or_ignition_turned_on,             STARTUP,                  sm_entry_startup },
+    { STARTUP,                  sm_guard_e_stop,                                       E_STOP,                   NULL },
+    { STARTUP,                  sm_guard_master_open,                                  ZERO_ENERGY,              NULL },
+    { STARTUP,                  sm_guard_ignition_off_and_unplugged,                   MASTER_CLOSED_NO_HV,      sm_entry_master_closed_no_hv },
+    { STARTUP,                  sm_guard_diagnostic_mode,                              DIAGNOSTIC_MODE,          NULL },
+    { STARTUP,                  sm_guard_critical_fault_hv_off_after_startup_timer,    CRITICAL_FAILURE_HV_OFF,  sm_entry_critical_failure_hv_off },
+    { STARTUP,                  sm_guard_critical_fault_hv_off,                        STARTUP,                  NULL },
+    { STARTUP,                  sm_guard_critical_fault_hv_on,                         CRITICAL_FAILURE_HV_ON,   sm_entry_critical_failure_hv_on },
+    { STARTUP,                  sm_guard_plugged_in,                                   CHARGING,                 sm_entry_charging },
+    { STARTUP,                  sm_guard_always,                                       READY_TO_DRIVE,           NULL },
+    { CHARGING,                 sm_guard_e_stop,                                       E_STOP,                   NULL },
+    { CHARGING,                 sm_guard_master_open,                                  SHUTDOWN,                 sm_entry_shutdown },
+    { CHARGING,                 sm_guard_diagnostic_mode,                              DIAGNOSTIC_MODE,          NULL },
+    { CHARGING,                 sm_guard_critical_fault_hv_off,                        CRITICAL_FAILURE_HV_OFF,  sm_entry_critical_failure_hv_off },
+    { CHARGING,                 sm_guard_critical_fault_hv_on,                         CRITICAL_FAILURE_HV_ON,   sm_entry_critical_failure_hv_on },
+    { CHARGING,                 sm_guard_unplugged,                                    POST_CHARGE_IDLE,         sm_entry_post_charge_idle },
+    { POST_CHARGE_IDLE,         sm_guard_e_stop,                                       E_STOP,                   NULL },
+    { POST_CHARGE_IDLE,         sm_guard_master_open,                                  SHUTDOWN,                 sm_entry_shutdown },
+    { POST_CHARGE_IDLE,         sm_guard_diagnostic_mode,                              DIAGNOSTIC_MODE,          NULL },
+    { POST_CHARGE_IDLE,         sm_guard_critical_fault_hv_off,                        CRITICAL_FAILURE_HV_OFF,  sm_entry_critical_failure_hv_off },
+    { POST_CHARGE_IDLE,         sm_guard_critical_fault_hv_on,                         CRITICAL_FAILURE_HV_ON,   sm_entry_critical_failure_hv_on },
+    { POST_CHARGE_IDLE,         sm_guard_plugged_in,                                   CHARGING,                 sm_entry_charging },
+    { POST_CHARGE_IDLE,         sm_guard_ignition_turned_on_or_exit_post_charge_idle,  READY_TO_DRIVE,           NULL },
+    { BRAKE_TEST_MODE,          sm_guard_e_stop,                                       E_STOP,                   NULL },
+    { BRAKE_TEST_MODE,          sm_guard_master_open_or_ignition_off,                  SHUTDOWN,                 sm_entry_shutdown },
+    { BRAKE_TEST_MODE,          sm_guard_diagnostic_mode,                              DIAGNOSTIC_MODE,          NULL },
+    { BRAKE_TEST_MODE,          sm_guard_critical_fault_hv_off,                        CRITICAL_FAILURE_HV_OFF,  sm_entry_critical_failure_hv_off },
+    { BRAKE_TEST_MODE,          sm_guard_critical_fault_hv_on,                         CRITICAL_FAILURE_HV_ON,   sm_entry_critical_failure_hv_on },
+    { BRAKE_TEST_MODE,          sm_guard_brake_test_mode_off,                          READY_TO_DRIVE,           NULL },
+    { DIAGNOSTIC_MODE,          sm_guard_e_stop,                                       E_STOP,                   NULL },
+    { DIAGNOSTIC_MODE,          sm_guard_master_open_or_diagnostic_mode_off,           ZERO_ENERGY,              NULL },
+    { READY_TO_DRIVE,           sm_guard_e_stop,                                       E_STOP,                   NULL },
+    { READY_TO_DRIVE,           sm_guard_master_open_or_ignition_off,                  SHUTDOWN,                 sm_entry_shutdown },
+    { READY_TO_DRIVE,           sm_guard_diagnostic_mode,                              DIAGNOSTIC_MODE,          NULL },
+    { READY_TO_DRIVE,           sm_guard_critical_fault_hv_off,                        CRITICAL_FAILURE_HV_OFF,  sm_entry_critical_failure_hv_off },
+    { READY_TO_DRIVE,           sm_guard_critical_fault_hv_on,                         CRITICAL_FAILURE_HV_ON,   sm_entry_critical_failure_hv_on },
+    { READY_TO_DRIVE,           sm_guard_plugged_in,                                   CHARGING,                 sm_entry_charging },
+    { READY_TO_DRIVE,           sm_guard_brake_test_mode,                              BRAKE_TEST_MODE,          NULL },
+    { TOW_MODE,                 sm_guard_e_stop,                                       E_STOP,                   NULL },
+    { TOW_MODE,                 sm_guard_master_open_or_ignition_off,                  SHUTDOWN,                 sm_entry_shutdown },
+    { TOW_MODE,                 sm_guard_diagnostic_mode,                              DIAGNOSTIC_MODE,          NULL },
+    { TOW_MODE,                 sm_guard_critical_fault_hv_off,                        CRITICAL_FAILURE_HV_OFF,  sm_entry_critical_failure_hv_off },
+    { TOW_MODE,                 sm_guard_critical_fault_hv_on,                         CRITICAL_FAILURE_HV_ON,   sm_entry_critical_failure_hv_on },
+    { TOW_MODE,                 sm_guard_plugged_in,                                   CHARGING,                 sm_entry_charging },
+    { DEAD_BATTERY,             sm_guard_e_stop,                                       E_STOP,                   NULL },
+    { DEAD_BATTERY,             sm_guard_master_open_or_ignition_off,                  SHUTDOWN,                 sm_entry_shutdown },
+    { DEAD_BATTERY,             sm_guard_diagnostic_mode,                              DIAGNOSTIC_MODE,          NULL },
+    { DEAD_BATTERY,             sm_guard_critical_fault_hv_off,                        CRITICAL_FAILURE_HV_OFF,  sm_entry_critical_failure_hv_off },
+    { DEAD_BATTERY,             sm_guard_critical_fault_hv_on,                         CRITICAL_FAILURE_HV_ON,   sm_entry_critical_failure_hv_on },
+    { DEAD_BATTERY,             sm_guard_plugged_in,                                   CHARGING,                 sm_entry_charging },
+    { CRITICAL_FAILURE_HV_OFF,  sm_guard_e_stop,                                       E_STOP,                   NULL },
+    { CRITICAL_FAILURE_HV_OFF,  sm_guard_master_open_or_ignition_off,                  ZERO_ENERGY,              NULL },
+    { CRITICAL_FAILURE_HV_OFF,  sm_guard_failure_shutdown_timer_expired,               ZERO_ENERGY,              NULL },
+    { CRITICAL_FAILURE_HV_ON,   sm_guard_e_stop,                                       E_STOP,                   NULL },
+    { CRITICAL_FAILURE_HV_ON,   sm_guard_master_open_or_ignition_off,                  SHUTDOWN,                 sm_entry_shutdown },
+    { CRITICAL_FAILURE_HV_ON,   sm_guard_diagnostic_mode,                              DIAGNOSTIC_MODE,          NULL },
+    { CRITICAL_FAILURE_HV_ON,   sm_guard_critical_fault_hv_off,                        CRITICAL_FAILURE_HV_OFF,  sm_entry_critical_failure_hv_off },
+    { CRITICAL_FAILURE_HV_ON,   sm_guard_no_critical_fault_hv_on,                      READY_TO_DRIVE,           NULL },
+    { E_STOP,                   sm_guard_e_stop_released,                              ZERO_ENERGY,              NULL },
+    { E_STOP,                   sm_guard_master_open,                                  ZERO_ENERGY,              NULL },
+    { SHUTDOWN,                 sm_guard_e_stop,                                       ZERO_ENERGY,              NULL },
+    { SHUTDOWN,                 sm_guard_shutdown_timer_expired,                       ZERO_ENERGY,              NULL },
+};
+
+static const uint8_t sm_transition_first[NUM_STATES + 1] =
+{
+      0, // ZERO_ENERGY
+      1, // MASTER_CLOSED_NO_HV
+      4, // STARTUP
+     13, // CHARGING
+     19, // POST_CHARGE_IDLE
+     26, // BRAKE_TEST_MODE
+     32, // DIAGNOSTIC_MODE
+     34, // READY_TO_DRIVE
+     41, // TOW_MODE
+     47, // DEAD_BATTERY
+     53, // CRITICAL_FAILURE_HV_OFF
+     56, // CRITICAL_FAILURE_HV_ON
+     61, // E_STOP
+     63, // SHUTDOWN
+     65, // NUM_STATES
+};
+
+#endif // STATE_MACHINE_TABLE_H_
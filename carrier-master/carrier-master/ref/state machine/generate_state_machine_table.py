@@ -0,0 +1,276 @@
+#!/usr/bin/env python3
+#
+# Generates carrier/vehicle-control/state_machine_table.h from the
+# machine readable state machine, fvt_state_machine_4_0.txt.
+#
+# The states of the spec are checked against the state_t enumeration
+# in state_machine.h, so the spec, the table and the code can not
+# drift apart without the generator failing.
+#
+# The transition graph of the spec is then explored from ZERO_ENERGY,
+# taking any guard as possibly true. The generator fails if:
+#
+#   - a transition can never be taken, because it follows an always
+#     guard or repeats a guard of the same state,
+#   - ZERO_ENERGY can not be reached from a state, so the vehicle
+#     could be stuck in it,
+#   - a state with high voltage desired does not have e_stop as its
+#     first guard.
+#
+# States that can not be reached from ZERO_ENERGY are reported, but
+# do not fail the generator.
+#
+# Usage: python3 generate_state_machine_table.py
+#
+
+import os
+import re
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+SPEC = os.path.join(HERE, "fvt_state_machine_4_0.txt")
+CARRIER = os.path.join(HERE, "..", "..", "carrier", "vehicle-control")
+STATE_MACHINE_H = os.path.join(CARRIER, "state_machine.h")
+OUTPUT = os.path.join(CARRIER, "state_machine_table.h")
+
+
+def fail(message):
+    sys.stderr.write("generate_state_machine_table: %s\n" % message)
+    sys.exit(1)
+
+
+def read_state_enum():
+    with open(STATE_MACHINE_H) as f:
+        text = f.read()
+
+    match = re.search(r"typedef enum\s*\{(.*?)\}\s*state_t;", text, re.S)
+    if match is None:
+        fail("state_t not found in state_machine.h")
+
+    body = re.sub(r"//[^\n]*", "", match.group(1))
+    states = [s.strip() for s in body.split(",") if s.strip()]
+
+    if states[-1] != "NUM_STATES":
+        fail("state_t must end with NUM_STATES")
+
+    return states[:-1]
+
+
+def read_spec():
+    states = []
+    transitions = []
+    section = None
+
+    with open(SPEC) as f:
+        for number, line in enumerate(f, 1):
+            line = line.split("#", 1)[0].strip()
+            if not line:
+                continue
+            if line in ("[states]", "[transitions]"):
+                section = line
+                continue
+
+            fields = line.split()
+            where = "%s:%d" % (os.path.basename(SPEC), number)
+
+            if section == "[states]":
+                if len(fields) != 5 or \
+                   fields[1] not in ("0", "1") or \
+                   fields[2] not in ("0", "1"):
+                    fail("%s: expected state hv_desired brakes_desired "
+                         "during entry" % where)
+                states.append(fields)
+            elif section == "[transitions]":
+                if len(fields) != 3:
+                    fail("%s: expected from guard to" % where)
+                transitions.append(fields + [where])
+            else:
+                fail("%s: line outside of a section" % where)
+
+    return states, transitions
+
+
+def reachable(start, edges):
+    seen = set([start])
+    todo = [start]
+    while todo:
+        state = todo.pop()
+        for next_state in edges.get(state, ()):
+            if next_state not in seen:
+                seen.add(next_state)
+                todo.append(next_state)
+    return seen
+
+
+def check_graph(states, transitions):
+    errors = []
+    forward = {}
+    backward = {}
+
+    for name, hv, brakes, d, e in states:
+        guards = [t[1] for t in transitions if t[0] == name]
+        if hv == "1" and (not guards or guards[0] != "e_stop"):
+            errors.append("%s: high voltage is desired, but e_stop is not "
+                          "its first guard" % name)
+
+    for name in [s[0] for s in states]:
+        seen = set()
+        after_always = False
+        for from_state, guard, to_state, where in transitions:
+            if from_state != name:
+                continue
+            if after_always:
+                errors.append("%s: %s follows the always guard of %s"
+                              % (where, guard, name))
+            elif guard in seen:
+                errors.append("%s: %s is already a guard of %s"
+                              % (where, guard, name))
+            seen.add(guard)
+            after_always = after_always or guard == "always"
+            forward.setdefault(from_state, set()).add(to_state)
+            backward.setdefault(to_state, set()).add(from_state)
+
+    names = [s[0] for s in states]
+    start = names[0]
+
+    to_start = reachable(start, backward)
+    for name in names:
+        if name not in to_start:
+            errors.append("%s: %s can not be reached from %s"
+                          % (name, start, name))
+
+    from_start = reachable(start, forward)
+    for name in names:
+        if name not in from_start:
+            sys.stderr.write("generate_state_machine_table: %s can not be "
+                             "reached from %s\n" % (name, start))
+
+    if errors:
+        fail("\n  " + "\n  ".join(errors))
+
+
+def c_action(prefix, name):
+    return "NULL" if name == "-" else "sm_%s_%s" % (prefix, name)
+
+
+def main():
+    enum_states = read_state_enum()
+    states, transitions = read_spec()
+
+    spec_states = [s[0] for s in states]
+    if spec_states != enum_states:
+        fail("[states] must list the state_t enumeration in order:\n  %s"
+             % " ".join(enum_states))
+
+    entry = dict((s[0], s[4]) for s in states)
+
+    for from_state, guard, to_state, where in transitions:
+        for state in (from_state, to_state):
+            if state not in entry:
+                fail("%s: unknown state %s" % (where, state))
+        if not re.match(r"^[a-z][a-z0-9_]*$", guard):
+            fail("%s: bad guard name %s" % (where, guard))
+
+    check_graph(states, transitions)
+
+    #
+    # Group the transitions by from state, keeping the priority order
+    # of the spec within each state.
+    #
+    rows = []
+    first = []
+    for state in enum_states:
+        first.append(len(rows))
+        rows.extend(t for t in transitions if t[0] == state)
+    first.append(len(rows))
+
+    guards = sorted(set(t[1] for t in transitions))
+    during = sorted(set(s[3] for s in states if s[3] != "-"))
+    entries = sorted(set(s[4] for s in states if s[4] != "-"))
+
+    out = []
+    out.append("""/******************************************************************************
+ *
+ *        Name: state_machine_table.h
+ *
+ * Description: GENERATED FILE, DO NOT EDIT.
+ *
+ *              Generated from ref/state machine/fvt_state_machine_4_0.txt
+ *              by generate_state_machine_table.py. Change the spec and
+ *              run the generator again.
+ *
+ *              Included by state_machine.c only.
+ *
+ ******************************************************************************
+ */
+
+#ifndef STATE_MACHINE_TABLE_H_
+#define STATE_MACHINE_TABLE_H_
+
+//
+// Guards and actions named in the spec. Defined in state_machine.c
+//""")
+    for g in guards:
+        out.append("static bool_t sm_guard_%s(const state_machine_input_data_t *input_data);" % g)
+    out.append("")
+    for d in during:
+        out.append("static void sm_during_%s(const state_machine_input_data_t *input_data);" % d)
+    out.append("")
+    for e in entries:
+        out.append("static void sm_entry_%s(const state_machine_input_data_t *input_data);" % e)
+
+    out.append("""
+//=============================================================================
+//
+// States, in the order of the state_t enumeration.
+//
+//=============================================================================
+//
+static const state_descriptor_t sm_state_table[NUM_STATES] =
+{""")
+    width = max(len(s) for s in enum_states) + 3
+    for name, hv, brakes, d, e in states:
+        out.append("    [%s]%s= { %-6s %-6s %s }," % (
+            name, " " * (width - len(name) - 2),
+            "TRUE," if hv == "1" else "FALSE,",
+            "TRUE," if brakes == "1" else "FALSE,",
+            c_action("during", d)))
+    out.append("};")
+
+    out.append("""
+//=============================================================================
+//
+// Transitions, grouped by from state and in priority order within
+// each state. The transitions out of state s are
+// sm_transition_table[sm_transition_first[s]] up to, but not
+// including, sm_transition_table[sm_transition_first[s + 1]].
+//
+//=============================================================================
+//
+#define SM_NUM_TRANSITIONS %d
+
+static const state_transition_t sm_transition_table[SM_NUM_TRANSITIONS] =
+{
+    // from                      guard                                                  to                        entry""" % len(rows))
+    for from_state, guard, to_state, where in rows:
+        action = "NULL" if to_state == from_state else c_action("entry", entry[to_state])
+        out.append("    { %-25s %-54s %-25s %s }," % (
+            from_state + ",", "sm_guard_" + guard + ",", to_state + ",", action))
+    out.append("};")
+
+    out.append("""
+static const uint8_t sm_transition_first[NUM_STATES + 1] =
+{""")
+    for state, index in zip(enum_states + ["NUM_STATES"], first):
+        out.append("    %3d, // %s" % (index, state))
+    out.append("};")
+
+    out.append("""
+#endif // STATE_MACHINE_TABLE_H_""")
+
+    with open(OUTPUT, "w") as f:
+        f.write("\n".join(out) + "\n")
+
+
+if __name__ == "__main__":
+    main()